@@ -0,0 +1,678 @@
+// Host benchmark and golden-output checks (ESP32 RTSP Mic for BirdNET-Go)
+// Builds the portable core (DSP kernels, codecs, resampler, block ring, RTP
+// framing, RTSP parser, power schedule) for the PC, so hot-loop regressions show up before
+// flashing:
+//   pio run -e native && .pio/build/native/program [--bench | --golden]
+// Exit code 1 when an output no longer matches its golden value.
+#include <chrono>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <algorithm>
+#include <vector>
+
+#include "AudioDSP.h"
+#include "AudioCodec.h"
+#include "AudioResampler.h"
+#include "AudioRing.h"
+#include "AudioBench.h"
+#include "RtpPacket.h"
+#include "RtspParser.h"
+#include "PowerSchedule.h"
+#include "AudioSpectrum.h"
+#include "RecordRing.h"
+#include "ClockDrift.h"
+#include "AudioPreroll.h"
+#include "SendQueue.h"
+#include "ActivityDetector.h"
+#include "LogRing.h"
+
+static const int GOLDEN_SAMPLES = 4096;
+static const uint32_t TEST_SSRC = 0x43215678;
+
+static uint64_t nowNs() {
+    using namespace std::chrono;
+    return (uint64_t)duration_cast<nanoseconds>(steady_clock::now().time_since_epoch()).count();
+}
+static uint32_t nsClock() { return (uint32_t)nowNs(); }
+
+// Deterministic input, integer only (no libm): 750 Hz triangle + LCG noise +
+// a burst that clips at gain 1.2 (Nyquist, so the HPF keeps it), as 32-bit I2S slots (16-bit data << 12)
+static void makeInput32(std::vector<int32_t> &v, int n) {
+    v.resize(n);
+    uint32_t lcg = 0x1234567;
+    for (int i = 0; i < n; ++i) {
+        lcg = lcg * 1664525u + 1013904223u;
+        int32_t noise = (int32_t)(lcg >> 21) - 1024;
+        int32_t phase = i & 63;
+        int32_t tone = (phase < 32 ? phase : 64 - phase) * 560 - 8960;
+        int32_t burst = (i >= 3000 && i < 3100) ? ((i & 1) ? 22000 : -22000) : 0;
+        v[i] = (tone + noise + burst) << 12;
+    }
+}
+
+static void makeInput16(std::vector<int16_t> &v, const std::vector<int32_t> &in32) {
+    v.resize(in32.size());
+    for (size_t i = 0; i < in32.size(); ++i) v[i] = (int16_t)(in32[i] >> 12);
+}
+
+static uint32_t fnv1a(const void* data, size_t len, uint32_t h = 2166136261u) {
+    const uint8_t* p = (const uint8_t*)data;
+    for (size_t i = 0; i < len; ++i) { h ^= p[i]; h *= 16777619u; }
+    return h;
+}
+
+// Q29 coefficients of the 500 Hz / 48 kHz Butterworth HPF, fixed here so the
+// golden hashes do not depend on the host libm
+static BiquadQ29 goldenHpfQ29() {
+    BiquadQ29 q;
+    q.b0 = 512590432; q.b1 = -1025180864; q.b2 = 512590432;
+    q.a1 = -1024082176; q.a2 = 489408544;
+    q.reset();
+    return q;
+}
+
+// ---------------------------------------------------------------- golden
+
+static int failures = 0;
+
+static void expectHash(const char* name, uint32_t got, uint32_t want) {
+    bool ok = (got == want);
+    printf("  %-34s %08x %s\n", name, got, ok ? "ok" : "FAIL");
+    if (!ok) { printf("    expected %08x\n", want); failures++; }
+}
+
+static void expectTrue(const char* name, bool ok, const char* detail = "") {
+    printf("  %-34s %s %s\n", name, ok ? "ok" : "FAIL", ok ? "" : detail);
+    if (!ok) failures++;
+}
+
+static void runGolden() {
+    printf("golden outputs\n");
+    std::vector<int32_t> in32;
+    std::vector<int16_t> in16;
+    makeInput32(in32, GOLDEN_SAMPLES);
+    makeInput16(in16, in32);
+    std::vector<int16_t> out(GOLDEN_SAMPLES), outLe(GOLDEN_SAMPLES);
+    const int32_t gainQ16 = dsp_gainToQ16(1.2f);
+
+    // Fixed-point kernels: bit exact on every host
+    BiquadQ29 q = goldenHpfQ29();
+    DspBlockStats st = dsp_processQ32(in32.data(), out.data(), GOLDEN_SAMPLES, 12, &q, gainQ16, true);
+    expectHash("dsp_processQ32 hpf l16", fnv1a(out.data(), out.size() * 2), 0x15a1a6dc);
+    expectTrue("dsp_processQ32 stats", st.clipped && st.peakAbs == 32767);
+    q = goldenHpfQ29();
+    dsp_processQ32(in32.data(), outLe.data(), GOLDEN_SAMPLES, 12, &q, gainQ16, false);
+    bool swapped = true;
+    for (int i = 0; i < GOLDEN_SAMPLES; ++i) {
+        uint16_t u = (uint16_t)outLe[i];
+        if ((int16_t)(uint16_t)((u << 8) | (u >> 8)) != out[i]) { swapped = false; break; }
+    }
+    expectTrue("big-endian == swapped host order", swapped);
+    q = goldenHpfQ29();
+    std::vector<int16_t> pdm(in16);
+    dsp_processQ16(pdm.data(), pdm.data(), GOLDEN_SAMPLES, &q, gainQ16, false);
+    expectTrue("dsp_processQ16 == Q32 (in place)", memcmp(pdm.data(), outLe.data(), pdm.size() * 2) == 0);
+    dsp_processQ32(in32.data(), out.data(), GOLDEN_SAMPLES, 12, nullptr, gainQ16, false);
+    expectHash("dsp_processQ32 no hpf", fnv1a(out.data(), out.size() * 2), 0x92660e3f);
+
+    // Float kernel against the Q29 one: same filter; truncation and the Q29
+    // error feedback differ by a few LSB
+    Biquad f;
+    f.b0 = (float)q.b0 / (float)(1 << 29); f.b1 = (float)q.b1 / (float)(1 << 29); f.b2 = (float)q.b2 / (float)(1 << 29);
+    f.a1 = (float)q.a1 / (float)(1 << 29); f.a2 = (float)q.a2 / (float)(1 << 29);
+    dsp_processFloat32(in32.data(), out.data(), GOLDEN_SAMPLES, 12, &f, 1.2f, false);
+    int maxDiff = 0;
+    for (int i = 0; i < GOLDEN_SAMPLES; ++i) maxDiff = std::max(maxDiff, abs((int)out[i] - (int)outLe[i]));
+    char detail[48];
+    snprintf(detail, sizeof(detail), "(max diff %d LSB)", maxDiff);
+    expectTrue("dsp_processFloat32 ~ Q32", maxDiff <= 8, detail);
+
+    // Filter chain: one float section is the fused kernel; Q3.28 vs Q29 differ by rounding
+    BiquadChain chain;
+    chain.add(f);
+    dsp_processChainFloat32(in32.data(), outLe.data(), GOLDEN_SAMPLES, 12, &chain, 1.2f, false);
+    expectTrue("dsp_processChainFloat32 == fused", memcmp(outLe.data(), out.data(), out.size() * 2) == 0);
+    q = goldenHpfQ29();
+    dsp_processQ32(in32.data(), outLe.data(), GOLDEN_SAMPLES, 12, &q, gainQ16, false);
+    BiquadChainQ28 chainQ;
+    chainQ.load(chain);
+    dsp_processChainQ32(in32.data(), out.data(), GOLDEN_SAMPLES, 12, &chainQ, gainQ16, false);
+    expectHash("dsp_processChainQ32 hpf", fnv1a(out.data(), out.size() * 2), 0xfb33f0c2);
+    maxDiff = 0;
+    for (int i = 0; i < GOLDEN_SAMPLES; ++i) maxDiff = std::max(maxDiff, abs((int)out[i] - (int)outLe[i]));
+    snprintf(detail, sizeof(detail), "(max diff %d LSB)", maxDiff);
+    expectTrue("dsp_processChainQ32 ~ Q32", maxDiff <= 8, detail);
+    // Live retune: a reloaded chain that takes over the filter memory continues
+    // the stream sample-exactly (here with unchanged coefficients)
+    const int half = GOLDEN_SAMPLES / 2;
+    std::vector<int16_t> split(GOLDEN_SAMPLES);
+    BiquadChainQ28 first, second;
+    first.load(chain);
+    dsp_processChainQ32(in32.data(), split.data(), half, 12, &first, gainQ16, false);
+    second.load(chain);
+    second.copyState(first);
+    dsp_processChainQ32(in32.data() + half, split.data() + half, GOLDEN_SAMPLES - half, 12, &second, gainQ16, false);
+    expectTrue("BiquadChainQ28 copyState", memcmp(split.data(), out.data(), out.size() * 2) == 0);
+    // Live change crossfade: starts on the outgoing block, ends on the new one, no steps
+    std::vector<int16_t> fadeFrom(GOLDEN_SAMPLES, 1000), fadeTo(GOLDEN_SAMPLES, -3000), fadeBe(GOLDEN_SAMPLES, -3000);
+    dsp_crossfade(fadeFrom.data(), fadeTo.data(), GOLDEN_SAMPLES, false);
+    dsp_crossfade(fadeFrom.data(), fadeBe.data(), GOLDEN_SAMPLES, true);
+    bool fadeOk = fadeTo[0] == 1000 && fadeTo[GOLDEN_SAMPLES - 1] == -3000;
+    for (int i = 1; i < GOLDEN_SAMPLES; ++i) {
+        fadeOk = fadeOk && fadeTo[i] <= fadeTo[i - 1] && fadeTo[i - 1] - fadeTo[i] <= 1;
+        fadeOk = fadeOk && (uint16_t)fadeBe[i] == (uint16_t)(((uint16_t)fadeTo[i] << 8) | ((uint16_t)fadeTo[i] >> 8));
+    }
+    expectTrue("dsp_crossfade", fadeOk);
+    // Two mics: planar split, delay-and-sum across block edges, stereo interleave
+    std::vector<int32_t> lr(2 * GOLDEN_SAMPLES), left(GOLDEN_SAMPLES), right(GOLDEN_SAMPLES), beam(GOLDEN_SAMPLES), beamSplit(GOLDEN_SAMPLES);
+    for (int i = 0; i < GOLDEN_SAMPLES; ++i) { lr[2 * i] = in32[i]; lr[2 * i + 1] = (i >= 7) ? in32[i - 7] : 0; }
+    dsp_deinterleave32(lr.data(), left.data(), right.data(), GOLDEN_SAMPLES);
+    DelaySum pair, pairSplit;
+    pair.delay = pairSplit.delay = -7;       // right mic hears it 7 samples late: delay the left
+    pair.process(left.data(), right.data(), beam.data(), GOLDEN_SAMPLES);
+    pairSplit.process(left.data(), right.data(), beamSplit.data(), 3);
+    pairSplit.process(left.data() + 3, right.data() + 3, beamSplit.data() + 3, GOLDEN_SAMPLES - 3);
+    bool beamOk = memcmp(beam.data(), beamSplit.data(), beam.size() * 4) == 0;
+    for (int i = 7; i < GOLDEN_SAMPLES; ++i) beamOk = beamOk && beam[i] == right[i];   // steered: in phase
+    std::vector<int16_t> planeL(GOLDEN_SAMPLES, 0x1234), planeR(GOLDEN_SAMPLES, -2), inter(2 * GOLDEN_SAMPLES);
+    dsp_interleave16(planeL.data(), planeR.data(), inter.data(), GOLDEN_SAMPLES, true);
+    beamOk = beamOk && (uint16_t)inter[0] == 0x3412 && (uint16_t)inter[1] == 0xFEFF;
+    expectTrue("two-mic beam/interleave", beamOk);
+    FilterSpec specs[DSP_CHAIN_MAX];
+    char text[DSP_CHAIN_SPEC_MAX];
+    int sections = dsp_parseFilterChain("notch:50:30, lp:15000,highshelf:4000:1:6", specs, DSP_CHAIN_MAX);
+    dsp_formatFilterChain(specs, sections, text, sizeof(text));
+    expectTrue("dsp_parseFilterChain round trip", sections == 3 && strcmp(text, "notch:50:30,lp:15000:0.707107,highshelf:4000:1:6") == 0, text);
+    expectTrue("dsp_parseFilterChain rejects", dsp_parseFilterChain("bandpass:1000", specs, DSP_CHAIN_MAX) < 0
+               && dsp_parseFilterChain("lp:", specs, DSP_CHAIN_MAX) < 0 && dsp_parseFilterChain("", specs, DSP_CHAIN_MAX) == 0);
+
+    // HPF design: coefficients against a double-precision RBJ reference
+    Biquad d;
+    float fc = dsp_designHighpass(d, 48000.0f, 500.0f);
+    double w0 = 2.0 * M_PI * 500.0 / 48000.0, alpha = sin(w0) / (2.0 * 0.70710678), a0 = 1.0 + alpha;
+    double ref[5] = { (1 + cos(w0)) / 2 / a0, -(1 + cos(w0)) / a0, (1 + cos(w0)) / 2 / a0, -2 * cos(w0) / a0, (1 - alpha) / a0 };
+    float got[5] = { d.b0, d.b1, d.b2, d.a1, d.a2 };
+    bool close = (fc == 500.0f);
+    for (int i = 0; i < 5; ++i) close = close && fabs(got[i] - ref[i]) < 1e-5;
+    expectTrue("dsp_designHighpass 500 Hz", close);
+    expectTrue("dsp_designHighpass clamps",
+               dsp_designHighpass(d, 48000.0f, 2.0f) == 10.0f && dsp_designHighpass(d, 16000.0f, 9000.0f) == 7200.0f);
+
+    // Codecs on the filtered host-order block
+    std::vector<uint8_t> enc(GOLDEN_SAMPLES * 2);
+    size_t bytes = codec_encodePCMU(outLe.data(), enc.data(), GOLDEN_SAMPLES);
+    expectHash("codec_encodePCMU", fnv1a(enc.data(), bytes), 0x337da160);
+    const int16_t edges[3] = { 0, 32767, -32768 };
+    uint8_t ulaw[3];
+    codec_encodePCMU(edges, ulaw, 3);
+    expectTrue("PCMU 0 / +max / -max", ulaw[0] == 0xFF && ulaw[1] == 0x80 && ulaw[2] == 0x00);
+    ImaAdpcmState adpcm;
+    uint32_t h = 2166136261u;
+    for (int off = 0; off < GOLDEN_SAMPLES; off += 1024) {   // state carried across packets
+        bytes = codec_encode(CODEC_DVI4, outLe.data() + off, enc.data(), 1024, adpcm);
+        h = fnv1a(enc.data(), bytes, h);
+    }
+    expectHash("codec_encodeDVI4 4x1024", h, 0x7bfb750e);
+    std::vector<int16_t> inPlace(outLe);
+    bytes = codec_encode(CODEC_PCMU, inPlace.data(), (uint8_t*)inPlace.data(), GOLDEN_SAMPLES, adpcm);
+    codec_encodePCMU(outLe.data(), enc.data(), GOLDEN_SAMPLES);
+    expectTrue("codec_encode in place", memcmp(inPlace.data(), enc.data(), bytes) == 0);
+
+    // Resampler, two ratios, block by block (the taps are designed with
+    // sinf/cosf, so a new libm may move a coefficient by one Q14 step)
+    const uint32_t ratios[2][3] = { { 96000, 48000, 0x4fccc8e3 }, { 48000, 32000, 0x7dcabab4 } };
+    for (const auto &r : ratios) {
+        PolyphaseResampler src;
+        src.begin(r[0], r[1], 1024);
+        std::vector<int16_t> so(1024);
+        h = 2166136261u;
+        int produced = 0;
+        for (int off = 0; off < GOLDEN_SAMPLES; off += 1024) {
+            int n = src.process(outLe.data() + off, 1024, so.data(), (int)so.size(), false);
+            produced += n;
+            h = fnv1a(so.data(), (size_t)n * 2, h);
+        }
+        char name[48];
+        snprintf(name, sizeof(name), "resampler %lu->%lu (%d out)", (unsigned long)r[0], (unsigned long)r[1], produced);
+        expectHash(name, h, r[2]);
+    }
+
+    // RTP/RTCP framing: exact bytes from RFC 3550 / RFC 2326 10.12
+    uint8_t pkt[RTSP_INTERLEAVE_BYTES + RTP_HEADER_BYTES];
+    uint16_t size = rtp_writeHeaders(pkt, 0, 96, 0xBEEF, 0x01020304, TEST_SSRC, 2048);
+    const uint8_t wantRtp[16] = { 0x24, 0x00, 0x08, 0x0C, 0x80, 96, 0xBE, 0xEF,
+                                  0x01, 0x02, 0x03, 0x04, 0x43, 0x21, 0x56, 0x78 };
+    expectTrue("rtp_writeHeaders", size == 2060 && memcmp(pkt, wantRtp, sizeof(wantRtp)) == 0);
+    uint8_t sr[RTCP_SR_BYTES];
+    rtcp_writeSenderReport(sr, TEST_SSRC, 0xE5000001, 0x80000000, 0x01020304, 10, 20480);
+    const uint8_t wantSr[RTCP_SR_BYTES] = { 0x80, 200, 0x00, 0x06, 0x43, 0x21, 0x56, 0x78,
+                                            0xE5, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00,
+                                            0x01, 0x02, 0x03, 0x04, 0x00, 0x00, 0x00, 0x0A,
+                                            0x00, 0x00, 0x50, 0x00 };
+    expectTrue("rtcp_writeSenderReport", memcmp(sr, wantSr, sizeof(wantSr)) == 0);
+
+    // RTSP: pipelined requests with an interleaved RTCP frame, fed byte by byte
+    static const char stream[] = "OPTIONS rtsp://h/audio RTSP/1.0\r\ncseq: 2\r\n\r\n"
+                                 "$\x01\x00\x02rr"
+                                 "SETUP rtsp://h/audio/track1 RTSP/1.0\r\nCSeq: 3\r\n"
+                                 "Transport: RTP/AVP;unicast;client_port=5000-5001\r\nContent-Length: 2\r\n\r\nxx"
+                                 "PLAY rtsp://h/audio/?preroll=30 RTSP/1.0\r\nCSeq: 4\r\n";
+    RtspRequestParser parser;
+    char rx[sizeof(stream)];
+    size_t rxLen = 0;
+    int requests = 0, frames = 0;
+    bool fieldsOk = true;
+    for (size_t i = 0; i + 1 < sizeof(stream); ++i) {
+        rx[rxLen++] = stream[i];
+        RtspRequestParser::Result r;
+        while ((r = parser.parse(rx, rxLen)) != RtspRequestParser::NEED_MORE) {
+            if (r == RtspRequestParser::REQUEST) {
+                requests++;
+                uint16_t rtp = (uint16_t)parser.transport.numberAfter("client_port=", 0);
+                if (requests == 1) fieldsOk = fieldsOk && parser.method == RTSP_OPTIONS && parser.cseq.len == 1 && parser.cseq.p[0] == '2';
+                if (requests == 2) fieldsOk = fieldsOk && parser.method == RTSP_SETUP && rtp == 5000;
+            } else if (r == RtspRequestParser::INTERLEAVED) {
+                frames++;
+            } else {
+                fieldsOk = false;
+                break;
+            }
+            memmove(rx, rx + parser.consumed(), rxLen - parser.consumed());
+            rxLen -= parser.consumed();
+        }
+    }
+    char detail2[64];
+    snprintf(detail2, sizeof(detail2), "(%d requests, %d frames, %u left)", requests, frames, (unsigned)rxLen);
+    expectTrue("RTSP parser pipelined/partial", requests == 2 && frames == 1 && fieldsOk && rxLen == 51, detail2);
+    static const char setup[] = "SETUP rtsp://h/audio RTSP/1.0\r\nCSeq: 3\r\n\r\n";
+    parser.reset();
+    parser.parse(setup, sizeof(setup) - 1);
+    char reply[64];
+    RtspWriter w(reply, sizeof(reply));
+    w.status(200, "OK", parser.cseq);
+    w.printf("Session: %s\r\n\r\n", "12345678");
+    expectTrue("RTSP reply formatting", !w.overflow() && strcmp(reply, "RTSP/1.0 200 OK\r\nCSeq: 3\r\nSession: 12345678\r\n\r\n") == 0, reply);
+
+    // Power schedule: a dawn window and one wrapping past midnight
+    PowerSchedule sched;
+    char spec[POWER_SPEC_MAX];
+    bool schedOk = sched.parse(" 5:00-8:30, 22:15-01:00");
+    sched.format(spec, sizeof(spec));
+    schedOk = schedOk && strcmp(spec, "05:00-08:30,22:15-01:00") == 0
+           && sched.active(5 * 60) && !sched.active(8 * 60 + 30) && sched.active(0) && !sched.active(60)
+           && sched.minutesUntilChange(4 * 60 + 59) == 1 && sched.minutesUntilChange(60) == 240
+           && sched.activeMinutesPerDay() == 210 + 165;
+    const bool schedBad = !sched.parse("05:00-05:00") && !sched.parse("25:00-26:00") && !sched.parse("05:00-06:00,")
+                       && !sched.parse("1:00-2:00,3:00-4:00,5:00-6:00,7:00-8:00,9:00-10:00") && sched.count() == 2;
+    expectTrue("power schedule windows", schedOk && schedBad, spec);
+
+    // Mel frames: a -6 dBFS 3 kHz tone (network order) peaks in the band
+    // around 3 kHz at about -6 dB; silence sits on the floor
+    MelSpectrum mel;
+    std::vector<int16_t> tone(4096), quiet(4096, 0);
+    for (int i = 0; i < 4096; ++i) {
+        uint16_t u = (uint16_t)(int16_t)lrint(16384.0 * sin(2.0 * M_PI * 3000.0 * i / 48000.0));
+        tone[i] = (int16_t)(uint16_t)((u << 8) | (u >> 8));
+    }
+    bool melOk = mel.begin(48000, 64, 150.0f, 15000.0f) && mel.fftSize() == 2048;
+    int melFrames = 0;
+    for (int off = 0; off < 4096; off += 1024) melFrames += mel.push(tone.data() + off, 1024, true);
+    uint8_t bandsOut[MEL_MAX_BANDS];
+    melOk = melOk && melFrames == 3 && mel.nextSeq() == 3 && mel.frame(2, bandsOut) && !mel.frame(3, bandsOut);
+    int peak = 0;
+    for (int b = 1; b < 64; ++b) if (bandsOut[b] > bandsOut[peak]) peak = b;
+    const float peakDb = MEL_DB_FLOOR + bandsOut[peak] * 0.5f;
+    char melDetail[64];
+    snprintf(melDetail, sizeof(melDetail), "(band %d, %.0f Hz, %.1f dB)", peak, mel.bandCenterHz((uint8_t)peak), peakDb);
+    melOk = melOk && fabs(mel.bandCenterHz((uint8_t)peak) - 3000.0f) < 150.0f && peakDb > -8.0f && peakDb < -3.0f;
+    for (int off = 0; off < 4096; off += 1024) mel.push(quiet.data() + off, 1024, false);
+    melOk = melOk && mel.frame(mel.nextSeq() - 1, bandsOut) && bandsOut[0] == 0 && bandsOut[63] == 0;
+    expectTrue("mel spectrum tone/silence", melOk, melDetail);
+
+    // Recording segments: sector-aligned WAV header, names, ranges, seq order
+    uint8_t wav[RECORD_HEADER_BYTES];
+    rec_writeWavHeader(wav, 48000, 1, 96000);
+    uint32_t dataBytes = 0, seqNo = 0, utc = 0, r0 = 0, r1 = 0;
+    bool recOk = rec_readWavDataBytes(wav, dataBytes) && dataBytes == 96000 && memcmp(wav + 504, "data", 4) == 0
+              && wav[4] == 0xF8 && wav[5] == 0x78 && wav[6] == 0x01 && wav[28] == 0x00 && wav[29] == 0x77 && wav[30] == 0x01;
+    rec_patchWavSizes(wav, 1000);
+    recOk = recOk && rec_readWavDataBytes(wav, dataBytes) && dataBytes == 1000 && wav[4] == 0xE0 && wav[5] == 0x05;
+    char recName[RECORD_NAME_MAX];
+    rec_formatName(recName, sizeof(recName), 42, 1760400000);
+    recOk = recOk && strcmp(recName, "000042-1760400000.wav") == 0 && rec_parseName(recName, seqNo, utc)
+         && seqNo == 42 && utc == 1760400000 && !rec_parseName("000042.wav", seqNo, utc) && !rec_parseName("1-2.wave", seqNo, utc);
+    recOk = recOk && rec_parseRange("bytes=0-499", 1000, r0, r1) && r0 == 0 && r1 == 499
+         && rec_parseRange("bytes=500-", 1000, r0, r1) && r0 == 500 && r1 == 999
+         && rec_parseRange("bytes=-100", 1000, r0, r1) && r0 == 900 && r1 == 999
+         && rec_parseRange("bytes=900-5000", 1000, r0, r1) && r1 == 999
+         && !rec_parseRange("bytes=1000-", 1000, r0, r1) && !rec_parseRange("bytes=5-1", 1000, r0, r1)
+         && !rec_parseRange("bytes=0-1,5-6", 1000, r0, r1) && !rec_parseRange("items=0-1", 1000, r0, r1);
+    RecordRing recRing;
+    const uint32_t scanOrder[] = { 7, 3, 9, 5 };
+    for (uint32_t sq : scanOrder) recOk = recOk && recRing.insert({ sq, 0, 1000 + sq });
+    recOk = recOk && !recRing.insert({ 5, 0, 1 }) && recRing.size() == 4 && recRing.oldest().seq == 3
+         && recRing.newest().seq == 9 && recRing.nextSeq() == 10 && recRing.totalBytes() == 4024;
+    recRing.popOldest();
+    recRing.setBytes((uint16_t)recRing.find(9), 2000);
+    recOk = recOk && recRing.oldest().seq == 5 && recRing.at(1).seq == 7 && recRing.totalBytes() == 1005 + 1007 + 2000;
+    expectTrue("record ring wav/names/ranges", recOk);
+
+    // 48 kHz nominal, I2S 25 ppm fast, blocks of 1024 frames stamped up to
+    // 3 ms late for 10 minutes, the 32-bit frame counter wrapping on the way
+    ClockDrift drift;
+    drift.begin(48000);
+    const double trueRate = 48000.0 * (1.0 + 25e-6);
+    uint32_t lcg = 12345, frameNo = 0xFFFF0000u;
+    bool driftOk = true;
+    for (int blk = 0; blk < 600 * 48000 / 1024; ++blk) {
+        frameNo += 1024;
+        lcg = lcg * 1664525u + 1013904223u;
+        const int64_t late = (blk % 7 == 0) ? 0 : (int64_t)(lcg >> 20) % 3000;
+        drift.add(frameNo, (int64_t)((double)(blk + 1) * 1024.0 * 1e6 / trueRate) + late);
+        if (blk == 20) driftOk = driftOk && !drift.valid();
+    }
+    driftOk = driftOk && drift.valid() && fabsf(drift.ppm() - 25.0f) < 1.0f && drift.spanSeconds() > 300.0f;
+    drift.begin(48000);
+    SampleClockAnchor anchor;
+    uint32_t anchorIdx = 0;
+    int64_t anchorUs = 0;
+    driftOk = driftOk && !drift.valid() && !anchor.get(anchorIdx, anchorUs);
+    anchor.set(4096, 123456789LL);
+    driftOk = driftOk && anchor.get(anchorIdx, anchorUs) && anchorIdx == 4096 && anchorUs == 123456789LL;
+    expectTrue("clock drift lower-envelope fit", driftOk);
+
+    // Stereo capture while a client plays: the block gets the interleaved,
+    // network-order pairs; the SD stage must get the host-order left plane.
+    // Mono L16: the block itself, swapped back on the way in.
+    const int stN = 256;
+    std::vector<int16_t> planes(2 * stN), block(2 * stN), back(stN);
+    for (int i = 0; i < stN; ++i) {
+        planes[i] = (int16_t)(i * 97 - 12000);
+        planes[stN + i] = (int16_t)(9000 - i * 31);
+    }
+    dsp_interleave16(planes.data(), planes.data() + stN, block.data(), stN, true);
+    PrerollBuffer stage;
+    bool stageOk = stage.begin(4 * stN);
+    const MonoPlane stereoView = preroll_monoPlane(block.data(), planes.data(), true, true);
+    stage.write(1000, stereoView.samples, stN, stereoView.byteSwapped);
+    stageOk = stageOk && stage.read(1000, back.data(), stN)
+              && memcmp(back.data(), planes.data(), stN * sizeof(int16_t)) == 0;
+    std::vector<int16_t> monoBlock(stN);
+    for (int i = 0; i < stN; ++i) monoBlock[i] = (int16_t)(((uint16_t)planes[i] << 8) | ((uint16_t)planes[i] >> 8));
+    const MonoPlane monoView = preroll_monoPlane(monoBlock.data(), nullptr, false, true);
+    stage.write(1000 + stN, monoView.samples, stN, monoView.byteSwapped);
+    stageOk = stageOk && stage.read(1000 + stN, back.data(), stN)
+              && memcmp(back.data(), planes.data(), stN * sizeof(int16_t)) == 0;
+    stage.end();
+    expectTrue("record stage stereo left plane", stageOk);
+
+    // TCP send queue: packet k is 20 + k bytes of value k
+    PacketQueue txq;
+    uint8_t qpkt[64];
+    auto pushQ = [&](uint8_t k, bool started) {
+        memset(qpkt, k, sizeof(qpkt));
+        return txq.push(qpkt, (uint16_t)(20 + k), started);
+    };
+    bool txOk = txq.begin(4, 64);
+    for (uint8_t k = 1; k <= 4; ++k) txOk = txOk && pushQ(k, false) == 0;
+    txOk = txOk && txq.size() == 4 && !txq.midPacket();
+    // Full, nothing on the wire: the oldest goes
+    txOk = txOk && pushQ(5, false) == 1 && txq.size() == 4 && txq.frontData()[0] == 2;
+    // Partial write: the remainder resumes at the right byte and the front is pinned
+    txq.consume(10);
+    txOk = txOk && txq.midPacket() && txq.frontRemaining() == 22 - 10 && txq.frontData()[0] == 2;
+    txOk = txOk && pushQ(6, false) == 1 && txq.size() == 4 && txq.midPacket() && txq.frontData()[0] == 2;
+    txOk = txOk && pushQ(7, true) == 1;   // a started packet only fits an empty queue
+    txq.consume(5);
+    txOk = txOk && txq.midPacket() && txq.frontRemaining() == 7;
+    txq.consume(7);
+    // Packet 3 was evicted behind the partial one
+    txOk = txOk && !txq.midPacket() && txq.size() == 3 && txq.frontData()[0] == 4 && txq.frontRemaining() == 24;
+    txq.consume(24);
+    txOk = txOk && txq.frontData()[0] == 5 && txq.frontRemaining() == 25;
+    txq.consume(1);
+    txq.dropUnstarted();
+    txOk = txOk && txq.size() == 1 && txq.midPacket() && txq.frontRemaining() == 24;
+    txq.consume(24);
+    txOk = txOk && txq.empty() && !txq.midPacket();
+    txOk = txOk && pushQ(7, true) == 0 && txq.midPacket() && txq.frontRemaining() == 27;
+    txq.dropUnstarted();
+    txOk = txOk && txq.size() == 1;
+    txq.clear();
+    txOk = txOk && pushQ(1, false) == 0 && txq.push(qpkt, 65, false) == 1 && txq.size() == 1;
+    txq.dropUnstarted();
+    txOk = txOk && txq.empty();
+    // Live packet-size change: a partly written packet and the queue behind it
+    // survive the resize, and a packet larger than the old slot then fits
+    std::vector<uint8_t> bigPkt(150, 0xB1);
+    uint8_t resizeDrops = 0;
+    txq.clear();
+    txOk = txOk && pushQ(9, false) == 0 && pushQ(10, false) == 0;
+    txq.consume(4);
+    txOk = txOk && txq.push(bigPkt.data(), (uint16_t)bigPkt.size(), false) == 1;   // old slots: rejected
+    txOk = txOk && txq.resize(3, 160, resizeDrops) && resizeDrops == 0 && txq.size() == 2 && txq.capacity() == 3
+           && txq.midPacket() && txq.frontRemaining() == 25 && txq.frontData()[0] == 9;
+    txOk = txOk && txq.push(bigPkt.data(), (uint16_t)bigPkt.size(), false) == 0;
+    txq.consume(25);
+    txOk = txOk && txq.frontData()[0] == 10 && txq.frontRemaining() == 30;
+    txq.consume(30);
+    txq.consume(100);
+    txOk = txOk && txq.midPacket() && txq.frontRemaining() == 50 && txq.frontData()[0] == 0xB1;
+    // Shrinking below the started packet keeps it; the oldest unstarted goes first
+    txOk = txOk && pushQ(11, false) == 0 && pushQ(12, false) == 0;
+    txOk = txOk && txq.resize(2, 40, resizeDrops) && resizeDrops == 1 && txq.size() == 2
+           && txq.midPacket() && txq.frontRemaining() == 50;
+    txq.consume(50);
+    txOk = txOk && txq.frontData()[0] == 12 && !txq.midPacket();
+    txq.end();
+    expectTrue("tcp send queue evict/resume/resize", txOk);
+
+    // Activity gate, 10 ms blocks: hiss closes it after the 500 ms hangover,
+    // a 2 kHz tone opens it at once, reset() opens it again
+    ActivityDetector gate;
+    gate.configure(48000, 10.0f, 500);
+    gate.reset();
+    const int gateN = 480;
+    std::vector<int16_t> gateBlk(gateN);
+    uint32_t gateLcg = 777;
+    auto hiss = [&]() {
+        for (int i = 0; i < gateN; ++i) {
+            gateLcg = gateLcg * 1664525u + 1013904223u;
+            gateBlk[i] = (int16_t)((int32_t)(gateLcg >> 26) - 32);
+        }
+    };
+    // hangoverBlocks - 1 quiet blocks keep it open, the next one closes it
+    auto quietUntilClosed = [&](int hangoverBlocks) {
+        bool ok = true;
+        for (int b = 0; b < hangoverBlocks - 1; ++b) { hiss(); ok = ok && gate.process(gateBlk.data(), gateN, false); }
+        hiss();
+        return ok && !gate.process(gateBlk.data(), gateN, false) && !gate.open();
+    };
+    bool gateOk = gate.open() && quietUntilClosed(50);
+    for (int b = 0; b < 20; ++b) { hiss(); gateOk = gateOk && !gate.process(gateBlk.data(), gateN, false); }
+    for (int i = 0; i < gateN; ++i) {
+        const int16_t v = (int16_t)(8000.0f * sinf(6.28318530718f * 2000.0f * i / 48000.0f));
+        gateBlk[i] = (int16_t)(uint16_t)(((uint16_t)v << 8) | ((uint16_t)v >> 8));   // network order
+    }
+    gateOk = gateOk && gate.process(gateBlk.data(), gateN, true) && gate.levelDb() - gate.floorDb() > 30.0f;
+    gateOk = gateOk && gate.noiseLevel() >= 14 && gate.noiseLevel() <= 16;   // 8000-peak sine: -15 dBov
+    // The step from the tone into hiss is itself loud: the hangover runs from there
+    hiss();
+    gateOk = gateOk && gate.process(gateBlk.data(), gateN, false) && quietUntilClosed(50);
+    gate.reset();
+    hiss();
+    gateOk = gateOk && gate.open() && gate.process(gateBlk.data(), gateN, false) && quietUntilClosed(49);
+    expectTrue("activity gate open/hangover/reset", gateOk);
+
+    // Log ring: the line table fills first with short lines, the arena with
+    // long ones (40 x 200 bytes fit in 8192, so lines straddle the wrap)
+    static LogRing logs;
+    char logLine[LogRing::MAX_LINE + 100], logOut[LogRing::MAX_LINE + 1];
+    size_t logLen = 0;
+    bool logOk = true;
+    for (int k = 0; k < LogRing::MAX_LINES + 2; ++k) {
+        const int w = snprintf(logLine, sizeof(logLine), "L%d", k);
+        logs.push(logLine, (size_t)w);
+    }
+    logOk = logOk && logs.lines() == LogRing::MAX_LINES && logs.oldestSeq() == 2
+            && !logs.line(1, logOut, sizeof(logOut), logLen)
+            && logs.line(2, logOut, sizeof(logOut), logLen) && strcmp(logOut, "L2") == 0 && logLen == 2
+            && logs.line(129, logOut, sizeof(logOut), logLen) && strcmp(logOut, "L129") == 0
+            && !logs.line(130, logOut, sizeof(logOut), logLen);
+    const uint32_t longFirst = logs.nextSeq();
+    for (int k = 0; k < 100; ++k) {
+        memset(logLine, 'a' + k % 26, sizeof(logLine));
+        snprintf(logLine, 8, "%07d", k);
+        logLine[7] = 'a' + k % 26;
+        logs.push(logLine, sizeof(logLine));   // cut to MAX_LINE
+    }
+    logOk = logOk && logs.lines() == LogRing::ARENA_BYTES / LogRing::MAX_LINE && logs.nextSeq() == longFirst + 100;
+    for (uint32_t q = logs.oldestSeq(); q != logs.nextSeq(); ++q) {
+        const int k = (int)(q - longFirst);
+        char expect[LogRing::MAX_LINE + 1];
+        memset(expect, 'a' + k % 26, LogRing::MAX_LINE);
+        snprintf(expect, 8, "%07d", k);
+        expect[7] = 'a' + k % 26;
+        expect[LogRing::MAX_LINE] = 0;
+        logOk = logOk && logs.line(q, logOut, sizeof(logOut), logLen) && logLen == LogRing::MAX_LINE
+                && strcmp(logOut, expect) == 0;
+    }
+    logOk = logOk && !logs.line(logs.oldestSeq() - 1, logOut, sizeof(logOut), logLen);
+    char shortOut[8];
+    logOk = logOk && logs.line(logs.nextSeq() - 1, shortOut, sizeof(shortOut), logLen) && logLen == 7
+            && strcmp(shortOut, "0000099") == 0;
+    expectTrue("log ring wrap/evict/truncate", logOk);
+}
+
+// ---------------------------------------------------------------- bench
+
+struct PipelineConfig {
+    const char* name;
+    bool fixedPoint;
+    bool pdm;
+    bool hpf;
+    AudioCodecId codec;
+    uint32_t captureRate;      // != streamRate runs the resampler
+};
+
+static const uint32_t STREAM_RATE = 48000;
+
+// Capture -> ring -> RTP framing, like captureAudioBlock() + sendRTPPacket()
+static void benchPipeline(const PipelineConfig &pc, int streamSamples) {
+    const int captureSamples = (int)((uint64_t)streamSamples * pc.captureRate / STREAM_RATE);
+    const bool resampling = pc.captureRate != STREAM_RATE;
+    std::vector<int32_t> in32;
+    std::vector<int16_t> in16, stage(captureSamples);
+    makeInput32(in32, captureSamples);
+    makeInput16(in16, in32);
+
+    Biquad f;
+    dsp_designHighpass(f, (float)pc.captureRate, 500.0f);
+    BiquadQ29 q;
+    q.load(f);
+    const int32_t gainQ16 = dsp_gainToQ16(1.2f);
+    PolyphaseResampler src;
+    if (resampling) src.begin(pc.captureRate, STREAM_RATE, captureSamples);
+    AudioBlockRing ring;
+    ring.begin(4, (uint16_t)streamSamples);
+    ImaAdpcmState adpcm;
+    uint16_t seq = 0;
+    uint32_t ts = 0;
+    volatile uint32_t sink = 0;
+
+    const int blocks = std::max(50, (int)(2000000 / captureSamples));   // ~2 M samples per row
+    std::vector<uint32_t> lat(blocks);
+    const uint64_t t0 = nowNs();
+    for (int b = 0; b < blocks; ++b) {
+        const uint64_t s = nowNs();
+        AudioBlock* blk = ring.acquireWrite();
+        const bool be = pc.codec == CODEC_L16 && !resampling;
+        int16_t* pcm = resampling ? stage.data() : blk->samples;
+        if (pc.fixedPoint) {
+            BiquadQ29* hp = pc.hpf ? &q : nullptr;
+            if (pc.pdm) dsp_processQ16(in16.data(), pcm, captureSamples, hp, gainQ16, be);
+            else dsp_processQ32(in32.data(), pcm, captureSamples, 12, hp, gainQ16, be);
+        } else {
+            Biquad* hp = pc.hpf ? &f : nullptr;
+            if (pc.pdm) dsp_processFloat16(in16.data(), pcm, captureSamples, hp, 1.2f, be);
+            else dsp_processFloat32(in32.data(), pcm, captureSamples, 12, hp, 1.2f, be);
+        }
+        int n = captureSamples;
+        if (resampling) {
+            n = src.process(pcm, captureSamples, blk->samples, streamSamples, pc.codec == CODEC_L16);
+            pcm = blk->samples;
+        }
+        blk->bytes = (uint16_t)codec_encode(pc.codec, pcm, (uint8_t*)blk->samples, n, adpcm);
+        blk->count = (uint16_t)n;
+        ring.commitWrite();
+
+        AudioBlock* rd = ring.acquireRead();
+        rtp_writeHeaders(rd->packet, 0, 96, seq++, ts, TEST_SSRC, rd->bytes);
+        ts += rd->count;
+        sink += rd->packet[AUDIO_BLOCK_HEADROOM];
+        ring.releaseRead();
+        lat[b] = (uint32_t)(nowNs() - s);
+    }
+    const double secs = (double)(nowNs() - t0) * 1e-9;
+    std::sort(lat.begin(), lat.end());
+    const double sps = (double)blocks * streamSamples / secs;
+    printf("  %-26s %5d %10.2f %9.1f %9.1f %8.0fx\n", pc.name, streamSamples, sps / 1e6,
+           lat[blocks / 2] / 1000.0, lat[(blocks * 99) / 100] / 1000.0, sps / STREAM_RATE);
+    (void)sink;
+}
+
+static void runBench() {
+    static const PipelineConfig configs[] = {
+        { "float i2s hpf l16",        false, false, true,  CODEC_L16,  48000 },
+        { "float i2s l16",            false, false, false, CODEC_L16,  48000 },
+        { "float pdm hpf l16",        false, true,  true,  CODEC_L16,  48000 },
+        { "float i2s hpf pcmu",       false, false, true,  CODEC_PCMU, 48000 },
+        { "float i2s hpf dvi4",       false, false, true,  CODEC_DVI4, 48000 },
+        { "float i2s hpf 96k->48k",   false, false, true,  CODEC_L16,  96000 },
+        { "q29 i2s hpf l16",          true,  false, true,  CODEC_L16,  48000 },
+        { "q29 pdm hpf l16",          true,  true,  true,  CODEC_L16,  48000 },
+        { "q29 i2s hpf dvi4",         true,  false, true,  CODEC_DVI4, 48000 },
+    };
+    static const int sizes[] = { 256, 1024, 4096 };
+    printf("pipeline (stream %lu Hz)\n", (unsigned long)STREAM_RATE);
+    printf("  %-26s %5s %10s %9s %9s %9s\n", "config", "block", "Msample/s", "p50 us", "p99 us", "realtime");
+    for (const auto &pc : configs) {
+        for (int n : sizes) benchPipeline(pc, n);
+    }
+
+    // Same stage split as /api/action/bench, in host nanoseconds
+    printf("stages, ns per sample (1024-sample block, AudioBench)\n");
+    printf("  %-10s %7s %7s %7s %7s %7s %7s\n", "kernel", "read", "conv", "hpf", "gain", "swap", "dvi4");
+    bench_begin(1024);
+    for (int fixed = 0; fixed < 2; ++fixed) {
+        BenchConfig cfg;
+        cfg.clock = nsClock;
+        cfg.pdm = false;
+        cfg.fixedPoint = fixed != 0;
+        cfg.shift = 12;
+        cfg.gain = 1.2f;
+        dsp_designHighpass(cfg.hpf, 48000.0f, 500.0f);
+        cfg.codec = CODEC_DVI4;
+        BenchStages s;
+        if (bench_measure(cfg, 1024, s)) {
+            printf("  %-10s %7.2f %7.2f %7.2f %7.2f %7.2f %7.2f\n", fixed ? "q29" : "float",
+                   s.read, s.convert, s.hpf, s.gainClip, s.byteSwap, s.encode);
+        }
+    }
+    bench_end();
+}
+
+int main(int argc, char** argv) {
+    bool golden = true, bench = true;
+    if (argc > 1 && strcmp(argv[1], "--golden") == 0) bench = false;
+    if (argc > 1 && strcmp(argv[1], "--bench") == 0) golden = false;
+    if (golden) runGolden();
+    if (bench) runBench();
+    if (failures) {
+        printf("%d golden check(s) FAILED\n", failures);
+        return 1;
+    }
+    return 0;
+}
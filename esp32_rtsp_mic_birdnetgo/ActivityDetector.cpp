@@ -0,0 +1,65 @@
+#include "ActivityDetector.h"
+#include <math.h>
+
+void ActivityDetector::configure(uint32_t sampleRate, float thrDb, uint32_t hangoverMs) {
+    rate = sampleRate ? sampleRate : 48000;
+    thresholdDb = thrDb;
+    hangoverSamples = (uint32_t)((uint64_t)rate * hangoverMs / 1000);
+}
+
+void ActivityDetector::reset() {
+    quietSamples = 0;
+    level = MIN_LEVEL_DBFS;
+    primed = false;
+    gateOpen = true;                 // start open: first audio after PLAY is sent
+    prev = 0;
+    cnLevel = 127;
+}
+
+static inline float energyDb(uint64_t sumSq, int n) {
+    // Mean square relative to full scale (32768^2); tiny bias keeps log finite
+    double ms = (double)sumSq / (double)n / (32768.0 * 32768.0);
+    return 10.0f * log10f((float)ms + 1e-12f);
+}
+
+bool ActivityDetector::process(const int16_t* x, int n, bool byteSwapped) {
+    if (n <= 0) return gateOpen;
+    uint64_t sumSq = 0, diffSq = 0;
+    int32_t p = prev;
+    for (int i = 0; i < n; ++i) {
+        int32_t v = x[i];
+        if (byteSwapped) {
+            uint16_t u = (uint16_t)v;
+            v = (int16_t)(uint16_t)((u << 8) | (u >> 8));
+        }
+        int32_t d = v - p;
+        sumSq += (uint64_t)(v * v);
+        diffSq += (uint64_t)((int64_t)d * d);
+        p = v;
+    }
+    prev = (int16_t)p;
+
+    // Difference energy is up to 4x (6 dB) the signal energy; -6 dB keeps a
+    // full-scale tone near 0 dBFS
+    level = energyDb(diffSq, n) - 6.02f;
+    float dbov = -energyDb(sumSq, n);
+    cnLevel = (uint8_t)(dbov < 0.0f ? 0.0f : (dbov > 127.0f ? 127.0f : dbov));
+
+    const float blockSec = (float)n / (float)rate;
+    if (!primed || level < floor) {
+        floor = level;
+        primed = true;
+    } else {
+        floor += FLOOR_RISE_DB_PER_S * blockSec;
+    }
+
+    const bool active = level > MIN_LEVEL_DBFS && level - floor >= thresholdDb;
+    if (active) {
+        quietSamples = 0;
+        gateOpen = true;
+    } else {
+        quietSamples += (uint32_t)n;
+        if (quietSamples >= hangoverSamples) gateOpen = false;
+    }
+    return gateOpen;
+}
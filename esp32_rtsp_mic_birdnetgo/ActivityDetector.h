@@ -0,0 +1,46 @@
+#pragma once
+#include <stdint.h>
+
+// Activity detector for stream gating (ESP32 RTSP Mic for BirdNET-Go)
+// Runs once per processed capture buffer. Feature: energy of the first
+// difference (pre-emphasis, +6 dB/oct), so bird song and voices weigh more than
+// rumble and wind, in dB against a noise floor that drops to quiet blocks at
+// once and creeps up slowly. A block thresholdDb above the floor is active;
+// the gate stays open for the hangover after the last active block.
+class ActivityDetector {
+public:
+    static constexpr float FLOOR_RISE_DB_PER_S = 0.05f;   // 3 dB per minute
+    static constexpr float MIN_LEVEL_DBFS = -90.0f;       // never active below this
+
+    void configure(uint32_t sampleRate, float thresholdDb, uint32_t hangoverMs);
+    void reset();
+
+    // n samples (byteSwapped: L16 network order). Returns true while the gate
+    // is open (active block or hangover).
+    bool process(const int16_t* x, int n, bool byteSwapped);
+
+    bool open() const { return gateOpen; }
+    float levelDb() const { return level; }      // pre-emphasized level, dBFS
+    float floorDb() const { return floor; }
+    // RFC 3389 comfort-noise level of the last block: -dBov, 0..127
+    uint8_t noiseLevel() const { return cnLevel; }
+
+private:
+    uint32_t rate = 48000;
+    float thresholdDb = 10.0f;
+    uint32_t hangoverSamples = 0;
+    uint32_t quietSamples = 0;       // since the last active block
+    float level = MIN_LEVEL_DBFS;
+    float floor = 0.0f;
+    bool primed = false;             // floor initialised
+    bool gateOpen = true;
+    int16_t prev = 0;
+    uint8_t cnLevel = 127;
+};
+
+// Per-hour active time kept by the sketch (slot = hour since boot % ACTIVITY_HOURS)
+#define ACTIVITY_HOURS 24
+struct ActivityHour {
+    uint32_t activeSamples;
+    uint32_t totalSamples;           // samples analysed (streaming or pre-roll)
+};
@@ -0,0 +1,102 @@
+#include "AudioBench.h"
+#include <stdlib.h>
+#include <string.h>
+
+static const int BENCH_REPEATS = 5;
+
+static int32_t* benchIn = nullptr;     // synthetic I2S slots (or PDM samples)
+static int32_t* benchCopy = nullptr;   // i2s_read() destination
+static int16_t* benchOut = nullptr;
+static int benchCap = 0;
+
+bool bench_begin(int maxSamples) {
+    bench_end();
+    benchIn = (int32_t*)malloc((size_t)maxSamples * sizeof(int32_t));
+    benchCopy = (int32_t*)malloc((size_t)maxSamples * sizeof(int32_t));
+    benchOut = (int16_t*)malloc((size_t)maxSamples * sizeof(int16_t));
+    if (!benchIn || !benchCopy || !benchOut) { bench_end(); return false; }
+    benchCap = maxSamples;
+    return true;
+}
+
+void bench_end() {
+    free(benchIn); free(benchCopy); free(benchOut);
+    benchIn = benchCopy = nullptr;
+    benchOut = nullptr;
+    benchCap = 0;
+}
+
+// Tone plus noise at about -12 dBFS after the default shift, deterministic
+static void fillInput(bool pdm, int n) {
+    uint32_t lcg = 12345;
+    int16_t* in16 = (int16_t*)benchIn;
+    for (int i = 0; i < n; ++i) {
+        lcg = lcg * 1664525u + 1013904223u;
+        int32_t noise = (int32_t)(lcg >> 20) - 2048;
+        int32_t tone = ((i & 63) < 32) ? 6000 : -6000;
+        int32_t v = tone + noise;
+        if (pdm) in16[i] = (int16_t)v;
+        else benchIn[i] = v << 12;
+    }
+}
+
+static DspBlockStats runKernel(const BenchConfig &cfg, int n, bool withHpf, bool bigEndian) {
+    if (cfg.fixedPoint) {
+        static BiquadQ29 q;
+        q.load(cfg.hpf);
+        int32_t g = dsp_gainToQ16(cfg.gain);
+        return cfg.pdm ? dsp_processQ16((const int16_t*)benchIn, benchOut, n, withHpf ? &q : nullptr, g, bigEndian)
+                       : dsp_processQ32(benchIn, benchOut, n, cfg.shift, withHpf ? &q : nullptr, g, bigEndian);
+    }
+    static Biquad f;
+    f = cfg.hpf;
+    f.reset();
+    return cfg.pdm ? dsp_processFloat16((const int16_t*)benchIn, benchOut, n, withHpf ? &f : nullptr, cfg.gain, bigEndian)
+                   : dsp_processFloat32(benchIn, benchOut, n, cfg.shift, withHpf ? &f : nullptr, cfg.gain, bigEndian);
+}
+
+enum BenchStage { STAGE_READ, STAGE_CONVERT, STAGE_KERNEL, STAGE_KERNEL_HPF, STAGE_KERNEL_SWAP, STAGE_ENCODE };
+
+static uint32_t timeStage(const BenchConfig &cfg, int n, BenchStage stage) {
+    uint32_t best = UINT32_MAX;
+    ImaAdpcmState adpcm;
+    for (int r = 0; r < BENCH_REPEATS; ++r) {
+        if (stage == STAGE_ENCODE) runKernel(cfg, n, false, false);   // host-order input, untimed
+        uint32_t t0 = cfg.clock();
+        switch (stage) {
+            case STAGE_READ:
+                memcpy(benchCopy, benchIn, (size_t)n * (cfg.pdm ? sizeof(int16_t) : sizeof(int32_t)));
+                break;
+            case STAGE_CONVERT:
+                if (cfg.pdm) memcpy(benchOut, benchIn, (size_t)n * sizeof(int16_t));
+                else for (int i = 0; i < n; ++i) benchOut[i] = (int16_t)(benchIn[i] >> cfg.shift);
+                break;
+            case STAGE_KERNEL:      runKernel(cfg, n, false, false); break;
+            case STAGE_KERNEL_HPF:  runKernel(cfg, n, true, false); break;
+            case STAGE_KERNEL_SWAP: runKernel(cfg, n, false, true); break;
+            case STAGE_ENCODE:
+                if (cfg.codec != CODEC_L16) codec_encode(cfg.codec, benchOut, (uint8_t*)benchOut, n, adpcm);
+                break;
+        }
+        uint32_t dt = cfg.clock() - t0;
+        if (dt < best) best = dt;
+    }
+    return best;
+}
+
+bool bench_measure(const BenchConfig &cfg, int samples, BenchStages &out) {
+    if (!benchIn || samples <= 0 || samples > benchCap || !cfg.clock) return false;
+    fillInput(cfg.pdm, samples);
+    const float n = (float)samples;
+    uint32_t base = timeStage(cfg, samples, STAGE_KERNEL);
+    uint32_t withHpf = timeStage(cfg, samples, STAGE_KERNEL_HPF);
+    uint32_t withSwap = timeStage(cfg, samples, STAGE_KERNEL_SWAP);
+    uint32_t convert = timeStage(cfg, samples, STAGE_CONVERT);
+    out.read = (float)timeStage(cfg, samples, STAGE_READ) / n;
+    out.convert = (float)convert / n;
+    out.hpf = (withHpf > base) ? (float)(withHpf - base) / n : 0.0f;
+    out.byteSwap = (withSwap > base) ? (float)(withSwap - base) / n : 0.0f;
+    out.gainClip = (base > convert) ? (float)(base - convert) / n : 0.0f;
+    out.encode = (cfg.codec == CODEC_L16) ? 0.0f : (float)timeStage(cfg, samples, STAGE_ENCODE) / n;
+    return true;
+}
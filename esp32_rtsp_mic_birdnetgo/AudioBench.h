@@ -0,0 +1,35 @@
+#pragma once
+#include <stdint.h>
+#include "AudioDSP.h"
+#include "AudioCodec.h"
+
+// Capture pipeline benchmark (ESP32 RTSP Mic for BirdNET-Go)
+// Runs the DSP stages on synthetic input for one buffer size and reports CPU
+// cycles per sample for each stage. The fused kernel does convert, HPF, gain
+// and byte swap in one pass, so those are separated by difference between
+// its specializations. Each figure is the minimum over a few repeats, which
+// drops preemption by higher-priority tasks.
+struct BenchStages {
+    float read;       // DMA buffer copy done by i2s_read()
+    float convert;    // 32->16 bit shift (PDM: plain copy)
+    float hpf;        // biquad, cost when enabled
+    float gainClip;   // gain, saturation, peak
+    float byteSwap;   // network order for L16
+    float encode;     // PCMU / DVI4 encoder (0 for L16)
+};
+
+struct BenchConfig {
+    uint32_t (*clock)();          // cycle counter
+    bool pdm;                     // 16-bit PDM input instead of 32-bit I2S slots
+    bool fixedPoint;              // Q29 kernel instead of float
+    uint8_t shift;
+    float gain;
+    Biquad hpf;                   // coefficients only; cost does not depend on them
+    AudioCodecId codec;
+};
+
+// Scratch for buffers up to maxSamples (10 bytes per sample)
+bool bench_begin(int maxSamples);
+void bench_end();
+// false without scratch or when samples exceeds it
+bool bench_measure(const BenchConfig &cfg, int samples, BenchStages &out);
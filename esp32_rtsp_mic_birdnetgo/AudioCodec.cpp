@@ -0,0 +1,122 @@
+#include "AudioCodec.h"
+#include <string.h>
+
+static const char* const CODEC_NAMES[CODEC_COUNT] = { "l16", "pcmu", "dvi4" };
+static const char* const CODEC_RTP_NAMES[CODEC_COUNT] = { "L16", "PCMU", "DVI4" };
+
+const char* codec_name(AudioCodecId id) {
+    return (id < CODEC_COUNT) ? CODEC_NAMES[id] : CODEC_NAMES[CODEC_L16];
+}
+
+bool codec_fromName(const char* name, AudioCodecId &id) {
+    for (uint8_t i = 0; i < CODEC_COUNT; ++i) {
+        if (strcmp(name, CODEC_NAMES[i]) == 0) { id = (AudioCodecId)i; return true; }
+    }
+    return false;
+}
+
+const char* codec_rtpEncoding(AudioCodecId id) {
+    return (id < CODEC_COUNT) ? CODEC_RTP_NAMES[id] : CODEC_RTP_NAMES[CODEC_L16];
+}
+
+uint8_t codec_payloadType(AudioCodecId id, uint32_t sampleRate) {
+    if (id == CODEC_PCMU && sampleRate == 8000) return 0;
+    if (id == CODEC_DVI4 && sampleRate == 8000) return 5;
+    if (id == CODEC_DVI4 && sampleRate == 16000) return 6;
+    return 96;
+}
+
+size_t codec_payloadBytes(AudioCodecId id, int samples) {
+    switch (id) {
+        case CODEC_PCMU: return (size_t)samples;
+        case CODEC_DVI4: return 4 + (size_t)(samples + 1) / 2;
+        default:         return (size_t)samples * 2;
+    }
+}
+
+// G.711 µ-law (segment search via leading zeros of the biased magnitude)
+static inline uint8_t linearToUlaw(int16_t pcm) {
+    const int32_t BIAS = 0x84, CLIP = 32635;
+    int32_t s = pcm;
+    uint8_t sign = 0;
+    if (s < 0) { s = -s; sign = 0x80; }
+    if (s > CLIP) s = CLIP;
+    s += BIAS;
+    int exponent = 7;
+    for (int32_t mask = 0x4000; (s & mask) == 0 && exponent > 0; mask >>= 1) exponent--;
+    uint8_t mantissa = (uint8_t)((s >> (exponent + 3)) & 0x0F);
+    return (uint8_t)~(sign | (exponent << 4) | mantissa);
+}
+
+size_t codec_encodePCMU(const int16_t* in, uint8_t* out, int n) {
+    // Write position i never passes read position 2i, so in place is safe
+    for (int i = 0; i < n; ++i) out[i] = linearToUlaw(in[i]);
+    return (size_t)n;
+}
+
+static const int16_t IMA_STEP[89] = {
+    7, 8, 9, 10, 11, 12, 13, 14, 16, 17, 19, 21, 23, 25, 28, 31, 34, 37, 41, 45,
+    50, 55, 60, 66, 73, 80, 88, 97, 107, 118, 130, 143, 157, 173, 190, 209, 230,
+    253, 279, 307, 337, 371, 408, 449, 494, 544, 598, 658, 724, 796, 876, 963,
+    1060, 1166, 1282, 1411, 1552, 1707, 1878, 2066, 2272, 2499, 2749, 3024, 3327,
+    3660, 4026, 4428, 4871, 5358, 5894, 6484, 7132, 7845, 8630, 9493, 10442,
+    11487, 12635, 13899, 15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794,
+    32767
+};
+static const int8_t IMA_INDEX_ADJ[8] = { -1, -1, -1, -1, 2, 4, 6, 8 };
+
+static inline uint8_t imaEncodeSample(int16_t sample, ImaAdpcmState &st) {
+    int32_t step = IMA_STEP[st.index];
+    int32_t diff = (int32_t)sample - st.predicted;
+    uint8_t code = 0;
+    if (diff < 0) { code = 8; diff = -diff; }
+    // Reconstruct exactly as the decoder will, so predictor drift cannot build up
+    int32_t delta = step >> 3;
+    if (diff >= step) { code |= 4; diff -= step; delta += step; }
+    step >>= 1;
+    if (diff >= step) { code |= 2; diff -= step; delta += step; }
+    step >>= 1;
+    if (diff >= step) { code |= 1; delta += step; }
+    int32_t pred = st.predicted + ((code & 8) ? -delta : delta);
+    if (pred > 32767) pred = 32767;
+    if (pred < -32768) pred = -32768;
+    st.predicted = (int16_t)pred;
+    int idx = (int)st.index + IMA_INDEX_ADJ[code & 7];
+    st.index = (uint8_t)(idx < 0 ? 0 : (idx > 88 ? 88 : idx));
+    return code;
+}
+
+size_t codec_encodeDVI4(const int16_t* in, uint8_t* out, int n, ImaAdpcmState &st) {
+    // The 4-byte header and the first nibbles overlap the first four input
+    // samples; after those, writes (4 + i/2) trail reads (2i).
+    int16_t head[4];
+    int h = n < 4 ? n : 4;
+    memcpy(head, in, (size_t)h * sizeof(int16_t));
+
+    // Header: predictor state before the first sample (big-endian), index, reserved
+    out[0] = (uint8_t)(((uint16_t)st.predicted >> 8) & 0xFF);
+    out[1] = (uint8_t)((uint16_t)st.predicted & 0xFF);
+    out[2] = st.index;
+    out[3] = 0;
+
+    uint8_t* data = out + 4;
+    uint8_t pending = 0;
+    for (int i = 0; i < n; ++i) {
+        uint8_t code = imaEncodeSample(i < 4 ? head[i] : in[i], st);
+        if ((i & 1) == 0) {
+            pending = (uint8_t)(code << 4);   // first sample in the high nibble
+        } else {
+            data[i >> 1] = pending | code;
+        }
+    }
+    if (n & 1) data[n >> 1] = pending;
+    return 4 + (size_t)(n + 1) / 2;
+}
+
+size_t codec_encode(AudioCodecId id, const int16_t* in, uint8_t* out, int n, ImaAdpcmState &st) {
+    if (id == CODEC_PCMU) return codec_encodePCMU(in, out, n);
+    if (id == CODEC_DVI4) return codec_encodeDVI4(in, out, n, st);
+    size_t bytes = (size_t)n * sizeof(int16_t);
+    if ((const uint8_t*)in != out) memcpy(out, in, bytes);
+    return bytes;
+}
@@ -0,0 +1,34 @@
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+
+// RTP payload encoders (ESP32 RTSP Mic for BirdNET-Go)
+// L16 is the uncompressed default; PCMU (G.711 µ-law, 8 bit) and DVI4
+// (IMA-ADPCM, 4 bit, RFC 3551 4.5.1) reduce the stream to 1/2 and ~1/4.
+enum AudioCodecId : uint8_t {
+    CODEC_L16 = 0,
+    CODEC_PCMU = 1,
+    CODEC_DVI4 = 2,
+    CODEC_COUNT
+};
+
+// IMA-ADPCM encoder state, carried from one block to the next
+struct ImaAdpcmState {
+    int16_t predicted = 0;
+    uint8_t index = 0;
+    inline void reset() { predicted = 0; index = 0; }
+};
+
+const char* codec_name(AudioCodecId id);              // "l16", "pcmu", "dvi4" (API/Preferences)
+bool codec_fromName(const char* name, AudioCodecId &id);
+const char* codec_rtpEncoding(AudioCodecId id);       // SDP rtpmap encoding name
+// Static payload type where RFC 3551 defines one for this rate, else dynamic 96
+uint8_t codec_payloadType(AudioCodecId id, uint32_t sampleRate);
+size_t codec_payloadBytes(AudioCodecId id, int samples);
+
+// Encoders take host-order samples; out may alias in (encoding is in place
+// inside the ring block). Return payload bytes written.
+size_t codec_encodePCMU(const int16_t* in, uint8_t* out, int n);
+size_t codec_encodeDVI4(const int16_t* in, uint8_t* out, int n, ImaAdpcmState &st);
+// Any codec; L16 input must already be in network order and is copied as-is
+size_t codec_encode(AudioCodecId id, const int16_t* in, uint8_t* out, int n, ImaAdpcmState &st);
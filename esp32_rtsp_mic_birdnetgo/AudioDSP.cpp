@@ -0,0 +1,455 @@
+#include "AudioDSP.h"
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Inputs are pre-limited so the Q29 biquad accumulator cannot overflow;
+// anything this large saturates the 16-bit output at any allowed gain anyway.
+static const int32_t DSP_INPUT_LIMIT = (1 << 24);
+
+void BiquadQ29::load(const Biquad &f) {
+    const float scale = (float)(1 << FRAC_BITS);
+    b0 = (int32_t)lroundf(f.b0 * scale);
+    b1 = (int32_t)lroundf(f.b1 * scale);
+    b2 = (int32_t)lroundf(f.b2 * scale);
+    a1 = (int32_t)lroundf(f.a1 * scale);
+    a2 = (int32_t)lroundf(f.a2 * scale);
+    reset();
+}
+
+float dsp_designHighpass(Biquad &f, float fs, float fc) {
+    if (fc < 10.0f) fc = 10.0f;
+    if (fc > fs * 0.45f) fc = fs * 0.45f; // keep reasonable
+
+    const float pi = 3.14159265358979323846f;
+    float w0 = 2.0f * pi * (fc / fs);
+    float cosw0 = cosf(w0);
+    float sinw0 = sinf(w0);
+    float Q = 0.70710678f; // Butterworth-like
+    float alpha = sinw0 / (2.0f * Q);
+
+    float b0 =  (1.0f + cosw0) * 0.5f;
+    float b1 = -(1.0f + cosw0);
+    float b2 =  (1.0f + cosw0) * 0.5f;
+    float a0 =  1.0f + alpha;
+    float a1 = -2.0f * cosw0;
+    float a2 =  1.0f - alpha;
+
+    f.b0 = b0 / a0;
+    f.b1 = b1 / a0;
+    f.b2 = b2 / a0;
+    f.a1 = a1 / a0;
+    f.a2 = a2 / a0;
+    f.reset();
+    return fc;
+}
+
+// ---- Filter chain: design and compilation (never on the sample path)
+
+static const char* const FILTER_TYPE_NAMES[FILTER_TYPE_COUNT] = {
+    "hp", "lp", "notch", "peak", "lowshelf", "highshelf"
+};
+static const float FILTER_DEFAULT_Q[FILTER_TYPE_COUNT] = {
+    0.70710678f, 0.70710678f, 10.0f, 1.0f, 1.0f, 1.0f
+};
+
+const char* dsp_filterTypeName(FilterType t) {
+    return (t < FILTER_TYPE_COUNT) ? FILTER_TYPE_NAMES[t] : "?";
+}
+
+static inline float clampf(float v, float lo, float hi) {
+    return v < lo ? lo : (v > hi ? hi : v);
+}
+
+void dsp_designSection(Biquad &f, const FilterSpec &spec, float fs) {
+    const float pi = 3.14159265358979323846f;
+    const float fc = clampf(spec.freq, 10.0f, fs * 0.45f);
+    const bool shelf = spec.type == FILTER_LOWSHELF || spec.type == FILTER_HIGHSHELF;
+    const float q = shelf ? clampf(spec.q, 0.1f, 1.0f) : clampf(spec.q, 0.1f, 50.0f);
+    const float A = powf(10.0f, clampf(spec.gainDb, -12.0f, 12.0f) / 40.0f);
+    const float w0 = 2.0f * pi * (fc / fs);
+    const float c = cosf(w0);
+    const float sn = sinf(w0);
+    float alpha = sn / (2.0f * q);
+    float b0, b1, b2, a0, a1, a2;
+    switch (spec.type) {
+        case FILTER_HIGHPASS:
+            b0 = (1.0f + c) * 0.5f; b1 = -(1.0f + c); b2 = b0;
+            a0 = 1.0f + alpha; a1 = -2.0f * c; a2 = 1.0f - alpha;
+            break;
+        case FILTER_LOWPASS:
+            b0 = (1.0f - c) * 0.5f; b1 = 1.0f - c; b2 = b0;
+            a0 = 1.0f + alpha; a1 = -2.0f * c; a2 = 1.0f - alpha;
+            break;
+        case FILTER_NOTCH:
+            b0 = 1.0f; b1 = -2.0f * c; b2 = 1.0f;
+            a0 = 1.0f + alpha; a1 = -2.0f * c; a2 = 1.0f - alpha;
+            break;
+        case FILTER_PEAK:
+            b0 = 1.0f + alpha * A; b1 = -2.0f * c; b2 = 1.0f - alpha * A;
+            a0 = 1.0f + alpha / A; a1 = -2.0f * c; a2 = 1.0f - alpha / A;
+            break;
+        default: {
+            // Shelves: q is the slope S
+            alpha = sn * 0.5f * sqrtf((A + 1.0f / A) * (1.0f / q - 1.0f) + 2.0f);
+            const float k = 2.0f * sqrtf(A) * alpha;
+            if (spec.type == FILTER_LOWSHELF) {
+                b0 = A * ((A + 1.0f) - (A - 1.0f) * c + k);
+                b1 = 2.0f * A * ((A - 1.0f) - (A + 1.0f) * c);
+                b2 = A * ((A + 1.0f) - (A - 1.0f) * c - k);
+                a0 = (A + 1.0f) + (A - 1.0f) * c + k;
+                a1 = -2.0f * ((A - 1.0f) + (A + 1.0f) * c);
+                a2 = (A + 1.0f) + (A - 1.0f) * c - k;
+            } else {
+                b0 = A * ((A + 1.0f) + (A - 1.0f) * c + k);
+                b1 = -2.0f * A * ((A - 1.0f) + (A + 1.0f) * c);
+                b2 = A * ((A + 1.0f) + (A - 1.0f) * c - k);
+                a0 = (A + 1.0f) - (A - 1.0f) * c + k;
+                a1 = 2.0f * ((A - 1.0f) - (A + 1.0f) * c);
+                a2 = (A + 1.0f) - (A - 1.0f) * c - k;
+            }
+            break;
+        }
+    }
+    f.b0 = b0 / a0;
+    f.b1 = b1 / a0;
+    f.b2 = b2 / a0;
+    f.a1 = a1 / a0;
+    f.a2 = a2 / a0;
+    f.reset();
+}
+
+int dsp_parseFilterChain(const char* text, FilterSpec* out, int max) {
+    int count = 0;
+    const char* p = text;
+    while (*p == ' ') p++;
+    while (*p) {
+        if (count >= max) return -1;
+        size_t nameLen = strcspn(p, ":,");
+        int type = -1;
+        for (int t = 0; t < FILTER_TYPE_COUNT; ++t) {
+            if (strlen(FILTER_TYPE_NAMES[t]) == nameLen && strncmp(p, FILTER_TYPE_NAMES[t], nameLen) == 0) type = t;
+        }
+        if (type < 0 || p[nameLen] != ':') return -1;
+        p += nameLen + 1;
+        FilterSpec &f = out[count];
+        f.type = (FilterType)type;
+        f.q = FILTER_DEFAULT_Q[type];
+        f.gainDb = 0.0f;
+        float* fields[3] = { &f.freq, &f.q, &f.gainDb };
+        for (int i = 0; i < 3; ++i) {
+            char* end;
+            float v = strtof(p, &end);
+            if (end == p || !isfinite(v) || v < -100000.0f || v > 100000.0f) return -1;
+            *fields[i] = v;
+            p = end;
+            if (*p != ':') break;
+            p++;
+        }
+        if (f.freq <= 0.0f || f.q <= 0.0f) return -1;
+        count++;
+        while (*p == ' ') p++;
+        if (*p == ',') {
+            p++;
+            while (*p == ' ') p++;
+            if (!*p) return -1;
+        } else if (*p) {
+            return -1;
+        }
+    }
+    return count;
+}
+
+size_t dsp_formatFilterChain(const FilterSpec* specs, int count, char* out, size_t n) {
+    size_t len = 0;
+    if (n) out[0] = 0;
+    for (int i = 0; i < count && len + 1 < n; ++i) {
+        const FilterSpec &f = specs[i];
+        const bool gain = f.type == FILTER_PEAK || f.type == FILTER_LOWSHELF || f.type == FILTER_HIGHSHELF;
+        int w = gain ? snprintf(out + len, n - len, "%s%s:%g:%g:%g", i ? "," : "", dsp_filterTypeName(f.type), (double)f.freq, (double)f.q, (double)f.gainDb)
+                     : snprintf(out + len, n - len, "%s%s:%g:%g", i ? "," : "", dsp_filterTypeName(f.type), (double)f.freq, (double)f.q);
+        if (w < 0) break;
+        len += ((size_t)w < n - len) ? (size_t)w : n - len - 1;
+    }
+    return len;
+}
+
+bool BiquadChain::add(const Biquad &f) {
+    if (count >= DSP_CHAIN_MAX) return false;
+    b0[count] = f.b0; b1[count] = f.b1; b2[count] = f.b2;
+    a1[count] = f.a1; a2[count] = f.a2;
+    x1[count] = x2[count] = y1[count] = y2[count] = 0.0f;
+    count++;
+    return true;
+}
+
+void BiquadChain::reset() {
+    for (int s = 0; s < count; ++s) x1[s] = x2[s] = y1[s] = y2[s] = 0.0f;
+}
+
+void BiquadChain::copyState(const BiquadChain &o) {
+    const int n = (count < o.count) ? count : o.count;
+    for (int s = 0; s < n; ++s) { x1[s] = o.x1[s]; x2[s] = o.x2[s]; y1[s] = o.y1[s]; y2[s] = o.y2[s]; }
+}
+
+void BiquadChainQ28::load(const BiquadChain &c) {
+    const float scale = (float)(1 << FRAC_BITS);
+    count = c.count;
+    for (int s = 0; s < count; ++s) {
+        b0[s] = (int32_t)lroundf(c.b0[s] * scale);
+        b1[s] = (int32_t)lroundf(c.b1[s] * scale);
+        b2[s] = (int32_t)lroundf(c.b2[s] * scale);
+        a1[s] = (int32_t)lroundf(c.a1[s] * scale);
+        a2[s] = (int32_t)lroundf(c.a2[s] * scale);
+    }
+    reset();
+}
+
+void BiquadChainQ28::reset() {
+    for (int s = 0; s < count; ++s) x1[s] = x2[s] = y1[s] = y2[s] = err[s] = 0;
+}
+
+void BiquadChainQ28::copyState(const BiquadChainQ28 &o) {
+    const int n = (count < o.count) ? count : o.count;
+    for (int s = 0; s < n; ++s) {
+        x1[s] = o.x1[s]; x2[s] = o.x2[s]; y1[s] = o.y1[s]; y2[s] = o.y2[s]; err[s] = o.err[s];
+    }
+}
+
+int32_t dsp_gainToQ16(float gain) {
+    return (int32_t)lroundf(gain * 65536.0f);
+}
+
+template <bool BigEndian>
+static inline int16_t storeSample(int32_t v) {
+    if (!BigEndian) return (int16_t)v;
+    uint16_t u = (uint16_t)v;
+    return (int16_t)(uint16_t)((u << 8) | (u >> 8));
+}
+
+template <typename In, bool UseHpf, bool BigEndian>
+static DspBlockStats kernelFloat(const In* in, int16_t* out, int n, uint8_t shift, Biquad* hpf, float gain) {
+    float peakAbs = 0.0f;
+    bool clipped = false;
+    for (int i = 0; i < n; i++) {
+        float sample = (float)(in[i] >> shift);
+        if (UseHpf) sample = hpf->process(sample);
+        float amplified = sample * gain;
+        float aabs = fabsf(amplified);
+        if (aabs > peakAbs) peakAbs = aabs;
+        if (aabs > 32767.0f) clipped = true;
+        if (amplified > 32767.0f) amplified = 32767.0f;
+        if (amplified < -32768.0f) amplified = -32768.0f;
+        out[i] = storeSample<BigEndian>((int32_t)amplified);
+    }
+    if (peakAbs > 32767.0f) peakAbs = 32767.0f;
+    return DspBlockStats{(uint16_t)peakAbs, clipped};
+}
+
+template <typename In, bool UseHpf, bool BigEndian>
+static DspBlockStats kernelQ(const In* in, int16_t* out, int n, uint8_t shift, BiquadQ29* hpf, int32_t gainQ16) {
+    int32_t peakAbs = 0;
+    bool clipped = false;
+    for (int i = 0; i < n; i++) {
+        int32_t x = (int32_t)in[i] >> shift;
+        if (x > DSP_INPUT_LIMIT) x = DSP_INPUT_LIMIT;
+        if (x < -DSP_INPUT_LIMIT) x = -DSP_INPUT_LIMIT;
+        if (UseHpf) x = hpf->process(x);
+        int64_t amplified = ((int64_t)x * gainQ16) >> 16;
+        int64_t aabs = amplified < 0 ? -amplified : amplified;
+        if (aabs > 32767) {
+            clipped = true;
+            aabs = 32767;
+            amplified = (amplified > 0) ? 32767 : -32768;
+        }
+        if ((int32_t)aabs > peakAbs) peakAbs = (int32_t)aabs;
+        out[i] = storeSample<BigEndian>((int32_t)amplified);
+    }
+    return DspBlockStats{(uint16_t)peakAbs, clipped};
+}
+
+// Dispatch runtime flags to the specialized kernels
+#define DSP_DISPATCH(kernel, In, ...) \
+    (hpf ? (bigEndianOut ? kernel<In, true, true>(__VA_ARGS__) : kernel<In, true, false>(__VA_ARGS__)) \
+         : (bigEndianOut ? kernel<In, false, true>(__VA_ARGS__) : kernel<In, false, false>(__VA_ARGS__)))
+
+DspBlockStats dsp_processFloat32(const int32_t* in, int16_t* out, int n, uint8_t shift, Biquad* hpf, float gain, bool bigEndianOut) {
+    return DSP_DISPATCH(kernelFloat, int32_t, in, out, n, shift, hpf, gain);
+}
+
+DspBlockStats dsp_processFloat16(const int16_t* in, int16_t* out, int n, Biquad* hpf, float gain, bool bigEndianOut) {
+    return DSP_DISPATCH(kernelFloat, int16_t, in, out, n, 0, hpf, gain);
+}
+
+DspBlockStats dsp_processQ32(const int32_t* in, int16_t* out, int n, uint8_t shift, BiquadQ29* hpf, int32_t gainQ16, bool bigEndianOut) {
+    return DSP_DISPATCH(kernelQ, int32_t, in, out, n, shift, hpf, gainQ16);
+}
+
+DspBlockStats dsp_processQ16(const int16_t* in, int16_t* out, int n, BiquadQ29* hpf, int32_t gainQ16, bool bigEndianOut) {
+    return DSP_DISPATCH(kernelQ, int16_t, in, out, n, 0, hpf, gainQ16);
+}
+
+// ---- Filter chain kernels: convert a chunk, run each section over it, then
+// gain/saturate/store. The chunk is copied in first, so in may alias out.
+
+// Fixed-point chain: samples carry DSP_CHAIN_GUARD_BITS of fraction between
+// sections (integer rounding noise would otherwise build up in narrow notches).
+// 2^19 still saturates the output at the lowest gain (0.1).
+static const int DSP_CHAIN_GUARD_BITS = 5;
+static const int32_t DSP_CHAIN_INPUT_LIMIT = (1 << 19);
+static const int32_t DSP_SECTION_LIMIT = (1 << 27);
+
+static inline void chainSectionFloat(BiquadChain* c, int s, float* w, int m) {
+    const float b0 = c->b0[s], b1 = c->b1[s], b2 = c->b2[s], a1 = c->a1[s], a2 = c->a2[s];
+    float x1 = c->x1[s], x2 = c->x2[s], y1 = c->y1[s], y2 = c->y2[s];
+    for (int i = 0; i < m; ++i) {
+        float x = w[i];
+        float y = b0 * x + b1 * x1 + b2 * x2 - a1 * y1 - a2 * y2;
+        x2 = x1; x1 = x; y2 = y1; y1 = y;
+        w[i] = y;
+    }
+    c->x1[s] = x1; c->x2[s] = x2; c->y1[s] = y1; c->y2[s] = y2;
+}
+
+static inline void chainSectionQ(BiquadChainQ28* c, int s, int32_t* w, int m) {
+    const int64_t b0 = c->b0[s], b1 = c->b1[s], b2 = c->b2[s], a1 = c->a1[s], a2 = c->a2[s];
+    int32_t x1 = c->x1[s], x2 = c->x2[s], y1 = c->y1[s], y2 = c->y2[s], err = c->err[s];
+    const int F = BiquadChainQ28::FRAC_BITS;
+    for (int i = 0; i < m; ++i) {
+        int32_t x = w[i];
+        int64_t acc = b0 * x + b1 * x1 + b2 * x2 - a1 * y1 - a2 * y2 + err;
+        int64_t y = acc >> F;
+        err = (int32_t)(acc & ((1 << F) - 1));
+        if (y > DSP_SECTION_LIMIT) y = DSP_SECTION_LIMIT;
+        if (y < -DSP_SECTION_LIMIT) y = -DSP_SECTION_LIMIT;
+        x2 = x1; x1 = x; y2 = y1; y1 = (int32_t)y;
+        w[i] = (int32_t)y;
+    }
+    c->x1[s] = x1; c->x2[s] = x2; c->y1[s] = y1; c->y2[s] = y2; c->err[s] = err;
+}
+
+template <typename In, bool BigEndian>
+static DspBlockStats chainFloat(const In* in, int16_t* out, int n, uint8_t shift, BiquadChain* chain, float gain) {
+    float w[DSP_CHAIN_CHUNK];
+    float peakAbs = 0.0f;
+    bool clipped = false;
+    for (int base = 0; base < n; base += DSP_CHAIN_CHUNK) {
+        const int m = (n - base < DSP_CHAIN_CHUNK) ? n - base : DSP_CHAIN_CHUNK;
+        for (int i = 0; i < m; ++i) w[i] = (float)(in[base + i] >> shift);
+        for (int s = 0; s < chain->count; ++s) chainSectionFloat(chain, s, w, m);
+        for (int i = 0; i < m; ++i) {
+            float amplified = w[i] * gain;
+            float aabs = fabsf(amplified);
+            if (aabs > peakAbs) peakAbs = aabs;
+            if (aabs > 32767.0f) clipped = true;
+            if (amplified > 32767.0f) amplified = 32767.0f;
+            if (amplified < -32768.0f) amplified = -32768.0f;
+            out[base + i] = storeSample<BigEndian>((int32_t)amplified);
+        }
+    }
+    if (peakAbs > 32767.0f) peakAbs = 32767.0f;
+    return DspBlockStats{(uint16_t)peakAbs, clipped};
+}
+
+template <typename In, bool BigEndian>
+static DspBlockStats chainQ(const In* in, int16_t* out, int n, uint8_t shift, BiquadChainQ28* chain, int32_t gainQ16) {
+    int32_t w[DSP_CHAIN_CHUNK];
+    int32_t peakAbs = 0;
+    bool clipped = false;
+    for (int base = 0; base < n; base += DSP_CHAIN_CHUNK) {
+        const int m = (n - base < DSP_CHAIN_CHUNK) ? n - base : DSP_CHAIN_CHUNK;
+        for (int i = 0; i < m; ++i) {
+            int32_t x = (int32_t)in[base + i] >> shift;
+            if (x > DSP_CHAIN_INPUT_LIMIT) x = DSP_CHAIN_INPUT_LIMIT;
+            if (x < -DSP_CHAIN_INPUT_LIMIT) x = -DSP_CHAIN_INPUT_LIMIT;
+            w[i] = x * (1 << DSP_CHAIN_GUARD_BITS);
+        }
+        for (int s = 0; s < chain->count; ++s) chainSectionQ(chain, s, w, m);
+        for (int i = 0; i < m; ++i) {
+            int64_t amplified = ((int64_t)w[i] * gainQ16) >> (16 + DSP_CHAIN_GUARD_BITS);
+            int64_t aabs = amplified < 0 ? -amplified : amplified;
+            if (aabs > 32767) {
+                clipped = true;
+                aabs = 32767;
+                amplified = (amplified > 0) ? 32767 : -32768;
+            }
+            if ((int32_t)aabs > peakAbs) peakAbs = (int32_t)aabs;
+            out[base + i] = storeSample<BigEndian>((int32_t)amplified);
+        }
+    }
+    return DspBlockStats{(uint16_t)peakAbs, clipped};
+}
+
+DspBlockStats dsp_processChainFloat32(const int32_t* in, int16_t* out, int n, uint8_t shift, BiquadChain* chain, float gain, bool bigEndianOut) {
+    return bigEndianOut ? chainFloat<int32_t, true>(in, out, n, shift, chain, gain) : chainFloat<int32_t, false>(in, out, n, shift, chain, gain);
+}
+
+DspBlockStats dsp_processChainFloat16(const int16_t* in, int16_t* out, int n, BiquadChain* chain, float gain, bool bigEndianOut) {
+    return bigEndianOut ? chainFloat<int16_t, true>(in, out, n, 0, chain, gain) : chainFloat<int16_t, false>(in, out, n, 0, chain, gain);
+}
+
+DspBlockStats dsp_processChainQ32(const int32_t* in, int16_t* out, int n, uint8_t shift, BiquadChainQ28* chain, int32_t gainQ16, bool bigEndianOut) {
+    return bigEndianOut ? chainQ<int32_t, true>(in, out, n, shift, chain, gainQ16) : chainQ<int32_t, false>(in, out, n, shift, chain, gainQ16);
+}
+
+DspBlockStats dsp_processChainQ16(const int16_t* in, int16_t* out, int n, BiquadChainQ28* chain, int32_t gainQ16, bool bigEndianOut) {
+    return bigEndianOut ? chainQ<int16_t, true>(in, out, n, 0, chain, gainQ16) : chainQ<int16_t, false>(in, out, n, 0, chain, gainQ16);
+}
+
+void dsp_crossfade(const int16_t* from, int16_t* to, int n, bool bigEndianOut) {
+    if (n <= 0) return;
+    // Q15 weight of `to`, reaching 1.0 on the last sample
+    const int32_t step = (n > 1) ? (int32_t)((1 << 15) / (n - 1)) : (1 << 15);
+    int32_t w = (n > 1) ? 0 : (1 << 15);
+    for (int i = 0; i < n; i++) {
+        if (i == n - 1) w = 1 << 15;
+        int32_t v = ((int32_t)from[i] * ((1 << 15) - w) + (int32_t)to[i] * w) >> 15;
+        to[i] = bigEndianOut ? storeSample<true>(v) : (int16_t)v;
+        w += step;
+    }
+}
+
+void dsp_deinterleave32(const int32_t* in, int32_t* left, int32_t* right, int n) {
+    for (int i = 0; i < n; i++) {
+        left[i] = in[2 * i];
+        right[i] = in[2 * i + 1];
+    }
+}
+
+void dsp_interleave16(const int16_t* left, const int16_t* right, int16_t* out, int n, bool bigEndianOut) {
+    if (bigEndianOut) {
+        for (int i = 0; i < n; i++) {
+            out[2 * i] = storeSample<true>(left[i]);
+            out[2 * i + 1] = storeSample<true>(right[i]);
+        }
+    } else {
+        for (int i = 0; i < n; i++) {
+            out[2 * i] = left[i];
+            out[2 * i + 1] = right[i];
+        }
+    }
+}
+
+void DelaySum::reset() {
+    for (int i = 0; i < DSP_BEAM_MAX_DELAY; i++) hist[i] = 0;
+}
+
+void DelaySum::process(const int32_t* left, const int32_t* right, int32_t* out, int n) {
+    int d = delay < 0 ? -delay : delay;
+    if (d > DSP_BEAM_MAX_DELAY) d = DSP_BEAM_MAX_DELAY;
+    const int32_t* late = (delay < 0) ? left : right;     // the channel that is delayed
+    const int32_t* early = (delay < 0) ? right : left;
+    // Averaged in 64 bits: full-scale 32-bit slots must not wrap
+    for (int i = 0; i < n; i++) {
+        const int32_t l = (i < d) ? hist[i] : late[i - d];
+        out[i] = (int32_t)(((int64_t)early[i] + l) >> 1);
+    }
+    if (d == 0) return;
+    if (n >= d) {
+        for (int k = 0; k < d; k++) hist[k] = late[n - d + k];
+    } else {
+        for (int k = 0; k < d - n; k++) hist[k] = hist[k + n];
+        for (int k = 0; k < n; k++) hist[d - n + k] = late[k];
+    }
+}
@@ -0,0 +1,151 @@
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+
+// Audio DSP block kernels (ESP32 RTSP Mic for BirdNET-Go)
+// One fused pass per block: shift -> [high-pass | filter chain] -> gain -> saturate -> peak
+
+// Float biquad (direct form I), coefficients normalized by a0
+struct Biquad {
+    float b0{1.0f}, b1{0.0f}, b2{0.0f}, a1{0.0f}, a2{0.0f};
+    float x1{0.0f}, x2{0.0f}, y1{0.0f}, y2{0.0f};
+    inline float process(float x) {
+        float y = b0 * x + b1 * x1 + b2 * x2 - a1 * y1 - a2 * y2;
+        x2 = x1; x1 = x; y2 = y1; y1 = y;
+        return y;
+    }
+    inline void reset() { x1 = x2 = y1 = y2 = 0.0f; }
+    // Filter memory from before a retune (same structure, new coefficients)
+    inline void copyState(const Biquad &o) { x1 = o.x1; x2 = o.x2; y1 = o.y1; y2 = o.y2; }
+};
+
+// Fixed-point biquad for targets without a usable FPU (ESP32-C6).
+// Coefficients in Q2.29, 64-bit accumulator, first-order error feedback
+// (the truncated fraction is carried into the next sample) to avoid
+// DC offset and limit cycles at low cutoffs.
+struct BiquadQ29 {
+    static const int FRAC_BITS = 29;
+    int32_t b0{1 << FRAC_BITS}, b1{0}, b2{0}, a1{0}, a2{0};
+    int32_t x1{0}, x2{0}, y1{0}, y2{0};
+    int32_t err{0};
+    inline int32_t process(int32_t x) {
+        int64_t acc = (int64_t)b0 * x + (int64_t)b1 * x1 + (int64_t)b2 * x2
+                    - (int64_t)a1 * y1 - (int64_t)a2 * y2 + err;
+        int32_t y = (int32_t)(acc >> FRAC_BITS);
+        err = (int32_t)(acc & ((1 << FRAC_BITS) - 1));
+        x2 = x1; x1 = x; y2 = y1; y1 = y;
+        return y;
+    }
+    inline void reset() { x1 = x2 = y1 = y2 = 0; err = 0; }
+    inline void copyState(const BiquadQ29 &o) { x1 = o.x1; x2 = o.x2; y1 = o.y1; y2 = o.y2; err = o.err; }
+    void load(const Biquad &f);   // quantize float coefficients, resets state
+};
+
+// 2nd-order Butterworth high-pass (RBJ cookbook) at sample rate fs. The cutoff
+// is clamped to 10 Hz .. 0.45 fs; returns the cutoff actually used.
+float dsp_designHighpass(Biquad &f, float fs, float fc);
+
+// Filter chain: up to DSP_CHAIN_MAX cascaded biquads, coefficients and state
+// as structure-of-arrays. The chain kernels run one section at a time over a
+// DSP_CHAIN_CHUNK-sample slice, so a section's coefficients and state stay in
+// registers. Coefficients are compiled (designed, quantized) outside the
+// sample loop; the kernels only read them.
+#define DSP_CHAIN_MAX 8
+#define DSP_CHAIN_CHUNK 32
+
+enum FilterType : uint8_t {
+    FILTER_HIGHPASS, FILTER_LOWPASS, FILTER_NOTCH, FILTER_PEAK,
+    FILTER_LOWSHELF, FILTER_HIGHSHELF, FILTER_TYPE_COUNT
+};
+
+// One section as configured: frequency in Hz, Q (shelves: slope S), gain in
+// dB (peak and shelves only)
+struct FilterSpec {
+    FilterType type;
+    float freq;
+    float q;
+    float gainDb;
+};
+
+struct BiquadChain {
+    uint8_t count = 0;
+    float b0[DSP_CHAIN_MAX], b1[DSP_CHAIN_MAX], b2[DSP_CHAIN_MAX], a1[DSP_CHAIN_MAX], a2[DSP_CHAIN_MAX];
+    float x1[DSP_CHAIN_MAX], x2[DSP_CHAIN_MAX], y1[DSP_CHAIN_MAX], y2[DSP_CHAIN_MAX];
+    bool add(const Biquad &f);   // append coefficients (zero state); false when full
+    void clear() { count = 0; }
+    void reset();
+    void copyState(const BiquadChain &o);   // memory of the sections both chains have
+};
+
+// Fixed-point chain in Q3.28 (boosting shelves need |b1| up to ~8), with the
+// same error feedback as BiquadQ29 and 5 guard bits of fraction per sample
+struct BiquadChainQ28 {
+    static const int FRAC_BITS = 28;
+    uint8_t count = 0;
+    int32_t b0[DSP_CHAIN_MAX], b1[DSP_CHAIN_MAX], b2[DSP_CHAIN_MAX], a1[DSP_CHAIN_MAX], a2[DSP_CHAIN_MAX];
+    int32_t x1[DSP_CHAIN_MAX], x2[DSP_CHAIN_MAX], y1[DSP_CHAIN_MAX], y2[DSP_CHAIN_MAX], err[DSP_CHAIN_MAX];
+    void load(const BiquadChain &c);   // quantize, resets state
+    void reset();
+    void copyState(const BiquadChainQ28 &o);
+};
+
+// RBJ cookbook section at fs. Frequency is clamped to 10 Hz .. 0.45 fs, Q to
+// 0.1..50 (shelf slope to 0.1..1), gain to +-12 dB.
+void dsp_designSection(Biquad &f, const FilterSpec &spec, float fs);
+
+// Chain spec "type:freq[:q[:gainDb]],..." with types hp, lp, notch, peak,
+// lowshelf, highshelf, e.g. "notch:50:30,notch:100:30,lp:15000". Returns the
+// number of sections parsed into out (max entries), or -1 on a syntax error.
+int dsp_parseFilterChain(const char* text, FilterSpec* out, int max);
+// Canonical text of a chain (inverse of dsp_parseFilterChain)
+size_t dsp_formatFilterChain(const FilterSpec* specs, int count, char* out, size_t n);
+const char* dsp_filterTypeName(FilterType t);
+#define DSP_CHAIN_SPEC_MAX 320   // text buffer for DSP_CHAIN_MAX sections
+
+// Gain as Q16.16 for the fixed-point kernel
+int32_t dsp_gainToQ16(float gain);
+
+struct DspBlockStats {
+    uint16_t peakAbs;   // block peak |sample| after gain, 0..32767
+    bool clipped;       // at least one sample exceeded the int16 range
+};
+
+// I2S: 32-bit slots shifted right by `shift`. PDM: 16-bit samples (in may alias out).
+// hpf == nullptr bypasses the filter. bigEndianOut stores network-order (L16)
+// samples so the block can be sent as RTP payload without another pass.
+DspBlockStats dsp_processFloat32(const int32_t* in, int16_t* out, int n, uint8_t shift, Biquad* hpf, float gain, bool bigEndianOut);
+DspBlockStats dsp_processFloat16(const int16_t* in, int16_t* out, int n, Biquad* hpf, float gain, bool bigEndianOut);
+DspBlockStats dsp_processQ32(const int32_t* in, int16_t* out, int n, uint8_t shift, BiquadQ29* hpf, int32_t gainQ16, bool bigEndianOut);
+DspBlockStats dsp_processQ16(const int16_t* in, int16_t* out, int n, BiquadQ29* hpf, int32_t gainQ16, bool bigEndianOut);
+
+// Same stages with a filter chain in place of the single high-pass (the
+// sketch folds the high-pass into the chain as its first section)
+DspBlockStats dsp_processChainFloat32(const int32_t* in, int16_t* out, int n, uint8_t shift, BiquadChain* chain, float gain, bool bigEndianOut);
+DspBlockStats dsp_processChainFloat16(const int16_t* in, int16_t* out, int n, BiquadChain* chain, float gain, bool bigEndianOut);
+DspBlockStats dsp_processChainQ32(const int32_t* in, int16_t* out, int n, uint8_t shift, BiquadChainQ28* chain, int32_t gainQ16, bool bigEndianOut);
+DspBlockStats dsp_processChainQ16(const int16_t* in, int16_t* out, int n, BiquadChainQ28* chain, int32_t gainQ16, bool bigEndianOut);
+
+// Linear crossfade over one block, both inputs host order: `from` (outgoing
+// parameters) starts at full weight and `to` ends at it. The result replaces
+// `to`, network order when bigEndianOut. Used once after a live change.
+void dsp_crossfade(const int16_t* from, int16_t* to, int n, bool bigEndianOut);
+
+// ---- Two microphones on one I2S bus (L/R select pins tied low / high)
+
+// Interleaved L/R slots -> planar, once per block (in != left/right)
+void dsp_deinterleave32(const int32_t* in, int32_t* left, int32_t* right, int n);
+// Planar host-order channels -> interleaved stereo, network order when bigEndianOut
+void dsp_interleave16(const int16_t* left, const int16_t* right, int16_t* out, int n, bool bigEndianOut);
+
+// Delay-and-sum of two mics: one channel is delayed by |delay| samples
+// (delay > 0: right, < 0: left) to steer the pair, then the two are averaged.
+// Sound from the steered direction adds in phase; the capsules' own noise is
+// uncorrelated and drops by up to 3 dB. The delayed channel's tail is kept
+// across blocks; out must not alias the inputs.
+#define DSP_BEAM_MAX_DELAY 32
+struct DelaySum {
+    int8_t delay = 0;
+    int32_t hist[DSP_BEAM_MAX_DELAY] = {0};   // last |delay| samples, oldest first
+    void reset();
+    void process(const int32_t* left, const int32_t* right, int32_t* out, int n);
+};
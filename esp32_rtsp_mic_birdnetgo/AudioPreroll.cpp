@@ -0,0 +1,75 @@
+#include "AudioPreroll.h"
+#if defined(ARDUINO)
+#include <Arduino.h>
+#else
+#include <stdlib.h>
+#endif
+
+bool PrerollBuffer::begin(uint32_t samples) {
+    end();
+#if defined(ARDUINO)
+    if (samples == 0 || !psramFound()) return false;
+    data = (int16_t*)ps_malloc((size_t)samples * sizeof(int16_t));
+#else
+    if (samples == 0) return false;   // host bench: plain heap
+    data = (int16_t*)malloc((size_t)samples * sizeof(int16_t));
+#endif
+    if (!data) return false;
+    cap = samples;
+    return true;
+}
+
+void PrerollBuffer::end() {
+    if (data) { free(data); data = nullptr; }
+    cap = 0;
+    headIdx.store(0, std::memory_order_relaxed);
+    startIdx.store(0, std::memory_order_relaxed);
+}
+
+void PrerollBuffer::write(uint32_t index, const int16_t* samples, int n, bool byteSwapped) {
+    if (!data || n <= 0) return;
+    if (index != headIdx.load(std::memory_order_relaxed)) {
+        startIdx.store(index, std::memory_order_relaxed);
+    }
+    uint32_t slot = index % cap;
+    for (int i = 0; i < n; ++i) {
+        int16_t v = samples[i];
+        if (byteSwapped) {
+            uint16_t u = (uint16_t)v;
+            v = (int16_t)(uint16_t)((u << 8) | (u >> 8));
+        }
+        data[slot] = v;
+        if (++slot == cap) slot = 0;
+    }
+    // index % cap is only continuous below 2^32: restart the history at the
+    // wrap (once per ~25 h at 48 kHz)
+    uint32_t next = index + (uint32_t)n;
+    if (next < index) startIdx.store(next, std::memory_order_relaxed);
+    headIdx.store(next, std::memory_order_release);
+}
+
+uint32_t PrerollBuffer::oldest() const {
+    uint32_t h = headIdx.load(std::memory_order_acquire);
+    uint32_t s = startIdx.load(std::memory_order_relaxed);
+    return (h - s > cap) ? h - cap : s;
+}
+
+bool PrerollBuffer::read(uint32_t pos, int16_t* out, int n) const {
+    if (!data || n <= 0) return false;
+    uint32_t h = head();
+    if ((int32_t)(pos - oldest()) < 0 || (int32_t)(h - (pos + (uint32_t)n)) < 0) return false;
+    uint32_t slot = pos % cap;
+    for (int i = 0; i < n; ++i) {
+        out[i] = data[slot];
+        if (++slot == cap) slot = 0;
+    }
+    // The producer may have lapped the copy meanwhile
+    return (head() - pos) <= cap;
+}
+
+MonoPlane preroll_monoPlane(const int16_t* pcm, const int16_t* stereoPlanes, bool stereo, bool networkOrder) {
+    MonoPlane m;
+    m.samples = stereo ? stereoPlanes : pcm;
+    m.byteSwapped = !stereo && networkOrder;
+    return m;
+}
@@ -0,0 +1,46 @@
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+#include <atomic>
+
+// Pre-roll history of processed stream-rate PCM (ESP32 RTSP Mic for BirdNET-Go)
+// Lives in PSRAM. Written by the capture task, read by the network task (RTSP
+// replay) and the Web UI (WAV download). Positions are absolute stream sample
+// indices (uint32_t, wrap-safe differences), the same numbering as
+// AudioBlock::sampleIndex, so a reader can hand over to the live ring exactly.
+class PrerollBuffer {
+public:
+    bool begin(uint32_t samples);           // PSRAM only; false when absent/short
+    void end();
+    bool active() const { return data != nullptr; }
+
+    // Producer: n host-order samples starting at absolute index `index`.
+    // A discontinuous index restarts the history.
+    void write(uint32_t index, const int16_t* samples, int n, bool byteSwapped);
+
+    uint32_t head() const { return headIdx.load(std::memory_order_acquire); }
+    uint32_t oldest() const;                 // first index still readable
+    uint32_t filled() const { return head() - oldest(); }
+    uint32_t capacity() const { return cap; }
+    size_t bytes() const { return (size_t)cap * sizeof(int16_t); }
+
+    // Copy n samples from absolute index pos; false if not written yet or
+    // overwritten by the producer while copying
+    bool read(uint32_t pos, int16_t* out, int n) const;
+
+private:
+    int16_t* data = nullptr;
+    uint32_t cap = 0;
+    std::atomic<uint32_t> headIdx{0};        // next index to write
+    std::atomic<uint32_t> startIdx{0};       // first index of the current history
+};
+
+// A processed capture block as one host-order-or-swapped mono plane, for the
+// consumers that want one channel (SD stage, mel frames). In stereo the RTP
+// block may already hold interleaved network-order pairs: the left plane of
+// the processed planes is used instead.
+struct MonoPlane {
+    const int16_t* samples;
+    bool byteSwapped;
+};
+MonoPlane preroll_monoPlane(const int16_t* pcm, const int16_t* stereoPlanes, bool stereo, bool networkOrder);
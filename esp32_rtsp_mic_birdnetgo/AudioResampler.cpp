@@ -0,0 +1,95 @@
+#include "AudioResampler.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+static uint32_t gcd32(uint32_t a, uint32_t b) {
+    while (b) { uint32_t t = a % b; a = b; b = t; }
+    return a;
+}
+
+bool PolyphaseResampler::begin(uint32_t inRate, uint32_t outRate, int maxInput) {
+    end();
+    if (inRate == 0 || outRate == 0 || maxInput <= 0) return false;
+    uint32_t g = gcd32(inRate, outRate);
+    uint32_t L = outRate / g, M = inRate / g;
+    if (L > MAX_FACTOR || M > MAX_FACTOR) return false;
+    upFactor = (uint8_t)L;
+    downFactor = (uint8_t)M;
+    if (!active()) return true;
+
+    const int factor = (L > M) ? (int)L : (int)M;
+    const int n = TAPS_PER_FACTOR * factor;        // multiple of L by construction
+    tapsPerPhase = n / (int)L;
+
+    // Prototype at the upsampled rate; cutoff 90% of the lower Nyquist
+    const float pi = 3.14159265358979323846f;
+    const float fc = 0.45f / (float)factor;        // cycles per upsampled sample
+    const float mid = (float)(n - 1) * 0.5f;
+    float proto[MAX_TAPS];
+    float sum = 0.0f;
+    for (int i = 0; i < n; ++i) {
+        float t = (float)i - mid;
+        float sinc = (t == 0.0f) ? 2.0f * fc : sinf(2.0f * pi * fc * t) / (pi * t);
+        float w = 0.42f - 0.5f * cosf(2.0f * pi * (float)i / (float)(n - 1))
+                        + 0.08f * cosf(4.0f * pi * (float)i / (float)(n - 1));
+        proto[i] = sinc * w;
+        sum += proto[i];
+    }
+    // Unity DC gain per output phase (sum of all taps = L), then Q14
+    const float scale = (float)L / sum * 16384.0f;
+    for (int p = 0; p < (int)L; ++p) {
+        for (int k = 0; k < tapsPerPhase; ++k) {
+            coeffs[p * tapsPerPhase + k] = (int16_t)lroundf(proto[p + k * (int)L] * scale);
+        }
+    }
+
+    workLen = tapsPerPhase - 1 + maxInput;
+    work = (int16_t*)malloc((size_t)workLen * sizeof(int16_t));
+    if (!work) { upFactor = downFactor = 1; return false; }
+    reset();
+    return true;
+}
+
+void PolyphaseResampler::end() {
+    if (work) { free(work); work = nullptr; }
+    workLen = 0;
+    tapsPerPhase = 0;
+    upFactor = downFactor = 1;
+    phaseAcc = 0;
+}
+
+void PolyphaseResampler::reset() {
+    if (work) memset(work, 0, (size_t)(tapsPerPhase - 1) * sizeof(int16_t));
+    phaseAcc = 0;
+}
+
+int PolyphaseResampler::process(const int16_t* in, int n, int16_t* out, int maxOut, bool bigEndianOut) {
+    const int hist = tapsPerPhase - 1;
+    if (!work || n > workLen - hist) return 0;
+    memcpy(work + hist, in, (size_t)n * sizeof(int16_t));
+
+    const uint32_t L = upFactor, M = downFactor;
+    const uint32_t end = (uint32_t)n * L;
+    int produced = 0;
+    uint32_t t = phaseAcc;
+    while (t < end && produced < maxOut) {
+        const uint32_t base = t / L;
+        const int16_t* h = coeffs + (t - base * L) * (uint32_t)tapsPerPhase;
+        const int16_t* x = work + hist + base;      // x[-k] = input base - k
+        int32_t acc = 0;
+        for (int k = 0; k < tapsPerPhase; ++k) acc += (int32_t)h[k] * x[-k];
+        int32_t y = (acc + (1 << 13)) >> 14;
+        if (y > 32767) y = 32767;
+        if (y < -32768) y = -32768;
+        if (bigEndianOut) {
+            uint16_t u = (uint16_t)y;
+            y = (int16_t)(uint16_t)((u << 8) | (u >> 8));
+        }
+        out[produced++] = (int16_t)y;
+        t += M;
+    }
+    phaseAcc = (t >= end) ? t - end : 0;           // outputs cut by maxOut are dropped
+    memmove(work, work + n, (size_t)hist * sizeof(int16_t));
+    return produced;
+}
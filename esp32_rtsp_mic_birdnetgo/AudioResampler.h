@@ -0,0 +1,39 @@
+#pragma once
+#include <stdint.h>
+
+// Rational polyphase sample-rate converter (ESP32 RTSP Mic for BirdNET-Go)
+// Converts the I2S capture rate to the RTSP stream rate by L/M (e.g. 96k->48k
+// is 1/2, 48k->32k is 2/3). Blackman-windowed sinc prototype, cut below the
+// lower of the two Nyquist rates; Q14 coefficients with a 32-bit accumulator.
+class PolyphaseResampler {
+public:
+    static const uint8_t MAX_FACTOR = 4;          // L and M after reduction
+    static const int TAPS_PER_FACTOR = 32;        // prototype length = 32 * max(L, M)
+    static const int MAX_TAPS = TAPS_PER_FACTOR * MAX_FACTOR;
+
+    ~PolyphaseResampler() { end(); }
+
+    // false when the reduced ratio exceeds MAX_FACTOR or memory is short;
+    // maxInput = largest block passed to process()
+    bool begin(uint32_t inRate, uint32_t outRate, int maxInput);
+    void end();
+    void reset();                                 // clear history (stream restart)
+
+    bool active() const { return upFactor != downFactor; }
+    uint8_t up() const { return upFactor; }
+    uint8_t down() const { return downFactor; }
+    int taps() const { return tapsPerPhase; }
+
+    // n input samples (host order) -> returns output count (<= maxOut).
+    // Blocks of n * L / M whole outputs keep the per-block count constant.
+    int process(const int16_t* in, int n, int16_t* out, int maxOut, bool bigEndianOut);
+
+private:
+    int16_t coeffs[MAX_TAPS];                     // [phase * tapsPerPhase + k]
+    int16_t* work = nullptr;                      // history (taps - 1) + current block
+    int workLen = 0;
+    int tapsPerPhase = 0;
+    uint8_t upFactor = 1;
+    uint8_t downFactor = 1;
+    uint32_t phaseAcc = 0;                        // next output, in 1/L input samples
+};
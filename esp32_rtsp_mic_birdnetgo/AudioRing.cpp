@@ -0,0 +1,65 @@
+#include "AudioRing.h"
+
+bool AudioBlockRing::begin(uint8_t slots, uint16_t samplesPerBlock) {
+    end();
+    if (slots < 2) slots = 2;
+    if (slots > MAX_SLOTS) slots = MAX_SLOTS;
+    // Keep every block 4-byte aligned for DMA-friendly reads into the samples
+    size_t stride = (AUDIO_BLOCK_HEADROOM + (size_t)samplesPerBlock * sizeof(int16_t) + 3) & ~(size_t)3;
+    storage = (uint8_t*)malloc((size_t)slots * stride);
+    if (!storage) return false;
+    for (uint8_t i = 0; i < slots; ++i) {
+        blocks[i].packet = storage + (size_t)i * stride;
+        blocks[i].samples = (int16_t*)(blocks[i].packet + AUDIO_BLOCK_HEADROOM);
+        blocks[i].count = 0;
+        blocks[i].bytes = 0;
+        blocks[i].payloadType = 96;
+        blocks[i].sampleIndex = 0;
+        blocks[i].gated = false;
+    }
+    slotCount = slots;
+    blockLen = samplesPerBlock;
+    head.store(0, std::memory_order_relaxed);
+    tail.store(0, std::memory_order_relaxed);
+    return true;
+}
+
+void AudioBlockRing::end() {
+    if (storage) { free(storage); storage = nullptr; }
+    slotCount = 0;
+    blockLen = 0;
+    head.store(0, std::memory_order_relaxed);
+    tail.store(0, std::memory_order_relaxed);
+}
+
+AudioBlock* AudioBlockRing::acquireWrite() {
+    if (!slotCount) return nullptr;
+    uint32_t h = head.load(std::memory_order_relaxed);
+    uint32_t t = tail.load(std::memory_order_acquire);
+    if (h - t >= slotCount) return nullptr;
+    return &blocks[h % slotCount];
+}
+
+void AudioBlockRing::commitWrite() {
+    head.store(head.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+}
+
+AudioBlock* AudioBlockRing::acquireRead() {
+    if (!slotCount) return nullptr;
+    uint32_t t = tail.load(std::memory_order_relaxed);
+    uint32_t h = head.load(std::memory_order_acquire);
+    if (h == t) return nullptr;
+    return &blocks[t % slotCount];
+}
+
+void AudioBlockRing::releaseRead() {
+    tail.store(tail.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+}
+
+void AudioBlockRing::drain() {
+    tail.store(head.load(std::memory_order_acquire), std::memory_order_release);
+}
+
+uint8_t AudioBlockRing::used() const {
+    return (uint8_t)(head.load(std::memory_order_acquire) - tail.load(std::memory_order_acquire));
+}
@@ -0,0 +1,51 @@
+#pragma once
+#include <stdint.h>
+#include <stdlib.h>
+#include <atomic>
+
+// Bytes reserved in front of every block for the RTSP interleave (4) + RTP (12)
+// headers, so a packet is assembled in place and sent with a single write
+#define AUDIO_BLOCK_HEADROOM 16
+
+// Block of processed 16-bit PCM handed from the capture task to the network task
+struct AudioBlock {
+    uint8_t* packet;    // AUDIO_BLOCK_HEADROOM header bytes, then the samples
+    int16_t* samples;   // == packet + AUDIO_BLOCK_HEADROOM
+    uint16_t count;     // valid samples in this block
+    uint16_t bytes;     // encoded payload bytes (count * 2 for L16)
+    uint8_t payloadType;
+    uint32_t sampleIndex;   // absolute stream position of the first sample
+    bool gated;             // activity gate closed: no payload, only the RTP clock advances
+};
+
+// Lock-free single-producer/single-consumer ring of fixed-size PCM blocks.
+// Producer: audio capture task. Consumer: RTSP network task.
+// Indices run freely; slot = index % slotCount, used = head - tail.
+class AudioBlockRing {
+public:
+    static const uint8_t MAX_SLOTS = 128;   // ptime slicing needs several blocks per buffer
+
+    bool begin(uint8_t slots, uint16_t samplesPerBlock);
+    void end();
+
+    // Producer side
+    AudioBlock* acquireWrite();   // nullptr when the ring is full
+    void commitWrite();
+
+    // Consumer side
+    AudioBlock* acquireRead();    // nullptr when the ring is empty
+    void releaseRead();
+    void drain();                 // drop all queued blocks
+
+    uint8_t used() const;
+    uint8_t capacity() const { return slotCount; }
+    uint16_t blockSamples() const { return blockLen; }
+
+private:
+    AudioBlock blocks[MAX_SLOTS];
+    uint8_t* storage = nullptr;
+    uint8_t slotCount = 0;
+    uint16_t blockLen = 0;
+    std::atomic<uint32_t> head{0};   // next block to write
+    std::atomic<uint32_t> tail{0};   // next block to read
+};
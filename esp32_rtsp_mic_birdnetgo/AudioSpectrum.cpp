@@ -0,0 +1,160 @@
+#include "AudioSpectrum.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+static float hzToMel(float hz) { return 2595.0f * log10f(1.0f + hz / 700.0f); }
+static float melToHz(float mel) { return 700.0f * (powf(10.0f, mel / 2595.0f) - 1.0f); }
+
+bool MelSpectrum::begin(uint32_t sampleRate, uint8_t bands, float fMinHz, float fMaxHz) {
+    end();
+    if (fMaxHz > sampleRate * 0.5f) fMaxHz = sampleRate * 0.5f;
+    if (sampleRate == 0 || bands == 0 || bands > MEL_MAX_BANDS || fMinHz < 0.0f || fMinHz >= fMaxHz) return false;
+    const uint16_t n = (sampleRate > 24000) ? 2048 : 1024;
+    const uint16_t half = (uint16_t)(n / 2);
+    window = (float*)malloc(n * sizeof(float));
+    cosT = (float*)malloc(half * sizeof(float));
+    sinT = (float*)malloc(half * sizeof(float));
+    bitrev = (uint16_t*)malloc(n * sizeof(uint16_t));
+    re = (float*)malloc(n * sizeof(float));
+    im = (float*)malloc(n * sizeof(float));
+    input = (float*)malloc(n * sizeof(float));
+    binSeg = (int16_t*)malloc((half + 1) * sizeof(int16_t));
+    binW = (float*)malloc((half + 1) * sizeof(float));
+    ring = (uint8_t*)malloc((size_t)MEL_RING_FRAMES * bands);
+    if (!window || !cosT || !sinT || !bitrev || !re || !im || !input || !binSeg || !binW || !ring) { end(); return false; }
+
+    fftN = n;
+    bandCount = bands;
+    rate = sampleRate;
+    const float twoPi = 6.28318530718f;
+    for (uint16_t i = 0; i < n; ++i) window[i] = 0.5f - 0.5f * cosf(twoPi * i / n);   // periodic Hann
+    for (uint16_t k = 0; k < half; ++k) { cosT[k] = cosf(twoPi * k / n); sinT[k] = sinf(twoPi * k / n); }
+    int bits = 0;
+    while ((1u << bits) < n) bits++;
+    for (uint16_t i = 0; i < n; ++i) {
+        uint16_t r = 0;
+        for (int b = 0; b < bits; ++b) if (i & (1u << b)) r |= (uint16_t)(1u << (bits - 1 - b));
+        bitrev[i] = r;
+    }
+    // A full-scale sine peaks at 32768 * sum(window) / 2 = 32768 * n / 4
+    const float peak = 32768.0f * n * 0.25f;
+    refPower = peak * peak;
+
+    // Triangles on bands + 2 equally spaced mel edges; bin k between edges j
+    // and j + 1 rises into band j and falls out of band j - 1
+    melLo = hzToMel(fMinHz);
+    melHi = hzToMel(fMaxHz);
+    const float step = (melHi - melLo) / (float)(bands + 1);
+    for (uint16_t k = 0; k <= half; ++k) {
+        binSeg[k] = -1;
+        binW[k] = 0.0f;
+        const float mel = hzToMel((float)k * sampleRate / n);
+        if (mel < melLo || mel >= melHi) continue;
+        int j = (int)((mel - melLo) / step);
+        if (j > bands) j = bands;
+        const float lo = melToHz(melLo + j * step), hi = melToHz(melLo + (j + 1) * step);
+        binSeg[k] = (int16_t)j;
+        binW[k] = ((float)k * sampleRate / n - lo) / (hi - lo);
+    }
+    memset(input, 0, n * sizeof(float));
+    fill = 0;
+    held.store(0, std::memory_order_relaxed);
+    return true;
+}
+
+void MelSpectrum::end() {
+    float** fp[] = { &window, &cosT, &sinT, &re, &im, &input, &binW };
+    for (float** p : fp) { free(*p); *p = nullptr; }
+    free(bitrev); bitrev = nullptr;
+    free(binSeg); binSeg = nullptr;
+    free(ring); ring = nullptr;
+    fftN = 0;
+    fill = 0;
+    bandCount = 0;
+    held.store(0, std::memory_order_relaxed);
+}
+
+float MelSpectrum::bandCenterHz(uint8_t band) const {
+    const float step = (melHi - melLo) / (float)(bandCount + 1);
+    return melToHz(melLo + (band + 1) * step);
+}
+
+int MelSpectrum::push(const int16_t* pcm, int n, bool byteSwapped) {
+    if (!window || n <= 0) return 0;
+    int frames = 0;
+    const uint16_t hopN = hop();
+    for (int i = 0; i < n; ++i) {
+        int16_t v = pcm[i];
+        if (byteSwapped) {
+            uint16_t u = (uint16_t)v;
+            v = (int16_t)(uint16_t)((u << 8) | (u >> 8));
+        }
+        input[fill++] = (float)v;
+        if (fill < fftN) continue;
+        const uint32_t seq = head.load(std::memory_order_relaxed);
+        computeFrame(ring + (size_t)(seq % MEL_RING_FRAMES) * bandCount);
+        head.store(seq + 1, std::memory_order_release);
+        if (held.load(std::memory_order_relaxed) < MEL_RING_FRAMES) held.fetch_add(1, std::memory_order_relaxed);
+        memmove(input, input + hopN, (size_t)(fftN - hopN) * sizeof(float));
+        fill = (uint16_t)(fftN - hopN);
+        frames++;
+    }
+    return frames;
+}
+
+// Windowed radix-2 FFT, power per bin, mel bands, 0.5 dB bytes
+void MelSpectrum::computeFrame(uint8_t* out) {
+    const uint16_t n = fftN;
+    for (uint16_t i = 0; i < n; ++i) {
+        const uint16_t k = bitrev[i];
+        re[i] = input[k] * window[k];
+        im[i] = 0.0f;
+    }
+    for (uint16_t size = 2; size <= n; size = (uint16_t)(size << 1)) {
+        const uint16_t halfSize = (uint16_t)(size >> 1), stride = (uint16_t)(n / size);
+        for (uint16_t base = 0; base < n; base = (uint16_t)(base + size)) {
+            for (uint16_t k = 0; k < halfSize; ++k) {
+                const float c = cosT[k * stride], s = sinT[k * stride];
+                const uint16_t a = (uint16_t)(base + k), b = (uint16_t)(a + halfSize);
+                // x[b] * e^(-j 2 pi k / size)
+                const float tr = re[b] * c + im[b] * s;
+                const float ti = im[b] * c - re[b] * s;
+                re[b] = re[a] - tr; im[b] = im[a] - ti;
+                re[a] += tr;        im[a] += ti;
+            }
+        }
+    }
+    float energy[MEL_MAX_BANDS];
+    for (uint8_t b = 0; b < bandCount; ++b) energy[b] = 0.0f;
+    for (uint16_t k = 0; k <= n / 2; ++k) {
+        const int s = binSeg[k];
+        if (s < 0) continue;
+        const float p = re[k] * re[k] + im[k] * im[k];
+        if (s < bandCount) energy[s] += binW[k] * p;
+        if (s > 0) energy[s - 1] += (1.0f - binW[k]) * p;
+    }
+    for (uint8_t b = 0; b < bandCount; ++b) {
+        const float db = 10.0f * log10f(energy[b] / refPower + 1e-20f);
+        float q = (db - (float)MEL_DB_FLOOR) * 2.0f + 0.5f;
+        if (q < 0.0f) q = 0.0f;
+        if (q > 255.0f) q = 255.0f;
+        out[b] = (uint8_t)q;
+    }
+}
+
+uint32_t MelSpectrum::oldestSeq() const {
+    // The slot after the newest may be mid-write: it is not offered
+    const uint32_t h = head.load(std::memory_order_acquire);
+    const uint32_t n = held.load(std::memory_order_relaxed);
+    return h - ((n < MEL_RING_FRAMES) ? n : MEL_RING_FRAMES - 1);
+}
+
+bool MelSpectrum::frame(uint32_t seq, uint8_t* out) const {
+    if (!ring) return false;
+    const uint32_t h = nextSeq();
+    if ((int32_t)(seq - oldestSeq()) < 0 || (int32_t)(h - seq) <= 0) return false;
+    memcpy(out, ring + (size_t)(seq % MEL_RING_FRAMES) * bandCount, bandCount);
+    // The producer may have lapped the copy meanwhile
+    return (nextSeq() - seq) < MEL_RING_FRAMES;
+}
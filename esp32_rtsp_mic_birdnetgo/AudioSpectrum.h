@@ -0,0 +1,63 @@
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+#include <atomic>
+
+// Log-mel spectrogram front end (ESP32 RTSP Mic for BirdNET-Go)
+// Hann-windowed FFT frames (50% overlap) of the processed stream, folded into
+// triangular mel bands and quantized to one byte per band, so a server that
+// only needs the spectrogram gets ~3 kB/s instead of 96 kB/s of L16.
+// Window, twiddles, bit reversal and filterbank are computed once in begin();
+// a frame does no trig and no allocation. Written by the capture task, read
+// without a lock like the pre-roll: frame() reports a frame lapped meanwhile.
+#define MEL_MAX_BANDS 64
+#define MEL_RING_FRAMES 256          // ~5 s at 48 kHz
+#define MEL_DB_FLOOR (-120)          // byte 0; 0.5 dB per step, 255 = +7.5 dBFS
+
+class MelSpectrum {
+public:
+    // FFT of 1024 points up to 24 kHz, 2048 above (bins stay <= 23.4 Hz, so
+    // the narrow low bands still get bins); bands between fMin and
+    // min(fMax, rate/2). False when out of memory or out of range.
+    bool begin(uint32_t sampleRate, uint8_t bands, float fMinHz, float fMaxHz);
+    void end();
+    bool active() const { return window != nullptr; }
+
+    // n stream samples (network order when byteSwapped); returns the frames
+    // completed by this call
+    int push(const int16_t* pcm, int n, bool byteSwapped);
+
+    uint32_t nextSeq() const { return head.load(std::memory_order_acquire); }
+    uint32_t oldestSeq() const;
+    // Copy frame `seq` (bands() bytes); false if not written yet or
+    // overwritten by the producer while copying
+    bool frame(uint32_t seq, uint8_t* out) const;
+
+    uint8_t bands() const { return bandCount; }
+    uint16_t fftSize() const { return fftN; }
+    uint16_t hop() const { return (uint16_t)(fftN / 2); }
+    uint32_t sampleRate() const { return rate; }
+    float bandCenterHz(uint8_t band) const;
+
+private:
+    void computeFrame(uint8_t* out);
+
+    float* window = nullptr;         // Hann, fftN
+    float* cosT = nullptr;           // twiddles, fftN / 2
+    float* sinT = nullptr;
+    uint16_t* bitrev = nullptr;
+    float* re = nullptr;
+    float* im = nullptr;
+    float* input = nullptr;          // sliding frame of fftN samples
+    int16_t* binSeg = nullptr;       // mel segment of bin k (-1: outside), fftN / 2 + 1
+    float* binW = nullptr;           // weight for band binSeg[k]; band binSeg[k] - 1 gets 1 - w
+    uint8_t* ring = nullptr;         // MEL_RING_FRAMES x bandCount
+    std::atomic<uint32_t> head{0};   // next frame to write
+    std::atomic<uint32_t> held{0};   // frames written since begin(); seq runs on across restarts
+    uint16_t fftN = 0;
+    uint16_t fill = 0;
+    uint8_t bandCount = 0;
+    uint32_t rate = 0;
+    float melLo = 0.0f, melHi = 0.0f;
+    float refPower = 1.0f;           // full-scale sine in one bin
+};
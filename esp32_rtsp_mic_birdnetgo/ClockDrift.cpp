@@ -0,0 +1,82 @@
+#include "ClockDrift.h"
+
+void ClockDrift::begin(uint32_t nominalRate) {
+    nominal = nominalRate;
+    started = false;
+    next = 0;
+    points = 0;
+    drift = 0.0f;
+    span = 0.0f;
+}
+
+void ClockDrift::add(uint32_t frameIndex, int64_t timeUs) {
+    if (nominal == 0) return;
+    if (!started) {
+        started = true;
+        lastIndex = frameIndex;
+        frames = 0;
+        baseUs = timeUs;
+        windowEndUs = timeUs + DRIFT_WINDOW_US;
+        windowMin = 1e300;
+        return;
+    }
+    frames += (uint32_t)(frameIndex - lastIndex);
+    lastIndex = frameIndex;
+    const double t = (double)(timeUs - baseUs);
+    const double offset = t - (double)frames * 1e6 / (double)nominal;
+    if (offset < windowMin) { windowMin = offset; windowMinT = t; }
+    if (timeUs < windowEndUs) return;
+
+    xs[next] = windowMinT * 1e-6;
+    ys[next] = windowMin;
+    next = (uint8_t)((next + 1) % DRIFT_WINDOWS);
+    if (points < DRIFT_WINDOWS) points = (uint8_t)(points + 1);
+    windowMin = 1e300;
+    windowEndUs += DRIFT_WINDOW_US;
+    if (windowEndUs <= timeUs) windowEndUs = timeUs + DRIFT_WINDOW_US;   // a stall skipped windows
+    if (points >= DRIFT_MIN_WINDOWS) fit();
+}
+
+// Least squares through the window minima, centred for precision
+void ClockDrift::fit() {
+    const uint8_t n = points;
+    double mx = 0.0, my = 0.0, lo = 1e300, hi = -1e300;
+    for (uint8_t i = 0; i < n; ++i) {
+        mx += xs[i];
+        my += ys[i];
+        if (xs[i] < lo) lo = xs[i];
+        if (xs[i] > hi) hi = xs[i];
+    }
+    mx /= n;
+    my /= n;
+    double sxx = 0.0, sxy = 0.0;
+    for (uint8_t i = 0; i < n; ++i) {
+        sxx += (xs[i] - mx) * (xs[i] - mx);
+        sxy += (xs[i] - mx) * (ys[i] - my);
+    }
+    if (sxx <= 0.0) return;
+    // More frames than nominal per second lowers the offset
+    drift = (float)(-sxy / sxx);
+    span = (float)(hi - lo);
+}
+
+void SampleClockAnchor::set(uint32_t sampleIndex, int64_t timeUs) {
+    uint32_t s = seq.load(std::memory_order_relaxed);
+    seq.store(s + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    index = sampleIndex;
+    us = timeUs;
+    seq.store(s + 2, std::memory_order_release);
+}
+
+bool SampleClockAnchor::get(uint32_t &sampleIndex, int64_t &timeUs) const {
+    for (int attempt = 0; attempt < 8; ++attempt) {
+        uint32_t s1 = seq.load(std::memory_order_acquire);
+        if (s1 & 1) continue;
+        sampleIndex = index;
+        timeUs = us;
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (seq.load(std::memory_order_relaxed) == s1) return s1 != 0;
+    }
+    return false;
+}
@@ -0,0 +1,59 @@
+#pragma once
+#include <stdint.h>
+#include <atomic>
+
+// Sample clock drift (ESP32 RTSP Mic for BirdNET-Go)
+// Compares the I2S frame count with a reference clock (esp_timer). Each
+// capture block gives a pair (frames so far, time the DMA delivered them);
+// the offset between reference time and nominal sample time only moves with
+// real drift, while a late wake-up adds positive noise. So the minimum offset
+// of every window is kept and a line is fitted through the last windows: its
+// slope in us/s is the drift in ppm. Written by the capture task; the result
+// is single words, read without a lock.
+#define DRIFT_WINDOW_US 10000000LL   // 10 s per lower-envelope point
+#define DRIFT_WINDOWS 36             // fit over the last 6 minutes
+#define DRIFT_MIN_WINDOWS 3
+
+class ClockDrift {
+public:
+    // Also the restart after a gap (lost DMA buffers, paused capture) or a
+    // new clock: frames and time no longer line up with the old points
+    void begin(uint32_t nominalRate);
+    void add(uint32_t frameIndex, int64_t timeUs);
+
+    bool valid() const { return points >= DRIFT_MIN_WINDOWS; }
+    float ppm() const { return drift; }               // + = the sample clock runs fast
+    float spanSeconds() const { return span; }        // time covered by the fit
+    uint32_t nominalRate() const { return nominal; }
+
+private:
+    void fit();
+
+    uint32_t nominal = 0;
+    bool started = false;
+    uint32_t lastIndex = 0;
+    uint64_t frames = 0;             // since the first pair
+    int64_t baseUs = 0;
+    int64_t windowEndUs = 0;
+    double windowMin = 0.0;          // lowest offset (us) in the open window
+    double windowMinT = 0.0;         // and when (us since the first pair)
+    double xs[DRIFT_WINDOWS];        // window minima: seconds since the first pair
+    double ys[DRIFT_WINDOWS];        // and offset in us
+    uint8_t next = 0;
+    volatile uint8_t points = 0;
+    volatile float drift = 0.0f;
+    volatile float span = 0.0f;
+};
+
+// Stream sample index and the reference time it was captured, published by
+// the capture task for the RTCP sender reports (sequence counter, no lock)
+class SampleClockAnchor {
+public:
+    void set(uint32_t sampleIndex, int64_t timeUs);
+    bool get(uint32_t &sampleIndex, int64_t &timeUs) const;   // false before the first set()
+
+private:
+    std::atomic<uint32_t> seq{0};    // odd while the writer is updating
+    uint32_t index = 0;
+    int64_t us = 0;
+};
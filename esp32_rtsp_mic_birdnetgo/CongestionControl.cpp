@@ -0,0 +1,31 @@
+#include "CongestionControl.h"
+
+static uint8_t percent(uint32_t part, uint32_t whole) {
+    if (whole == 0) return 0;
+    uint64_t p = (uint64_t)part * 100 / whole;
+    return (uint8_t)(p > 255 ? 255 : p);
+}
+
+void CongestionController::reset(uint32_t nowMs) {
+    lastChangeMs = nowMs;
+    badRun = goodRun = 0;
+    lastUtil = lastStall = 0;
+}
+
+CongestionController::Decision CongestionController::update(const Window &w, uint32_t nowMs, bool canDown, bool canUp) {
+    if (w.packets == 0) {                    // idle: no evidence either way
+        badRun = goodRun = 0;
+        return HOLD;
+    }
+    lastUtil = percent(w.sendUs, w.audioUs);
+    lastStall = percent(w.stalls, w.packets);
+    const bool bad = lastUtil >= DOWN_UTIL_PCT || lastStall >= DOWN_STALL_PCT;
+    const bool good = lastUtil < UP_UTIL_PCT && w.stalls == 0;
+    badRun = bad ? (uint8_t)(badRun < 255 ? badRun + 1 : 255) : 0;
+    goodRun = good ? (uint8_t)(goodRun < 255 ? goodRun + 1 : 255) : 0;
+
+    if (nowMs - lastChangeMs < HOLD_MS) return HOLD;
+    if (canDown && badRun >= DOWN_WINDOWS) { reset(nowMs); return STEP_DOWN; }
+    if (canUp && goodRun >= UP_WINDOWS) { reset(nowMs); return STEP_UP; }
+    return HOLD;
+}
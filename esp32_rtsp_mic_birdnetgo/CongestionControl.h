@@ -0,0 +1,41 @@
+#pragma once
+#include <stdint.h>
+
+// Send-side congestion controller (ESP32 RTSP Mic for BirdNET-Go)
+// Fed once per window with what the network task saw while sending: packets,
+// stalled writes (short TCP write = socket send buffer full, failed UDP send)
+// and time spent in write() against the audio time those packets carried.
+// Steps down after a few congested windows in a row, back up only after a
+// long clean run, and never twice within the hold time.
+class CongestionController {
+public:
+    struct Window {
+        uint32_t packets;
+        uint32_t stalls;
+        uint32_t sendUs;      // time inside write()/endPacket()
+        uint32_t audioUs;     // audio duration of the packets sent
+    };
+    enum Decision : int8_t { HOLD = 0, STEP_DOWN = 1, STEP_UP = -1 };
+
+    static const uint8_t DOWN_UTIL_PCT = 60;     // write time / audio time
+    static const uint8_t DOWN_STALL_PCT = 5;     // stalled packets
+    static const uint8_t UP_UTIL_PCT = 20;
+    static const uint8_t DOWN_WINDOWS = 3;       // consecutive congested windows
+    static const uint8_t UP_WINDOWS = 120;       // consecutive clean windows
+    static const uint32_t HOLD_MS = 30000;       // after any transition
+
+    void reset(uint32_t nowMs);
+    // canDown/canUp: whether the format ladder has a step in that direction
+    Decision update(const Window &w, uint32_t nowMs, bool canDown, bool canUp);
+
+    uint8_t utilPct() const { return lastUtil; }
+    uint8_t stallPct() const { return lastStall; }
+    bool congested() const { return badRun > 0; }
+
+private:
+    uint32_t lastChangeMs = 0;
+    uint8_t badRun = 0;
+    uint8_t goodRun = 0;
+    uint8_t lastUtil = 0;
+    uint8_t lastStall = 0;
+};
@@ -0,0 +1,40 @@
+#include "LogRing.h"
+#include <string.h>
+
+void LogRing::push(const char* text, size_t len) {
+    if (len > MAX_LINE) len = MAX_LINE;
+    // Lines are contiguous in push order, so evicting the oldest only frees bytes
+    while (count > 0 && (used + len > ARENA_BYTES || count >= MAX_LINES)) {
+        used -= lens[oldestSeq() % MAX_LINES];
+        count--;
+    }
+    const uint16_t slot = (uint16_t)(seq % MAX_LINES);
+    starts[slot] = (uint16_t)head;
+    lens[slot] = (uint8_t)len;
+    size_t first = ARENA_BYTES - head;
+    if (first > len) first = len;
+    memcpy(arena + head, text, first);
+    memcpy(arena, text + first, len - first);
+    head = (head + len) % ARENA_BYTES;
+    used += len;
+    count++;
+    seq++;
+}
+
+bool LogRing::line(uint32_t s, char* out, size_t n, size_t &len) const {
+    len = 0;
+    if (n == 0) return false;
+    out[0] = 0;
+    if ((int32_t)(s - oldestSeq()) < 0 || (int32_t)(s - seq) >= 0) return false;
+    const uint16_t slot = (uint16_t)(s % MAX_LINES);
+    size_t want = lens[slot];
+    if (want > n - 1) want = n - 1;
+    const size_t start = starts[slot];
+    size_t first = ARENA_BYTES - start;
+    if (first > want) first = want;
+    memcpy(out, arena + start, first);
+    memcpy(out + first, arena, want - first);
+    out[want] = 0;
+    len = want;
+    return true;
+}
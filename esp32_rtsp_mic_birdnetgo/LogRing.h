@@ -0,0 +1,35 @@
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+
+// Log line history in one fixed byte arena (ESP32 RTSP Mic for BirdNET-Go)
+// Lines are copied into a static ring, no allocation per line, so months of
+// logging do not fragment the heap. Every line gets a sequence number
+// (lines pushed since boot); readers keep a cursor and ask for the next line.
+// The oldest lines are evicted when the arena or the line table is full.
+// Not thread-safe: the caller serializes push() and the readers.
+class LogRing {
+public:
+    static const size_t ARENA_BYTES = 8192;
+    static const uint16_t MAX_LINES = 128;
+    static const size_t MAX_LINE = 200;             // longer lines are truncated
+
+    void push(const char* text, size_t len);
+
+    uint32_t nextSeq() const { return seq; }        // sequence of the next line pushed
+    uint32_t oldestSeq() const { return seq - count; }
+    uint16_t lines() const { return count; }
+
+    // Copy line `s` into out (NUL-terminated, cut to n-1); false once evicted
+    // or not written yet. len receives the copied length.
+    bool line(uint32_t s, char* out, size_t n, size_t &len) const;
+
+private:
+    char arena[ARENA_BYTES];
+    uint16_t starts[MAX_LINES];                     // arena offset of line seq % MAX_LINES
+    uint8_t lens[MAX_LINES];
+    size_t head = 0;                                // next arena byte to write
+    size_t used = 0;                                // bytes held by the retained lines
+    uint32_t seq = 0;
+    uint16_t count = 0;
+};
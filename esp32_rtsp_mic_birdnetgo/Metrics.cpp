@@ -0,0 +1,40 @@
+#include "Metrics.h"
+#include <string.h>
+
+uint32_t LatencyHistogram::cyclesPerUs = 160;
+
+void LatencyHistogram::recordUs(uint32_t us) {
+    // Smallest i with 16 << i >= us
+    int i = 0;
+    if (us > 16) {
+        int log2Ceil = 32 - __builtin_clz(us - 1);
+        i = log2Ceil - 4;
+        if (i > BUCKETS) i = BUCKETS;
+    }
+    uint32_t s = seq.load(std::memory_order_relaxed);
+    seq.store(s + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    counts[i]++;
+    sumUs += us;
+    seq.store(s + 2, std::memory_order_release);
+}
+
+void LatencyHistogram::snapshot(Snapshot &out) const {
+    bool consistent = false;
+    for (int attempt = 0; attempt < 8 && !consistent; ++attempt) {
+        uint32_t s1 = seq.load(std::memory_order_acquire);
+        if (s1 & 1) continue;
+        memcpy(out.counts, counts, sizeof(out.counts));
+        out.sumUs = sumUs;
+        std::atomic_thread_fence(std::memory_order_acquire);
+        consistent = (seq.load(std::memory_order_relaxed) == s1);
+    }
+    if (!consistent) {
+        // Writer kept racing: take it as is, at most one sample out of step
+        memcpy(out.counts, counts, sizeof(out.counts));
+        out.sumUs = sumUs;
+    }
+    // The +Inf bucket must equal the count, so derive it from the buckets
+    out.count = 0;
+    for (int i = 0; i <= BUCKETS; ++i) out.count += out.counts[i];
+}
@@ -0,0 +1,31 @@
+#pragma once
+#include <stdint.h>
+#include <atomic>
+
+// Hot-path latency histograms (ESP32 RTSP Mic for BirdNET-Go)
+// Each histogram has one writer task (capture or network) that records CPU
+// cycle deltas into power-of-two microsecond buckets; /metrics readers take a
+// consistent copy through a sequence counter, so recording takes no lock.
+class LatencyHistogram {
+public:
+    static const int BUCKETS = 15;                 // upper bounds 16 us .. 262 ms, plus +Inf
+    struct Snapshot {
+        uint32_t counts[BUCKETS + 1];              // per bucket, not cumulative
+        uint32_t count;
+        uint64_t sumUs;
+    };
+
+    static void setCpuMhz(uint32_t mhz) { cyclesPerUs = mhz ? mhz : 1; }
+    static uint32_t bucketBoundUs(int i) { return 16u << i; }
+
+    static uint32_t cyclesToUs(uint32_t cycles) { return cycles / cyclesPerUs; }
+    void recordCycles(uint32_t cycles) { recordUs(cyclesToUs(cycles)); }
+    void recordUs(uint32_t us);
+    void snapshot(Snapshot &out) const;
+
+private:
+    static uint32_t cyclesPerUs;
+    std::atomic<uint32_t> seq{0};                  // odd while the writer is updating
+    uint32_t counts[BUCKETS + 1] = {};
+    uint64_t sumUs = 0;
+};
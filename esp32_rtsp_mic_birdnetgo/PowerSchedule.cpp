@@ -0,0 +1,75 @@
+#include "PowerSchedule.h"
+#include <stdio.h>
+
+static const uint16_t MINUTES_PER_DAY = 1440;
+
+// "HH:MM" -> minute of day; advances p
+static bool parseClock(const char* &p, uint16_t &minute) {
+    int h = 0, m = 0, digits = 0;
+    while (*p >= '0' && *p <= '9' && digits < 2) { h = h * 10 + (*p++ - '0'); digits++; }
+    if (digits == 0 || *p != ':') return false;
+    p++;
+    digits = 0;
+    while (*p >= '0' && *p <= '9' && digits < 2) { m = m * 10 + (*p++ - '0'); digits++; }
+    if (digits != 2 || h > 24 || m > 59 || (h == 24 && m != 0)) return false;
+    minute = (uint16_t)((h * 60 + m) % MINUTES_PER_DAY);
+    return true;
+}
+
+bool PowerSchedule::parse(const char* text) {
+    uint16_t s[POWER_MAX_WINDOWS], e[POWER_MAX_WINDOWS];
+    uint8_t n = 0;
+    const char* p = text;
+    while (*p == ' ') p++;
+    while (*p) {
+        if (n >= POWER_MAX_WINDOWS) return false;
+        if (!parseClock(p, s[n]) || *p++ != '-' || !parseClock(p, e[n]) || s[n] == e[n]) return false;
+        n++;
+        while (*p == ' ') p++;
+        if (*p == ',') {
+            p++;
+            while (*p == ' ') p++;
+            if (!*p) return false;
+        } else if (*p) {
+            return false;
+        }
+    }
+    for (uint8_t i = 0; i < n; ++i) { startMin[i] = s[i]; endMin[i] = e[i]; }
+    windows = n;
+    return true;
+}
+
+size_t PowerSchedule::format(char* out, size_t n) const {
+    size_t len = 0;
+    if (n) out[0] = 0;
+    for (uint8_t i = 0; i < windows && len + 1 < n; ++i) {
+        int w = snprintf(out + len, n - len, "%s%02u:%02u-%02u:%02u", i ? "," : "",
+                         (unsigned)(startMin[i] / 60), (unsigned)(startMin[i] % 60),
+                         (unsigned)(endMin[i] / 60), (unsigned)(endMin[i] % 60));
+        if (w < 0) break;
+        len += ((size_t)w < n - len) ? (size_t)w : n - len - 1;
+    }
+    return len;
+}
+
+bool PowerSchedule::active(uint16_t minuteOfDay) const {
+    for (uint8_t i = 0; i < windows; ++i) {
+        const uint16_t s = startMin[i], e = endMin[i];
+        if (s < e ? (minuteOfDay >= s && minuteOfDay < e) : (minuteOfDay >= s || minuteOfDay < e)) return true;
+    }
+    return false;
+}
+
+uint16_t PowerSchedule::minutesUntilChange(uint16_t minuteOfDay) const {
+    const bool now = active(minuteOfDay);
+    for (uint16_t d = 1; d < MINUTES_PER_DAY; ++d) {
+        if (active((uint16_t)((minuteOfDay + d) % MINUTES_PER_DAY)) != now) return d;
+    }
+    return MINUTES_PER_DAY;
+}
+
+uint16_t PowerSchedule::activeMinutesPerDay() const {
+    uint16_t n = 0;
+    for (uint16_t m = 0; m < MINUTES_PER_DAY; ++m) if (active(m)) n++;
+    return n;
+}
@@ -0,0 +1,29 @@
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+
+// Daily capture windows for the low-power mode (ESP32 RTSP Mic for BirdNET-Go)
+// Windows are local wall-clock ranges "HH:MM-HH:MM" (end before start wraps
+// past midnight). Pure time arithmetic: the sketch supplies the minute of the
+// day from NTP and switches I2S / CPU / Wi-Fi sleep at the edges.
+#define POWER_MAX_WINDOWS 4
+#define POWER_SPEC_MAX 64            // text of POWER_MAX_WINDOWS windows
+
+class PowerSchedule {
+public:
+    // "05:00-08:30,18:00-21:00"; false (schedule unchanged) on a syntax error.
+    // An empty spec clears all windows.
+    bool parse(const char* text);
+    size_t format(char* out, size_t n) const;
+
+    uint8_t count() const { return windows; }
+    bool active(uint16_t minuteOfDay) const;
+    // Minutes from minuteOfDay until active() changes (1440 when it never does)
+    uint16_t minutesUntilChange(uint16_t minuteOfDay) const;
+    uint16_t activeMinutesPerDay() const;
+
+private:
+    uint16_t startMin[POWER_MAX_WINDOWS];
+    uint16_t endMin[POWER_MAX_WINDOWS];
+    uint8_t windows = 0;
+};
@@ -0,0 +1,130 @@
+#include "RecordRing.h"
+#include <stdio.h>
+#include <string.h>
+
+static void put32(uint8_t* p, uint32_t v) { p[0] = (uint8_t)v; p[1] = (uint8_t)(v >> 8); p[2] = (uint8_t)(v >> 16); p[3] = (uint8_t)(v >> 24); }
+static void put16(uint8_t* p, uint16_t v) { p[0] = (uint8_t)v; p[1] = (uint8_t)(v >> 8); }
+static uint32_t get32(const uint8_t* p) { return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24); }
+
+// RIFF/WAVE, fmt (16 bytes), JUNK up to byte 504, data header at 504..511
+static const uint32_t JUNK_BYTES = RECORD_HEADER_BYTES - 12 - 24 - 8 - 8;
+
+void rec_writeWavHeader(uint8_t* out, uint32_t rate, uint16_t channels, uint32_t dataBytes) {
+    memset(out, 0, RECORD_HEADER_BYTES);
+    memcpy(out, "RIFF", 4);
+    put32(out + 4, RECORD_HEADER_BYTES - 8 + dataBytes);
+    memcpy(out + 8, "WAVEfmt ", 8);
+    put32(out + 16, 16);
+    put16(out + 20, 1);
+    put16(out + 22, channels);
+    put32(out + 24, rate);
+    put32(out + 28, rate * channels * 2);
+    put16(out + 32, (uint16_t)(channels * 2));
+    put16(out + 34, 16);
+    memcpy(out + 36, "JUNK", 4);
+    put32(out + 40, JUNK_BYTES);
+    memcpy(out + RECORD_HEADER_BYTES - 8, "data", 4);
+    put32(out + RECORD_HEADER_BYTES - 4, dataBytes);
+}
+
+bool rec_readWavDataBytes(const uint8_t* header, uint32_t &dataBytes) {
+    if (memcmp(header, "RIFF", 4) != 0 || memcmp(header + 8, "WAVEfmt ", 8) != 0
+        || memcmp(header + 36, "JUNK", 4) != 0 || memcmp(header + RECORD_HEADER_BYTES - 8, "data", 4) != 0) return false;
+    dataBytes = get32(header + RECORD_HEADER_BYTES - 4);
+    return true;
+}
+
+void rec_patchWavSizes(uint8_t* header, uint32_t dataBytes) {
+    put32(header + 4, RECORD_HEADER_BYTES - 8 + dataBytes);
+    put32(header + RECORD_HEADER_BYTES - 4, dataBytes);
+}
+
+size_t rec_formatName(char* out, size_t n, uint32_t seq, uint32_t startUtc) {
+    int w = snprintf(out, n, "%06lu-%010lu.wav", (unsigned long)seq, (unsigned long)startUtc);
+    return (w < 0) ? 0 : ((size_t)w < n ? (size_t)w : n - 1);
+}
+
+bool rec_parseName(const char* name, uint32_t &seq, uint32_t &startUtc) {
+    uint32_t v[2] = { 0, 0 };
+    const char* p = name;
+    for (int part = 0; part < 2; ++part) {
+        int digits = 0;
+        while (*p >= '0' && *p <= '9' && digits < 10) { v[part] = v[part] * 10 + (uint32_t)(*p++ - '0'); digits++; }
+        if (digits == 0 || *p++ != (part ? '.' : '-')) return false;
+    }
+    if (strcmp(p, "wav") != 0) return false;
+    seq = v[0];
+    startUtc = v[1];
+    return true;
+}
+
+// Decimal up to the first non-digit; false without digits or above 2^32
+static bool parseDecimal(const char* &p, uint32_t &v) {
+    uint64_t acc = 0;
+    int digits = 0;
+    while (*p >= '0' && *p <= '9') {
+        acc = acc * 10 + (uint64_t)(*p++ - '0');
+        if (acc > 0xFFFFFFFFull) return false;
+        digits++;
+    }
+    v = (uint32_t)acc;
+    return digits > 0;
+}
+
+bool rec_parseRange(const char* header, uint32_t size, uint32_t &first, uint32_t &last) {
+    if (strncmp(header, "bytes=", 6) != 0 || size == 0) return false;
+    const char* p = header + 6;
+    while (*p == ' ') p++;
+    uint32_t a = 0, b = 0;
+    if (*p == '-') {   // the last b bytes
+        p++;
+        if (!parseDecimal(p, b) || b == 0) return false;
+        first = (b >= size) ? 0 : size - b;
+        last = size - 1;
+    } else {
+        if (!parseDecimal(p, a) || *p++ != '-') return false;
+        if (*p >= '0' && *p <= '9') {
+            if (!parseDecimal(p, b) || b < a) return false;
+        } else {
+            b = size - 1;
+        }
+        if (a >= size) return false;
+        first = a;
+        last = (b >= size) ? size - 1 : b;
+    }
+    while (*p == ' ') p++;
+    return *p == 0;
+}
+
+bool RecordRing::insert(const RecordSegment &seg) {
+    if (full() || find(seg.seq) >= 0) return false;
+    // Walk back from the newest to the slot that keeps seq order
+    uint16_t i = count;
+    while (i > 0 && at((uint16_t)(i - 1)).seq > seg.seq) {
+        segs[(first + i) % RECORD_MAX_SEGMENTS] = at((uint16_t)(i - 1));
+        i--;
+    }
+    segs[(first + i) % RECORD_MAX_SEGMENTS] = seg;
+    count++;
+    total += seg.bytes;
+    return true;
+}
+
+void RecordRing::popOldest() {
+    if (count == 0) return;
+    total -= oldest().bytes;
+    first = (uint16_t)((first + 1) % RECORD_MAX_SEGMENTS);
+    count--;
+}
+
+int RecordRing::find(uint32_t seq) const {
+    for (uint16_t i = 0; i < count; ++i) if (at(i).seq == seq) return i;
+    return -1;
+}
+
+void RecordRing::setBytes(uint16_t i, uint32_t bytes) {
+    if (i >= count) return;
+    RecordSegment &s = segs[(first + i) % RECORD_MAX_SEGMENTS];
+    total = total - s.bytes + bytes;
+    s.bytes = bytes;
+}
@@ -0,0 +1,59 @@
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+
+// Local recording segments (ESP32 RTSP Mic for BirdNET-Go)
+// The SD card holds a bounded ring of WAV files "<seq>-<utc>.wav": seq counts
+// up across reboots, utc is the wall clock of the first sample (0 without
+// NTP). This is the table of those files, oldest first, plus the file format
+// helpers; the sketch does the card I/O. Not thread-safe: the caller
+// serializes the recorder task and the Web UI.
+#define RECORD_HEADER_BYTES 512      // WAV header padded with a JUNK chunk: samples start on a sector
+#define RECORD_MAX_SEGMENTS 512
+#define RECORD_NAME_MAX 24           // "000042-1760400000.wav"
+
+struct RecordSegment {
+    uint32_t seq;
+    uint32_t startUtc;
+    uint32_t bytes;                  // file size, header included
+};
+
+// 16-bit PCM header for dataBytes of samples (RECORD_HEADER_BYTES long)
+void rec_writeWavHeader(uint8_t* out, uint32_t rate, uint16_t channels, uint32_t dataBytes);
+// Data size a header claims; false when it is not one of ours
+bool rec_readWavDataBytes(const uint8_t* header, uint32_t &dataBytes);
+// New RIFF and data sizes in a header of ours (a file cut off by a power loss)
+void rec_patchWavSizes(uint8_t* header, uint32_t dataBytes);
+
+size_t rec_formatName(char* out, size_t n, uint32_t seq, uint32_t startUtc);
+bool rec_parseName(const char* name, uint32_t &seq, uint32_t &startUtc);
+
+// One "bytes=first-last" / "bytes=first-" / "bytes=-suffix" range of a
+// file of size bytes, clamped to the file; false when malformed or
+// unsatisfiable (multiple ranges are not supported)
+bool rec_parseRange(const char* header, uint32_t size, uint32_t &first, uint32_t &last);
+
+class RecordRing {
+public:
+    // Keeps seq order (the card scan finds files in directory order);
+    // false when full or seq is already listed
+    bool insert(const RecordSegment &seg);
+    void popOldest();
+    void clear() { count = 0; total = 0; }
+
+    uint16_t size() const { return count; }
+    bool full() const { return count >= RECORD_MAX_SEGMENTS; }
+    const RecordSegment &at(uint16_t i) const { return segs[(first + i) % RECORD_MAX_SEGMENTS]; }
+    const RecordSegment &oldest() const { return at(0); }
+    const RecordSegment &newest() const { return at((uint16_t)(count - 1)); }
+    int find(uint32_t seq) const;                   // index or -1
+    void setBytes(uint16_t i, uint32_t bytes);
+    uint64_t totalBytes() const { return total; }
+    uint32_t nextSeq() const { return count ? newest().seq + 1 : 0; }
+
+private:
+    RecordSegment segs[RECORD_MAX_SEGMENTS];
+    uint16_t first = 0;
+    uint16_t count = 0;
+    uint64_t total = 0;
+};
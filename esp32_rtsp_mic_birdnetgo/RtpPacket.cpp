@@ -0,0 +1,38 @@
+#include "RtpPacket.h"
+
+static inline void putBE32(uint8_t* p, uint32_t v) {
+    p[0] = (uint8_t)((v >> 24) & 0xFF);
+    p[1] = (uint8_t)((v >> 16) & 0xFF);
+    p[2] = (uint8_t)((v >> 8) & 0xFF);
+    p[3] = (uint8_t)(v & 0xFF);
+}
+
+uint16_t rtp_writeHeaders(uint8_t* pkt, uint8_t channel, uint8_t payloadType,
+                          uint16_t sequence, uint32_t timestamp, uint32_t ssrc,
+                          uint16_t payloadBytes) {
+    const uint16_t packetSize = (uint16_t)(RTP_HEADER_BYTES + payloadBytes);
+    pkt[0] = 0x24;
+    pkt[1] = channel;
+    pkt[2] = (uint8_t)((packetSize >> 8) & 0xFF);
+    pkt[3] = (uint8_t)(packetSize & 0xFF);
+
+    uint8_t* header = pkt + RTSP_INTERLEAVE_BYTES;
+    header[0] = 0x80;          // V=2, P=0, X=0, CC=0
+    header[1] = payloadType;   // M=0
+    header[2] = (uint8_t)((sequence >> 8) & 0xFF);
+    header[3] = (uint8_t)(sequence & 0xFF);
+    putBE32(header + 4, timestamp);
+    putBE32(header + 8, ssrc);
+    return packetSize;
+}
+
+size_t rtcp_writeSenderReport(uint8_t* out, uint32_t ssrc, uint32_t ntpSec, uint32_t ntpFrac,
+                              uint32_t rtpTimestamp, uint32_t packets, uint32_t octets) {
+    const uint32_t words[6] = { ssrc, ntpSec, ntpFrac, rtpTimestamp, packets, octets };
+    out[0] = 0x80;          // V=2, P=0, RC=0
+    out[1] = 200;           // PT=SR
+    out[2] = 0;
+    out[3] = 6;             // length in 32-bit words minus one
+    for (int i = 0; i < 6; ++i) putBE32(out + 4 + i * 4, words[i]);
+    return RTCP_SR_BYTES;
+}
@@ -0,0 +1,20 @@
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+
+// RTP / RTCP framing (ESP32 RTSP Mic for BirdNET-Go)
+// Pure byte layout, no sockets: the network task and the host bench share it.
+#define RTP_HEADER_BYTES 12
+#define RTSP_INTERLEAVE_BYTES 4
+#define RTCP_SR_BYTES 28
+
+// Fill the RTSP interleave prefix ('$', channel, length) and the RTP header
+// (V=2, M=0) in the 16 bytes in front of the payload. Byte-wise stores, so
+// pkt needs no alignment. Returns the RTP packet size (header + payload).
+uint16_t rtp_writeHeaders(uint8_t* pkt, uint8_t channel, uint8_t payloadType,
+                          uint16_t sequence, uint32_t timestamp, uint32_t ssrc,
+                          uint16_t payloadBytes);
+
+// RTCP sender report (RFC 3550 6.4.1) without report blocks; out holds RTCP_SR_BYTES
+size_t rtcp_writeSenderReport(uint8_t* out, uint32_t ssrc, uint32_t ntpSec, uint32_t ntpFrac,
+                              uint32_t rtpTimestamp, uint32_t packets, uint32_t octets);
@@ -0,0 +1,146 @@
+#include "RtspParser.h"
+#include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
+
+static const char* const RTSP_METHOD_NAMES[RTSP_METHOD_UNKNOWN] = {
+    "OPTIONS", "DESCRIBE", "SETUP", "PLAY", "TEARDOWN", "GET_PARAMETER"
+};
+
+static bool namesEqual(const char* a, size_t n, const char* name) {
+    size_t i = 0;
+    for (; i < n && name[i]; ++i) {
+        char c = a[i];
+        if (c >= 'A' && c <= 'Z') c = (char)(c - 'A' + 'a');
+        char d = name[i];
+        if (d >= 'A' && d <= 'Z') d = (char)(d - 'A' + 'a');
+        if (c != d) return false;
+    }
+    return i == n && name[i] == 0;
+}
+
+bool RtspField::contains(const char* needle) const {
+    const size_t n = strlen(needle);
+    for (size_t i = 0; p && n && i + n <= len; ++i) {
+        if (memcmp(p + i, needle, n) == 0) return true;
+    }
+    return false;
+}
+
+uint32_t RtspField::numberAfter(const char* key, uint32_t def) const {
+    const size_t n = strlen(key);                 // "" parses the field itself
+    for (size_t i = 0; p && i + n <= len; ++i) {
+        if (memcmp(p + i, key, n) != 0) continue;
+        size_t j = i + n;
+        if (j >= len || p[j] < '0' || p[j] > '9') return def;
+        uint32_t v = 0;
+        for (; j < len && p[j] >= '0' && p[j] <= '9'; ++j) {
+            v = v * 10 + (uint32_t)(p[j] - '0');
+            if (v > 0xFFFFFFu) return def;
+        }
+        return v;
+    }
+    return def;
+}
+
+RtspRequestParser::Result RtspRequestParser::parse(const char* buf, size_t len) {
+    msgLen = 0;
+    // Stray line breaks between requests belong to the next message
+    size_t start = 0;
+    while (start < len && (buf[start] == '\r' || buf[start] == '\n')) start++;
+    if (start == len) { scanned = 0; return NEED_MORE; }
+
+    if (buf[start] == '$') {
+        if (len - start < 4) return NEED_MORE;
+        size_t frame = 4 + (((size_t)(uint8_t)buf[start + 2] << 8) | (uint8_t)buf[start + 3]);
+        if (len - start < frame) return NEED_MORE;
+        msgLen = start + frame;
+        scanned = 0;
+        return INTERLEAVED;
+    }
+
+    size_t i = (scanned > start + 3) ? scanned - 3 : start;
+    size_t headEnd = 0;
+    for (; i + 4 <= len; ++i) {
+        if (buf[i] == '\r' && buf[i + 1] == '\n' && buf[i + 2] == '\r' && buf[i + 3] == '\n') { headEnd = i; break; }
+    }
+    if (headEnd == 0) {
+        scanned = len;
+        return NEED_MORE;
+    }
+    uint32_t contentLength = 0;
+    if (!parseHead(buf, start, headEnd, contentLength)) { scanned = 0; return BAD; }
+    const size_t total = headEnd + 4 + contentLength;
+    if (total > len) {
+        scanned = headEnd;      // header seen; waiting for the body
+        return NEED_MORE;
+    }
+    msgLen = total;
+    scanned = 0;
+    return REQUEST;
+}
+
+// Request line and headers in buf[start, headEnd)
+bool RtspRequestParser::parseHead(const char* buf, size_t start, size_t headEnd, uint32_t &contentLength) {
+    method = RTSP_METHOD_UNKNOWN;
+    uri = RtspField(); cseq = RtspField(); transport = RtspField(); session = RtspField();
+
+    const char* line = buf + start;
+    const char* end = buf + headEnd;
+    const char* eol = (const char*)memchr(line, '\r', (size_t)(end - line));
+    if (!eol) eol = end;
+    const char* sp1 = (const char*)memchr(line, ' ', (size_t)(eol - line));
+    if (!sp1) return false;
+    const char* sp2 = (const char*)memchr(sp1 + 1, ' ', (size_t)(eol - sp1 - 1));
+    if (!sp2 || eol - sp2 < 5 || memcmp(sp2 + 1, "RTSP/", 5) != 0) return false;
+    for (int m = 0; m < RTSP_METHOD_UNKNOWN; ++m) {
+        if (namesEqual(line, (size_t)(sp1 - line), RTSP_METHOD_NAMES[m])) { method = (RtspMethod)m; break; }
+    }
+    uri.p = sp1 + 1;
+    uri.len = (uint16_t)(sp2 - sp1 - 1);
+
+    for (line = eol + 2; line < end; line = eol + 2) {
+        eol = (const char*)memchr(line, '\r', (size_t)(end - line));
+        if (!eol) eol = end;
+        const char* colon = (const char*)memchr(line, ':', (size_t)(eol - line));
+        if (!colon) continue;
+        const char* v = colon + 1;
+        while (v < eol && (*v == ' ' || *v == '\t')) v++;
+        const char* ve = eol;
+        while (ve > v && (ve[-1] == ' ' || ve[-1] == '\t')) ve--;
+        RtspField f;
+        f.p = v;
+        f.len = (uint16_t)(ve - v);
+        const size_t nameLen = (size_t)(colon - line);
+        if (namesEqual(line, nameLen, "CSeq")) cseq = f;
+        else if (namesEqual(line, nameLen, "Transport")) transport = f;
+        else if (namesEqual(line, nameLen, "Session")) session = f;
+        else if (namesEqual(line, nameLen, "Content-Length")) contentLength = f.numberAfter("", 0);
+    }
+    return true;
+}
+
+void RtspWriter::printf(const char* fmt, ...) {
+    if (full) return;
+    va_list ap;
+    va_start(ap, fmt);
+    int n = vsnprintf(buf + len, cap - len, fmt, ap);
+    va_end(ap);
+    if (n < 0 || (size_t)n >= cap - len) { full = true; buf[len] = 0; return; }
+    len += (size_t)n;
+}
+
+void RtspWriter::field(const RtspField &f) {
+    if (full || !f.p) return;
+    if (len + f.len >= cap) { full = true; return; }
+    memcpy(buf + len, f.p, f.len);
+    len += f.len;
+    buf[len] = 0;
+}
+
+void RtspWriter::status(int code, const char* reason, const RtspField &cseq) {
+    printf("RTSP/1.0 %d %s\r\nCSeq: ", code, reason);
+    if (cseq.present() && cseq.len > 0 && cseq.len <= 10) field(cseq);
+    else printf("1");
+    printf("\r\n");
+}
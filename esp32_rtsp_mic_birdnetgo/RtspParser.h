@@ -0,0 +1,70 @@
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+
+// RTSP request parsing and response formatting (ESP32 RTSP Mic for BirdNET-Go)
+// No heap and no sockets: the parser works in place on a session's receive
+// buffer and the writer formats a whole response into one caller buffer, so
+// each reply goes out with a single write.
+
+enum RtspMethod : uint8_t {
+    RTSP_OPTIONS, RTSP_DESCRIBE, RTSP_SETUP, RTSP_PLAY, RTSP_TEARDOWN,
+    RTSP_GET_PARAMETER, RTSP_METHOD_UNKNOWN
+};
+
+// A slice of the receive buffer (not NUL-terminated)
+struct RtspField {
+    const char* p = nullptr;
+    uint16_t len = 0;
+    bool present() const { return p != nullptr; }
+    bool contains(const char* needle) const;
+    // Unsigned decimal after "key" (e.g. "preroll=") or def when absent
+    uint32_t numberAfter(const char* key, uint32_t def) const;
+};
+
+// Incremental parser: call parse() with the unconsumed bytes after each read.
+// It resumes the search for the end of the header block where the previous
+// call stopped, so a request trickling in is not rescanned from the start.
+// Pipelined requests come out one per call; drop consumed() bytes in between.
+class RtspRequestParser {
+public:
+    enum Result : uint8_t {
+        NEED_MORE,      // incomplete message
+        REQUEST,        // request of consumed() bytes; fields below are valid
+        INTERLEAVED,    // '$' frame from the client (RTCP receiver report): skip
+        BAD             // not RTSP: drop the buffer
+    };
+
+    Result parse(const char* buf, size_t len);
+    size_t consumed() const { return msgLen; }
+    void reset() { scanned = 0; msgLen = 0; }
+
+    RtspMethod method = RTSP_METHOD_UNKNOWN;
+    RtspField uri, cseq, transport, session;
+
+private:
+    bool parseHead(const char* buf, size_t start, size_t headEnd, uint32_t &contentLength);
+
+    size_t scanned = 0;         // bytes already searched for the blank line
+    size_t msgLen = 0;
+};
+
+// Response (or any text) formatted into a fixed buffer; overflow() once the
+// text no longer fit, in which case it must not be sent
+class RtspWriter {
+public:
+    RtspWriter(char* buffer, size_t capacity) : buf(buffer), cap(capacity) { if (cap) buf[0] = 0; }
+    void printf(const char* fmt, ...) __attribute__((format(printf, 2, 3)));
+    void field(const RtspField &f);         // append a field verbatim
+    // Status line plus the CSeq of the request it answers
+    void status(int code, const char* reason, const RtspField &cseq);
+    const char* data() const { return buf; }
+    size_t length() const { return len; }
+    bool overflow() const { return full; }
+
+private:
+    char* buf;
+    size_t cap;
+    size_t len = 0;
+    bool full = false;
+};
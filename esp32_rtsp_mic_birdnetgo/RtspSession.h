@@ -0,0 +1,62 @@
+#pragma once
+#include <Arduino.h>
+#include <WiFi.h>
+#include "AudioCodec.h"
+#include "SendQueue.h"
+#include "RtspParser.h"
+
+// RTSP session table (ESP32 RTSP Mic for BirdNET-Go)
+// One capture/DSP pass feeds every playing session; each session keeps its
+// own control connection, RTSP state and RTP counters.
+#define RTSP_MAX_SESSIONS 4
+#define RTSP_PARSE_BUFFER_SIZE 1024
+
+struct RtspSession {
+    bool active = false;             // slot in use (control connection open)
+    bool playing = false;            // PLAY received, receives audio
+    WiFiClient client;
+    IPAddress remoteIP;              // cached at accept (safe to read from Web UI)
+    char sessionId[12] = "";         // empty until SETUP
+
+    // Control channel: received bytes not yet parsed into a request
+    uint8_t parseBuffer[RTSP_PARSE_BUFFER_SIZE];
+    int parseBufferPos = 0;
+    bool parseHeld = false;          // complete requests wait for a partly sent packet
+    RtspRequestParser parser;
+
+    // RTP state
+    uint16_t rtpSequence = 0;
+    uint32_t rtpTimestamp = 0;
+
+    // Stream position (absolute sample index, see AudioBlock::sampleIndex).
+    // While replaying, packets come from the pre-roll until it catches up live.
+    bool replaying = false;
+    bool synced = false;             // nextSampleIndex valid
+    uint32_t nextSampleIndex = 0;
+    ImaAdpcmState replayAdpcm;       // DVI4 state of replayed packets
+    uint16_t prerollRequestSec = 0;  // "?preroll=<s>" from a request URL (clients PLAY on Content-Base)
+
+    // Activity gating: in a silence (comfort noise) since the last audio packet
+    bool inSilence = false;
+    unsigned long lastComfortNoiseMs = 0;
+
+    // Transport: interleaved TCP or UDP to client_port=
+    bool overUdp = false;
+    uint16_t udpRtpPort = 0;
+    uint16_t udpRtcpPort = 0;
+    PacketQueue txQueue;             // TCP: packets the socket could not take yet
+    bool txQueueRefit = false;       // packet size changed live: the network task resizes txQueue
+
+    // Timing and statistics
+    unsigned long lastActivityMs = 0;
+    unsigned long connectedAtMs = 0;
+    unsigned long playStartedMs = 0;
+    unsigned long lastSenderReportMs = 0;
+    uint32_t packets = 0;             // RTP packets since PLAY (RTCP SR counts)
+    uint32_t octets = 0;              // RTP payload octets since PLAY
+    uint64_t bytesSent = 0;           // wire bytes since PLAY
+    uint32_t drops = 0;               // blocks not delivered to this session
+    uint32_t queueDrops = 0;          // of those: dropped from a full send queue
+};
+
+extern RtspSession rtspSessions[RTSP_MAX_SESSIONS];
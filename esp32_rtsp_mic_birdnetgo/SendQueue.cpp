@@ -0,0 +1,102 @@
+#include "SendQueue.h"
+#include <string.h>
+
+bool PacketQueue::begin(uint8_t packets, uint16_t maxPacketBytes) {
+    end();
+    if (packets < 2) packets = 2;
+    if (packets > MAX_PACKETS) packets = MAX_PACKETS;
+    arena = (uint8_t*)malloc((size_t)packets * maxPacketBytes);
+    if (!arena) return false;
+    slots = packets;
+    slotBytes = maxPacketBytes;
+    return true;
+}
+
+void PacketQueue::end() {
+    if (arena) { free(arena); arena = nullptr; }
+    slots = 0;
+    slotBytes = 0;
+    clear();
+}
+
+bool PacketQueue::resize(uint8_t packets, uint16_t maxPacketBytes, uint8_t &dropped) {
+    dropped = 0;
+    if (!arena) return begin(packets, maxPacketBytes);
+    if (packets < 2) packets = 2;
+    if (packets > MAX_PACKETS) packets = MAX_PACKETS;
+    // The rest of a started packet must go out whatever the new size
+    if (midPacket() && lens[0] > maxPacketBytes) maxPacketBytes = lens[0];
+    uint8_t* fresh = (uint8_t*)malloc((size_t)packets * maxPacketBytes);
+    if (!fresh) return false;
+    uint8_t fitting = 0;
+    for (uint8_t i = 0; i < count; ++i) if (lens[i] <= maxPacketBytes) fitting++;
+    uint8_t excess = (fitting > packets) ? (uint8_t)(fitting - packets) : 0;
+    uint8_t n = 0;
+    uint16_t kept[MAX_PACKETS];
+    for (uint8_t i = 0; i < count; ++i) {
+        const bool pinned = (i == 0 && started);
+        if (!pinned && (lens[i] > maxPacketBytes || excess > 0)) {
+            if (lens[i] <= maxPacketBytes) excess--;
+            dropped++;
+            continue;
+        }
+        memcpy(fresh + (size_t)n * maxPacketBytes, arena + (size_t)order[i] * slotBytes, lens[i]);
+        kept[n++] = lens[i];
+    }
+    free(arena);
+    arena = fresh;
+    slots = packets;
+    slotBytes = maxPacketBytes;
+    count = n;
+    for (uint8_t i = 0; i < n; ++i) { order[i] = i; lens[i] = kept[i]; }
+    if (n == 0) { sentOff = 0; started = false; }
+    return true;
+}
+
+void PacketQueue::popFront() {
+    count--;
+    memmove(order, order + 1, count);
+    memmove(lens, lens + 1, count * sizeof(lens[0]));
+    sentOff = 0;
+    started = false;
+}
+
+uint8_t PacketQueue::push(const uint8_t* data, uint16_t len, bool startedOnWire) {
+    if (!arena || len > slotBytes || (startedOnWire && count > 0)) return 1;
+    uint8_t dropped = 0;
+    if (count == slots) {
+        // Oldest droppable packet: the front, unless it is partly written
+        const uint8_t victim = started ? 1 : 0;
+        const uint8_t freed = order[victim];
+        count--;
+        memmove(order + victim, order + victim + 1, count - victim);
+        memmove(lens + victim, lens + victim + 1, (count - victim) * sizeof(lens[0]));
+        order[count] = freed;
+        if (victim == 0) sentOff = 0;
+        dropped = 1;
+    } else {
+        // First arena slot no queued packet uses
+        uint8_t used[MAX_PACKETS] = {0};
+        for (uint8_t i = 0; i < count; ++i) used[order[i]] = 1;
+        uint8_t s = 0;
+        while (used[s]) s++;
+        order[count] = s;
+    }
+    memcpy(arena + (size_t)order[count] * slotBytes, data, len);
+    lens[count] = len;
+    if (count == 0) { sentOff = 0; started = startedOnWire; }
+    count++;
+    return dropped;
+}
+
+void PacketQueue::consume(uint16_t n) {
+    if (count == 0) return;
+    sentOff += n;
+    started = true;
+    if (sentOff >= lens[0]) popFront();
+}
+
+void PacketQueue::dropUnstarted() {
+    count = midPacket() ? 1 : 0;
+    if (count == 0) { sentOff = 0; started = false; }
+}
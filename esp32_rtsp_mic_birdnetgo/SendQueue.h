@@ -0,0 +1,52 @@
+#pragma once
+#include <stdint.h>
+#include <stdlib.h>
+
+// Bounded per-session queue of outgoing TCP packets (ESP32 RTSP Mic for BirdNET-Go)
+// Holds whole interleaved RTP packets the socket could not take yet. Packets
+// carry their own RTP sequence number and timestamp, so dropping one leaves a
+// sequence gap for the receiver and never shifts the audio clock. The front
+// packet may be partly on the wire; it is never dropped (that would break the
+// interleaved framing) and no RTSP reply may be written until it is finished.
+class PacketQueue {
+public:
+    static const uint8_t MAX_PACKETS = 16;
+
+    bool begin(uint8_t packets, uint16_t maxPacketBytes);   // one arena, packets >= 2
+    void end();
+    // New arena for another packet size, queued packets kept in order (a partly
+    // written front packet always; others while they fit, the oldest unstarted
+    // dropped first). false when out of memory: the old queue stays.
+    bool resize(uint8_t packets, uint16_t maxPacketBytes, uint8_t &dropped);
+    bool active() const { return arena != nullptr; }
+
+    // Append a packet (started: its first bytes were already written). When
+    // full, the oldest packet not yet started is dropped to make room.
+    // Returns the number of packets dropped (the new one, if it cannot fit).
+    uint8_t push(const uint8_t* data, uint16_t len, bool started);
+
+    bool empty() const { return count == 0; }
+    uint8_t size() const { return count; }
+    uint8_t capacity() const { return slots; }
+    bool midPacket() const { return count > 0 && started; }
+
+    // Unsent bytes of the oldest packet; consume() what the socket took
+    const uint8_t* frontData() const { return arena + (size_t)order[0] * slotBytes + sentOff; }
+    uint16_t frontRemaining() const { return lens[0] - sentOff; }
+    void consume(uint16_t n);
+
+    void dropUnstarted();   // keep only a partly written front packet
+    void clear() { count = 0; sentOff = 0; started = false; }
+
+private:
+    void popFront();
+
+    uint8_t* arena = nullptr;
+    uint16_t slotBytes = 0;
+    uint8_t slots = 0;
+    uint8_t count = 0;
+    uint8_t order[MAX_PACKETS];      // arena slot of each queued packet, oldest first
+    uint16_t lens[MAX_PACKETS];      // packet length, same order
+    uint16_t sentOff = 0;            // bytes of the front packet already written
+    bool started = false;            // front packet partly written
+};
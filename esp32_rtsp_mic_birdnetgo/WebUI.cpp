@@ -1,21 +1,41 @@
 #include <Arduino.h>
 #include <math.h>
+#include <stdarg.h>
 #include <WiFi.h>
 #include <WebServer.h>
+#include <SD.h>
 #include "WebUI.h"
+#include "AudioRing.h"
+#include "RtspSession.h"
+#include "AudioCodec.h"
+#include "AudioDSP.h"
+#include "AudioPreroll.h"
+#include "WebUI_index.h"
+#include "Metrics.h"
+#include "AudioBench.h"
+#include "CongestionControl.h"
+#include "ActivityDetector.h"
+#include "LogRing.h"
+#include "PowerSchedule.h"
+#include "AudioSpectrum.h"
+#include "RecordRing.h"
+#include "ClockDrift.h"
 
 // External variables and functions from main (.ino) – ESP32 RTSP Mic for BirdNET-Go
-extern WiFiServer rtspServer;
-extern WiFiClient rtspClient;
 extern volatile bool isStreaming;
-extern uint16_t rtpSequence;
-extern uint32_t rtpTimestamp;
 extern unsigned long lastStatsReset;
 extern unsigned long lastRtspPlayMs;
 extern uint32_t rtspPlayCount;
+extern uint32_t rtspConnectCount;
+extern uint32_t audioPacketsSentTotal;
+extern uint32_t i2sRestartCount;
+extern LatencyHistogram histI2sWait;
+extern LatencyHistogram histDspBlock;
+extern LatencyHistogram histRtpSend;
+extern LatencyHistogram histStreamFanout;
+extern LatencyHistogram histMelFrame;
 extern unsigned long lastRtspClientConnectMs;
 extern unsigned long bootTime;
-extern unsigned long lastRTSPActivity;
 extern unsigned long lastWiFiCheck;
 extern unsigned long lastTempCheck;
 extern uint32_t minFreeHeap;
@@ -52,6 +72,82 @@ extern bool overheatSensorFault;
 extern float lastTemperatureC;
 extern bool lastTemperatureValid;
 extern bool overheatLatched;
+extern volatile uint32_t audioRingOverruns;
+extern volatile uint32_t audioRingUnderruns;
+extern AudioBlockRing audioRing;
+extern float dspCyclesPerSample;
+extern const char* DSP_KERNEL_STR;
+extern uint64_t rtpBytesSent;
+extern uint32_t rtpWriteCalls;
+extern uint32_t rtpPacketsTotal;
+extern uint8_t rtspActiveSessions;
+extern AudioCodecId currentCodec;
+extern float codecCyclesPerSample;
+extern bool highpassEnabled;
+extern const uint8_t CPU_MHZ_CANDIDATES[];
+extern const uint8_t CPU_MHZ_CANDIDATE_COUNT;
+extern bool benchmarkPipeline(int samples, BenchStages &out);
+extern float benchSendCyclesPerSample();
+extern bool abrEnabled;
+extern uint8_t abrLevel;
+extern uint8_t abrLevelCount;
+extern uint32_t abrTransitions;
+extern volatile uint32_t rtpWriteStalls;
+extern uint32_t rtpQueueDrops;
+extern CongestionController abrController;
+extern bool abrRestoreConfigured();
+extern void abrBuildLadder();
+extern bool activityGateEnabled;
+extern uint8_t activityThresholdDb;
+extern uint16_t activityHangoverSec;
+extern ActivityDetector activityDetector;
+extern volatile bool activityGated;
+extern ActivityHour activityHours[ACTIVITY_HOURS];
+extern uint32_t activityHour;
+extern uint64_t activityActiveSamplesTotal;
+extern uint32_t comfortNoisePackets;
+extern void activityConfigure();
+extern uint32_t captureSampleRate;
+extern uint32_t i2sCaptureRate;
+extern float srcCyclesPerSample;
+extern uint8_t packetTimeMs;
+extern uint16_t rtpPacketSamples();
+extern volatile uint32_t i2sRxDoneEvents;
+extern volatile uint32_t i2sRxOverflows;
+extern volatile uint32_t i2sDmaErrors;
+extern uint32_t i2sEventTimeouts;
+extern uint32_t rtspRejectedCount;
+extern void rtspStopAllStreams();
+extern uint32_t udpSendErrors;
+extern uint32_t rtcpReportsSent;
+extern uint32_t rtcpReportsReceived;
+extern ClockDrift i2sClockDrift;
+extern uint32_t clockDriftRestarts;
+extern uint32_t ntpSyncCount;
+extern float ntpTimerDriftPpm;
+extern bool ntpTimerDriftValid;
+extern PrerollBuffer preroll;
+extern uint16_t prerollSeconds;
+extern uint32_t prerollReplayedPackets;
+extern bool powerScheduleEnabled;
+extern PowerSchedule powerSchedule;
+extern char powerTimezone[];
+extern volatile bool powerIdle;
+extern bool powerLightSleep;
+extern uint32_t powerIdleEntries;
+extern uint32_t powerNextChangeS;
+extern bool powerTimeValid();
+extern float powerEstimateMa();
+extern float powerAverageMa();
+extern float powerDutyPercent();
+extern bool setPowerWindows(const char* spec);
+extern bool setPowerTimezone(const char* tz);
+extern bool wifiStaticFromLease;
+extern bool wifiFastConnected;
+extern uint32_t bootCaptureMs;
+extern uint32_t bootWifiMs;
+extern uint32_t bootRtspReadyMs;
+extern uint32_t bootFirstPacketMs;
 
 // Local helper: snap requested Wi‑Fi TX power (dBm) to nearest supported step
 static float snapWifiTxDbm(float dbm) {
@@ -82,38 +178,74 @@ static void rebootTask(void* arg){
 
 // Helper functions in main
 extern float wifiPowerLevelToDbm(wifi_power_t lvl);
-extern String formatUptime(unsigned long seconds);
-extern String formatSince(unsigned long eventMs);
+extern size_t formatUptimeTo(char* out, size_t n, unsigned long seconds);
+extern size_t formatSinceTo(char* out, size_t n, unsigned long eventMs);
 extern void restartI2S();
+extern void resizeAudioBuffers();
+extern uint8_t micMode;
+extern int8_t beamDelaySamples;
+extern uint8_t streamChannels();
+extern const char* micModeName(uint8_t mode);
+extern bool setMicMode(const char* name);
+extern void setBeamDelay(int samples);
+extern uint8_t melMode;
+extern MelSpectrum melSpectrum;
+extern uint32_t melFramesTotal;
+extern bool melSupported();
+extern const char* melModeName(uint8_t mode);
+extern bool setMelMode(const char* name);
+extern uint8_t recordMode;
+extern uint16_t recordMaxMb;
+extern RecordRing recordRing;
+extern SemaphoreHandle_t recordMutex;
+extern uint64_t recordCardBytes;
+extern volatile uint32_t recordServingSeq;
+extern uint32_t recordLostSamples;
+extern uint32_t recordSegmentsTotal;
+extern uint64_t recordBytesTotal;
+extern uint32_t recordWriteUsMax;
+extern bool recordSupported();
+extern const char* recordModeName(uint8_t mode);
+extern const char* recordStateName();
+extern uint64_t recordBudgetBytes();
+extern size_t recordPath(char* out, size_t n, uint32_t seq, uint32_t startUtc);
+extern bool recordSegmentOpen(uint32_t seq);
+extern bool setRecordMode(const char* name);
 extern void saveAudioSettings();
+extern bool settingsDirty;
+extern uint32_t settingsCommits;
+extern uint32_t audioCrossfades;
+extern uint32_t audioLiveResizes;
+extern uint32_t settingsKeysWritten;
 extern void applyWifiTxPower(bool log);
 extern const char* FW_VERSION_STR;
 
-// Web server and in-memory log ring buffer
+// Web server and in-memory log ring (fixed arena; SSE clients and
+// /api/logs?since= keep a cursor into its sequence numbers)
 static WebServer web(80);
-static const size_t LOG_CAP = 80;
-static String logBuffer[LOG_CAP];
-static size_t logHead = 0;
-static size_t logCount = 0;
+static LogRing logRing;
+// Logs arrive from loop() and from the audio/network tasks
+static SemaphoreHandle_t logMutex = nullptr;
 
-void webui_pushLog(const String &line) {
-    logBuffer[logHead] = line;
-    logHead = (logHead + 1) % LOG_CAP;
-    if (logCount < LOG_CAP) logCount++;
+void webui_pushLog(const char* line, size_t len) {
+    if (!logMutex) logMutex = xSemaphoreCreateMutex();
+    xSemaphoreTake(logMutex, portMAX_DELAY);
+    logRing.push(line, len);
+    xSemaphoreGive(logMutex);
 }
 
-static String jsonEscape(const String &s) {
-    String o; o.reserve(s.length()+8);
-    for (size_t i=0;i<s.length();++i){char c=s[i]; if(c=='"'||c=='\\'){o+='\\';o+=c;} else if(c=='\n'){o+="\\n";} else {o+=c;}}
-    return o;
+void webui_pushLog(const char* line) {
+    webui_pushLog(line, strlen(line));
 }
 
-static String profileName(uint16_t buf) {
-    // Server-side fallback (English). UI localizes on client by buffer size.
-    if (buf <= 256) return F("Ultra-Low Latency (Higher CPU, May have dropouts)");
-    if (buf <= 512) return F("Balanced (Moderate CPU, Good stability)");
-    if (buf <= 1024) return F("Stable Streaming (Lower CPU, Excellent stability)");
-    return F("High Stability (Lowest CPU, Maximum stability)");
+void webui_pushLogf(const char* fmt, ...) {
+    char line[LogRing::MAX_LINE + 1];
+    va_list ap;
+    va_start(ap, fmt);
+    int n = vsnprintf(line, sizeof(line), fmt, ap);
+    va_end(ap);
+    if (n < 0) return;
+    webui_pushLog(line, ((size_t)n < sizeof(line)) ? (size_t)n : sizeof(line) - 1);
 }
 
 static void apiSendJSON(const String &json) {
@@ -121,271 +253,504 @@ static void apiSendJSON(const String &json) {
     web.send(200, "application/json", json);
 }
 
-// HTML UI
-static String htmlIndex() {
-    String ip = WiFi.localIP().toString();
-    String h;
-    h += F(
-        "<!doctype html><html><head><meta charset='utf-8'>"
-        "<meta name='viewport' content='width=device-width,initial-scale=1'>"
-        "<title>ESP32 RTSP Mic for BirdNET-Go</title>"
-        "<style>:root{--bg:#0b1020;--fg:#e7ebf2;--muted:#9aa3b2;--card:#121a2e;--border:#1b2745;--acc:#4ea1f3;--acc2:#36d399;--warn:#f59e0b;--bad:#ef4444}"
-        "body{font-family:system-ui,Segoe UI,Roboto,Arial,sans-serif;margin:0;background:linear-gradient(180deg,#0b1020 0%,#0f1530 100%);color:var(--fg)}"
-        ".page{max-width:1000px;margin:0 auto;padding:16px}"
-        ".hero{display:flex;justify-content:space-between;align-items:center;margin-bottom:12px}"
-        ".brand{display:flex;align-items:center;gap:10px;flex-wrap:wrap}"
-        ".title{font-weight:700;font-size:18px;letter-spacing:.2px} .subtitle{color:var(--muted);font-size:13px}"
-        ".badge{display:inline-block;border:1px solid var(--border);color:var(--muted);padding:2px 6px;border-radius:8px;font-size:12px;margin-left:8px}"
-        ".card{background:var(--card);border:1px solid var(--border);border-radius:12px;padding:12px;margin-bottom:12px;box-shadow:0 1px 1px rgba(0,0,0,.2)}"
-        ".row{display:grid;grid-template-columns:repeat(auto-fit,minmax(320px,1fr));gap:12px} h1{font-size:20px;margin:0 0 4px} h2{font-size:15px;margin:4px 0 10px;color:var(--muted);font-weight:600;letter-spacing:.2px}"
-        "table{width:100%;border-collapse:collapse} td{padding:8px 6px;border-bottom:1px solid var(--border)} td.k{color:var(--muted);width:44%} td.v{font-weight:600}"
-        "button,select,input{font:inherit;padding:8px 10px;border-radius:10px;border:1px solid var(--border);background:#0d1427;color:var(--fg)}"
-        "button{background:#0e152a} button:hover{border-color:var(--acc)} button.active{background:var(--acc);color:#061120;border-color:#2a7dd4}"
-        ".actions{display:flex;flex-wrap:wrap;gap:8px;margin-top:8px} .ok{color:var(--acc2)} .warn{color:var(--warn)} .bad{color:var(--bad)} .lang{float:right} .mono{font-family:ui-monospace,Consolas,Menlo,monospace}"
-        "input[type=number]{width:130px} select{min-width:110px} .muted{color:var(--muted)}"
-        ".field{display:flex;align-items:center;gap:8px} .unit{color:var(--muted);font-size:12px} .help{display:inline-flex;align-items:center;justify-content:center;width:16px;height:16px;border:1px solid var(--acc);border-radius:50%;font-size:12px;color:var(--fg);margin-left:6px;background:#0a1224;cursor:pointer} .help:hover{filter:brightness(1.1)} .hint{margin-top:6px;padding:8px;border:1px solid var(--border);border-radius:8px;background:#0d162c;color:var(--fg);font-size:12px;line-height:1.35}"
-        ".dirty{border-color:var(--bad)!important; box-shadow:0 0 0 2px rgba(239,68,68,.25) inset; background:#1a0d12}"
-        ".gh{margin-right:10px;color:var(--acc);text-decoration:none;border:1px solid var(--border);padding:4px 8px;border-radius:8px} .gh:hover{border-color:var(--acc)}"
-        "pre{white-space:pre-wrap;word-break:break-word;background:#0c1325;border:1px solid var(--border);border-radius:10px;padding:10px;overflow:auto} pre#logs{height:45vh}"
-        ".overlay{position:fixed;inset:0;display:none;align-items:center;justify-content:center;background:rgba(0,0,0,.6);z-index:9999} .overlay .box{background:var(--card);border:1px solid var(--border);padding:16px 20px;border-radius:12px;color:var(--fg);text-align:center;min-width:260px}"
-        "</style></head><body>"
-        "<div id='ovr' class='overlay'><div class='box' id='ovr_msg'>Restarting…</div></div>"
-        "<div class='page'>"
-        "<div class='card'><div class='hero'><div><div class='brand'><div class='title' id='t_title'>ESP32 RTSP Mic for BirdNET-Go</div><span class='badge' id='fwv'></span></div><div class='subtitle'>URL: <a id='rtsp' class='mono' href='rtsp://");
-    h += ip;
-    h += F(
-        ":8554/audio' target='_blank'>rtsp://");
-    h += ip;
-    h += F(
-        ":8554/audio</a></div></div>"
-        "<div class='lang'><a href='https://github.com/Sukecz/birdnetgo-esp32-rtsp-mic' target='_blank' class='gh'>GitHub</a>Lang: <select id='langSel'><option value='en'>English</option><option value='cs'>Čeština</option></select></div></div></div>"
-        "<div class='row'>"
-        "<div class='card'><h2 id='t_status'>Status</h2><table>"
-        "<tr><td class='k' id='t_ip'>IP Address</td><td class='v' id='ip'></td></tr>"
-        "<tr><td class='k' id='t_wifi_rssi'>WiFi RSSI</td><td class='v' id='rssi'></td></tr>"
-        "<tr><td class='k' id='t_wifi_tx'>WiFi TX Power</td><td class='v' id='wtx'></td></tr>"
-        "<tr><td class='k' id='t_heap'>Free Heap (min)</td><td class='v' id='heap'></td></tr>"
-        "<tr><td class='k' id='t_uptime'>Uptime</td><td class='v' id='uptime'></td></tr>"
-        "<tr><td class='k' id='t_rtsp_server'>RTSP Server</td><td class='v' id='srv'></td></tr>"
-        "<tr><td class='k' id='t_client'>Client</td><td class='v' id='client'></td></tr>"
-        "<tr><td class='k' id='t_streaming'>Streaming</td><td class='v' id='stream'></td></tr>"
-        "<tr><td class='k' id='t_pkt_rate'>Packet Rate</td><td class='v' id='rate'></td></tr>"
-        "<tr><td class='k' id='t_last_connect'>Last RTSP Connect</td><td class='v' id='lcon'></td></tr>"
-        "<tr><td class='k' id='t_last_play'>Last Stream Start</td><td class='v' id='lplay'></td></tr>"
-        "</table><div class='actions'>"
-        "<button onclick=\"act('server_start')\" id='b_srv_on'>Server ON</button>"
-        "<button onclick=\"act('server_stop')\" id='b_srv_off'>Server OFF</button>"
-        "<button onclick=\"act('reset_i2s')\" id='b_reset'>Reset I2S</button>"
-        "<button onclick=\"rebootNow()\" id='b_reboot'>Reboot</button>"
-        "<button onclick=\"defaultsNow()\" id='b_defaults'>Defaults</button>"
-        "<div id='adv' class='footer muted'></div></div>"
-
-        "<div class='card'><h2 id='t_audio'>Audio</h2><table>"
-        "<tr><td class='k'><span id='t_rate'>Sample Rate</span><span class='help' id='h_rate'>?</span><div class='hint' id='rate_hint' style='display:none'></div></td><td class='v'><div class='field'><input id='in_rate' type='number' step='1000' min='8000' max='96000'><span class='unit'>Hz</span><button id='btn_rate_set' onclick=\"setv('rate',in_rate.value)\">Set</button></div></td></tr>"
-        "<tr id='row_rate_hint' style='display:none'><td colspan='2'><div class='hint' id='txt_rate_hint'></div></td></tr>"
-        "<tr><td class='k'><span id='t_gain'>Gain</span><span class='help' id='h_gain'>?</span></td><td class='v'><div class='field'><input id='in_gain' type='number' step='0.1' min='0.1' max='100'><span class='unit'>×</span><button id='btn_gain_set' onclick=\"setv('gain',in_gain.value)\">Set</button></div></td></tr>"
-        "<tr id='row_gain_hint' style='display:none'><td colspan='2'><div class='hint' id='txt_gain_hint'></div></td></tr>"
-        "<tr><td class='k'><span id='t_hpf'>High-pass</span><span class='help' id='h_hpf'>?</span></td><td class='v'><div class='field'><select id='sel_hp'><option value='off'>OFF</option><option value='on'>ON</option></select><button onclick=\"setv('hp_enable',sel_hp.value)\">Set</button></div></td></tr>"
-        "<tr id='row_hpf_hint' style='display:none'><td colspan='2'><div class='hint' id='txt_hpf_hint'></div></td></tr>"
-        "<tr><td class='k'><span id='t_hpf_cut'>HPF Cutoff</span><span class='help' id='h_hpf_cut'>?</span></td><td class='v'><div class='field'><input id='in_hp_cutoff' type='number' step='10' min='10' max='10000'><span class='unit'>Hz</span><button onclick=\"setv('hp_cutoff',in_hp_cutoff.value)\">Set</button></div></td></tr>"
-        "<tr id='row_hpf_cut_hint' style='display:none'><td colspan='2'><div class='hint' id='txt_hpf_cut_hint'></div></td></tr>"
-        "<tr><td class='k'><span id='t_buf'>Buffer Size</span><span class='help' id='h_buf'>?</span></td><td class='v'><div class='field'>"
-        "<select id='sel_buf'><option>256</option><option>512</option><option selected>1024</option><option>2048</option><option>4096</option><option>8192</option></select>"
-        "<span class='unit'>samples</span><button id='btn_buf_set' onclick=\"setv('buffer',sel_buf.value)\">Set</button></div></td></tr>"
-        "<tr id='row_buf_hint' style='display:none'><td colspan='2'><div class='hint' id='txt_buf_hint'></div></td></tr>"
-        "<tr><td class='k' id='t_latency'>Latency</td><td class='v' id='lat'></td></tr>"
-        "<tr><td class='k'><span id='t_level'>Signal Level</span><span class='help' id='h_level'>?</span></td><td class='v' id='level'></td></tr>"
-        "<tr id='row_level_hint' style='display:none'><td colspan='2'><div class='hint' id='txt_level_hint'></div></td></tr>"
-        "<tr><td class='k' id='t_profile'>Profile</td><td class='v' id='profile'></td></tr>"
-        "</table></div>"
-
-        "<div class='card'><h2 id='t_perf'>Reliability</h2><table>"
-        "<tr><td class='k'><span id='t_auto'>Auto Recovery</span><span class='help' id='h_auto'>?</span></td><td class='v'><div class='field'><select id='in_auto'><option value='on'>ON</option><option value='off'>OFF</option></select><button id='btn_auto_set' onclick=\"setv('auto_recovery',in_auto.value)\">Set</button></div></td></tr>"
-        "<tr id='row_auto_hint' style='display:none'><td colspan='2'><div class='hint' id='txt_auto_hint'></div></td></tr>"
-        "<tr><td class='k'><span id='t_thr_mode'>Threshold Mode</span><span class='help' id='h_thr_mode'>?</span></td><td class='v'><div class='field'><select id='in_thr_mode'><option value='auto'>Auto</option><option value='manual'>Manual</option></select><button id='btn_thrmode_set' onclick=\"setv('thr_mode',in_thr_mode.value)\">Set</button></div></td></tr>"
-        "<tr id='row_thrmode_hint' style='display:none'><td colspan='2'><div class='hint' id='txt_thr_mode_hint'></div></td></tr>"
-        "<tr id='row_thr_hint' style='display:none'><td colspan='2'><div class='hint' id='txt_thr_hint'></div></td></tr>"
-        "<tr id='row_min_rate'><td class='k'><span id='t_thr'>Restart Threshold</span><span class='help' id='h_thr'>?</span></td><td class='v'><div class='field'><input id='in_thr' type='number' step='1' min='5' max='200'><span class='unit'>pkt/s</span><button id='btn_thr_set' onclick=\"setv('min_rate',in_thr.value)\">Set</button></div></td></tr>"
-        "<tr><td class='k'><span id='t_sched'>Scheduled Reset</span><span class='help' id='h_sched'>?</span></td><td class='v'><div class='field'><select id='in_sched'><option value='on'>ON</option><option value='off' selected>OFF</option></select><button id='btn_sched_set' onclick=\"setv('sched_reset',in_sched.value)\">Set</button></div></td></tr>"
-        "<tr id='row_sched_hint' style='display:none'><td colspan='2'><div class='hint' id='txt_sched_hint'></div></td></tr>"
-        "<tr><td class='k'><span id='t_hours'>Reset After</span><span class='help' id='h_hours'>?</span></td><td class='v'><div class='field'><input id='in_hours' type='number' step='1' min='1' max='168'><span class='unit'>h</span><button id='btn_hours_set' onclick=\"setv('reset_hours',in_hours.value)\">Set</button></div></td></tr>"
-        "<tr id='row_hours_hint' style='display:none'><td colspan='2'><div class='hint' id='txt_hours_hint'></div></td></tr>"
-        "</table></div>"
-
-        ""
-
-        "<div class='card'><h2 id='t_thermal'>Thermal</h2><table>"
-        "<tr><td class='k'><span id='t_therm_protect'>Overheat Protection</span><span class='help' id='h_therm_protect'>?</span></td><td class='v'><div class='field'><select id='sel_oh_enable'><option value='on'>ON</option><option value='off'>OFF</option></select><button id='btn_oh_enable' onclick=\"setv('oh_enable',sel_oh_enable.value)\">Set</button></div></td></tr>"
-        "<tr id='row_therm_hint_protect' style='display:none'><td colspan='2'><div class='hint' id='txt_therm_hint_protect'></div></td></tr>"
-        "<tr><td class='k'><span id='t_therm_limit'>Shutdown Limit</span><span class='help' id='h_therm_limit'>?</span></td><td class='v'><div class='field'><select id='sel_oh_limit'><option>30</option><option>35</option><option>40</option><option>45</option><option>50</option><option>55</option><option>60</option><option>65</option><option>70</option><option>75</option><option selected>80</option><option>85</option><option>90</option><option>95</option></select><span class='unit'>&deg;C</span><button id='btn_oh_limit' onclick=\"setv('oh_limit',sel_oh_limit.value)\">Set</button></div></td></tr>"
-        "<tr id='row_therm_hint_limit' style='display:none'><td colspan='2'><div class='hint' id='txt_therm_hint_limit'></div></td></tr>"
-        "<tr><td class='k' id='t_therm_status'>Status</td><td class='v' id='therm_status'></td></tr>"
-        "<tr><td class='k' id='t_therm_now'>Current Temp</td><td class='v' id='therm_now'></td></tr>"
-        "<tr><td class='k' id='t_therm_max'>Peak Temp</td><td class='v' id='therm_max'></td></tr>"
-"<tr><td class='k' id='t_therm_cpu'>CPU Clock</td><td class='v' id='therm_cpu'></td></tr>"
-"<tr><td class='k'><span id='t_therm_last'>Last Shutdown</span></td><td class='v'><div id='therm_last' class='hint'></div></td></tr>"
-"<tr id='row_therm_latch' style='display:none'><td colspan='2'><div class='hint warn' id='txt_therm_latch'></div><div class='field' style='margin-top:8px'><button id='btn_therm_clear' class='danger' onclick=\"clearThermalLatch()\"></button></div></td></tr>"
-"</table></div>"
-
-        "<div id='advsec'>"
-        "<div class='card'><h2 id='t_advanced_settings'>Advanced Settings</h2><table>"
-#if WEBUI_HAS_SHIFT_BITS
-        "<tr><td class='k'><span id='t_shift'>I2S Shift</span><span class='help' id='h_shift'>?</span></td><td class='v'><div class='field'><input id='in_shift' type='number' step='1' min='0' max='24'><span class='unit'>bits</span><button id='btn_shift_set' onclick=\"setv('shift',in_shift.value)\">Set</button></div></td></tr>"
-        "<tr id='row_shift_hint' style='display:none'><td colspan='2'><div class='hint' id='txt_shift_hint'></div></td></tr>"
-#endif
-        "<tr><td class='k'><span id='t_chk'>Check Interval</span><span class='help' id='h_chk'>?</span></td><td class='v'><div class='field'><input id='in_chk' type='number' step='1' min='1' max='60'><span class='unit'>min</span><button id='btn_chk_set' onclick=\"setv('check_interval',in_chk.value)\">Set</button></div></td></tr>"
-        "<tr id='row_chk_hint' style='display:none'><td colspan='2'><div class='hint' id='txt_chk_hint'></div></td></tr>"
-        "<tr id='row_tx_hint' style='display:none'><td colspan='2'><div class='hint' id='txt_tx_hint'></div></td></tr>"
-        "<tr><td class='k'><span id='t_wifi_tx2'>TX Power</span><span class='help' id='h_tx'>?</span></td><td class='v'><div class='field'>"
-        "<select id='sel_tx'><option>-1.0</option><option>2.0</option><option>5.0</option><option>7.0</option><option>8.5</option><option>11.0</option><option>13.0</option><option selected>15.0</option><option>17.0</option><option>18.5</option><option>19.0</option><option>19.5</option></select>"
-        "<span class='unit'>dBm</span><button id='btn_tx_set' onclick=\"setv('wifi_tx',sel_tx.value)\">Set</button></div></td></tr>"
-        "<tr><td class='k'><span id='t_cpu'>CPU Frequency</span><span class='help' id='h_cpu'>?</span></td><td class='v'><div class='field'>"
-        "<select id='sel_cpu'><option>80</option><option>120</option><option selected>160</option></select><span class='unit'>MHz</span><button id='btn_cpu_set' onclick=\"setv('cpu_freq',sel_cpu.value)\">Set</button></div></td></tr>"
-        "<tr id='row_cpu_hint' style='display:none'><td colspan='2'><div class='hint' id='txt_cpu_hint'></div></td></tr>"
-        "</table></div>"
-        "</div>"
-
-        "<div class='card'><h2 id='t_logs'>Logs</h2><pre id='logs' class='mono'></pre></div>"
-
-        "</div>"
-        "</div>"
-        "<script>"
-"const T={en:{title:'ESP32 RTSP Mic for BirdNET-Go',status:'Status',ip:'IP Address',wifi_rssi:'WiFi RSSI',wifi_tx:'WiFi TX Power',heap:'Free Heap (min)',uptime:'Uptime',rtsp_server:'RTSP Server',client:'Client',streaming:'Streaming',pkt_rate:'Packet Rate',last_connect:'Last RTSP Connect',last_play:'Last Stream Start',audio:'Audio',rate:'Sample Rate',gain:'Gain',buf:'Buffer Size',latency:'Latency',profile:'Profile',perf:'Reliability',auto:'Auto Recovery',wifi:'WiFi',wifi_tx2:'TX Power (dBm)',thermal:'Thermal',logs:'Logs',bsrvon:'Server ON',bsrvoff:'Server OFF',breset:'Reset I2S',breboot:'Reboot',bdefaults:'Defaults',confirm_reboot:'Restart device now?',confirm_reset:'Reset to defaults and reboot?',restarting:'Restarting device…',resetting:'Restoring defaults and rebooting…',advanced_settings:'Advanced Settings',shift:'I2S Shift',thr:'Restart Threshold',chk:'Check Interval',thr_mode:'Threshold Mode',auto_m:'Auto',manual_m:'Manual',sched:'Scheduled Reset',hours:'Reset After',cpu:'CPU Frequency',set:'Set',profile_ultra:'Ultra-Low Latency (Higher CPU, May have dropouts)',profile_balanced:'Balanced (Moderate CPU, Good stability)',profile_stable:'Stable Streaming (Lower CPU, Excellent stability)',profile_high:'High Stability (Lowest CPU, Maximum stability)',help_rate:'Higher sample-rate = more detail, more bandwidth.',help_gain:'Amplifies audio after I²S shift; too high clips.',help_buf:'More samples per packet = higher latency, more stability.',help_auto:'Auto-restarts the pipeline when packet-rate collapses.',help_tx:'Wi‑Fi TX power; lowering can reduce RF noise.',help_shift:'Digital right shift applied before scaling.',help_thr:'Minimum packet-rate before auto-recovery triggers.',help_chk:'How often performance is checked.',help_sched:'Periodic device restart for stability.',help_hours:'Interval between scheduled restarts.',help_cpu:'Lower MHz = cooler, higher latency possible.',therm_protect:'Overheat Protection',therm_limit:'Shutdown Limit',therm_status:'Status',therm_now:'Current Temp',therm_max:'Peak Temp',therm_cpu:'CPU Clock',therm_last:'Last Shutdown',therm_status_ready:'Protection ready',therm_status_disabled:'Protection disabled',therm_status_latched:'Cooling required – restart manually',therm_status_sensor_fault:'Sensor unavailable – protection paused',therm_status_latched_persist:'Protection latched — acknowledge to re-enable',therm_hint:'80 °C suits most ESP32 boards; drop to 70–75 °C for sealed enclosures.',therm_last_none:'No shutdown recorded yet.',therm_last_fmt:'Stopped at %TEMP% °C (limit %LIMIT% °C) after %TIME% uptime (%AGO%).',therm_last_sensor_fault:'Thermal protection disabled: temperature sensor unavailable.',therm_latch_notice:'Thermal shutdown latched the RTSP server. Confirm only after hardware cools down.',therm_clear_btn:'Acknowledge & re-enable RTSP',therm_time_unknown:'unknown time',therm_time_ago_unknown:'just now',help_therm_protect:'Automatically stops streaming when the ESP32 exceeds the limit to protect the board and microphone preamp.',help_therm_limit:'Temperature threshold for thermal shutdown. 80 °C is a safe default; use 70–75 °C if airflow is poor.'},cs:{title:'ESP32 RTSP Mic pro BirdNET-Go',status:'Stav',ip:'IP adresa',wifi_rssi:'WiFi RSSI',wifi_tx:'WiFi výkon',heap:'Volná RAM (min)',uptime:'Doba běhu',rtsp_server:'RTSP server',client:'Klient',streaming:'Streamování',pkt_rate:'Rychlost paketů',last_connect:'Poslední RTSP připojení',last_play:'Poslední start streamu',audio:'Audio',rate:'Vzorkovací frekvence',gain:'Zisk',buf:'Velikost bufferu',latency:'Latence',profile:'Profil',perf:'Spolehlivost',auto:'Automatická obnova',wifi:'WiFi',wifi_tx2:'TX výkon (dBm)',thermal:'Teplota',logs:'Logy',bsrvon:'Server ZAP',bsrvoff:'Server VYP',breset:'Reset I2S',breboot:'Restart',bdefaults:'Výchozí',confirm_reboot:'Restartovat zařízení nyní?',confirm_reset:'Obnovit výchozí nastavení a restartovat?',restarting:'Zařízení se restartuje…',resetting:'Obnovuji výchozí nastavení a restartuji…',advanced_settings:'Pokročilá nastavení',shift:'I2S posun',thr:'Prahová hodnota restartu',chk:'Interval kontroly',thr_mode:'Režim prahu',auto_m:'Automaticky',manual_m:'Manuálně',sched:'Plánovaný restart',hours:'Po kolika hodinách',cpu:'Frekvence CPU',set:'Nastavit',profile_ultra:'Ultra nízká latence (vyšší zátěž CPU, možné výpadky)',profile_balanced:'Vyvážené (střední zátěž CPU, dobrá stabilita)',profile_stable:'Stabilní stream (nižší zátěž CPU, výborná stabilita)',profile_high:'Vysoká stabilita (nejnižší zátěž CPU, max. stabilita)',help_rate:'Vyšší frekvence = více detailů, větší datový tok.',help_gain:'Zesílení po I²S posunu; příliš vysoké klipuje.',help_buf:'Více vzorků v paketu = vyšší latence, větší stabilita.',help_auto:'Při poklesu rychlosti paketů dojde k obnově.',help_tx:'Výkon vysílače Wi‑Fi; snížení může zlepšit šum.',help_shift:'Digitální bitový posun před škálováním.',help_thr:'Minimální rychlost paketů pro spuštění obnovy.',help_chk:'Jak často se provádí kontrola výkonu.',help_sched:'Pravidelný restart zařízení kvůli stabilitě.',help_hours:'Interval mezi plánovanými restarty.',help_cpu:'Nižší MHz = chladnější, může přidat latenci.',therm_protect:'Ochrana proti přehřátí',therm_limit:'Vypínací teplota',therm_status:'Stav',therm_now:'Aktuální teplota',therm_max:'Maximální teplota',therm_cpu:'Takt CPU',therm_last:'Poslední zásah',therm_status_ready:'Ochrana připravena',therm_status_disabled:'Ochrana vypnuta',therm_status_latched:'Přehřátí – nejprve vychlaďte a spusťte ručně',therm_status_sensor_fault:'Senzor teploty nedostupný – ochrana pozastavena',therm_status_latched_persist:'Ochrana zůstává blokovaná – potvrďte znovuspuštění',therm_hint:'80 °C je bezpečné pro většinu ESP32; v uzavřených krabičkách volte 70–75 °C.',therm_last_none:'Zatím žádné přehřátí.',therm_last_fmt:'Stream vypnut při %TEMP% °C (limit %LIMIT% °C) po %TIME% běhu (%AGO%).',therm_last_sensor_fault:'Tepelná ochrana vypnuta: teplota není k dispozici.',therm_latch_notice:'Tepelná ochrana odstavila RTSP server. Zapínejte až po vychladnutí.',therm_clear_btn:'Potvrdit a znovu povolit RTSP',therm_time_unknown:'neznámý čas',therm_time_ago_unknown:'právě teď',help_therm_protect:'Při překročení limitu zastaví stream, aby chránila desku a předzesilovač.',help_therm_limit:'Teplota, při které se stream vypne. 80 °C vyhoví odkrytým deskám; v teplém prostředí nastavte 70–75 °C.'}};"
-        "const HELP_EXT_EN={hpf:'High-pass', hpf_cut:'HPF Cutoff', help_hpf:'High-pass filter (2nd-order, ~12 dB/oct) removes low-frequency rumble such as distant traffic, wind or handling noise. Turn ON to attenuate frequencies below the cutoff while keeping most bird vocalizations intact.', help_hpf_cut:'Cutoff frequency for the high-pass filter. Typical: 300–800 Hz. Lower values (300–400 Hz) keep more ambience and low calls; higher values (600–800 Hz) strongly reduce road noise. Very high settings may suppress low-pitched species.', help_rate:'How many audio samples per second are captured. Higher rates increase detail and bandwidth and CPU usage. 48 kHz is a safe default; 44.1 kHz is also fine. Very high rates may stress Wi‑Fi and processing.',help_gain:'Software amplification after the I2S shift. Use to boost loudness. Too high causes clipping (distortion). With default shift, 1.0× is neutral. Adjust while watching the stream.',help_buf:'Samples per network packet. Bigger buffer increases latency but improves stability on weak Wi‑Fi; smaller buffer lowers latency but may drop packets. 1024 is a good balance.',help_auto:'When enabled, the device restarts the audio pipeline if packet rate drops below the threshold. Helps recover from glitches without manual intervention.',help_tx:'Wi‑Fi transmit power in dBm. Lower values can reduce RF self-noise near the microphone and power draw, but reduce range. Only specific steps are supported by the radio. Change carefully if your signal is weak.',help_shift:'Right bit-shift applied to 32‑bit I2S samples before converting to 16‑bit. Higher shift lowers volume and avoids clipping; lower shift raises volume but may clip.',help_thr:'Minimum packet rate (packets per second) considered healthy while streaming. If measured rate stays below this at a check, auto recovery restarts I2S. In Auto mode this comes from sample rate and buffer size (about 70% of expected).',help_chk:'How often performance is checked (minutes). Shorter intervals react faster with small CPU cost; longer intervals reduce checks.',help_sched:'Optional periodic device reboot for long-term stability on problematic networks. Leave OFF unless you need it.',help_hours:'Number of hours between scheduled reboots. Applies only when Scheduled Reset is ON.',help_cpu:'Processor clock. Lower MHz reduces heat and power; higher MHz can help under heavy load. 120 MHz is a balanced default.',help_thr_mode:'Auto: Threshold is computed from Sample Rate and Buffer; recommended for most users. Manual: You set the exact minimum packet rate; use if you know your network and latency constraints.', level:'Signal Level', help_level:'Shows the highest peak since last update. Aim for 60–80% (about −4 to −2 dBFS). If it says CLIPPING, increase I2S Shift or reduce Gain. Turning ON the High‑pass (500–600 Hz) often helps.', clip_ok:'OK', clip_warn:'High level — close to clipping (reduce Gain or increase I2S Shift).', clip_bad:'CLIPPING! Increase I2S Shift or reduce Gain; try High‑pass 500–600 Hz.'};"
-        "const HELP_EXT_CS={hpf:'Vysokopropustný filtr', hpf_cut:'Mezní frekvence HPF', help_hpf:'Vysokopropustný filtr (2. řád, ~12 dB/okt.) potlačí nízké frekvence jako vzdálená silnice, vítr nebo manipulační hluk. Zapněte pro zeslabení pásem pod mezní frekvencí a zachování většiny ptačích hlasů.', help_hpf_cut:'Mezní frekvence vysokopropustného filtru. Typicky 300–800 Hz. Nižší hodnoty (300–400 Hz) ponechají více atmosféry a nízkých zvuků; vyšší (600–800 Hz) silněji potlačí silniční hluk. Příliš vysoké nastavení může omezit nízko posazené druhy.', help_rate:'Kolik vzorků za sekundu se pořizuje. Vyšší frekvence zvyšuje detail i nároky na šířku pásma a CPU. 48 kHz je bezpečné výchozí nastavení; 44,1 kHz je také v pořádku. Velmi vysoké frekvence mohou zatěžovat Wi‑Fi a zpracování.',help_gain:'Softwarové zesílení po I2S posunu. 1,0× je neutrální s výchozím posunem. Příliš vysoká hodnota způsobí ořez (zkreslení). Upravujte podle poslechu a spektra.',help_buf:'Počet vzorků v jednom síťovém paketu. Větší buffer zvyšuje latenci a zlepšuje stabilitu na slabším Wi‑Fi; menší buffer snižuje latenci, ale může zvyšovat ztráty paketů. 1024 je dobrý kompromis.',help_auto:'Při poklesu rychlosti odchozích paketů pod práh zařízení automaticky restartuje audio pipeline. Pomáhá zotavit se z výpadků bez zásahu.',help_tx:'Vysílací výkon Wi‑Fi v dBm. Snížení může omezit vlastní RF šum u mikrofonu a spotřebu, ale zmenší dosah. Čip podporuje jen určité kroky. Pokud máte slabý signál, měňte opatrně.',help_shift:'Pravý bitový posun na 32bitových I2S vzorcích před převodem na 16bit audio. Vyšší posun snižuje hlasitost a brání klipování; nižší posun zvyšuje hlasitost, ale může klipovat.',help_thr:'Minimální rychlost paketů (paketů za sekundu), považovaná při streamování za zdravou. Pokud při kontrole klesne pod tuto hodnotu, automatická obnova restartuje I2S. V režimu Auto se práh odvozuje z frekvence a bufferu (asi 70 % očekávané hodnoty).',help_chk:'Jak často se kontroluje výkon (minuty). Kratší interval reaguje rychleji s malou zátěží CPU; delší interval snižuje počet kontrol.',help_sched:'Volitelný pravidelný restart zařízení pro dlouhodobou stabilitu na problematických sítích. Nechte VYP, pokud není nutné.',help_hours:'Počet hodin mezi plánovanými restarty. Platí pouze pokud je Plánovaný restart ZAP.',help_cpu:'Frekvence procesoru. Nižší MHz snižuje zahřívání a spotřebu; vyšší MHz pomůže při zátěži. 120 MHz je vyvážené výchozí nastavení.',help_thr_mode:'Auto: Práh restartu se počítá z Vzorkovací frekvence a Bufferu; doporučeno pro většinu uživatelů. Manuálně: Nastavíte přesný minimální počet paketů za sekundu; použijte, pokud znáte svou síť a požadavky na latenci.', level:'Úroveň signálu', help_level:'Zobrazuje nejvyšší špičku od poslední obnovy. Cíl je 60–80 % (asi −4 až −2 dBFS). Při CLIPPING zvyšte I2S posun nebo snižte Gain. Často pomůže zapnout High‑pass (500–600 Hz).', clip_ok:'OK', clip_warn:'Vysoká úroveň — blízko klipu (snižte Gain nebo zvyšte I2S posun).', clip_bad:'CLIPPING! Zvyšte I2S posun nebo snižte Gain; zkuste High‑pass 500–600 Hz.'};"
-        "Object.assign(T.en, HELP_EXT_EN); Object.assign(T.cs, HELP_EXT_CS);"
-        "let lang=localStorage.getItem('lang')||'en'; const $=id=>document.getElementById(id);"
-"function applyLang(){const L=T[lang]; const st=(id,t)=>{const e=$(id); if(e) e.textContent=t}; const help=(k)=>{const b=L[k]||''; return b}; st('t_title',L.title); st('t_status',L.status); st('t_ip',L.ip); st('t_wifi_rssi',L.wifi_rssi); st('t_wifi_tx',L.wifi_tx); st('t_heap',L.heap); st('t_uptime',L.uptime); st('t_rtsp_server',L.rtsp_server); st('t_client',L.client); st('t_streaming',L.streaming); st('t_pkt_rate',L.pkt_rate); st('t_last_connect',L.last_connect); st('t_last_play',L.last_play); st('t_audio',L.audio); st('t_rate',L.rate); st('t_gain',L.gain); st('t_buf',L.buf); st('t_latency',L.latency); st('t_level',L.level); st('t_profile',L.profile); st('t_perf',L.perf); st('t_auto',L.auto); st('t_wifi',L.wifi); st('t_wifi_tx2',L.wifi_tx2); st('t_thermal',L.thermal); st('t_therm_protect',L.therm_protect); st('t_therm_limit',L.therm_limit); st('t_therm_status',L.therm_status); st('t_therm_now',L.therm_now); st('t_therm_max',L.therm_max); st('t_therm_cpu',L.therm_cpu); st('t_therm_last',L.therm_last); st('t_logs',L.logs); st('b_srv_on',L.bsrvon); st('b_srv_off',L.bsrvoff); st('b_reset',L.breset); st('b_reboot',L.breboot); st('b_defaults',L.bdefaults); st('t_advanced_settings',L.advanced_settings); st('t_shift',L.shift); st('t_thr',L.thr); st('t_chk',L.chk); st('t_thr_mode',L.thr_mode); st('t_sched',L.sched); st('t_hours',L.hours); st('t_cpu',L.cpu); const hm=(id,k)=>{const e=$(id); if(e) e.setAttribute('title',help(k))}; hm('h_rate','help_rate'); hm('h_gain','help_gain'); hm('h_hpf','help_hpf'); hm('h_hpf_cut','help_hpf_cut'); hm('h_buf','help_buf'); hm('h_auto','help_auto'); hm('h_tx','help_tx'); hm('h_thr','help_thr'); hm('h_chk','help_chk'); hm('h_shift','help_shift'); hm('h_sched','help_sched'); hm('h_hours','help_hours'); hm('h_cpu','help_cpu'); hm('h_thr_mode','help_thr_mode'); hm('h_level','help_level'); hm('h_therm_protect','help_therm_protect'); hm('h_therm_limit','help_therm_limit'); st('btn_rate_set',L.set); st('btn_gain_set',L.set); st('btn_buf_set',L.set); st('btn_auto_set',L.set); st('btn_thrmode_set',L.set); st('btn_thr_set',L.set); st('btn_sched_set',L.set); st('btn_hours_set',L.set); st('btn_shift_set',L.set); st('btn_chk_set',L.set); st('btn_tx_set',L.set); st('btn_cpu_set',L.set); st('btn_oh_enable',L.set); st('btn_oh_limit',L.set); const sht=(id,k)=>{const e=$(id); if(e) e.textContent=help(k)}; sht('txt_rate_hint','help_rate'); sht('txt_gain_hint','help_gain'); sht('txt_hpf_hint','help_hpf'); sht('txt_hpf_cut_hint','help_hpf_cut'); sht('txt_buf_hint','help_buf'); sht('txt_auto_hint','help_auto'); sht('txt_thr_hint','help_thr'); sht('txt_thr_mode_hint','help_thr_mode'); sht('txt_sched_hint','help_sched'); sht('txt_hours_hint','help_hours'); sht('txt_shift_hint','help_shift'); sht('txt_chk_hint','help_chk'); sht('txt_tx_hint','help_tx'); sht('txt_cpu_hint','help_cpu'); sht('txt_level_hint','help_level'); sht('txt_therm_hint_protect','help_therm_protect'); sht('txt_therm_hint_limit','help_therm_limit'); st('t_hpf',L.hpf); st('t_hpf_cut',L.hpf_cut); document.title=L.title;}"
-        "function profileText(buf){const L=T[lang]; buf=parseInt(buf,10)||0; if(buf<=256) return L.profile_ultra; if(buf<=512) return L.profile_balanced; if(buf<=1024) return L.profile_stable; return L.profile_high;}"
-        "function fmtBool(b){return b?'<span class=ok>YES</span>':'<span class=bad>NO</span>'}"
-        "function fmtSrv(b){return b?'<span class=ok>ENABLED</span>':'<span class=bad>DISABLED</span>'}"
-        "function showOverlay(msg){ $('ovr_msg').textContent=msg; $('ovr').style.display='flex'; }"
-        "function rebootSequence(kind){ const L=T[lang]; const msg=(kind==='factory_reset')?L.resetting:L.restarting; showOverlay(msg); function tick(){ fetch('/api/status',{cache:'no-store'}).then(r=>{ if(r.ok){ location.reload(); } else { setTimeout(tick,2000); } }).catch(()=>setTimeout(tick,2000)); } setTimeout(tick,4000); }"
-        "function act(a){fetch('/api/action/'+a,{cache:'no-store'}).then(r=>r.json()).then(loadAll)}"
-        "function rebootNow(){ rebootSequence('reboot'); act('reboot'); }"
-        "function defaultsNow(){ rebootSequence('factory_reset'); act('factory_reset'); }"
-        "const locks={}; const edits={};"
-        "function setv(k,v){v=String(v||'').trim().replace(',', '.'); if(v==='')return; locks[k]=Date.now()+5000; delete edits[k]; fetch('/api/set?key='+encodeURIComponent(k)+'&value='+encodeURIComponent(v),{cache:'no-store'}).then(r=>r.json()).then(loadAll)}"
-        "function bindSaver(el,key){if(!el)return; el.addEventListener('keydown',e=>{if(e.key==='Enter'){setv(key,el.value)}})}"
-        "function trackEdit(el,key){if(!el)return; const bump=()=>{edits[key]=Date.now()+10000; toggleDirty(el,key)}; el.addEventListener('input',bump); el.addEventListener('change',bump)}"
-        "function toggleDirty(el,key){ if(!el)return; const now=Date.now(); const d=(edits[key]&&now<edits[key]); el.classList.toggle('dirty', !!d); if(!d){ delete edits[key]; } }"
-        "function setToggleState(on){const onb=$('b_srv_on'), offb=$('b_srv_off'); if(onb&&offb){onb.classList.toggle('active',on); offb.classList.toggle('active',!on); onb.disabled=on; offb.disabled=!on;}}"
-        "function loadStatus(){fetch('/api/status',{cache:'no-store'}).then(r=>r.json()).then(j=>{ $('ip').textContent=j.ip; $('rssi').textContent=j.wifi_rssi+' dBm'; $('wtx').textContent=j.wifi_tx_dbm.toFixed(1)+' dBm'; $('heap').textContent=j.free_heap_kb+' KB ('+j.min_free_heap_kb+' KB)'; $('uptime').textContent=j.uptime; $('srv').innerHTML=fmtSrv(j.rtsp_server_enabled); setToggleState(j.rtsp_server_enabled); $('client').textContent=j.client || 'Waiting...'; $('stream').innerHTML=fmtBool(j.streaming); $('rate').textContent=j.current_rate_pkt_s+' pkt/s'; $('lcon').textContent=j.last_rtsp_connect; $('lplay').textContent=j.last_stream_start; const stx=$('sel_tx'); const now=Date.now(); if(stx){ const editing=(edits['wifi_tx']&&now<edits['wifi_tx']); if(!(locks['wifi_tx']&&now<locks['wifi_tx']) && !editing) stx.value=j.wifi_tx_dbm.toFixed(1); toggleDirty(stx,'wifi_tx'); } const fv=$('fwv'); if(fv && j.fw_version){ fv.textContent='v'+j.fw_version; } })}"
-        "function loadAudio(){fetch('/api/audio_status',{cache:'no-store'}).then(r=>r.json()).then(j=>{ const r=$('in_rate'); const g=$('in_gain'); const sb=$('sel_buf'); const s=$('in_shift'); const hp=$('sel_hp'); const hpc=$('in_hp_cutoff'); const now=Date.now(); if(r){ const editing=(edits['rate']&&now<edits['rate']); if(!(locks['rate']&&now<locks['rate']) && !editing) r.value=j.sample_rate; toggleDirty(r,'rate'); } if(g){ const editing=(edits['gain']&&now<edits['gain']); if(!(locks['gain']&&now<locks['gain']) && !editing) g.value=j.gain.toFixed(2); toggleDirty(g,'gain'); } if(sb){ const editing=(edits['buffer']&&now<edits['buffer']); if(!(locks['buffer']&&now<locks['buffer']) && !editing) sb.value=j.buffer_size; toggleDirty(sb,'buffer'); } if(s){ const editing=(edits['shift']&&now<edits['shift']); if(!(locks['shift']&&now<locks['shift']) && !editing) s.value=j.i2s_shift; toggleDirty(s,'shift'); } if(hp){ const editing=(edits['hp_enable']&&now<edits['hp_enable']); if(!(locks['hp_enable']&&now<locks['hp_enable']) && !editing) hp.value=j.hp_enable?'on':'off'; toggleDirty(hp,'hp_enable'); } if(hpc){ const editing=(edits['hp_cutoff']&&now<edits['hp_cutoff']); if(!(locks['hp_cutoff']&&now<locks['hp_cutoff']) && !editing) hpc.value=j.hp_cutoff_hz; toggleDirty(hpc,'hp_cutoff'); } $('lat').textContent=j.latency_ms.toFixed(1)+' ms'; $('profile').textContent=profileText(j.buffer_size); const L=T[lang]; const lvl=$('level'); if(lvl){ const pct=j.peak_pct||0, db=j.peak_dbfs||-90, clip=j.clip, cc=j.clip_count||0; if(clip){ lvl.innerHTML = `<span class='bad'>${L.clip_bad}</span> Peak ${pct.toFixed(0)}% (${db.toFixed(1)} dBFS), clips: ${cc}`; } else if(pct>=90){ lvl.innerHTML = `<span class='warn'>${L.clip_warn}</span> Peak ${pct.toFixed(0)}% (${db.toFixed(1)} dBFS)`; } else { lvl.textContent = `Peak ${pct.toFixed(0)}% (${db.toFixed(1)} dBFS) — ${L.clip_ok}`; } } updateAdvice(j); })}"
-        "function updateAdvice(a){const L=T[lang]; let tips=[]; if(a.buffer_size<512) tips.push(L.adv_buf512); if(a.buffer_size<1024) tips.push(L.adv_buf1024); if(a.gain>20) tips.push(L.adv_gain); $('adv').textContent=tips.join(' ');}"
-        "function loadPerf(){fetch('/api/perf_status',{cache:'no-store'}).then(r=>r.json()).then(j=>{ const el=$('in_auto'); if(el) el.value=j.auto_recovery?'on':'off'; const thr=$('in_thr'); const chk=$('in_chk'); const mode=$('in_thr_mode'); const sch=$('in_sched'); const hrs=$('in_hours'); const now=Date.now(); if(mode){ const editing=(edits['thr_mode']&&now<edits['thr_mode']); if(!(locks['thr_mode']&&now<locks['thr_mode']) && !editing) mode.value=j.auto_threshold?'auto':'manual'; toggleDirty(mode,'thr_mode'); } if(thr){ const editing=(edits['min_rate']&&now<edits['min_rate']); if(!(locks['min_rate']&&now<locks['min_rate']) && !editing) thr.value=j.restart_threshold_pkt_s; toggleDirty(thr,'min_rate'); } if(chk){ const editing=(edits['check_interval']&&now<edits['check_interval']); if(!(locks['check_interval']&&now<locks['check_interval']) && !editing) chk.value=j.check_interval_min; toggleDirty(chk,'check_interval'); } if(sch){ const editing=(edits['sched_reset']&&now<edits['sched_reset']); if(!(locks['sched_reset']&&now<locks['sched_reset']) && !editing) sch.value=j.scheduled_reset?'on':'off'; toggleDirty(sch,'sched_reset'); } if(hrs){ const editing=(edits['reset_hours']&&now<edits['reset_hours']); if(!(locks['reset_hours']&&now<locks['reset_hours']) && !editing) hrs.value=j.reset_hours; toggleDirty(hrs,'reset_hours'); } $('row_min_rate').style.display=j.auto_threshold?'none':''; })}"
-"function loadTherm(){fetch('/api/thermal',{cache:'no-store'}).then(r=>r.json()).then(j=>{ const now=Date.now(); const L=T[lang]; const en=$('sel_oh_enable'); if(en){ const editing=(edits['oh_enable']&&now<edits['oh_enable']); if(!(locks['oh_enable']&&now<locks['oh_enable']) && !editing) en.value=j.protection_enabled?'on':'off'; toggleDirty(en,'oh_enable'); } const lim=$('sel_oh_limit'); if(lim){ const editing=(edits['oh_limit']&&now<edits['oh_limit']); if(!(locks['oh_limit']&&now<locks['oh_limit']) && !editing) lim.value=(Number(j.shutdown_c)||80).toFixed(0); toggleDirty(lim,'oh_limit'); } const sc=$('sel_cpu'); if(sc && !(locks['cpu_freq']&&now<locks['cpu_freq'])){ sc.value=j.cpu_mhz; } const currentValid=(j.current_valid&&typeof j.current_c==='number'&&isFinite(j.current_c)); const cur=$('therm_now'); if(cur) cur.textContent=currentValid?j.current_c.toFixed(1)+' °C':'N/A'; const max=$('therm_max'); if(max){ const maxValid=(typeof j.max_c==='number'&&isFinite(j.max_c)); max.textContent=maxValid?j.max_c.toFixed(1)+' °C':'N/A'; } const cpu=$('therm_cpu'); if(cpu) cpu.textContent=j.cpu_mhz+' MHz'; const status=$('therm_status'); if(status){ if(j.sensor_fault){ status.innerHTML='<span class=warn>'+L.therm_status_sensor_fault+'</span>'; } else if(j.latched_persist){ status.innerHTML='<span class=warn>'+L.therm_status_latched_persist+'</span>'; } else if(!j.protection_enabled){ status.innerHTML='<span class=bad>'+L.therm_status_disabled+'</span>'; } else if(j.manual_restart || j.latched){ status.innerHTML='<span class=warn>'+L.therm_status_latched+'</span>'; } else { status.innerHTML='<span class=ok>'+L.therm_status_ready+'</span>'; } } const latchRow=$('row_therm_latch'); const latchMsg=$('txt_therm_latch'); const latchBtn=$('btn_therm_clear'); if(latchRow){ if(j.latched_persist){ latchRow.style.display=''; if(latchMsg) latchMsg.textContent=L.therm_latch_notice; if(latchBtn){ latchBtn.textContent=L.therm_clear_btn; latchBtn.disabled=false; } } else { latchRow.style.display='none'; if(latchBtn){ latchBtn.disabled=true; } } } const last=$('therm_last'); if(last){ if(j.sensor_fault){ last.textContent=L.therm_last_sensor_fault; } else if(j.last_trip_ts && j.last_trip_ts.length){ let msg=L.therm_last_fmt; const temp=(typeof j.last_trip_c==='number'&&isFinite(j.last_trip_c)&&j.last_trip_c>0)?j.last_trip_c.toFixed(1):'0'; const limit=(Number(j.shutdown_c)||0).toFixed(0); const ts=j.last_trip_ts||L.therm_time_unknown; const ago=j.last_trip_since||L.therm_time_ago_unknown; msg=msg.replace('%TEMP%',temp).replace('%LIMIT%',limit).replace('%TIME%',ts).replace('%AGO%',ago); last.textContent=msg; if(j.latched_persist){ last.textContent+=' — '+L.therm_status_latched_persist; } else if(j.manual_restart){ last.textContent+=' — '+L.therm_status_latched; } } else if(j.last_reason && j.last_reason.length){ last.textContent=j.last_reason; } else { last.textContent=L.therm_last_none; } } })}"
-"function loadLogs(){fetch('/api/logs',{cache:'no-store'}).then(r=>r.text()).then(t=>{ const lg=$('logs'); lg.textContent=t; lg.scrollTop=lg.scrollHeight; })}"
-"function loadAll(){loadStatus();loadAudio();loadPerf();loadTherm();loadLogs()}"
-"function clearThermalLatch(){ const btn=$('btn_therm_clear'); if(btn) btn.disabled=true; fetch('/api/thermal/clear',{method:'POST',cache:'no-store'}).then(r=>r.json()).then(j=>{ if(!j.ok){ console.warn('Thermal latch clear rejected'); } loadAll(); }).catch(()=>loadAll());}"
-"setInterval(loadAll,3000);"
-        "const sel=document.getElementById('langSel'); sel.value=lang; sel.onchange=()=>{lang=sel.value;localStorage.setItem('lang',lang);applyLang()}; applyLang();"
-#if WEBUI_HAS_SHIFT_BITS
-        "bindSaver($('in_rate'),'rate'); bindSaver($('in_gain'),'gain'); bindSaver($('in_shift'),'shift'); bindSaver($('in_thr'),'min_rate'); bindSaver($('in_chk'),'check_interval'); bindSaver($('in_hours'),'reset_hours'); bindSaver($('in_hp_cutoff'),'hp_cutoff');"
-        "trackEdit($('in_rate'),'rate'); trackEdit($('in_gain'),'gain'); trackEdit($('in_shift'),'shift'); trackEdit($('in_thr'),'min_rate'); trackEdit($('in_chk'),'check_interval'); trackEdit($('in_hours'),'reset_hours'); trackEdit($('in_hp_cutoff'),'hp_cutoff');"
-#else
-        "bindSaver($('in_rate'),'rate'); bindSaver($('in_gain'),'gain'); bindSaver($('in_thr'),'min_rate'); bindSaver($('in_chk'),'check_interval'); bindSaver($('in_hours'),'reset_hours'); bindSaver($('in_hp_cutoff'),'hp_cutoff');"
-        "trackEdit($('in_rate'),'rate'); trackEdit($('in_gain'),'gain'); trackEdit($('in_thr'),'min_rate'); trackEdit($('in_chk'),'check_interval'); trackEdit($('in_hours'),'reset_hours'); trackEdit($('in_hp_cutoff'),'hp_cutoff');"
-#endif
-"trackEdit($('in_auto'),'auto_recovery'); trackEdit($('in_thr_mode'),'thr_mode'); trackEdit($('in_sched'),'sched_reset'); trackEdit($('sel_buf'),'buffer'); trackEdit($('sel_tx'),'wifi_tx'); trackEdit($('sel_hp'),'hp_enable'); trackEdit($('sel_cpu'),'cpu_freq'); trackEdit($('sel_oh_enable'),'oh_enable'); trackEdit($('sel_oh_limit'),'oh_limit');"
-        "const H=(hid,rid)=>{const h=$(hid), r=$(rid); if(h&&r){ h.onclick=()=>{ r.style.display = (r.style.display==='none'||!r.style.display)?'block':'none'; }; }};"
-"H('h_rate','row_rate_hint'); H('h_gain','row_gain_hint'); H('h_hpf','row_hpf_hint'); H('h_hpf_cut','row_hpf_cut_hint'); H('h_buf','row_buf_hint'); H('h_auto','row_auto_hint'); H('h_thr','row_thr_hint'); H('h_thr_mode','row_thrmode_hint'); H('h_chk','row_chk_hint'); H('h_sched','row_sched_hint'); H('h_hours','row_hours_hint'); H('h_tx','row_tx_hint'); H('h_shift','row_shift_hint'); H('h_cpu','row_cpu_hint'); H('h_level','row_level_hint'); H('h_therm_protect','row_therm_hint_protect'); H('h_therm_limit','row_therm_hint_limit');"
-        "loadAll();"
-        "</script></body></html>");
-    return h;
+// HTTP handlery
+// UI page: gzip in flash (WebUI_index.h), streamed without a heap copy.
+// ETag + no-cache lets the browser revalidate with a 304 instead of refetching.
+static void httpIndex() {
+    web.sendHeader("ETag", WEBUI_INDEX_ETAG);
+    web.sendHeader("Cache-Control", "no-cache");
+    if (web.header("If-None-Match") == WEBUI_INDEX_ETAG) {
+        web.send(304);
+        return;
+    }
+    web.sendHeader("Content-Encoding", "gzip");
+    web.setContentLength(WEBUI_INDEX_GZ_LEN);
+    web.send(200, "text/html; charset=utf-8", "");
+    const size_t CHUNK = 1436;   // one TCP segment
+    for (size_t off = 0; off < WEBUI_INDEX_GZ_LEN; off += CHUNK) {
+        size_t n = (WEBUI_INDEX_GZ_LEN - off < CHUNK) ? (WEBUI_INDEX_GZ_LEN - off) : CHUNK;
+        web.sendContent_P((const char*)WEBUI_INDEX_GZ + off, n);
+    }
 }
 
-// HTTP handlery
-static void httpIndex() { web.send(200, "text/html; charset=utf-8", htmlIndex()); }
+// Fixed-buffer JSON writer for the API handlers: no String, no heap. All
+// handlers run in loop(), so one static buffer serves them in turn.
+static const size_t API_JSON_CAP = 6144;
+static char apiJsonBuf[API_JSON_CAP];
+
+class JsonOut {
+public:
+    JsonOut(char* b, size_t c) : buf(b), cap(c) { buf[0] = 0; }
+    size_t length() const { return len; }
+    bool overflow() const { return full; }
+    const char* c_str() const { return buf; }
 
-static void httpStatus() {
-    unsigned long uptimeSeconds = (millis() - bootTime) / 1000;
-    String uptimeStr = formatUptime(uptimeSeconds);
+    void beginObject(const char* k = nullptr) { key(k); put('{'); comma = false; }
+    void endObject() { put('}'); comma = true; }
+    void beginArray(const char* k = nullptr) { key(k); put('['); comma = false; }
+    void endArray() { put(']'); comma = true; }
+    void val(const char* k, bool v) { key(k); raw(v ? "true" : "false"); comma = true; }
+    void val(const char* k, int32_t v) { key(k); fmt("%ld", (long)v); comma = true; }
+    void val(const char* k, uint32_t v) { key(k); fmt("%lu", (unsigned long)v); comma = true; }
+    void val(const char* k, uint64_t v) { key(k); fmt("%llu", (unsigned long long)v); comma = true; }
+    void val(const char* k, float v, int decimals) {
+        key(k);
+        if (isfinite(v)) fmt("%.*f", decimals, (double)v); else raw("null");
+        comma = true;
+    }
+    void null(const char* k) { key(k); raw("null"); comma = true; }
+    void str(const char* k, const char* s) {
+        key(k); put('"');
+        for (; s && *s; ++s) {
+            char c = *s;
+            if (c == '"' || c == '\\') { put('\\'); put(c); }
+            else if (c == '\n') { put('\\'); put('n'); }
+            else if ((uint8_t)c >= 0x20) put(c);
+        }
+        put('"'); comma = true;
+    }
+    void ip(const char* k, const IPAddress &a) {
+        key(k); fmt("\"%u.%u.%u.%u\"", a[0], a[1], a[2], a[3]); comma = true;
+    }
+
+private:
+    void key(const char* k) {
+        if (comma) put(',');
+        if (k) { put('"'); raw(k); put('"'); put(':'); }
+    }
+    void put(char c) {
+        if (len + 1 < cap) { buf[len++] = c; buf[len] = 0; } else full = true;
+    }
+    void raw(const char* s) { while (*s) put(*s++); }
+    void fmt(const char* f, ...) {
+        va_list ap; va_start(ap, f);
+        int n = vsnprintf(buf + len, cap - len, f, ap);
+        va_end(ap);
+        if (n < 0 || (size_t)n >= cap - len) { full = true; buf[len] = 0; } else len += (size_t)n;
+    }
+    char* buf;
+    size_t cap;
+    size_t len = 0;
+    bool comma = false;
+    bool full = false;
+};
+
+static void apiSendJSON(const JsonOut &j) {
+    web.sendHeader("Cache-Control", "no-cache");
+    if (j.overflow()) { web.send(500, "application/json", "{\"ok\":false,\"error\":\"json_overflow\"}"); return; }
+    web.send_P(200, "application/json", j.c_str(), j.length());
+}
+
+static const char* profileKey(uint16_t buf) {
+    // Server-side fallback (English). UI localizes on client by buffer size.
+    if (buf <= 256) return "Ultra-Low Latency (Higher CPU, May have dropouts)";
+    if (buf <= 512) return "Balanced (Moderate CPU, Good stability)";
+    if (buf <= 1024) return "Stable Streaming (Lower CPU, Excellent stability)";
+    return "High Stability (Lowest CPU, Maximum stability)";
+}
+
+static uint32_t currentPacketRate() {
     unsigned long runtime = millis() - lastStatsReset;
-    uint32_t currentRate = (isStreaming && runtime > 1000) ? (audioPacketsSent * 1000) / runtime : 0;
-    String json = "{";
-    json += "\"fw_version\":\"" + String(FW_VERSION_STR) + "\",";
-    json += "\"ip\":\"" + WiFi.localIP().toString() + "\",";
-    json += "\"wifi_rssi\":" + String(WiFi.RSSI()) + ",";
-    json += "\"wifi_tx_dbm\":" + String(wifiPowerLevelToDbm(currentWifiPowerLevel),1) + ",";
-    json += "\"free_heap_kb\":" + String(ESP.getFreeHeap()/1024) + ",";
-    json += "\"min_free_heap_kb\":" + String(minFreeHeap/1024) + ",";
-    json += "\"uptime\":\"" + uptimeStr + "\",";
-    json += "\"rtsp_server_enabled\":" + String(rtspServerEnabled?"true":"false") + ",";
-    if (rtspClient && rtspClient.connected()) json += "\"client\":\"" + rtspClient.remoteIP().toString() + "\","; else json += "\"client\":\"\",";
-    json += "\"streaming\":" + String(isStreaming?"true":"false") + ",";
-    json += "\"current_rate_pkt_s\":" + String(currentRate) + ",";
-    json += "\"last_rtsp_connect\":\"" + jsonEscape(formatSince(lastRtspClientConnectMs)) + "\",";
-    json += "\"last_stream_start\":\"" + jsonEscape(formatSince(lastRtspPlayMs)) + "\"";
-    json += "}";
-    apiSendJSON(json);
-}
-
-static void httpAudioStatus() {
+    return (isStreaming && runtime > 1000) ? (audioPacketsSent * 1000) / runtime : 0;
+}
+
+// Peak since the last UI read (hold) or of the last block
+static void peakLevel(float &pct, float &dbfs) {
+    uint16_t p = (peakHoldAbs16 > 0) ? peakHoldAbs16 : lastPeakAbs16;
+    pct = (p <= 0) ? 0.0f : (100.0f * (float)p / 32767.0f);
+    dbfs = (p <= 0) ? -90.0f : (20.0f * log10f((float)p / 32767.0f));
+}
+
+static int sseClientCount();
+
+static void writeStatus(JsonOut &j) {
+    char text[40];
+    uint32_t currentRate = currentPacketRate();
+    j.str("fw_version", FW_VERSION_STR);
+    j.ip("ip", WiFi.localIP());
+    j.val("wifi_rssi", (int32_t)WiFi.RSSI());
+    j.val("wifi_tx_dbm", wifiPowerLevelToDbm(currentWifiPowerLevel), 1);
+    j.val("free_heap_kb", (uint32_t)(ESP.getFreeHeap()/1024));
+    j.val("min_free_heap_kb", (uint32_t)(minFreeHeap/1024));
+    formatUptimeTo(text, sizeof(text), (millis() - bootTime) / 1000);
+    j.str("uptime", text);
+    j.val("rtsp_server_enabled", rtspServerEnabled);
+    // Sessions are owned by the network task; remoteIP is cached at accept
+    char clients[RTSP_MAX_SESSIONS * 18] = "";
+    size_t clen = 0;
+    for (int i = 0; i < RTSP_MAX_SESSIONS; ++i) {
+        const RtspSession &s = rtspSessions[i];
+        if (!s.active) continue;
+        IPAddress a = s.remoteIP;
+        int n = snprintf(clients + clen, sizeof(clients) - clen, "%s%u.%u.%u.%u", clen ? ", " : "", a[0], a[1], a[2], a[3]);
+        if (n > 0) clen += ((size_t)n < sizeof(clients) - clen) ? (size_t)n : sizeof(clients) - clen - 1;
+    }
+    j.str("client", clients);
+    j.val("clients", (uint32_t)rtspActiveSessions);
+    j.val("max_clients", (uint32_t)RTSP_MAX_SESSIONS);
+    j.val("clients_rejected", rtspRejectedCount);
+    j.beginArray("sessions");
+    for (int i = 0; i < RTSP_MAX_SESSIONS; ++i) {
+        const RtspSession &s = rtspSessions[i];
+        if (!s.active) continue;
+        unsigned long playMs = s.playing ? (millis() - s.playStartedMs) : 0;
+        float kbps = (playMs > 0) ? ((float)s.bytesSent * 8.0f / (float)playMs) : 0.0f;
+        j.beginObject();
+        j.ip("ip", s.remoteIP);
+        j.str("transport", s.overUdp ? "udp" : "tcp");
+        j.val("playing", s.playing);
+        j.val("packets", s.packets);
+        j.val("kbps", kbps, 1);
+        j.val("drops", s.drops);
+        j.val("queue_drops", s.queueDrops);
+        j.val("queue_depth", (uint32_t)s.txQueue.size());
+        j.val("queue_capacity", (uint32_t)s.txQueue.capacity());
+        j.endObject();
+    }
+    j.endArray();
+    j.val("streaming", (bool)isStreaming);
+    // Pre-roll history (PSRAM)
+    uint32_t prerollCap = preroll.capacity();
+    uint32_t prerollFill = preroll.filled();
+    j.val("preroll_enabled", preroll.active());
+    j.val("preroll_seconds", (uint32_t)prerollSeconds);
+    j.val("preroll_capacity_s", (float)prerollCap / currentSampleRate, 1);
+    j.val("preroll_filled_s", (float)prerollFill / currentSampleRate, 1);
+    j.val("preroll_fill_pct", prerollCap ? (100.0f * prerollFill / prerollCap) : 0.0f, 1);
+    j.val("preroll_kb", (uint32_t)(preroll.bytes() / 1024));
+    j.val("preroll_replayed_packets", prerollReplayedPackets);
+    j.val("psram_total_kb", (uint32_t)(ESP.getPsramSize()/1024));
+    j.val("psram_free_kb", (uint32_t)(ESP.getFreePsram()/1024));
+    j.val("current_rate_pkt_s", currentRate);
+    j.val("event_clients", (uint32_t)sseClientCount());
+    formatSinceTo(text, sizeof(text), lastRtspClientConnectMs);
+    j.str("last_rtsp_connect", text);
+    formatSinceTo(text, sizeof(text), lastRtspPlayMs);
+    j.str("last_stream_start", text);
+    // Startup latency, ms since boot (compare across firmware versions)
+    j.beginObject("boot");
+    j.val("capture_ms", bootCaptureMs);
+    j.val("wifi_ms", bootWifiMs);
+    j.val("fast_connect", wifiFastConnected);
+    j.val("static_lease", wifiStaticFromLease);
+    j.val("rtsp_ready_ms", bootRtspReadyMs);
+    if (bootFirstPacketMs) j.val("first_packet_ms", bootFirstPacketMs);
+    else j.null("first_packet_ms");
+    j.endObject();
+}
+
+static void writeAudioStatus(JsonOut &j) {
     float latency_ms = (float)currentBufferSize / currentSampleRate * 1000.0f;
-    String json = "{";
-    json += "\"sample_rate\":" + String(currentSampleRate) + ",";
-    json += "\"gain\":" + String(currentGainFactor,2) + ",";
-    json += "\"buffer_size\":" + String(currentBufferSize) + ",";
+    j.val("sample_rate", currentSampleRate);
+    j.val("capture_rate", captureSampleRate);          // setting, 0 = auto
+    j.val("i2s_rate", i2sCaptureRate);                 // effective I2S clock
+    j.val("gain", currentGainFactor, 2);
+    j.val("buffer_size", (uint32_t)currentBufferSize);
+    // Packetization: ptime setting (0 = one packet per buffer) and resulting packet size/rate
+    uint16_t pktSamples = rtpPacketSamples();
+    float pktPerSec = (float)currentSampleRate / (float)pktSamples;
+    j.val("ptime_ms", (uint32_t)packetTimeMs);
+    j.val("packet_samples", (uint32_t)pktSamples);
+    j.val("packet_ms", (float)pktSamples * 1000.0f / (float)currentSampleRate, 1);
+    j.val("packets_per_s", pktPerSec, 1);
 #if WEBUI_HAS_SHIFT_BITS
-    json += "\"i2s_shift\":" + String(i2sShiftBits) + ",";
+    j.val("i2s_shift", (uint32_t)i2sShiftBits);
 #endif
-    json += "\"latency_ms\":" + String(latency_ms,1) + ",";
+    j.val("channels", (uint32_t)streamChannels());
+#if WEBUI_HAS_MIC_MODES
+    j.str("mic_mode", micModeName(micMode));
+    j.val("beam_delay", (int32_t)beamDelaySamples);
+#endif
+    j.val("mel_supported", melSupported());
+    j.str("mel_mode", melModeName(melMode));
+    j.val("mel_bands", (uint32_t)melSpectrum.bands());
+    if (melSpectrum.active()) j.val("mel_fps", (float)melSpectrum.sampleRate() / (float)melSpectrum.hop(), 1);
+    else j.null("mel_fps");
+    LatencyHistogram::Snapshot melSnap;
+    histMelFrame.snapshot(melSnap);
+    if (melSnap.count) j.val("mel_frame_us", (uint32_t)(melSnap.sumUs / melSnap.count));
+    else j.null("mel_frame_us");
+    j.val("mel_frames", melFramesTotal);
+    j.val("record_supported", recordSupported());
+    j.str("record_mode", recordModeName(recordMode));
+    j.str("record_state", recordStateName());
+    j.val("record_max_mb", (uint32_t)recordMaxMb);
+    if (recordMutex) xSemaphoreTake(recordMutex, portMAX_DELAY);
+    j.val("record_segments", (uint32_t)recordRing.size());
+    j.val("record_used_mb", (float)recordRing.totalBytes() / 1048576.0f, 1);
+    if (recordMutex) xSemaphoreGive(recordMutex);
+    j.val("record_budget_mb", (uint32_t)(recordBudgetBytes() >> 20));
+    j.val("record_lost_s", (float)recordLostSamples / (float)currentSampleRate, 1);
+    j.val("record_write_ms_max", (float)recordWriteUsMax / 1000.0f, 1);
+    j.val("latency_ms", latency_ms, 1);
     extern bool highpassEnabled; extern uint16_t highpassCutoffHz;
-    json += "\"profile\":\"" + jsonEscape(profileName(currentBufferSize)) + "\",";
-    json += "\"hp_enable\":" + String(highpassEnabled?"true":"false") + ",";
-    json += "\"hp_cutoff_hz\":" + String((uint32_t)highpassCutoffHz) + ",";
+    j.str("profile", profileKey(currentBufferSize));
+    j.val("hp_enable", highpassEnabled);
+    j.val("hp_cutoff_hz", (uint32_t)highpassCutoffHz);
+    extern FilterSpec filterSections[]; extern uint8_t filterSectionCount;
+    char filterSpec[DSP_CHAIN_SPEC_MAX];
+    dsp_formatFilterChain(filterSections, filterSectionCount, filterSpec, sizeof(filterSpec));
+    j.str("filters", filterSpec);
+    j.val("filter_sections", (uint32_t)filterSectionCount);
+    j.val("filter_max_sections", (uint32_t)(DSP_CHAIN_MAX - 1));
+    // Codec: RTP bitrate (payload + 12-byte header) and encoder cost
+    float codecKbps = (float)(codec_payloadBytes(currentCodec, pktSamples * streamChannels()) + 12) * 8.0f * pktPerSec / 1000.0f;
+    float codecLoadPct = codecCyclesPerSample * (float)currentSampleRate / ((float)getCpuFrequencyMhz() * 1e6f) * 100.0f;
+    j.str("codec", codec_name(currentCodec));
+    j.val("codec_payload_type", (uint32_t)codec_payloadType(currentCodec, currentSampleRate));
+    j.val("codec_kbps", codecKbps, 1);
+    j.val("codec_cycles_per_sample", codecCyclesPerSample, 1);
+    j.val("codec_load_pct", codecLoadPct, 2);
     // Metering/clipping
-    uint16_t p = (peakHoldAbs16 > 0) ? peakHoldAbs16 : lastPeakAbs16;
-    float peak_pct = (p <= 0) ? 0.0f : (100.0f * (float)p / 32767.0f);
-    float peak_dbfs = (p <= 0) ? -90.0f : (20.0f * log10f((float)p / 32767.0f));
-    json += "\"peak_pct\":" + String(peak_pct,1) + ",";
-    json += "\"peak_dbfs\":" + String(peak_dbfs,1) + ",";
-    json += "\"clip\":" + String(audioClippedLastBlock?"true":"false") + ",";
-    json += "\"clip_count\":" + String(audioClipCount);
-    json += "}";
-    apiSendJSON(json);
-}
-
-static void httpPerfStatus() {
-    String json = "{";
-    json += "\"restart_threshold_pkt_s\":" + String(minAcceptableRate) + ",";
-    json += "\"check_interval_min\":" + String(performanceCheckInterval) + ",";
-    json += "\"auto_recovery\":" + String(autoRecoveryEnabled?"true":"false") + ",";
-    json += "\"auto_threshold\":" + String(autoThresholdEnabled?"true":"false") + ",";
-    json += "\"recommended_min_rate\":" + String(computeRecommendedMinRate()) + ",";
-    json += "\"scheduled_reset\":" + String(scheduledResetEnabled?"true":"false") + ",";
-    json += "\"reset_hours\":" + String(resetIntervalHours) + "}";
-    apiSendJSON(json);
-}
-
-static void httpThermal() {
-    String since = "";
+    float peak_pct, peak_dbfs;
+    peakLevel(peak_pct, peak_dbfs);
+    j.val("peak_pct", peak_pct, 1);
+    j.val("peak_dbfs", peak_dbfs, 1);
+    j.val("clip", audioClippedLastBlock);
+    j.val("clip_count", audioClipCount);
+    // Activity gate; hours oldest first, the current hour last (null = not analysed)
+    j.val("activity_gate", activityGateEnabled);
+    j.val("activity_open", !activityGated);
+    j.val("activity_threshold_db", (uint32_t)activityThresholdDb);
+    j.val("activity_hangover_s", (uint32_t)activityHangoverSec);
+    j.val("activity_level_db", activityDetector.levelDb(), 1);
+    j.val("activity_floor_db", activityDetector.floorDb(), 1);
+    j.val("comfort_noise_packets", comfortNoisePackets);
+    j.beginArray("activity_hours_pct");
+    const uint32_t nowHour = activityHour;
+    for (uint32_t back = ACTIVITY_HOURS; back-- > 0;) {
+        if (back > nowHour) continue;
+        const ActivityHour &h = activityHours[(nowHour - back) % ACTIVITY_HOURS];
+        if (h.totalSamples == 0) j.null(nullptr);
+        else j.val(nullptr, 100.0f * (float)h.activeSamples / (float)h.totalSamples, 1);
+    }
+    j.endArray();
+}
+
+static void writePerfStatus(JsonOut &j) {
+    j.val("restart_threshold_pkt_s", minAcceptableRate);
+    j.val("check_interval_min", performanceCheckInterval);
+    j.val("auto_recovery", autoRecoveryEnabled);
+    j.val("auto_threshold", autoThresholdEnabled);
+    j.val("recommended_min_rate", computeRecommendedMinRate());
+    j.val("scheduled_reset", scheduledResetEnabled);
+    j.val("settings_pending", settingsDirty);
+    j.val("settings_commits", settingsCommits);
+    j.val("settings_nvs_writes", settingsKeysWritten);
+    j.val("live_crossfades", audioCrossfades);
+    j.val("live_resizes", audioLiveResizes);
+    j.val("reset_hours", resetIntervalHours);
+    j.val("ring_slots", (uint32_t)audioRing.capacity());
+    j.val("ring_used", (uint32_t)audioRing.used());
+    j.val("ring_overruns", (uint32_t)audioRingOverruns);
+    j.val("ring_underruns", (uint32_t)audioRingUnderruns);
+    j.val("i2s_rx_events", (uint32_t)i2sRxDoneEvents);
+    j.val("i2s_dma_overflows", (uint32_t)i2sRxOverflows);
+    j.val("i2s_dma_errors", (uint32_t)i2sDmaErrors);
+    j.val("i2s_event_timeouts", i2sEventTimeouts);
+    // DSP kernel cost: cycles per sample and share of one core at the current rate
+    float dspLoadPct = dspCyclesPerSample * (float)i2sCaptureRate / ((float)getCpuFrequencyMhz() * 1e6f) * 100.0f;
+    j.str("dsp_kernel", DSP_KERNEL_STR);
+    j.val("dsp_cycles_per_sample", dspCyclesPerSample, 1);
+    j.val("dsp_load_pct", dspLoadPct, 2);
+    // Sample-rate converter cost per stream sample (0 when capture rate = stream rate)
+    float srcLoadPct = srcCyclesPerSample * (float)currentSampleRate / ((float)getCpuFrequencyMhz() * 1e6f) * 100.0f;
+    j.val("src_active", i2sCaptureRate != currentSampleRate);
+    j.val("src_cycles_per_sample", srcCyclesPerSample, 1);
+    j.val("src_load_pct", srcLoadPct, 2);
+    // RTP TX efficiency: expect one write() per packet
+    float bytesPerPkt = rtpPacketsTotal ? (float)((double)rtpBytesSent / rtpPacketsTotal) : 0.0f;
+    float writesPerPkt = rtpPacketsTotal ? (float)rtpWriteCalls / (float)rtpPacketsTotal : 0.0f;
+    j.val("rtp_packets_total", rtpPacketsTotal);
+    j.val("tx_bytes_per_packet", bytesPerPkt, 1);
+    j.val("tx_writes_per_packet", writesPerPkt, 2);
+    j.val("udp_send_errors", udpSendErrors);
+    j.val("rtcp_sr_sent", rtcpReportsSent);
+    j.val("rtcp_rr_received", rtcpReportsReceived);
+    // Sample clock: I2S against esp_timer (fit over DMA completions), esp_timer
+    // against NTP (SNTP steps); + = runs fast. The sum is the drift of the audio
+    // against wall time that the sender reports let receivers correct.
+    const bool i2sDriftOk = i2sClockDrift.valid();
+    j.val("ntp_synced", powerTimeValid());
+    j.val("ntp_syncs", ntpSyncCount);
+    if (i2sDriftOk) j.val("i2s_clock_ppm", i2sClockDrift.ppm(), 2);
+    else j.null("i2s_clock_ppm");
+    if (i2sDriftOk) j.val("i2s_measured_rate_hz", (float)i2sClockDrift.nominalRate() * (1.0f + i2sClockDrift.ppm() * 1e-6f), 2);
+    else j.null("i2s_measured_rate_hz");
+    j.val("i2s_clock_span_s", (uint32_t)i2sClockDrift.spanSeconds());
+    j.val("i2s_clock_restarts", clockDriftRestarts);
+    if (ntpTimerDriftValid) j.val("timer_clock_ppm", ntpTimerDriftPpm, 2);
+    else j.null("timer_clock_ppm");
+    if (i2sDriftOk && ntpTimerDriftValid) j.val("audio_clock_ppm", i2sClockDrift.ppm() + ntpTimerDriftPpm, 2);
+    else j.null("audio_clock_ppm");
+    // Adaptive bitrate: level 0 = configured format; sample_rate/codec show the running one
+    j.val("abr_enabled", abrEnabled);
+    j.val("abr_level", (uint32_t)abrLevel);
+    j.val("abr_levels", (uint32_t)abrLevelCount);
+    j.val("abr_transitions", abrTransitions);
+    j.val("abr_congested", abrController.congested());
+    j.val("tx_write_util_pct", (uint32_t)abrController.utilPct());
+    j.val("tx_stall_pct", (uint32_t)abrController.stallPct());
+    j.val("tx_write_stalls", (uint32_t)rtpWriteStalls);
+    j.val("tx_queue_drops", rtpQueueDrops);
+}
+
+static void writeThermal(JsonOut &j) {
+    char since[40] = "";
     if (overheatTripTemp > 0.0f && overheatTriggeredAt != 0) {
-        since = formatSince(overheatTriggeredAt);
+        formatSinceTo(since, sizeof(since), overheatTriggeredAt);
     }
     bool manualRequired = overheatLatched || (!rtspServerEnabled && overheatProtectionEnabled && overheatTripTemp > 0.0f);
-    String json = "{";
-    if (lastTemperatureValid) {
-        json += "\"current_c\":" + String(lastTemperatureC,1) + ",";
-    } else {
-        json += "\"current_c\":null,";
-    }
-    json += "\"current_valid\":" + String(lastTemperatureValid?"true":"false") + ",";
-    json += "\"max_c\":" + String(maxTemperature,1) + ",";
-    json += "\"cpu_mhz\":" + String(getCpuFrequencyMhz()) + ",";
-    json += "\"protection_enabled\":" + String(overheatProtectionEnabled?"true":"false") + ",";
-    json += "\"shutdown_c\":" + String(overheatShutdownC,0) + ",";
-    json += "\"latched\":" + String(overheatLockoutActive?"true":"false") + ",";
-    json += "\"latched_persist\":" + String(overheatLatched?"true":"false") + ",";
-    json += "\"sensor_fault\":" + String(overheatSensorFault?"true":"false") + ",";
-    json += "\"last_trip_c\":" + String(overheatTripTemp,1) + ",";
-    json += "\"last_reason\":\"" + jsonEscape(overheatLastReason) + "\",";
-    json += "\"last_trip_ts\":\"" + jsonEscape(overheatLastTimestamp) + "\",";
-    json += "\"last_trip_since\":\"" + jsonEscape(since) + "\",";
-    json += "\"manual_restart\":" + String(manualRequired?"true":"false");
-    json += "}";
-    apiSendJSON(json);
+    if (lastTemperatureValid) j.val("current_c", lastTemperatureC, 1);
+    else j.null("current_c");
+    j.val("current_valid", lastTemperatureValid);
+    j.val("max_c", maxTemperature, 1);
+    j.val("cpu_mhz", (uint32_t)getCpuFrequencyMhz());
+    j.val("protection_enabled", overheatProtectionEnabled);
+    j.val("shutdown_c", overheatShutdownC, 0);
+    j.val("latched", overheatLockoutActive);
+    j.val("latched_persist", overheatLatched);
+    j.val("sensor_fault", overheatSensorFault);
+    j.val("last_trip_c", overheatTripTemp, 1);
+    j.str("last_reason", overheatLastReason.c_str());
+    j.str("last_trip_ts", overheatLastTimestamp.c_str());
+    j.str("last_trip_since", since);
+    j.val("manual_restart", manualRequired);
+    char windows[POWER_SPEC_MAX];
+    powerSchedule.format(windows, sizeof(windows));
+    j.val("power_schedule", powerScheduleEnabled);
+    j.str("power_state", powerIdle ? "idle" : "streaming");
+    j.str("power_windows", windows);
+    j.str("power_tz", powerTimezone);
+    j.val("power_time_valid", powerTimeValid());
+    j.val("power_light_sleep", powerLightSleep);
+    j.val("power_est_ma", powerEstimateMa(), 1);
+    j.val("power_avg_ma", powerAverageMa(), 1);
+    j.val("power_duty_pct", powerDutyPercent(), 1);
+    j.val("power_next_change_s", powerNextChangeS);
+    j.val("power_idle_entries", powerIdleEntries);
+}
+
+// One section as a top-level object (the per-card endpoints)
+static void httpSection(void (*write)(JsonOut&)) {
+    JsonOut j(apiJsonBuf, API_JSON_CAP);
+    j.beginObject(); write(j); j.endObject();
+    apiSendJSON(j);
+}
+static void httpStatus() { httpSection(writeStatus); }
+static void httpAudioStatus() { httpSection(writeAudioStatus); }
+static void httpPerfStatus() { httpSection(writePerfStatus); }
+static void httpThermal() { httpSection(writeThermal); }
+
+// Everything the UI polls, in one response
+static void httpSnapshot() {
+    JsonOut j(apiJsonBuf, API_JSON_CAP);
+    j.beginObject();
+    j.beginObject("status"); writeStatus(j); j.endObject();
+    j.beginObject("audio"); writeAudioStatus(j); j.endObject();
+    j.beginObject("perf"); writePerfStatus(j); j.endObject();
+    j.beginObject("thermal"); writeThermal(j); j.endObject();
+    j.endObject();
+    apiSendJSON(j);
+}
+
+// Prometheus text exposition (/metrics). Written in pieces through the API
+// buffer and sent chunked, so the page size is not bounded by the buffer.
+class MetricsOut {
+public:
+    MetricsOut() { web.setContentLength(CONTENT_LENGTH_UNKNOWN); web.send(200, "text/plain; version=0.0.4; charset=utf-8", ""); }
+    ~MetricsOut() { flush(); web.sendContent(""); }
+    void printf(const char* f, ...) {
+        if (len > API_JSON_CAP - 256) flush();
+        va_list ap; va_start(ap, f);
+        int n = vsnprintf(apiJsonBuf + len, API_JSON_CAP - len, f, ap);
+        va_end(ap);
+        if (n > 0) len += ((size_t)n < API_JSON_CAP - len) ? (size_t)n : API_JSON_CAP - len - 1;
+    }
+    void meta(const char* name, const char* type, const char* help) {
+        printf("# HELP birdnetgo_%s %s\n# TYPE birdnetgo_%s %s\n", name, help, name, type);
+    }
+    void counter(const char* name, const char* help, uint64_t v) {
+        meta(name, "counter", help);
+        printf("birdnetgo_%s %llu\n", name, (unsigned long long)v);
+    }
+    void gauge(const char* name, const char* help, float v) {
+        meta(name, "gauge", help);
+        if (isfinite(v)) printf("birdnetgo_%s %.3f\n", name, (double)v);
+        else printf("birdnetgo_%s NaN\n", name);
+    }
+    void histogram(const char* name, const char* help, const LatencyHistogram &h) {
+        LatencyHistogram::Snapshot s;
+        h.snapshot(s);
+        meta(name, "histogram", help);
+        uint32_t cumulative = 0;
+        for (int i = 0; i < LatencyHistogram::BUCKETS; ++i) {
+            cumulative += s.counts[i];
+            printf("birdnetgo_%s_bucket{le=\"%.6f\"} %lu\n", name,
+                   (double)LatencyHistogram::bucketBoundUs(i) / 1e6, (unsigned long)cumulative);
+        }
+        printf("birdnetgo_%s_bucket{le=\"+Inf\"} %lu\n", name, (unsigned long)s.count);
+        printf("birdnetgo_%s_sum %llu.%06llu\n", name,
+               (unsigned long long)(s.sumUs / 1000000ULL), (unsigned long long)(s.sumUs % 1000000ULL));
+        printf("birdnetgo_%s_count %lu\n", name, (unsigned long)s.count);
+    }
+private:
+    void flush() { if (len) { web.sendContent(apiJsonBuf, len); len = 0; } }
+    size_t len = 0;
+};
+
+static void httpMetrics() {
+    MetricsOut m;
+    m.counter("audio_packets_sent_total", "Audio blocks streamed to at least one client.", audioPacketsSentTotal);
+    m.counter("rtp_packets_total", "RTP packets sent, summed over sessions.", rtpPacketsTotal);
+    m.counter("rtp_bytes_total", "RTP bytes handed to the network stack.", rtpBytesSent);
+    m.counter("audio_clip_blocks_total", "Audio blocks that clipped.", audioClipCount);
+    m.counter("rtsp_connects_total", "Accepted RTSP connections.", rtspConnectCount);
+    m.counter("rtsp_plays_total", "RTSP PLAY requests.", rtspPlayCount);
+    m.counter("rtsp_rejected_total", "RTSP connections refused because all sessions were busy.", rtspRejectedCount);
+    m.counter("i2s_restarts_total", "I2S pipeline restarts (settings changes and auto recovery).", i2sRestartCount);
+    m.counter("audio_live_resizes_total", "Buffer, ptime and pre-roll changes applied without ending sessions.", audioLiveResizes);
+    m.counter("mel_frames_total", "Mel spectrogram frames computed.", melFramesTotal);
+    m.counter("record_bytes_total", "Audio bytes written to recording segments on the SD card.", recordBytesTotal);
+    m.counter("record_segments_total", "Recording segments started on the SD card.", recordSegmentsTotal);
+    m.counter("ring_overruns_total", "Audio blocks dropped because the network side fell behind.", (uint32_t)audioRingOverruns);
+    m.counter("ring_underruns_total", "Network task starved while streaming.", (uint32_t)audioRingUnderruns);
+    m.counter("i2s_dma_overflows_total", "I2S DMA buffers overwritten before they were read.", (uint32_t)i2sRxOverflows);
+    m.counter("udp_send_errors_total", "Failed RTP/UDP datagram sends.", udpSendErrors);
+    m.counter("rtp_write_stalls_total", "RTP packets whose write hit a full send buffer or failed.", (uint32_t)rtpWriteStalls);
+    m.counter("rtp_queue_drops_total", "RTP packets dropped from a full TCP send queue.", rtpQueueDrops);
+    m.counter("abr_transitions_total", "Adaptive bitrate format changes.", abrTransitions);
+    m.counter("activity_active_seconds_total", "Stream time the activity gate was open.", (uint32_t)(activityActiveSamplesTotal / currentSampleRate));
+    m.counter("comfort_noise_packets_total", "RFC 3389 comfort-noise packets sent while gated.", comfortNoisePackets);
+    m.gauge("uptime_seconds", "Seconds since boot.", (float)((millis() - bootTime) / 1000));
+    m.gauge("heap_free_bytes", "Free heap.", (float)ESP.getFreeHeap());
+    m.gauge("heap_min_free_bytes", "Lowest free heap since boot.", (float)minFreeHeap);
+    m.gauge("psram_free_bytes", "Free PSRAM (0 without PSRAM).", (float)ESP.getFreePsram());
+    m.gauge("wifi_rssi_dbm", "Wi-Fi RSSI.", (float)WiFi.RSSI());
+    m.gauge("temperature_celsius", "Chip temperature (NaN when the sensor is unavailable).", lastTemperatureValid ? lastTemperatureC : NAN);
+    m.gauge("cpu_frequency_mhz", "CPU clock.", (float)getCpuFrequencyMhz());
+    m.gauge("boot_wifi_connect_ms", "Milliseconds from boot to the Wi-Fi connection.", (float)bootWifiMs);
+    if (i2sClockDrift.valid()) m.gauge("i2s_clock_drift_ppm", "I2S sample clock against esp_timer (+ = fast).", i2sClockDrift.ppm());
+    if (i2sClockDrift.valid() && ntpTimerDriftValid) m.gauge("audio_clock_drift_ppm", "I2S sample clock against NTP time (+ = fast).", i2sClockDrift.ppm() + ntpTimerDriftPpm);
+    if (bootFirstPacketMs) m.gauge("boot_first_packet_ms", "Milliseconds from boot to the first RTP packet.", (float)bootFirstPacketMs);
+    m.counter("settings_nvs_writes_total", "Preferences keys written to flash since boot.", settingsKeysWritten);
+    m.gauge("record_active", "1 while a recording segment is being written.", strcmp(recordStateName(), "recording") == 0 ? 1.0f : 0.0f);
+    m.gauge("power_idle", "1 while outside the capture windows (I2S stopped, modem sleep).", powerIdle ? 1.0f : 0.0f);
+    m.gauge("power_estimated_ma", "Estimated board current in the present state.", powerEstimateMa());
+    m.gauge("sample_rate_hz", "RTSP stream sample rate.", (float)currentSampleRate);
+    m.gauge("abr_level", "Adaptive bitrate step below the configured format (0 = none).", (float)abrLevel);
+    m.gauge("activity_gate_open", "1 while audio is sent, 0 while the activity gate holds it back.", activityGated ? 0.0f : 1.0f);
+    m.gauge("activity_level_dbfs", "Pre-emphasized level of the last buffer.", activityDetector.levelDb());
+    m.gauge("tx_write_util_ratio", "Time in RTP writes per unit of audio sent, last second.", abrController.utilPct() / 100.0f);
+    m.gauge("rtsp_clients", "Open RTSP sessions.", (float)rtspActiveSessions);
+    m.gauge("streaming", "1 while at least one session is playing.", isStreaming ? 1.0f : 0.0f);
+    m.gauge("packet_rate", "Audio blocks per second in the current stats window.", (float)currentPacketRate());
+    m.gauge("ring_used_blocks", "Blocks waiting in the capture ring.", (float)audioRing.used());
+    m.histogram("i2s_wait_seconds", "Capture task wait for DMA data plus i2s_read().", histI2sWait);
+    m.histogram("dsp_block_seconds", "DSP, resampling, pre-roll and encoding of one capture buffer.", histDspBlock);
+    m.histogram("rtp_send_seconds", "One RTP packet write (TCP interleaved or UDP).", histRtpSend);
+    m.histogram("stream_fanout_seconds", "One ring block sent to all playing sessions.", histStreamFanout);
+    m.histogram("mel_frame_seconds", "FFT and mel filterbank of one spectrogram frame.", histMelFrame);
 }
 
 static void httpThermalClear() {
@@ -396,51 +761,429 @@ static void httpThermalClear() {
         overheatTriggeredAt = 0;
         overheatLastReason = String("Thermal latch cleared manually.");
         overheatLastTimestamp = String("");
-        if (!rtspServerEnabled) {
-            rtspServer.begin();
-            rtspServer.setNoDelay(true);
-            rtspServerEnabled = true;
-        }
+        // Network task reopens the RTSP server socket
+        rtspServerEnabled = true;
         saveAudioSettings();
-        webui_pushLog(F("UI action: thermal_latch_clear"));
+        webui_pushLog("UI action: thermal_latch_clear");
         apiSendJSON(F("{\"ok\":true}"));
     } else {
         apiSendJSON(F("{\"ok\":false}"));
     }
 }
 
+// Last N seconds of the pre-roll as a 16-bit mono WAV, streamed in chunks
+static void httpPrerollWav() {
+    if (!preroll.active() || preroll.filled() == 0) {
+        web.send(404, "application/json", "{\"ok\":false,\"error\":\"preroll_empty\"}");
+        return;
+    }
+    uint32_t want = web.hasArg("seconds") ? (uint32_t)web.arg("seconds").toInt() * currentSampleRate : preroll.filled();
+    // Keep 2 s clear of the write head's lap so a slow download is not overwritten
+    uint32_t held = preroll.filled();
+    uint32_t margin = 2 * currentSampleRate;
+    if (held + margin > preroll.capacity()) held = (preroll.capacity() > margin) ? preroll.capacity() - margin : 0;
+    if (want == 0 || want > held) want = held;
+    const uint32_t rate = currentSampleRate;
+    const uint32_t start = preroll.head() - want;
+    const uint32_t dataBytes = want * sizeof(int16_t);
+
+    uint8_t hdr[44];
+    auto put32 = [&](int o, uint32_t v){ hdr[o]=v; hdr[o+1]=v>>8; hdr[o+2]=v>>16; hdr[o+3]=v>>24; };
+    auto put16 = [&](int o, uint16_t v){ hdr[o]=v; hdr[o+1]=v>>8; };
+    memcpy(hdr, "RIFF", 4); put32(4, 36 + dataBytes); memcpy(hdr + 8, "WAVEfmt ", 8);
+    put32(16, 16); put16(20, 1); put16(22, 1); put32(24, rate); put32(28, rate * 2); put16(32, 2); put16(34, 16);
+    memcpy(hdr + 36, "data", 4); put32(40, dataBytes);
+
+    web.sendHeader("Content-Disposition", "attachment; filename=\"preroll.wav\"");
+    web.setContentLength(sizeof(hdr) + dataBytes);
+    web.send(200, "audio/wav", "");
+    web.sendContent((const char*)hdr, sizeof(hdr));
+    static int16_t chunk[512];
+    for (uint32_t off = 0; off < want; ) {
+        int n = (want - off < 512) ? (int)(want - off) : 512;
+        if (!preroll.read(start + off, chunk, n)) memset(chunk, 0, sizeof(chunk));   // lapped: silence
+        web.sendContent((const char*)chunk, (size_t)n * sizeof(int16_t));   // ESP32 is little-endian
+        off += (uint32_t)n;
+    }
+    webui_pushLogf("UI action: preroll.wav %u s", (unsigned)(want / rate));
+}
+
+// Mel frames from ?since=<seq> on (the retained ones when absent or out of
+// range), binary little-endian: "MEL1", u32 first seq, u16 frames, u8 bands,
+// i8 floor dB, u16 hop, u16 FFT size, u32 sample rate, then bands bytes per
+// frame at 0.5 dB per step. X-Mel-Next is the cursor for the next request.
+static void httpMel() {
+    if (!melSpectrum.active()) {
+        web.send(404, "application/json", "{\"ok\":false,\"error\":\"mel_off\"}");
+        return;
+    }
+    const uint32_t oldest = melSpectrum.oldestSeq(), next = melSpectrum.nextSeq();
+    uint32_t cursor = web.hasArg("since") ? (uint32_t)strtoul(web.arg("since").c_str(), nullptr, 10) : oldest;
+    if ((int32_t)(cursor - oldest) < 0 || (int32_t)(cursor - next) > 0) cursor = oldest;
+    const uint16_t frames = (uint16_t)(next - cursor);
+    const uint8_t bands = melSpectrum.bands();
+
+    uint8_t hdr[20];
+    auto put32 = [&](int o, uint32_t v){ hdr[o]=v; hdr[o+1]=v>>8; hdr[o+2]=v>>16; hdr[o+3]=v>>24; };
+    auto put16 = [&](int o, uint16_t v){ hdr[o]=v; hdr[o+1]=v>>8; };
+    memcpy(hdr, "MEL1", 4); put32(4, cursor); put16(8, frames); hdr[10] = bands; hdr[11] = (uint8_t)(int8_t)MEL_DB_FLOOR;
+    put16(12, melSpectrum.hop()); put16(14, melSpectrum.fftSize()); put32(16, melSpectrum.sampleRate());
+
+    char nextText[12];
+    snprintf(nextText, sizeof(nextText), "%u", (unsigned)next);
+    web.sendHeader("Cache-Control", "no-cache");
+    web.sendHeader("X-Mel-Next", nextText);
+    web.setContentLength(sizeof(hdr) + (size_t)frames * bands);
+    web.send(200, "application/octet-stream", "");
+    web.sendContent((const char*)hdr, sizeof(hdr));
+    size_t used = 0;
+    for (uint32_t s = cursor; s != next; ++s) {
+        uint8_t* out = (uint8_t*)apiJsonBuf + used;
+        if (!melSpectrum.frame(s, out)) memset(out, 0, bands);   // lapped meanwhile: floor
+        used += bands;
+        if (API_JSON_CAP - used < bands) { web.sendContent(apiJsonBuf, used); used = 0; }
+    }
+    if (used) web.sendContent(apiJsonBuf, used);
+}
+
+// Recording segments on the SD card from ?since=<seq> on, oldest first, at
+// most RECORD_LIST_MAX per reply; "next" is the cursor for the rest
+#define RECORD_LIST_MAX 48
+static void httpRecordings() {
+    const uint32_t since = web.hasArg("since") ? (uint32_t)strtoul(web.arg("since").c_str(), nullptr, 10) : 0;
+    JsonOut j(apiJsonBuf, API_JSON_CAP);
+    j.beginObject();
+    j.val("ok", true);
+    j.str("mode", recordModeName(recordMode));
+    j.str("state", recordStateName());
+    j.val("card_mb", (uint32_t)(recordCardBytes >> 20));
+    j.val("budget_mb", (uint32_t)(recordBudgetBytes() >> 20));
+    if (recordMutex) xSemaphoreTake(recordMutex, portMAX_DELAY);
+    j.val("used_mb", (float)recordRing.totalBytes() / 1048576.0f, 1);
+    j.beginArray("segments");
+    uint32_t next = recordRing.nextSeq();
+    uint16_t listed = 0;
+    for (uint16_t i = 0; i < recordRing.size(); ++i) {
+        const RecordSegment &seg = recordRing.at(i);
+        if (seg.seq < since) continue;
+        if (listed == RECORD_LIST_MAX) { next = seg.seq; break; }
+        char name[RECORD_NAME_MAX];
+        rec_formatName(name, sizeof(name), seg.seq, seg.startUtc);
+        j.beginObject();
+        j.val("seq", seg.seq);
+        j.str("name", name);
+        j.val("start_utc", seg.startUtc);
+        j.val("bytes", seg.bytes);
+        j.val("open", recordSegmentOpen(seg.seq));
+        j.endObject();
+        listed++;
+    }
+    if (recordMutex) xSemaphoreGive(recordMutex);
+    j.endArray();
+    j.val("next", next);
+    j.endObject();
+    apiSendJSON(j);
+}
+
+// One closed segment as audio/wav, with single byte ranges for resuming a
+// backfill (a multi-range request gets the whole file). The segment is kept
+// from eviction while it is being sent.
+static void httpRecording() {
+    const uint32_t seq = web.hasArg("seq") ? (uint32_t)strtoul(web.arg("seq").c_str(), nullptr, 10) : UINT32_MAX;
+    char path[48], name[RECORD_NAME_MAX];
+    uint32_t size = 0;
+    int found = -1;
+    bool open = false;
+    if (recordMutex) xSemaphoreTake(recordMutex, portMAX_DELAY);
+    found = recordRing.find(seq);
+    if (found >= 0) {
+        const RecordSegment &seg = recordRing.at((uint16_t)found);
+        recordPath(path, sizeof(path), seg.seq, seg.startUtc);
+        rec_formatName(name, sizeof(name), seg.seq, seg.startUtc);
+        size = seg.bytes;
+        open = recordSegmentOpen(seq);
+        if (!open) recordServingSeq = seq;
+    }
+    if (recordMutex) xSemaphoreGive(recordMutex);
+    if (found < 0) { web.send(404, "application/json", "{\"ok\":false,\"error\":\"no_segment\"}"); return; }
+    if (open) { web.send(409, "application/json", "{\"ok\":false,\"error\":\"segment_open\"}"); return; }
+
+    File f = SD.open(path, FILE_READ);
+    if (!f) {
+        recordServingSeq = UINT32_MAX;
+        web.send(500, "application/json", "{\"ok\":false,\"error\":\"sd_read\"}");
+        return;
+    }
+    uint32_t first = 0, last = size - 1;
+    int code = 200;
+    char text[48];
+    const String range = web.header("Range");
+    if (range.length() && range.indexOf(',') < 0) {
+        if (!rec_parseRange(range.c_str(), size, first, last)) {
+            f.close();
+            recordServingSeq = UINT32_MAX;
+            snprintf(text, sizeof(text), "bytes */%lu", (unsigned long)size);
+            web.sendHeader("Content-Range", text);
+            web.send(416, "application/json", "{\"ok\":false,\"error\":\"bad_range\"}");
+            return;
+        }
+        code = 206;
+        snprintf(text, sizeof(text), "bytes %lu-%lu/%lu", (unsigned long)first, (unsigned long)last, (unsigned long)size);
+        web.sendHeader("Content-Range", text);
+    }
+    snprintf(text, sizeof(text), "attachment; filename=\"%s\"", name);
+    web.sendHeader("Content-Disposition", text);
+    web.sendHeader("Accept-Ranges", "bytes");
+    web.setContentLength(last - first + 1);
+    web.send(code, "audio/wav", "");
+    f.seek(first);
+    for (uint32_t left = last - first + 1; left; ) {
+        const size_t want = (left < 4096) ? left : 4096;
+        const int got = f.read((uint8_t*)apiJsonBuf, want);
+        if (got <= 0) break;   // card gone: the client sees a short body
+        web.sendContent(apiJsonBuf, (size_t)got);
+        left -= (uint32_t)got;
+    }
+    f.close();
+    recordServingSeq = UINT32_MAX;
+}
+
+// Retained log lines as text; ?since=<seq> returns only lines from that
+// cursor on. X-Log-Next is the cursor for the next request (a cursor ahead of
+// it, e.g. after a reboot, gets the whole backlog again).
 static void httpLogs() {
-    String out;
-    for (size_t i=0;i<logCount;i++){
-        size_t idx = (logHead + LOG_CAP - logCount + i) % LOG_CAP;
-        out += logBuffer[idx]; out += '\n';
+    if (logMutex) xSemaphoreTake(logMutex, portMAX_DELAY);
+    const uint32_t oldest = logRing.oldestSeq(), next = logRing.nextSeq();
+    if (logMutex) xSemaphoreGive(logMutex);
+    uint32_t cursor = web.hasArg("since") ? (uint32_t)strtoul(web.arg("since").c_str(), nullptr, 10) : oldest;
+    if ((int32_t)(cursor - oldest) < 0 || (int32_t)(cursor - next) > 0) cursor = oldest;
+
+    char nextText[12];
+    snprintf(nextText, sizeof(nextText), "%u", (unsigned)next);
+    web.sendHeader("Cache-Control", "no-cache");
+    web.sendHeader("X-Log-Next", nextText);
+    web.setContentLength(CONTENT_LENGTH_UNKNOWN);
+    web.send(200, "text/plain; charset=utf-8", "");
+    // Lines are copied one at a time under the lock, sent without it
+    size_t used = 0;
+    for (uint32_t s = cursor; s != next; ++s) {
+        size_t len;
+        if (logMutex) xSemaphoreTake(logMutex, portMAX_DELAY);
+        bool ok = logRing.line(s, apiJsonBuf + used, API_JSON_CAP - used - 1, len);
+        if (logMutex) xSemaphoreGive(logMutex);
+        if (!ok) continue;   // evicted meanwhile
+        apiJsonBuf[used + len] = '\n';
+        used += len + 1;
+        if (API_JSON_CAP - used < LogRing::MAX_LINE + 2) { web.sendContent(apiJsonBuf, used); used = 0; }
+    }
+    if (used) web.sendContent(apiJsonBuf, used);
+    web.sendContent("");
+}
+
+// Server-Sent Events (/api/events): the socket is copied out of WebServer and
+// kept; loop() pushes new log lines and a metrics frame once per second, so an
+// open dashboard costs one connection instead of polling.
+static const int SSE_MAX_CLIENTS = 2;
+static const unsigned long SSE_METRICS_INTERVAL_MS = 1000;
+static const int SSE_LOG_LINES_PER_PASS = 8;   // bounds the time spent per loop()
+struct SseClient { WiFiClient client; uint32_t logSeq; bool active; };
+static SseClient sseClients[SSE_MAX_CLIENTS];
+static unsigned long sseLastMetricsMs = 0;
+static char sseFrame[512];
+
+static int sseClientCount() {
+    int n = 0;
+    for (int i = 0; i < SSE_MAX_CLIENTS; ++i) if (sseClients[i].active) n++;
+    return n;
+}
+
+static void httpEvents() {
+    SseClient* slot = nullptr;
+    for (int i = 0; i < SSE_MAX_CLIENTS; ++i) {
+        if (!sseClients[i].active || !sseClients[i].client.connected()) { slot = &sseClients[i]; break; }
+    }
+    if (!slot) {
+        web.send(503, "application/json", "{\"ok\":false,\"error\":\"too_many_event_clients\"}");
+        return;
+    }
+    slot->client.stop();
+    slot->client = web.client();
+    slot->client.setNoDelay(true);
+    slot->client.print("HTTP/1.1 200 OK\r\nContent-Type: text/event-stream\r\nCache-Control: no-cache\r\n"
+                       "Connection: keep-alive\r\n\r\nretry: 3000\n\n");
+    // Replay the retained backlog first
+    if (logMutex) xSemaphoreTake(logMutex, portMAX_DELAY);
+    slot->logSeq = logRing.oldestSeq();
+    if (logMutex) xSemaphoreGive(logMutex);
+    slot->active = true;
+    sseLastMetricsMs = 0;   // first metrics frame right away
+}
+
+static void sseWrite(SseClient &c, size_t n) {
+    if (c.client.write((const uint8_t*)sseFrame, n) == n) return;
+    c.client.stop();        // stalled or gone
+    c.active = false;
+}
+
+// One "event: log" frame, or false when the client is up to date
+static bool sseNextLogFrame(SseClient &c, size_t &n) {
+    static const char PREFIX[] = "event: log\ndata: ";
+    const size_t p = sizeof(PREFIX) - 1;
+    if (logMutex) xSemaphoreTake(logMutex, portMAX_DELAY);
+    uint32_t oldest = logRing.oldestSeq();
+    if ((int32_t)(c.logSeq - oldest) < 0) c.logSeq = oldest;   // fell behind: lines were overwritten
+    size_t len = 0;
+    bool have = logRing.line(c.logSeq, sseFrame + p, sizeof(sseFrame) - p - 2, len);
+    if (logMutex) xSemaphoreGive(logMutex);
+    if (!have) return false;
+    memcpy(sseFrame, PREFIX, p);
+    for (size_t i = p; i < p + len; ++i) if (sseFrame[i] == '\n' || sseFrame[i] == '\r') sseFrame[i] = ' ';
+    n = p + len;
+    sseFrame[n++] = '\n'; sseFrame[n++] = '\n';
+    c.logSeq++;
+    return true;
+}
+
+static size_t sseMetricsFrame() {
+    static const char PREFIX[] = "event: metrics\ndata: ";
+    const size_t p = sizeof(PREFIX) - 1;
+    memcpy(sseFrame, PREFIX, p);
+    JsonOut j(sseFrame + p, sizeof(sseFrame) - p - 2);
+    float peakPct, peakDbfs;
+    peakLevel(peakPct, peakDbfs);
+    j.beginObject();
+    j.val("uptime_s", (uint32_t)((millis() - bootTime) / 1000));
+    j.val("streaming", (bool)isStreaming);
+    j.val("clients", (uint32_t)rtspActiveSessions);
+    j.val("pkt_rate", currentPacketRate());
+    j.val("peak_pct", peakPct, 1);
+    j.val("peak_dbfs", peakDbfs, 1);
+    j.val("clip", audioClippedLastBlock);
+    j.val("clip_count", audioClipCount);
+    j.val("free_heap_kb", (uint32_t)(ESP.getFreeHeap()/1024));
+    j.val("min_free_heap_kb", (uint32_t)(minFreeHeap/1024));
+    if (lastTemperatureValid) j.val("temp_c", lastTemperatureC, 1);
+    else j.null("temp_c");
+    j.val("ring_overruns", (uint32_t)audioRingOverruns);
+    j.val("i2s_dma_overflows", (uint32_t)i2sRxOverflows);
+    j.endObject();
+    size_t n = p + j.length();
+    sseFrame[n++] = '\n'; sseFrame[n++] = '\n';
+    return n;
+}
+
+static void sseService() {
+    bool any = false;
+    for (int i = 0; i < SSE_MAX_CLIENTS; ++i) {
+        SseClient &c = sseClients[i];
+        if (c.active && !c.client.connected()) { c.client.stop(); c.active = false; }
+        any = any || c.active;
+    }
+    if (!any) return;
+    size_t n;
+    for (int i = 0; i < SSE_MAX_CLIENTS; ++i) {
+        SseClient &c = sseClients[i];
+        for (int k = 0; c.active && k < SSE_LOG_LINES_PER_PASS && sseNextLogFrame(c, n); ++k) sseWrite(c, n);
+    }
+    if (millis() - sseLastMetricsMs >= SSE_METRICS_INTERVAL_MS) {
+        sseLastMetricsMs = millis();
+        n = sseMetricsFrame();
+        for (int i = 0; i < SSE_MAX_CLIENTS; ++i) if (sseClients[i].active) sseWrite(sseClients[i], n);
     }
-    web.send(200, "text/plain; charset=utf-8", out);
 }
 
 static void httpActionServerStart(){
     if (overheatLatched) {
-        webui_pushLog(F("Server start blocked: thermal protection latched"));
+        webui_pushLog("Server start blocked: thermal protection latched");
         apiSendJSON(F("{\"ok\":false,\"error\":\"thermal_latched\"}"));
         return;
     }
     if (!rtspServerEnabled) {
-        rtspServerEnabled=true; rtspServer.begin(); rtspServer.setNoDelay(true);
+        rtspServerEnabled=true;   // network task opens the socket
         overheatLockoutActive = false;
     }
-    webui_pushLog(F("UI action: server_start"));
+    webui_pushLog("UI action: server_start");
     apiSendJSON(F("{\"ok\":true}"));
 }
 static void httpActionServerStop(){
-    rtspServerEnabled=false; if (rtspClient && rtspClient.connected()) rtspClient.stop(); isStreaming=false; rtspServer.stop();
-    webui_pushLog(F("UI action: server_stop"));
+    rtspServerEnabled=false; rtspStopAllStreams();   // network task closes sessions and socket
+    webui_pushLog("UI action: server_stop");
     apiSendJSON(F("{\"ok\":true}"));
 }
 static void httpActionResetI2S(){
-    webui_pushLog(F("UI action: reset_i2s"));
+    webui_pushLog("UI action: reset_i2s");
     restartI2S(); apiSendJSON(F("{\"ok\":true}"));
 }
 
+// Pipeline benchmark: per-stage cycles per sample for each buffer size, and
+// the load each stream rate would put on the CPU at the current clock
+static const uint16_t BENCH_BUFFERS[] = { 256, 512, 1024, 2048, 4096 };
+static const uint32_t BENCH_RATES[] = { 8000, 16000, 24000, 32000, 44100, 48000 };
+static const float BENCH_SAFE_LOAD_PCT = 50.0f;   // leave half the core to WiFi/lwIP and the UI
+
+static void httpActionBench() {
+    webui_pushLog("UI action: bench");
+    if (!bench_begin(BENCH_BUFFERS[sizeof(BENCH_BUFFERS) / sizeof(BENCH_BUFFERS[0]) - 1])) {
+        apiSendJSON(F("{\"ok\":false,\"error\":\"no_memory\"}"));
+        return;
+    }
+    const uint32_t mhz = getCpuFrequencyMhz();
+    const float send = benchSendCyclesPerSample();
+    JsonOut j(apiJsonBuf, API_JSON_CAP);
+    j.beginObject();
+    j.val("ok", true);
+    j.val("cpu_mhz", mhz);
+    j.str("kernel", DSP_KERNEL_STR);
+    j.str("codec", codec_name(currentCodec));
+    j.val("hpf", highpassEnabled);
+    j.val("send_measured", send > 0.0f);
+    j.val("safe_load_pct", BENCH_SAFE_LOAD_PCT, 0);
+    j.beginArray("stages");
+    static const char* const stages[] = { "read", "convert", "hpf", "gain_clip", "byte_swap", "encode", "send" };
+    for (const char* name : stages) j.str(nullptr, name);
+    j.endArray();
+    j.beginArray("buffers");
+    for (uint16_t samples : BENCH_BUFFERS) {
+        BenchStages st;
+        if (!benchmarkPipeline(samples, st)) continue;
+        // Stages the current settings actually run
+        float total = st.read + st.convert + st.gainClip + send
+                    + (highpassEnabled ? st.hpf : 0.0f)
+                    + (currentCodec == CODEC_L16 ? st.byteSwap : st.encode);
+        j.beginObject();
+        j.val("samples", (uint32_t)samples);
+        j.beginArray("cycles_per_sample");
+        const float cps[] = { st.read, st.convert, st.hpf, st.gainClip, st.byteSwap, st.encode, send };
+        for (float v : cps) j.val(nullptr, v, 2);
+        j.endArray();
+        j.val("total", total, 2);
+        j.beginArray("rates");
+        for (uint32_t rate : BENCH_RATES) {
+            float load = total * (float)rate / ((float)mhz * 1e4f);   // percent of one core
+            j.beginObject();
+            j.val("rate", rate);
+            j.val("load_pct", load, 2);
+            j.val("headroom_pct", 100.0f - load, 2);
+            bool found = false;
+            for (uint8_t c = 0; c < CPU_MHZ_CANDIDATE_COUNT && !found; ++c) {
+                if (total * (float)rate / ((float)CPU_MHZ_CANDIDATES[c] * 1e4f) <= BENCH_SAFE_LOAD_PCT) {
+                    j.val("min_safe_mhz", (uint32_t)CPU_MHZ_CANDIDATES[c]);
+                    found = true;
+                }
+            }
+            if (!found) j.null("min_safe_mhz");
+            j.endObject();
+        }
+        j.endArray();
+        j.endObject();
+        delay(0);
+    }
+    j.endArray();
+    j.endObject();
+    bench_end();
+    apiSendJSON(j);
+}
+
 static inline bool argToFloat(const String &name, float &out) { if (!web.hasArg("value")) return false; out = web.arg("value").toFloat(); return true; }
 static inline bool argToUInt(const String &name, uint32_t &out) { if (!web.hasArg("value")) return false; out = (uint32_t) web.arg("value").toInt(); return true; }
 static inline bool argToUShort(const String &name, uint16_t &out) { if (!web.hasArg("value")) return false; out = (uint16_t) web.arg("value").toInt(); return true; }
@@ -449,12 +1192,27 @@ static inline bool argToUChar(const String &name, uint8_t &out) { if (!web.hasAr
 static void httpSet() {
     String key = web.arg("key");
     String val = web.hasArg("value") ? web.arg("value") : String("");
-    if (val.length()) { webui_pushLog(String("UI set: ")+key+"="+val); }
-    if (key == "gain") { float v; if (argToFloat("value", v) && v>=0.1f && v<=100.0f) { currentGainFactor=v; saveAudioSettings(); restartI2S(); } }
-    else if (key == "rate") { uint32_t v; if (argToUInt("value", v) && v>=8000 && v<=96000) { currentSampleRate=v; if (autoThresholdEnabled) { minAcceptableRate = computeRecommendedMinRate(); } saveAudioSettings(); restartI2S(); } }
-    else if (key == "buffer") { uint16_t v; if (argToUShort("value", v) && v>=256 && v<=8192) { currentBufferSize=v; if (autoThresholdEnabled) { minAcceptableRate = computeRecommendedMinRate(); } saveAudioSettings(); restartI2S(); } }
+    if (val.length()) { webui_pushLogf("UI set: %s=%s", key.c_str(), val.c_str()); }
+    if (key == "gain") { float v; if (argToFloat("value", v) && v>=0.1f && v<=100.0f) { currentGainFactor=v; saveAudioSettings(); } }   // read per block: live
+    else if (key == "rate") { uint32_t v; if (argToUInt("value", v) && v>=8000 && v<=96000) { abrRestoreConfigured(); currentSampleRate=v; if (autoThresholdEnabled) { minAcceptableRate = computeRecommendedMinRate(); } saveAudioSettings(); restartI2S(); } }
+    else if (key == "preroll_sec") { uint32_t v; if (argToUInt("value", v) && v<=600) { prerollSeconds=(uint16_t)v; saveAudioSettings(); resizeAudioBuffers(); } }   // sessions keep playing
+    else if (key == "ptime") { uint32_t v; if (argToUInt("value", v) && (v==0 || (v>=2 && v<=100))) { packetTimeMs=(uint8_t)v; if (autoThresholdEnabled) { minAcceptableRate = computeRecommendedMinRate(); } saveAudioSettings(); resizeAudioBuffers(); } }
+    else if (key == "capture_rate") { uint32_t v; if (argToUInt("value", v) && (v==0 || (v>=8000 && v<=96000))) { abrRestoreConfigured(); captureSampleRate=v; saveAudioSettings(); restartI2S(); } }
+    else if (key == "codec") { AudioCodecId c; if (codec_fromName(web.arg("value").c_str(), c)) { if (streamChannels() == 2 && c != CODEC_L16) { apiSendJSON(F("{\"ok\":false,\"error\":\"stereo_needs_l16\"}")); return; } bool wasDegraded = abrRestoreConfigured(); currentCodec=c; saveAudioSettings(); if (wasDegraded) restartI2S(); else { abrBuildLadder(); rtspStopAllStreams(); } } }   // new SDP: clients re-DESCRIBE
+    else if (key == "abr") { String v=web.arg("value"); if (v=="on" && streamChannels() == 2) { apiSendJSON(F("{\"ok\":false,\"error\":\"not_in_stereo\"}")); return; } if (v=="on"||v=="off") { abrEnabled=(v=="on"); bool wasDegraded = !abrEnabled && abrRestoreConfigured(); saveAudioSettings(); if (wasDegraded) restartI2S(); } }
+    else if (key == "activity_gate") { String v=web.arg("value"); if (v=="on" && streamChannels() == 2) { apiSendJSON(F("{\"ok\":false,\"error\":\"not_in_stereo\"}")); return; } if (v=="on"||v=="off") { activityGateEnabled=(v=="on"); activityConfigure(); saveAudioSettings(); rtspStopAllStreams(); } }   // SDP adds/drops CN
+    else if (key == "activity_threshold_db") { uint32_t v; if (argToUInt("value", v) && v>=3 && v<=40) { activityThresholdDb=(uint8_t)v; activityConfigure(); saveAudioSettings(); } }
+    else if (key == "activity_hangover_s") { uint32_t v; if (argToUInt("value", v) && v>=1 && v<=600) { activityHangoverSec=(uint16_t)v; activityConfigure(); saveAudioSettings(); } }
+    else if (key == "buffer") { uint16_t v; if (argToUShort("value", v) && v>=256 && v<=8192) { currentBufferSize=v; if (autoThresholdEnabled) { minAcceptableRate = computeRecommendedMinRate(); } saveAudioSettings(); resizeAudioBuffers(); } }
+    else if (key == "mel_mode") { if (!setMelMode(val.c_str())) { apiSendJSON(F("{\"ok\":false,\"error\":\"bad_mel_mode\"}")); return; } saveAudioSettings(); }
+    else if (key == "record_mode") { if (!setRecordMode(val.c_str())) { apiSendJSON(F("{\"ok\":false,\"error\":\"bad_record_mode\"}")); return; } saveAudioSettings(); }
+    else if (key == "record_max_mb") { uint32_t v; if (argToUInt("value", v) && v<=65535) { recordMaxMb=(uint16_t)v; saveAudioSettings(); } }   // applies at the next segment
+#if WEBUI_HAS_MIC_MODES
+    else if (key == "mic_mode") { if (!setMicMode(val.c_str())) { apiSendJSON(F("{\"ok\":false,\"error\":\"bad_mic_mode\"}")); return; } saveAudioSettings(); }   // new SDP: clients re-DESCRIBE
+    else if (key == "beam_delay") { long v = val.toInt(); if (val.length() && v>=-DSP_BEAM_MAX_DELAY && v<=DSP_BEAM_MAX_DELAY) { setBeamDelay((int)v); saveAudioSettings(); } }
+#endif
 #if WEBUI_HAS_SHIFT_BITS
-    else if (key == "shift") { uint8_t v; if (argToUChar("value", v) && v<=24) { i2sShiftBits=v; saveAudioSettings(); restartI2S(); } }
+    else if (key == "shift") { uint8_t v; if (argToUChar("value", v) && v<=24) { i2sShiftBits=v; saveAudioSettings(); } }   // read per block: live
 #endif
     else if (key == "wifi_tx") { float v; if (argToFloat("value", v) && v>=-1.0f && v<=19.5f) { extern float wifiTxPowerDbm; wifiTxPowerDbm = snapWifiTxDbm(v); applyWifiTxPower(true); saveAudioSettings(); } }
     else if (key == "auto_recovery") { String v=web.arg("value"); if (v=="on"||v=="off") { autoRecoveryEnabled=(v=="on"); saveAudioSettings(); } }
@@ -463,9 +1221,14 @@ static void httpSet() {
     else if (key == "check_interval") { uint32_t v; if (argToUInt("value", v) && v>=1 && v<=60) { performanceCheckInterval=v; saveAudioSettings(); } }
     else if (key == "sched_reset") { String v=web.arg("value"); if (v=="on"||v=="off") { extern bool scheduledResetEnabled; scheduledResetEnabled=(v=="on"); saveAudioSettings(); } }
     else if (key == "reset_hours") { uint32_t v; if (argToUInt("value", v) && v>=1 && v<=168) { extern uint32_t resetIntervalHours; resetIntervalHours=v; saveAudioSettings(); } }
-    else if (key == "cpu_freq") { uint32_t v; if (argToUInt("value", v) && v>=40 && v<=160) { cpuFrequencyMhz=(uint8_t)v; setCpuFrequencyMhz(cpuFrequencyMhz); saveAudioSettings(); } }
-    else if (key == "hp_enable") { String v=web.arg("value"); if (v=="on"||v=="off") { extern bool highpassEnabled; highpassEnabled=(v=="on"); extern void updateHighpassCoeffs(); updateHighpassCoeffs(); saveAudioSettings(); } }
-    else if (key == "hp_cutoff") { uint32_t v; if (argToUInt("value", v) && v>=10 && v<=10000) { extern uint16_t highpassCutoffHz; highpassCutoffHz=(uint16_t)v; extern void updateHighpassCoeffs(); updateHighpassCoeffs(); saveAudioSettings(); } }
+    else if (key == "cpu_freq") { uint32_t v; if (argToUInt("value", v) && v>=40 && v<=160) { cpuFrequencyMhz=(uint8_t)v; if (!powerIdle) { setCpuFrequencyMhz(cpuFrequencyMhz); LatencyHistogram::setCpuMhz(getCpuFrequencyMhz()); } saveAudioSettings(); } }
+    else if (key == "hp_enable") { String v=web.arg("value"); if (v=="on"||v=="off") { extern bool highpassEnabled; highpassEnabled=(v=="on"); extern void retuneAudioFilters(); retuneAudioFilters(); saveAudioSettings(); } }
+    else if (key == "hp_cutoff") { uint32_t v; if (argToUInt("value", v) && v>=10 && v<=10000) { extern uint16_t highpassCutoffHz; highpassCutoffHz=(uint16_t)v; extern void retuneAudioFilters(); retuneAudioFilters(); saveAudioSettings(); } }
+    else if (key == "wifi_static_ip") { String v=web.arg("value"); if (v=="on"||v=="off") { wifiStaticFromLease=(v=="on"); saveAudioSettings(); } }
+    else if (key == "power_schedule") { String v=web.arg("value"); if (v=="on"||v=="off") { powerScheduleEnabled=(v=="on"); saveAudioSettings(); } }
+    else if (key == "power_windows") { if (!setPowerWindows(val.c_str())) { apiSendJSON(F("{\"ok\":false,\"error\":\"bad_power_windows\"}")); return; } saveAudioSettings(); }
+    else if (key == "timezone") { if (setPowerTimezone(val.c_str())) saveAudioSettings(); }
+    else if (key == "filters") { extern bool setFilterChain(const char*); if (!setFilterChain(val.c_str())) { apiSendJSON(F("{\"ok\":false,\"error\":\"bad_filter_spec\"}")); return; } saveAudioSettings(); }
     else if (key == "oh_enable") { String v=web.arg("value"); if (v=="on"||v=="off") { overheatProtectionEnabled = (v=="on"); if (!overheatProtectionEnabled) { overheatLockoutActive = false; } saveAudioSettings(); } }
     else if (key == "oh_limit") { uint32_t v; if (argToUInt("value", v) && v>=OH_MIN && v<=OH_MAX) { uint32_t snapped = OH_MIN + ((v - OH_MIN)/OH_STEP)*OH_STEP; overheatShutdownC = (float)snapped; overheatLockoutActive = false; saveAudioSettings(); } }
     apiSendJSON(F("{\"ok\":true}"));
@@ -477,17 +1240,28 @@ void webui_begin() {
     web.on("/api/audio_status", httpAudioStatus);
     web.on("/api/perf_status", httpPerfStatus);
     web.on("/api/thermal", httpThermal);
+    web.on("/api/snapshot", httpSnapshot);
+    web.on("/api/events", httpEvents);
+    web.on("/metrics", httpMetrics);
     web.on("/api/thermal/clear", HTTP_POST, httpThermalClear);
     web.on("/api/logs", httpLogs);
+    web.on("/api/preroll.wav", httpPrerollWav);
+    web.on("/api/mel", httpMel);
+    web.on("/api/recordings", httpRecordings);
+    web.on("/api/recording", httpRecording);
     web.on("/api/action/server_start", httpActionServerStart);
     web.on("/api/action/server_stop", httpActionServerStop);
     web.on("/api/action/reset_i2s", httpActionResetI2S);
-    web.on("/api/action/reboot", [](){ webui_pushLog(F("UI action: reboot")); apiSendJSON(F("{\"ok\":true}")); scheduleReboot(false, 600); });
-    web.on("/api/action/factory_reset", [](){ webui_pushLog(F("UI action: factory_reset")); apiSendJSON(F("{\"ok\":true}")); scheduleReboot(true, 600); });
+    web.on("/api/action/bench", httpActionBench);
+    web.on("/api/action/reboot", [](){ webui_pushLog("UI action: reboot"); apiSendJSON(F("{\"ok\":true}")); scheduleReboot(false, 600); });
+    web.on("/api/action/factory_reset", [](){ webui_pushLog("UI action: factory_reset"); apiSendJSON(F("{\"ok\":true}")); scheduleReboot(true, 600); });
     web.on("/api/set", httpSet);
+    static const char* headerKeys[] = { "If-None-Match", "Range" };
+    web.collectHeaders(headerKeys, 2);
     web.begin();
 }
 
 void webui_handleClient() {
     web.handleClient();
+    sseService();
 }
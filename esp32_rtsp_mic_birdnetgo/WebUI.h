@@ -5,13 +5,18 @@
 void webui_begin();
 void webui_handleClient();
 
-// Push a log line from main into the Web UI ring buffer
-void webui_pushLog(const String &line);
+// Push a log line from main into the Web UI ring buffer (copied into a
+// fixed arena; no allocation per line)
+void webui_pushLog(const char* line, size_t len);
+void webui_pushLog(const char* line);
+void webui_pushLogf(const char* fmt, ...) __attribute__((format(printf, 1, 2)));
 
 // Microphone type detection for WebUI
-// PDM microphones don't use shift bits
+// PDM microphones don't use shift bits, and have no second (R) slot
 #if defined(MIC_TYPE_PDM)
     #define WEBUI_HAS_SHIFT_BITS 0
+    #define WEBUI_HAS_MIC_MODES 0
 #else
     #define WEBUI_HAS_SHIFT_BITS 1
+    #define WEBUI_HAS_MIC_MODES 1
 #endif
@@ -0,0 +1,1412 @@
+// Generated by tools/embed_webui.py from webui/index.html - do not edit
+#pragma once
+#include <Arduino.h>
+
+// 74919 bytes of HTML, gzip 22443 bytes
+#define WEBUI_INDEX_ETAG "\"14c23ffd40a7e24c\""
+static const size_t WEBUI_INDEX_GZ_LEN = 22443;
+static const uint8_t WEBUI_INDEX_GZ[] PROGMEM = {
+    0x1f,0x8b,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0xb5,0xbd,0x6b,0x6f,0x1c,0x47,
+    0x96,0x28,0xf8,0xdd,0xbf,0x22,0xdc,0x6e,0x3a,0xab,0xa0,0x62,0xf1,0x21,0x51,0x96,
+    0x8b,0x2a,0x0a,0xb2,0x1e,0x96,0xc6,0x94,0xc4,0x11,0x65,0xb9,0xc7,0x3d,0x06,0x27,
+    0xab,0x32,0x8a,0x95,0xac,0xac,0xcc,0x9c,0x7c,0x14,0x59,0x25,0x69,0xd1,0x9f,0x16,
+    0xf3,0x61,0x1a,0x17,0x7b,0xe7,0x02,0xb3,0x7d,0xbd,0x58,0xac,0x3e,0xcc,0x05,0xfc,
+    0xc1,0xf0,0xdd,0xbd,0xb8,0x58,0x60,0x81,0xee,0x0f,0x4d,0xf1,0x8f,0xf8,0x97,0xec,
+    0x79,0x44,0x44,0x46,0x3e,0x8a,0x0f,0x49,0xdd,0x0f,0xb1,0x32,0xe2,0xc4,0xc9,0x88,
+    0x13,0x27,0xce,0x23,0xe2,0xc4,0xc9,0xdb,0x9f,0x7a,0xd1,0x30,0x9b,0xc7,0x52,0x8c,
+    0xb3,0x69,0xb0,0x73,0x5b,0xfd,0x2b,0x5d,0x6f,0xe7,0xf6,0x54,0x66,0xae,0x18,0x8e,
+    0xdd,0x24,0x95,0x59,0xdf,0xc9,0xb3,0xd1,0xea,0x2d,0x67,0xe7,0x13,0x2e,0x0e,0xdd,
+    0xa9,0xec,0x3b,0x33,0x5f,0x1e,0xc7,0x51,0x92,0x39,0x62,0x18,0x85,0x99,0x0c,0x01,
+    0xec,0xd8,0xf7,0xb2,0x71,0xdf,0x93,0x33,0x7f,0x28,0x57,0xe9,0xa1,0xe3,0x87,0x7e,
+    0xe6,0xbb,0xc1,0x6a,0x3a,0x74,0x03,0xd9,0xdf,0x40,0x1c,0x99,0x9f,0x05,0x72,0xe7,
+    0xc1,0xfe,0xde,0xf5,0x4d,0xf1,0xfc,0xc5,0xfe,0x9e,0x78,0xe2,0x0f,0xc5,0x28,0x4a,
+    0xc4,0x57,0x7e,0xe2,0x3d,0x7d,0xf0,0x62,0xf5,0xeb,0xe8,0xf6,0x1a,0x03,0x7d,0x72,
+    0x3b,0xcd,0xe6,0xf0,0xb7,0x97,0x44,0x51,0xf6,0x6a,0x75,0x75,0x70,0xd8,0xfb,0x6c,
+    0x7d,0xb0,0xb1,0xbe,0xb9,0xbe,0xbd,0xba,0x3a,0x82,0x07,0xf9,0x85,0x1c,0x8c,0x36,
+    0xe1,0x61,0x9a,0x67,0xd2,0xeb,0x7d,0xf6,0xa5,0xeb,0x5e,0x1f,0xe0,0xf3,0xd0,0x4d,
+    0xe0,0x71,0x63,0x73,0xc3,0xdd,0x94,0xf0,0x38,0x88,0x12,0x4f,0x26,0x50,0x30,0xd8,
+    0xfc,0xe2,0xc6,0x16,0x14,0xb8,0xc3,0x61,0xef,0xb3,0x1b,0xd2,0xdd,0x18,0x5d,0xe7,
+    0xa7,0xcd,0xde,0x67,0xd7,0x6f,0x7a,0xd7,0xbf,0xfc,0x12,0x1e,0x8f,0xdd,0x24,0xec,
+    0x7d,0x36,0xda,0xfa,0x52,0xae,0x0f,0xb0,0xb1,0x0b,0xa8,0xe4,0xe8,0x06,0xfc,0xe7,
+    0xcd,0x27,0x83,0xc8,0x9b,0xbf,0x1a,0xc1,0x88,0x57,0x47,0xee,0xd4,0x0f,0xe6,0xbd,
+    0x74,0x9e,0x66,0x72,0xba,0x9a,0xfb,0x9d,0x7d,0x79,0x18,0x49,0xf1,0xed,0xe3,0xce,
+    0xf3,0x68,0x10,0x65,0x51,0xe7,0x6e,0x02,0x23,0xef,0xa4,0x6e,0x98,0xae,0xa6,0x32,
+    0xf1,0x47,0xdb,0x53,0x37,0x39,0xf4,0xc3,0xde,0xfa,0xf6,0xc0,0x1d,0x4e,0x0e,0x93,
+    0x28,0x0f,0xbd,0x5e,0xe0,0x87,0xd2,0x4d,0x56,0x0f,0x13,0xd7,0xf3,0x81,0x88,0xad,
+    0x8d,0x5b,0xeb,0x9e,0x3c,0xec,0xa8,0x61,0x8a,0xf5,0x15,0xf8,0x39,0xda,0xd8,0xba,
+    0xbe,0x2e,0x36,0xd6,0xd7,0x57,0xda,0xdb,0xc3,0x28,0x88,0x92,0xde,0xcc,0x4d,0x5a,
+    0x48,0x81,0xf6,0x9b,0x4f,0xba,0xb1,0x7b,0x28,0x5f,0x4d,0xdd,0x13,0xa6,0x78,0x0f,
+    0xc0,0xd6,0xe3,0x13,0xf3,0x2e,0xe1,0xe6,0x59,0xb4,0x1d,0xbb,0x9e,0xe7,0x87,0x87,
+    0xbd,0x8d,0x9b,0xf1,0x09,0x34,0x19,0xcb,0x24,0x7a,0xe5,0xf9,0x69,0x1c,0xb8,0xf3,
+    0xde,0x28,0x90,0x27,0xdb,0x47,0x79,0x9a,0xf9,0xa3,0xf9,0xaa,0x9a,0xcb,0x5e,0x1a,
+    0xbb,0x30,0x87,0x03,0x99,0x1d,0x4b,0x19,0x6e,0xbb,0x81,0x7f,0x18,0xae,0xfa,0x30,
+    0xce,0xb4,0x37,0x84,0x6a,0x99,0x28,0xfc,0x40,0xd8,0x2c,0x8b,0xa6,0xbd,0x8d,0x4d,
+    0xc2,0x3b,0x48,0xdc,0xd0,0x2b,0x23,0x6e,0x68,0x7a,0xe8,0xc6,0xd0,0x4b,0xe8,0x23,
+    0x02,0xac,0x1e,0x27,0xf0,0x88,0xff,0x40,0x7b,0x9a,0x75,0xa6,0xee,0xb1,0xf4,0x0f,
+    0xc7,0x59,0xef,0x8b,0xf5,0xf5,0x6d,0x7a,0x4e,0xfd,0x85,0xec,0x6d,0xdc,0x82,0x56,
+    0x81,0xcc,0x00,0xcb,0x2a,0xf6,0x10,0x87,0xd4,0xc5,0x57,0x8b,0x6e,0x9a,0x0f,0xb8,
+    0xb5,0x4d,0x20,0xe2,0x8a,0xb6,0x8d,0xe0,0x3a,0xf7,0xd3,0xf5,0x80,0x66,0xba,0x9f,
+    0x7e,0x88,0x93,0xb0,0x3a,0x08,0xa2,0xe1,0x64,0x5b,0x71,0xca,0x46,0x7c,0x22,0xd2,
+    0x28,0xf0,0x3d,0xc1,0x98,0xb8,0xb8,0x4c,0x7e,0x85,0x5d,0xd3,0x16,0xfa,0x21,0x80,
+    0xbc,0x0a,0xc3,0x2a,0x4e,0x68,0x9e,0xf6,0xb0,0xc7,0xd6,0xfb,0x37,0xcd,0xd4,0xac,
+    0x06,0x72,0x94,0x61,0x35,0xf4,0x07,0xb9,0xf5,0x95,0xc5,0x14,0x8c,0x1f,0x4b,0xdb,
+    0x17,0x75,0xa8,0xfc,0x36,0xc2,0x6f,0x26,0xdb,0x7a,0x99,0x35,0x4f,0xd0,0xe4,0x64,
+    0x35,0x1d,0xbb,0x5e,0x74,0x0c,0xec,0x81,0x78,0xf1,0xff,0xc9,0xe1,0xc0,0x6d,0xad,
+    0x77,0xf0,0xbf,0xdd,0x4d,0x64,0xab,0x24,0x3a,0x36,0x14,0x3a,0x4c,0x7c,0x6f,0x1b,
+    0xff,0x59,0x85,0x79,0x84,0x92,0x4c,0x02,0xa3,0x04,0xf9,0x34,0x4c,0x7b,0x89,0x8c,
+    0xa5,0x9b,0xb5,0x90,0xcb,0x56,0x47,0x7e,0xd6,0x99,0xfa,0x21,0xf0,0x62,0xeb,0xfa,
+    0x26,0x4c,0x70,0x67,0x63,0x94,0xb4,0xdb,0x3c,0xdf,0x34,0x4b,0xe3,0x8d,0x57,0x05,
+    0x2d,0x36,0x4b,0x6c,0xba,0x2e,0x6e,0x10,0xc4,0xa6,0x05,0xb1,0xb1,0x55,0x40,0x40,
+    0xad,0xc0,0x35,0x00,0x25,0xcb,0x66,0x58,0xb1,0xcc,0x4d,0x60,0x99,0x26,0x1e,0xf9,
+    0x24,0x73,0x07,0xc0,0x1f,0x66,0x95,0xac,0x68,0xda,0x01,0xbe,0xc0,0x8d,0x53,0xd9,
+    0xd3,0x3f,0xde,0x88,0xcc,0x7b,0xa5,0xa9,0x78,0xab,0x3c,0xad,0x9a,0x90,0xcd,0xd3,
+    0x81,0x2d,0xbb,0x93,0x26,0x1e,0xe4,0xd7,0xde,0xb8,0xb1,0x42,0x20,0xb3,0x57,0x95,
+    0x1e,0x83,0x60,0xc9,0x01,0x71,0xd8,0x49,0x65,0x20,0x87,0x19,0xc8,0xcd,0x38,0xcf,
+    0x08,0x08,0xd8,0x13,0x96,0xab,0x9f,0x6d,0xdb,0x1d,0x22,0x3a,0x54,0xa6,0xbe,0x28,
+    0x5a,0xce,0x2c,0x05,0x8b,0x7d,0xb6,0xee,0x6d,0xdc,0xd8,0xfc,0xa2,0x2e,0x4f,0xb8,
+    0x1f,0xaf,0x4a,0xa0,0x72,0x63,0x6b,0xd3,0x7d,0x23,0xb8,0xaa,0x37,0x8e,0x66,0x32,
+    0x79,0x55,0x10,0xcf,0xb4,0x07,0x31,0xda,0xd6,0x50,0x5d,0x77,0x98,0xf9,0x33,0x59,
+    0xe7,0x6a,0x04,0x52,0x6f,0xfd,0x6c,0xfd,0xe6,0xc6,0x06,0xc8,0xf2,0x12,0xaa,0xcf,
+    0x36,0xdd,0x2f,0x3c,0x0f,0x24,0x2d,0x61,0x88,0xc2,0xb4,0x2c,0x4f,0xca,0x32,0x83,
+    0x78,0xeb,0x56,0xc1,0xe6,0x59,0x44,0x8f,0x20,0x0f,0xa2,0xf2,0x2c,0xa0,0x84,0x87,
+    0xbe,0x75,0x51,0xb4,0x97,0x2a,0xb0,0x00,0x2b,0x40,0x24,0x94,0xca,0xe1,0x19,0x8b,
+    0x03,0x37,0x3c,0x7c,0x35,0x0a,0x22,0x37,0xeb,0x25,0x38,0x57,0x50,0x34,0x8d,0xc2,
+    0xa8,0xa4,0x01,0x72,0x7f,0x15,0xcb,0x48,0x64,0x76,0xee,0x41,0x8f,0xa3,0xc0,0x4d,
+    0x3b,0x4f,0x64,0x18,0x44,0x1d,0x53,0xf1,0xe6,0x13,0x9a,0xd2,0xdf,0xa3,0xbe,0xed,
+    0x87,0xf9,0x74,0x20,0x93,0x1f,0x34,0x2f,0x5e,0x5f,0xc7,0x2e,0xf3,0xcc,0xbf,0x82,
+    0x05,0xa4,0x25,0xf9,0x06,0x95,0x77,0x89,0x83,0x1a,0x78,0x0a,0x48,0x34,0xf2,0x65,
+    0x70,0x39,0x81,0xcb,0x54,0xc9,0x41,0x1d,0x5f,0x20,0x21,0x59,0x9c,0x8e,0x65,0x10,
+    0x57,0x05,0xe4,0x32,0xf4,0x55,0xdd,0xa1,0x8a,0xd5,0x20,0x70,0xed,0x8c,0x99,0xcf,
+    0x37,0x6e,0x2e,0x67,0x51,0x62,0x8b,0x32,0x47,0x6f,0xc1,0x12,0xad,0x88,0xce,0x0a,
+    0xb7,0x96,0x44,0x29,0x21,0xb7,0xb9,0xd6,0xdd,0xd8,0xdc,0xbc,0xb1,0x3d,0xcc,0x93,
+    0x14,0xda,0xc4,0x91,0x8f,0xbd,0x52,0x43,0x53,0x3c,0x3c,0xf2,0x03,0x28,0xeb,0x0d,
+    0x68,0x6a,0x43,0x99,0xa6,0xad,0x8d,0xee,0x06,0x4e,0xfb,0x18,0x80,0x5f,0x59,0x3c,
+    0x75,0xd3,0x12,0xab,0xb7,0x2e,0xb1,0xce,0x6a,0x2a,0xa0,0xb2,0xf2,0x6e,0x6e,0x0e,
+    0x6b,0x63,0xa9,0x0c,0x95,0x48,0xae,0x09,0xd7,0xbd,0xbe,0x05,0xb3,0xed,0xf9,0x49,
+    0x36,0x6f,0x5a,0x78,0xc8,0xac,0x9f,0xfa,0x53,0x34,0xc7,0xdc,0x30,0xdb,0x16,0x25,
+    0x09,0x8f,0xff,0xdd,0xd4,0x12,0x7e,0xf3,0xfa,0x97,0x9d,0x9b,0xb7,0xf0,0x7f,0xdd,
+    0xcd,0xad,0xb6,0xf0,0x43,0xb0,0xef,0x00,0xde,0xea,0xdd,0x86,0x0b,0xfd,0xdb,0x84,
+    0xb7,0x1d,0x8e,0x35,0x05,0x12,0xee,0x44,0x55,0xf6,0xd2,0x94,0x65,0xf2,0x24,0x5b,
+    0xf5,0xe4,0x30,0x4a,0x5c,0x5c,0xad,0xbd,0x30,0x0a,0xe5,0x45,0xe4,0xd1,0x94,0x44,
+    0x99,0x7e,0xab,0x49,0x63,0xc2,0x0c,0x1c,0x8e,0x2f,0x90,0x33,0x9f,0xc4,0x09,0x08,
+    0xf3,0x31,0x70,0x22,0x89,0x79,0xd9,0x83,0x67,0x12,0x0c,0xdb,0xc7,0xd0,0x62,0x75,
+    0x90,0x48,0x77,0xd2,0xa3,0x7f,0x57,0xb1,0xa0,0x3c,0x03,0xc3,0x8d,0xeb,0x9b,0x5b,
+    0x57,0x54,0xad,0xeb,0xb6,0x6a,0xc5,0x07,0xec,0x1e,0x88,0x86,0xe3,0x1e,0x2a,0xbf,
+    0x37,0x02,0xde,0xff,0x59,0x10,0x1d,0xa6,0xaf,0xd4,0xa4,0xdd,0xd8,0x9a,0x8d,0x81,
+    0x8c,0x08,0x05,0x8b,0xe8,0x55,0x1c,0xa5,0x3e,0x51,0x68,0xe4,0x9f,0x48,0x6f,0x9b,
+    0x28,0x0f,0xa6,0xa0,0x5e,0x63,0x44,0xb7,0xcb,0x2f,0x2e,0x6b,0x34,0xb6,0xe6,0xbe,
+    0xd9,0xde,0x5e,0xac,0xfa,0xa1,0x27,0x4f,0x7a,0x5f,0xc2,0x7f,0x50,0x0e,0xf2,0xeb,
+    0x41,0xc0,0x45,0x27,0xef,0x69,0x62,0xd8,0xc6,0xa3,0xd8,0x6c,0xd0,0x3c,0x4d,0x2b,
+    0x93,0xf8,0x82,0xc6,0x63,0x2c,0x46,0x23,0xd8,0x36,0x6f,0xa2,0x60,0xfb,0xe4,0xf6,
+    0x1a,0x5b,0xf7,0xb7,0xd7,0xd8,0xe7,0x40,0xd3,0x1a,0x4c,0x7e,0xcf,0x9f,0x09,0xdf,
+    0xeb,0x3b,0xd1,0x2c,0x01,0xdf,0x02,0x44,0x69,0x8a,0xbf,0x69,0x14,0xce,0x0e,0xd5,
+    0xaa,0x42,0x18,0x91,0xa3,0x21,0x0f,0xa6,0xe9,0xa1,0xb3,0xf3,0x5c,0xa6,0x99,0x9b,
+    0x64,0xd0,0xd9,0x5f,0xff,0xf0,0xdf,0x6e,0xaf,0x01,0xec,0x0e,0xff,0xfb,0x89,0xdd,
+    0x0e,0x0d,0x66,0xa7,0x5c,0x84,0x74,0x28,0x23,0x47,0x13,0x99,0x4b,0xca,0xef,0x44,
+    0x0b,0xb7,0x0c,0x49,0x66,0x27,0x77,0x24,0x3b,0xe0,0x87,0x8b,0xbc,0x1b,0xc2,0x0a,
+    0x5c,0x1b,0x1a,0xb4,0x68,0x90,0x32,0x8e,0xd1,0xf1,0x0c,0xf0,0xaf,0x61,0xad,0xea,
+    0xbc,0xfd,0x32,0x6d,0xe6,0x3a,0x3b,0xdf,0x3e,0xdf,0xed,0x89,0xdb,0x2e,0xb5,0x49,
+    0xb2,0x34,0x36,0xb4,0x42,0x95,0xe3,0x88,0x71,0x22,0x47,0x7d,0xe7,0x33,0x47,0x00,
+    0x41,0x0e,0xd1,0x87,0x3b,0x18,0x80,0x2e,0x9b,0x20,0x6a,0x77,0x67,0x29,0x69,0x50,
+    0xdd,0x01,0x88,0xab,0x9a,0x8f,0xb3,0x2c,0x4e,0x7b,0x6b,0x6b,0x87,0x7e,0x36,0xce,
+    0x07,0xdd,0x61,0x34,0x5d,0xdb,0xcf,0x27,0x72,0xb8,0x58,0x1b,0xc0,0x68,0x42,0x99,
+    0x1d,0x46,0xab,0x32,0x8d,0xaf,0x6f,0xae,0x62,0x0f,0x56,0xa7,0xfe,0xb0,0xf6,0x3e,
+    0x8d,0xf9,0x70,0xec,0xec,0x7c,0xed,0x67,0x8f,0xf2,0x01,0x76,0x60,0x17,0xde,0x03,
+    0xbd,0x67,0x95,0x47,0x43,0xc0,0x37,0xef,0xcb,0x00,0x5e,0x1e,0xc5,0xb8,0x4c,0x80,
+    0x07,0x83,0x1c,0xdc,0x4c,0x19,0x02,0x35,0xc3,0xc3,0xc0,0x4f,0xc7,0xb7,0xd7,0xb8,
+    0xaa,0x0a,0x32,0x4c,0x9d,0x9d,0x77,0xff,0x2a,0xcf,0xde,0xc2,0xc4,0xbb,0x05,0xd0,
+    0x1a,0x63,0x2f,0x0d,0xb6,0x61,0xc8,0x60,0xe7,0x36,0x33,0xc3,0x78,0x53,0xcd,0x29,
+    0xf0,0x54,0x96,0xc3,0x3b,0xf6,0xe9,0x2f,0x70,0xeb,0xe6,0xce,0x6d,0xb2,0x25,0xd1,
+    0x99,0x4d,0xe0,0xb7,0xa7,0x5b,0x4e,0x34,0x1b,0xf8,0xb1,0xb3,0xf3,0x78,0x4f,0xdc,
+    0xf5,0xbc,0x04,0xb4,0x0a,0xb8,0xb3,0x9e,0x0d,0x36,0x63,0x30,0x04,0xe2,0xaa,0x35,
+    0x40,0xb3,0x14,0xd7,0xb1,0x3f,0xf2,0x0f,0x92,0x34,0xf5,0x9d,0x9d,0xef,0xfc,0x87,
+    0xbe,0x78,0xbe,0xbf,0xff,0x78,0x09,0x46,0x86,0xba,0x2c,0xce,0xec,0x44,0x61,0x7c,
+    0xf1,0x3b,0xb1,0x17,0x1d,0xcb,0x64,0x09,0xd6,0x63,0x04,0xbc,0x04,0x52,0x58,0xc5,
+    0x30,0xa2,0x87,0x89,0x94,0xe2,0x11,0xfc,0x14,0x2d,0x58,0xf1,0xed,0x25,0x38,0x19,
+    0xf6,0x12,0x48,0x73,0x98,0xcd,0x29,0xb2,0x3b,0xfd,0x5d,0x82,0x4d,0x03,0x5d,0x02,
+    0xdf,0x20,0x8a,0x32,0x9a,0xca,0x24,0xcb,0xe3,0x25,0xe8,0x18,0xe6,0x12,0xc8,0x90,
+    0xeb,0x0f,0xc0,0xb7,0x07,0xe9,0x04,0xc2,0x07,0x57,0xfb,0x3e,0x3d,0x2c,0xc1,0x9b,
+    0x26,0xb3,0x4b,0xa1,0x1d,0x06,0xb8,0x15,0xe0,0xec,0xdc,0xa3,0xbf,0x4b,0x90,0x69,
+    0xa0,0x4b,0xe0,0x4b,0x33,0x50,0x83,0x30,0x19,0x87,0x38,0x70,0xf5,0x73,0x59,0x17,
+    0xa9,0xfe,0x52,0x58,0xe3,0x09,0x10,0x00,0x5c,0x41,0x67,0x67,0x0f,0xd4,0x8a,0xcc,
+    0xc4,0x73,0x78,0x58,0xc6,0x98,0x04,0x77,0x09,0xa4,0xf0,0x08,0xe3,0x8f,0xc2,0x10,
+    0x56,0xae,0x03,0x62,0x22,0xcd,0x58,0x8a,0xde,0xe3,0xa2,0x25,0xe8,0x03,0x68,0x71,
+    0x79,0xf4,0x31,0x69,0x12,0xc2,0xcd,0xe4,0x10,0xc4,0x0e,0xcb,0x70,0x33,0xb8,0x8d,
+    0x7c,0x8d,0x57,0xbf,0x2d,0x33,0x94,0xaf,0x82,0x92,0x84,0xfd,0x1f,0x11,0x85,0x30,
+    0x43,0xc3,0x49,0xff,0x37,0x50,0xd5,0x72,0x98,0x49,0x0e,0x48,0x3d,0x39,0xed,0xdf,
+    0x30,0x9b,0x1d,0x00,0x43,0x1c,0x60,0xcf,0x99,0x6b,0xc4,0xb3,0xa7,0xb7,0xd7,0xb8,
+    0xf5,0x85,0x68,0xa2,0xb8,0x82,0x65,0x34,0x2a,0xd0,0x3c,0x7c,0x78,0x11,0x1e,0x90,
+    0x4a,0x12,0xa4,0xd4,0x66,0x5a,0x60,0xa1,0x22,0x52,0xa1,0x30,0x95,0x8f,0x37,0xf7,
+    0xcf,0x41,0x91,0x48,0x5c,0x21,0x4f,0xa3,0xe3,0x96,0xd5,0x9a,0x17,0xcd,0x73,0xfa,
+    0x7b,0x4e,0x5b,0x4f,0x8e,0xdc,0x3c,0xc8,0xd2,0x52,0x6b,0x5d,0xe8,0xec,0xdc,0x57,
+    0xbf,0x2c,0x0c,0xda,0x1e,0x70,0xbd,0x99,0xd1,0x26,0x23,0x78,0x09,0x8c,0x94,0xbc,
+    0x17,0x67,0xb9,0x6c,0xaf,0x4a,0x72,0x37,0xf7,0x7c,0xd0,0xea,0x77,0xf1,0xcf,0xf9,
+    0x72,0x5c,0xa9,0x67,0xb5,0xcc,0x89,0x7b,0xf7,0xdd,0x69,0x1c,0x48,0xc5,0xe5,0xac,
+    0x9e,0x6d,0x15,0x8e,0x6e,0x85,0x92,0x6d,0xaa,0xc1,0x1d,0x0d,0x66,0x9b,0x15,0xe0,
+    0x58,0x14,0x4b,0xe2,0x80,0x1f,0xc9,0x0c,0xea,0x3b,0xb6,0x29,0x58,0x0c,0xaa,0xca,
+    0x94,0x25,0x74,0xe4,0xff,0x41,0x11,0xf9,0x96,0xac,0x54,0x42,0x7e,0xbb,0x20,0x47,
+    0xd3,0x61,0x4f,0x13,0x5f,0x21,0xe3,0xbe,0x83,0x7b,0x83,0x8e,0x80,0xe5,0xdf,0x77,
+    0x6e,0xf1,0x4f,0xf7,0xa4,0xef,0x7c,0x79,0x13,0x7f,0x97,0x47,0x83,0x8e,0xa2,0xb3,
+    0xf3,0x68,0xa1,0x87,0xa0,0xa6,0x91,0xa6,0x2b,0xe3,0x57,0x1c,0x20,0xbf,0x14,0x13,
+    0x0b,0x4f,0xb3,0x16,0x2f,0xf4,0x8e,0xea,0x44,0x97,0x14,0x74,0xfb,0x37,0xc0,0x98,
+    0x05,0x4b,0xd8,0xe3,0xd2,0x6b,0x95,0x09,0x12,0x1d,0x1f,0x5c,0x48,0x14,0xa4,0x44,
+    0x14,0x60,0x9f,0xfa,0xce,0xa6,0xb3,0x84,0xb4,0xd9,0x49,0x66,0x61,0x6a,0x7c,0xe3,
+    0x39,0xb3,0x3d,0x74,0x63,0x35,0x81,0xf7,0xdc,0x38,0xcb,0x93,0xcb,0x4d,0x79,0xd1,
+    0xca,0x4c,0xfb,0x7b,0x4c,0x9d,0xc1,0x72,0xd1,0xf4,0xbd,0xc7,0xdc,0x55,0x66,0x6a,
+    0xc8,0x83,0x3b,0x30,0x33,0xa6,0xdf,0x7d,0xde,0xac,0x35,0x92,0x5b,0x37,0x3c,0xf0,
+    0xc3,0x51,0xe4,0x9c,0x3f,0xc1,0x06,0xf6,0xa3,0x4c,0x72,0x19,0xdb,0x55,0x27,0xfa,
+    0xd0,0xf5,0x41,0xf6,0x7e,0x0d,0xff,0x5e,0x34,0xb9,0x0c,0xf9,0x21,0x13,0x4b,0x18,
+    0x1a,0x27,0x75,0xbd,0xbb,0xa1,0xe7,0x94,0x7e,0xe1,0xac,0x6e,0x2c,0x99,0xd3,0xd3,
+    0x7f,0x5f,0xb2,0x1e,0x11,0x7d,0xe3,0x7a,0xa4,0xf7,0x76,0x54,0x07,0xae,0xbe,0x1e,
+    0x09,0xef,0x47,0x99,0xaa,0x02,0xd3,0x55,0xa7,0x69,0x1c,0x83,0x6a,0x7b,0x04,0x2e,
+    0xf5,0x6a,0xec,0xa2,0x2d,0x7d,0xfe,0x54,0x11,0xf4,0x15,0x67,0xca,0x72,0x43,0xe0,
+    0x27,0xa0,0xa8,0x79,0x21,0xa4,0x5e,0x49,0xaf,0x36,0xbb,0x20,0xa8,0xc4,0x51,0x7b,
+    0xd7,0x7c,0x8f,0xe6,0xb5,0x37,0x8e,0x0f,0x64,0x88,0x9a,0xc7,0xe9,0xf0,0x0b,0xaf,
+    0x3e,0x33,0x30,0xce,0x8f,0x33,0x31,0x06,0xd1,0x7b,0xcc,0xcb,0xc1,0x30,0x47,0x49,
+    0xb3,0xf7,0x50,0xdc,0xcb,0x33,0xa0,0xd1,0x25,0x26,0x87,0x9b,0x7c,0xc8,0x52,0x02,
+    0xe2,0x0d,0xe9,0x6d,0xcb,0x84,0xa4,0x5a,0x4e,0x1b,0xeb,0xc5,0x6a,0x7a,0x4f,0x19,
+    0x59,0xbc,0xaa,0x63,0xbf,0xf8,0xfd,0x66,0x0b,0xda,0x7e,0xbc,0x19,0x33,0xc8,0xae,
+    0x3a,0x6b,0xb8,0xe5,0x09,0x4e,0x1a,0x6d,0x7c,0x8a,0x7b,0xe3,0x4b,0x08,0x3f,0x6e,
+    0xf1,0x21,0x33,0xc6,0xdb,0xac,0xa9,0x9e,0x2f,0xdc,0x1a,0x72,0x04,0x0c,0x7d,0x28,
+    0xc7,0x51,0xe0,0xc9,0x04,0xa6,0x30,0xca,0x86,0xe3,0xde,0xd6,0x7a,0xef,0xfa,0x7a,
+    0x27,0x88,0x7b,0x1b,0x5b,0xa4,0xe9,0x14,0x9d,0xd4,0x46,0xf2,0x0d,0x89,0x7e,0x49,
+    0xc3,0x44,0xf1,0x60,0xd2,0x56,0xf1,0xa6,0x2b,0xab,0x30,0xd5,0xee,0x32,0x1a,0x0c,
+    0x41,0x3f,0xce,0x3c,0x16,0x98,0xae,0x3a,0x89,0x83,0x1c,0xc4,0xd1,0x57,0xf9,0x68,
+    0x04,0x73,0xb8,0xef,0x2f,0x2e,0x34,0x4e,0x08,0xfe,0x6a,0x33,0xf8,0x49,0x55,0x2a,
+    0x12,0x0e,0x25,0xf6,0x76,0x36,0xb7,0x6e,0x56,0x45,0xe1,0xce,0xd6,0xc6,0x66,0x4d,
+    0x3c,0x32,0x0e,0xe9,0xed,0x6c,0xac,0x6f,0xde,0xa8,0xb5,0xd8,0x5c,0xbf,0x71,0xab,
+    0x56,0x78,0x63,0xfd,0xcb,0x3a,0xee,0x5b,0x1b,0x5f,0x6e,0xd6,0xa5,0xeb,0x27,0x0d,
+    0x4b,0x3a,0x25,0x2b,0x3d,0x5d,0xa2,0x27,0x61,0x10,0x8d,0x6a,0x72,0x40,0xb4,0x64,
+    0x69,0x0c,0xbf,0xaf,0xbe,0xc0,0x11,0xf1,0x47,0x61,0x0a,0x83,0xe8,0xaa,0x3c,0xa1,
+    0xb6,0x40,0x94,0x2f,0xfe,0x82,0x36,0x4b,0xce,0xe7,0x0a,0xd5,0xe2,0xc3,0x94,0xa5,
+    0xde,0x79,0x29,0xeb,0x43,0x10,0xb7,0x7d,0xc1,0x0c,0xba,0x4c,0x65,0x6e,0x39,0x3b,
+    0x5b,0xcb,0xea,0x40,0x74,0x03,0xc7,0x2c,0xab,0xdd,0x84,0xda,0xcd,0xa5,0xb5,0x37,
+    0xa0,0xf6,0xc6,0x7a,0x83,0x2a,0xae,0xf3,0xca,0x34,0x3d,0x5f,0xfc,0xf3,0xd8,0x3a,
+    0x66,0x98,0x57,0x16,0x2b,0xd4,0xea,0x32,0x42,0x85,0x01,0x3f,0x0a,0x03,0x59,0xa8,
+    0xae,0xec,0xf9,0x44,0x9e,0x1c,0x82,0xdb,0x83,0x7f,0x2e,0xf4,0x77,0x18,0xf6,0xc3,
+    0x98,0x47,0x21,0xa9,0xcc,0x60,0xb0,0x71,0xd3,0xd9,0xd9,0xdd,0xb8,0x29,0x5a,0x7b,
+    0xf7,0x9e,0xb4,0x97,0xcd,0x73,0x3c,0x9c,0xe6,0xc0,0xee,0xf7,0x9e,0x7c,0x2b,0x5a,
+    0x7f,0xfd,0x9f,0xab,0x81,0x7b,0xbc,0x14,0xd4,0x9b,0xf9,0x37,0x9c,0x9d,0xfb,0x2f,
+    0x1f,0xdf,0x10,0xad,0xbb,0xf7,0xcb,0x48,0x2f,0xb0,0xd4,0xb8,0x87,0x1d,0xd3,0xd9,
+    0xab,0x3b,0x47,0xd8,0xea,0x52,0x9e,0x11,0x01,0x7e,0x1c,0xb7,0xa8,0x40,0x75,0xfe,
+    0x3b,0x71,0xc3,0xfe,0x1c,0x7e,0xa0,0xea,0x27,0xfe,0x30,0x89,0xe2,0x31,0x74,0xe1,
+    0x42,0xdb,0x9b,0xe0,0x3f,0x8c,0x23,0xb8,0x47,0xe5,0xe9,0xa3,0x03,0x8d,0x9d,0x27,
+    0xf0,0xaf,0x68,0xed,0x2e,0x9d,0x64,0xb0,0xfe,0x12,0x19,0xe1,0x0e,0x27,0xfe,0x05,
+    0xc8,0x8d,0x9b,0x6b,0x9b,0x4b,0xa1,0x07,0xb4,0xcb,0xf9,0x15,0x6e,0xfe,0xb5,0x76,
+    0xaf,0x3d,0xbf,0x3c,0x43,0x40,0x07,0x0f,0xa6,0x40,0x5f,0xe6,0x09,0x78,0xba,0xba,
+    0xae,0x40,0x14,0x1f,0x65,0x9e,0x0d,0xa2,0x0b,0x74,0x13,0x8e,0xf5,0x9c,0x77,0x35,
+    0x9b,0x18,0x05,0x81,0xee,0x4b,0x68,0xf0,0x01,0xe6,0x1f,0xbf,0xbf,0xd1,0x56,0x57,
+    0xa6,0xfa,0xea,0xf5,0x4d,0x65,0xab,0x5f,0xdf,0x6c,0x34,0xd4,0x9b,0xb5,0x7a,0x55,
+    0x89,0xc3,0x7b,0x0e,0x3c,0xec,0x2c,0x99,0xeb,0xf8,0xf8,0x1e,0x93,0x43,0x67,0x50,
+    0xcb,0x97,0x04,0x56,0x3f,0x91,0x81,0x78,0x98,0xb8,0xd3,0x4b,0xac,0x08,0x04,0xff,
+    0xc0,0x15,0xd1,0x70,0x28,0xc6,0xee,0x28,0xfa,0x5b,0xcb,0xdd,0xd1,0xef,0xfc,0x6c,
+    0x2c,0x5c,0xde,0xe9,0x5c,0x06,0x15,0xcc,0x9d,0x9d,0xc7,0x21,0xcc,0x85,0xeb,0x89,
+    0x68,0x54,0x85,0xbe,0x68,0x25,0x60,0xe7,0x8a,0x95,0x20,0x83,0x2b,0xcb,0x46,0xc4,
+    0x70,0x09,0xc9,0x88,0x60,0x1f,0x67,0xbd,0x68,0x44,0x57,0xb6,0xad,0x12,0x99,0x44,
+    0x01,0xcc,0xc3,0x5e,0x22,0x57,0xf1,0xd7,0x85,0xa6,0x95,0x6e,0xf0,0x21,0x6e,0x93,
+    0x46,0x52,0x59,0x3a,0xa5,0xfd,0xbf,0x9b,0xec,0x27,0x29,0xc7,0xb7,0x71,0xe9,0x5c,
+    0x60,0xe3,0xf0,0x4b,0xc0,0x2a,0x1e,0xd2,0xaa,0x51,0xcf,0x57,0x37,0x75,0x14,0x9e,
+    0xcb,0x18,0x3b,0x0a,0xf4,0xe3,0x98,0x3b,0x36,0xb2,0x0b,0x36,0x97,0xe5,0xb9,0xda,
+    0x8e,0xaa,0xf7,0xef,0x8b,0xe7,0x18,0xcc,0xe2,0xd1,0x11,0xd9,0x05,0xbb,0xfc,0x1f,
+    0x6e,0x00,0x25,0x0d,0xe6,0xcf,0x85,0x8b,0x3b,0xcf,0x28,0x80,0xe1,0x3b,0x7f,0xf5,
+    0xa1,0x2f,0xf8,0x29,0x5d,0x06,0xec,0x06,0xc7,0xee,0x3c,0x75,0x76,0xee,0xd2,0xdf,
+    0x4b,0xaf,0xed,0x84,0x68,0x60,0x2d,0xef,0xe4,0x3d,0x4c,0x9f,0xe4,0x72,0x86,0x4f,
+    0xf2,0xb1,0xcc,0x9e,0xe4,0x5c,0xa3,0xe7,0x9c,0x99,0x77,0xf1,0xac,0xf1,0x2e,0xc6,
+    0x2b,0xfa,0xd9,0x5c,0x7c,0x7d,0x89,0xdd,0x7e,0x6a,0xf1,0x61,0x53,0x4f,0x28,0x2e,
+    0xd8,0x46,0xac,0x33,0x46,0xe1,0x51,0x97,0x76,0x23,0x2f,0x98,0x4e,0x57,0x8d,0xed,
+    0xe0,0x90,0x36,0xfb,0xd5,0xeb,0xaf,0x3c,0xa1,0xd0,0xe6,0x32,0x13,0x8a,0x60,0x1f,
+    0x65,0x42,0x0d,0xa2,0xf7,0x98,0xd0,0x83,0x6c,0x9c,0xe0,0xe6,0x7e,0x26,0xc5,0x8b,
+    0x71,0x22,0x53,0xdc,0x69,0xba,0xc4,0xac,0x72,0xb3,0x0f,0x91,0xda,0x1a,0x49,0x93,
+    0xd4,0xbe,0xae,0xa4,0xf6,0x8d,0x42,0x68,0x37,0xca,0x6c,0xef,0xab,0xf3,0x85,0xb6,
+    0x99,0xcf,0x4c,0x0f,0xed,0xc0,0x1b,0x90,0xf8,0x56,0x6f,0xbf,0xba,0xdd,0xa3,0x1a,
+    0x7e,0xbc,0x89,0x33,0xc8,0xde,0x67,0xf2,0xc6,0x14,0x87,0x44,0xb3,0xf7,0x08,0x7e,
+    0x46,0x14,0x53,0x71,0xf1,0xe4,0x71,0xb3,0x0f,0x9d,0x3d,0xc2,0xd2,0x34,0x7d,0x1b,
+    0x0d,0x4a,0xf7,0x7d,0x74,0xae,0x99,0xbe,0xb1,0x1a,0xdb,0x41,0x6a,0x26,0x0f,0x8b,
+    0xde,0x6f,0xf6,0xb0,0xe5,0x47,0x5c,0x77,0x06,0xdb,0x25,0xe6,0xcf,0x44,0x57,0x64,
+    0x32,0x1c,0x52,0x6c,0x05,0xfd,0x58,0x16,0x51,0xe1,0x5e,0x10,0xb6,0x52,0x62,0x87,
+    0x40,0xce,0xd0,0x02,0xde,0xf7,0x0f,0x43,0x37,0x10,0xbb,0xf8,0x74,0x11,0x2b,0xa8,
+    0x26,0xcb,0xf9,0x80,0xbb,0xc1,0x50,0x4b,0x28,0x4a,0xb5,0x1f,0x87,0x9c,0x16,0xaa,
+    0xcb,0xd3,0x32,0x4e,0xa2,0x91,0x8f,0x71,0x7e,0x7b,0xfc,0x63,0xc9,0x20,0x0c,0x58,
+    0x53,0x7c,0xca,0xc5,0x01,0x11,0xb1,0x4c,0x46,0x18,0xb4,0x11,0xf8,0xee,0xc0,0x0f,
+    0x80,0x25,0xaf,0x10,0x15,0x81,0x51,0xaf,0x18,0x4b,0x91,0x45,0x64,0x32,0x01,0x1b,
+    0xcf,0x2f,0x5c,0xa3,0xd4,0xe4,0xfd,0xf5,0x26,0xae,0x11,0x42,0x71,0x65,0xbd,0x79,
+    0xbe,0xba,0xd4,0xdb,0xc3,0x88,0xbc,0x71,0x7f,0x98,0x2a,0x12,0x35,0x4a,0x5e,0xab,
+    0x50,0xf2,0x1e,0xeb,0x14,0xf1,0x7c,0x9c,0x35,0x6a,0x30,0x5d,0x55,0xbe,0xa2,0x60,
+    0x26,0xc3,0x6e,0xc7,0x28,0x46,0xf1,0x04,0x9e,0x2f,0x9a,0xbc,0xa2,0xdd,0x07,0x4d,
+    0x60,0x81,0xa6,0x6a,0xaa,0x1a,0x7e,0x5a,0x36,0x91,0x53,0x37,0xcc,0x5d,0xf4,0xbf,
+    0xe9,0xef,0xc5,0xd3,0x09,0xaf,0xc2,0x37,0x35,0xce,0xa8,0xe9,0x46,0xc7,0xea,0xd3,
+    0xd5,0x27,0x54,0xbf,0xe2,0xa3,0xcc,0xa9,0xee,0xc6,0x65,0x9c,0x99,0x8f,0xa6,0xab,
+    0xcf,0xd7,0xd3,0xd6,0xa6,0x95,0x0a,0x2c,0x3a,0x9f,0xb3,0x4c,0x0c,0xf6,0xe5,0xad,
+    0xae,0x0f,0xb6,0xb8,0x1a,0xac,0xad,0xf2,0xf6,0xd2,0x96,0xd2,0xdb,0x9b,0x4b,0x8e,
+    0x81,0xe3,0x49,0xb6,0xb6,0xec,0xc4,0x08,0xc9,0xd3,0xc4,0x3f,0x86,0x1e,0x8a,0x7f,
+    0x2e,0xcd,0x3a,0xe7,0xd0,0x2f,0x1d,0x8e,0x31,0x9c,0x6d,0x1f,0xff,0xe4,0x81,0xf4,
+    0x04,0x05,0xe3,0x5d,0x44,0x3f,0xd5,0xea,0x83,0x16,0xa5,0xc2,0xf1,0xb7,0x72,0x47,
+    0x34,0x31,0xe9,0x35,0x8d,0xe4,0xe4,0x1a,0x8e,0x41,0xec,0xe8,0x0e,0x5d,0x7d,0x39,
+    0x32,0x9a,0x8f,0xb2,0x2e,0x2c,0x54,0x57,0x8e,0x8c,0x88,0xf2,0x24,0xd5,0xa1,0x94,
+    0x77,0x47,0xd9,0xc5,0xc6,0xab,0x6a,0xf1,0x41,0x61,0x11,0x84,0xe2,0xdc,0x75,0x60,
+    0xc2,0x8b,0x6e,0xde,0x6a,0x5c,0x07,0xe3,0x25,0x6b,0x80,0x50,0x37,0x87,0xfb,0x51,
+    0x1c,0x29,0xbf,0xba,0xa3,0x3b,0xf1,0x1e,0xe1,0x11,0xf4,0x82,0x8f,0x13,0x1c,0x51,
+    0xa0,0x6a,0x78,0xe7,0xe5,0x2d,0xa3,0x6c,0x2c,0x93,0x29,0x2a,0x9b,0x17,0xfc,0xe3,
+    0x0a,0x86,0x11,0x35,0x45,0x03,0x2e,0xa3,0x20,0xe6,0x67,0x60,0x33,0x8c,0xa5,0x9b,
+    0x89,0x3d,0x2e,0x81,0x15,0x72,0xb1,0x48,0x2c,0x61,0xf8,0xb0,0x8d,0x86,0x68,0xac,
+    0x83,0x8d,0xfe,0x56,0x66,0x53,0xf1,0x86,0x2a,0x7f,0x14,0x35,0x9d,0x52,0x57,0xde,
+    0x47,0xd1,0x22,0x49,0x70,0x5e,0x0d,0x5d,0x3e,0x5c,0xf3,0xd5,0x50,0x5e,0xdd,0x96,
+    0x42,0x14,0x81,0x3f,0xc5,0xe5,0xb3,0x3f,0xce,0x33,0x2f,0x3a,0x0e,0xc5,0x2e,0x3e,
+    0x5f,0x6e,0x8e,0x55,0xd3,0x0f,0x9e,0x61,0x85,0x47,0xc7,0x4b,0x5c,0xaf,0x1d,0x8f,
+    0xef,0x5c,0xdf,0x6a,0x08,0xb5,0xa8,0x17,0xd5,0xa1,0xb6,0xea,0x50,0x5b,0x75,0xa8,
+    0x9b,0x75,0xa8,0x9b,0x75,0xa8,0x2f,0xea,0x50,0x5f,0x6c,0x2d,0x8f,0x1a,0xb9,0x55,
+    0x07,0xbf,0x55,0x47,0xfa,0x65,0x1d,0xea,0xcb,0xad,0x4b,0x05,0x00,0x7c,0xee,0xc9,
+    0xc3,0xed,0x7b,0x4b,0xa4,0x9e,0xa1,0x6a,0x03,0x53,0x73,0x45,0xc7,0x26,0xfe,0x07,
+    0xb1,0xb4,0x7a,0xd1,0xc7,0x63,0x68,0xcd,0x0f,0x97,0x75,0x37,0xb9,0x69,0xf5,0xa6,
+    0x53,0xa3,0xcb,0x59,0x06,0xbd,0x34,0xee,0x10,0xef,0x59,0xdd,0xcb,0x93,0x44,0x86,
+    0x60,0x1c,0xca,0x69,0x7c,0x2e,0x7a,0x82,0xbe,0x34,0x6e,0xd0,0x6a,0xe0,0x28,0x4b,
+    0x77,0x72,0x31,0x62,0x02,0xbd,0x34,0xe2,0x61,0x9c,0x43,0xa7,0xf7,0xbe,0x15,0xf7,
+    0x30,0x39,0xc4,0xb9,0x88,0x09,0xf4,0xf2,0x27,0x4a,0xc7,0x60,0xf4,0xd2,0xa5,0x2b,
+    0xa1,0xcd,0xbd,0x0b,0xcf,0x94,0x8e,0x93,0x0f,0x0e,0xd6,0x41,0x14,0x7f,0x23,0x25,
+    0x00,0xb8,0x1b,0x4d,0x84,0x18,0x07,0xc9,0xd6,0x54,0xae,0xf5,0x00,0xc0,0x5e,0x7d,
+    0xb9,0xe0,0x0b,0x3e,0xce,0x91,0xd1,0xf1,0x7b,0xee,0x4c,0x62,0xc3,0x63,0x8c,0x04,
+    0xd7,0x17,0x03,0xbe,0xf3,0x43,0x10,0xf8,0xe9,0x87,0x9c,0xf1,0x29,0x94,0xcb,0x43,
+    0x23,0xd7,0xb7,0x7a,0xeb,0xeb,0xab,0xeb,0x5f,0xc2,0xbf,0x9d,0x8d,0x2f,0xf0,0xf7,
+    0xe6,0x46,0xef,0x82,0xe8,0x48,0x7b,0x4e,0x08,0xbb,0x3d,0x27,0xc4,0x75,0x2f,0xe0,
+    0x45,0x7a,0x6e,0x8e,0x79,0x14,0x7c,0xfc,0xc7,0x2d,0xae,0x7e,0xfc,0xc7,0xed,0xce,
+    0x39,0x1e,0xb8,0x80,0xae,0xd9,0x02,0x4c,0x2d,0x7f,0x2a,0xc5,0xf7,0x30,0x9b,0x1f,
+    0x48,0x50,0xc0,0xb5,0x9c,0x9e,0xf7,0x1e,0xbc,0x58,0xdd,0xb8,0xf7,0x60,0xff,0x45,
+    0xe7,0xc9,0xf5,0xee,0x56,0x77,0xbd,0xf3,0x64,0x63,0x1d,0xff,0xae,0x5d,0xbf,0x34,
+    0x49,0x11,0xff,0x12,0x8a,0x62,0xf0,0xd5,0x02,0xf9,0xb1,0x63,0xfa,0xf2,0x9e,0x9e,
+    0xa1,0x45,0x1b,0x94,0xb5,0xd2,0x88,0x8b,0x6c,0xf9,0x35,0x3b,0x0b,0xf8,0x92,0xa8,
+    0xc1,0x59,0x77,0x76,0x1e,0xa4,0x59,0x57,0x28,0xd1,0x7c,0x0e,0x66,0x82,0xbd,0xaa,
+    0x69,0xe4,0xa6,0xfa,0x1e,0x9f,0x36,0x8f,0x2e,0x98,0xdc,0x42,0xa2,0x52,0xdb,0x12,
+    0xab,0x5d,0x46,0x9f,0x06,0x6e,0x36,0x1c,0xbf,0xa7,0x8c,0x10,0x98,0x0d,0xa4,0xaa,
+    0x4f,0x19,0x61,0x03,0xf7,0x33,0xff,0xe9,0x37,0x95,0x33,0x90,0x38,0x0d,0x1b,0x09,
+    0xa4,0x25,0x02,0xe9,0x16,0xd7,0xda,0x3d,0x37,0x3c,0x44,0x37,0xcd,0x30,0x13,0x55,
+    0x2b,0x8f,0x63,0x17,0xdf,0xdb,0x02,0xbe,0x39,0x87,0x69,0x1a,0xfc,0x19,0x75,0x55,
+    0x0e,0xcf,0xf3,0x2f,0xb8,0x0c,0xe7,0xcd,0xdc,0x70,0xc8,0xfe,0x38,0x5e,0x99,0xc7,
+    0x53,0x62,0x55,0x24,0xf6,0x55,0x51,0xd5,0xeb,0x29,0x1c,0xed,0xb1,0x3f,0xca,0xce,
+    0xdb,0x0b,0x52,0x00,0x8f,0x37,0xf7,0x61,0xe2,0xe1,0xe7,0x85,0xbb,0x18,0x0c,0xff,
+    0x21,0x1e,0x30,0xa3,0x38,0xd7,0x03,0xd6,0x61,0x13,0x9b,0x37,0x1a,0x1d,0xe0,0x81,
+    0x9f,0x2d,0xdb,0x07,0x22,0xe4,0xcd,0x5b,0x17,0xf4,0xda,0x8e,0xee,0xc0,0x7b,0x6c,
+    0x5a,0x10,0xea,0x8f,0xb3,0x69,0x51,0xa0,0xba,0x72,0xf0,0xe7,0x18,0x0a,0xee,0x8d,
+    0xe5,0x70,0x22,0x1e,0x63,0xbe,0x86,0x99,0x7b,0xe1,0x39,0x0b,0x35,0xf9,0xa0,0xeb,
+    0x6e,0x80,0xe0,0x52,0x3b,0x16,0x37,0x9b,0x37,0xee,0xa6,0xc5,0xed,0x85,0xca,0x74,
+    0x01,0xe6,0xc6,0xc9,0x1a,0xe2,0x00,0x0f,0x7c,0x35,0x40,0xbe,0xf7,0x36,0x9e,0x5c,
+    0x7d,0xce,0x10,0xff,0xc7,0x89,0xd5,0xd4,0x88,0x2e,0x90,0x6d,0x27,0x1f,0x69,0xb7,
+    0xf7,0xe4,0xfd,0xb8,0x43,0x25,0x0c,0x00,0xdc,0x45,0xb2,0x80,0x0b,0xfc,0xdb,0x93,
+    0x0f,0xbe,0x72,0x40,0x79,0x07,0x94,0xdd,0xb9,0xba,0xd1,0xad,0xbb,0x79,0x9b,0x0d,
+    0x65,0x5b,0x0d,0x65,0x5f,0x34,0x94,0xdd,0xea,0xd6,0x3d,0xc9,0x8d,0xa6,0x97,0x6c,
+    0x5c,0xaf,0x17,0x5a,0x17,0x1b,0x9a,0xde,0xb7,0xd1,0xf4,0xc2,0x8d,0xc6,0x37,0x7e,
+    0xd9,0x04,0xf9,0x65,0x77,0xeb,0x72,0xb7,0x1d,0xbc,0xaf,0xa6,0xcb,0xf6,0xad,0x4f,
+    0x1a,0xf9,0x5f,0x27,0x7e,0xe8,0x30,0x7d,0x3f,0xc6,0xae,0xf5,0xf1,0x08,0x4d,0x0e,
+    0x8c,0xdb,0x7d,0x2e,0xf3,0x54,0x8a,0xc7,0x7b,0x62,0x57,0xba,0xe9,0x85,0xfe,0x4c,
+    0xd1,0xee,0xc3,0x9c,0x9a,0x02,0xcf,0xdf,0xc8,0xb3,0xd1,0x2f,0x58,0x4e,0x50,0x55,
+    0xef,0xc7,0x4c,0x57,0xdd,0xe0,0xea,0x62,0xc5,0xbc,0xea,0xa3,0x2c,0xf6,0x32,0xb6,
+    0x2b,0x2b,0x04,0xed,0xfb,0x3e,0x4c,0xe4,0x3f,0xe7,0x7c,0x9e,0x7f,0x81,0x3e,0xc0,
+    0x16,0x1f,0xb8,0xe6,0xd9,0x8d,0xd6,0x6b,0xb4,0x61,0x6d,0x6c,0x9e,0xb7,0x18,0x6f,
+    0x5e,0xee,0xe2,0xc7,0x93,0xa5,0x17,0xdb,0xe1,0xf5,0xcd,0x7a,0x03,0xca,0x47,0x40,
+    0x07,0x75,0x15,0x20,0xce,0xdf,0x43,0x65,0x00,0x8a,0x8f,0xa3,0x32,0x34,0xa2,0x2b,
+    0x47,0xd6,0x0c,0x12,0xb4,0xf1,0xc0,0x79,0xf5,0x67,0x52,0x7c,0xe5,0x67,0xc9,0x65,
+    0x42,0xdd,0x06,0x1f,0xbc,0xed,0x40,0x28,0xfe,0xd6,0x67,0x4b,0xf0,0x92,0xe6,0xa3,
+    0xfb,0x81,0xba,0xd7,0x05,0x3f,0xae,0x1e,0xf1,0x06,0x48,0x2f,0x13,0xf1,0x36,0xf8,
+    0x58,0x81,0x53,0x83,0xe4,0xb2,0x67,0x17,0x17,0x1f,0x61,0x60,0x32,0x32,0xf0,0xbd,
+    0x22,0x6d,0xc6,0xc7,0x89,0xe4,0xc0,0x17,0x2c,0x2f,0x65,0x8b,0x02,0xa4,0x50,0x59,
+    0x45,0xad,0xfe,0xa4,0xc3,0xc4,0x8f,0x41,0xfd,0x0c,0xa3,0x10,0xbc,0xb8,0x17,0xfd,
+    0x57,0x32,0xec,0xbd,0xa2,0x24,0x54,0x3d,0xe7,0xdc,0x3c,0x57,0x40,0x76,0xda,0x24,
+    0xec,0x39,0xbc,0x9f,0x08,0xd6,0x56,0xdc,0x73,0x8a,0xb4,0x48,0x4e,0xc7,0xa4,0x36,
+    0xea,0x39,0x26,0xb5,0x91,0x2a,0xcd,0x4e,0x54,0x99,0xb6,0x37,0x9c,0x0e,0xe6,0x0c,
+    0xea,0x39,0x95,0xfc,0x42,0x4e,0x87,0x93,0xff,0xf4,0x9c,0x6f,0xd5,0x75,0x2d,0x2b,
+    0x29,0x4f,0xcf,0xb1,0x92,0xf2,0x38,0x1d,0x4e,0x99,0xd3,0x73,0x38,0xaf,0x0e,0x76,
+    0x4f,0x25,0xc3,0xc1,0x1e,0xea,0x14,0x39,0x1d,0x9d,0xd7,0xa6,0xe7,0x58,0x79,0x6d,
+    0x9c,0x8e,0x9d,0x99,0xa6,0xe7,0xd4,0x32,0xd3,0x28,0x00,0x9a,0x75,0xa7,0x96,0x5b,
+    0xc6,0xe9,0x50,0x6c,0x7d,0xcf,0xa1,0xd4,0x23,0xd0,0x47,0xc2,0x6f,0x65,0x14,0x71,
+    0x3a,0x78,0x41,0xbe,0xe7,0x7c,0x4d,0xf7,0xf5,0x07,0xf9,0xa8,0xe7,0x58,0xf7,0x3b,
+    0x11,0x39,0x45,0x54,0x21,0x6a,0x8e,0xb1,0xea,0xa8,0xc8,0x1f,0xe8,0xa5,0x0a,0x01,
+    0xea,0x60,0x30,0x0f,0x8c,0xb8,0x08,0xe6,0xc1,0xb7,0x66,0xf4,0x52,0x2b,0x46,0x87,
+    0xe9,0xcb,0xc4,0x35,0xb4,0xde,0xec,0x39,0x9a,0xce,0xa2,0x05,0x46,0x05,0x90,0x55,
+    0x1d,0x80,0x41,0x85,0x3a,0x09,0xeb,0x20,0xdf,0x40,0x07,0x90,0x7b,0x3a,0x83,0x34,
+    0x99,0x45,0xd0,0x5f,0x93,0xb9,0x46,0x15,0x8d,0x46,0x45,0xd9,0xc3,0x87,0x50,0x48,
+    0x27,0x84,0xd8,0x2b,0x95,0x56,0x86,0x8a,0x30,0x47,0x0c,0x96,0x51,0xce,0x98,0xce,
+    0x40,0xa7,0x7f,0xe9,0x39,0x3a,0xfd,0x0b,0xcc,0x55,0x14,0x8e,0x7c,0x70,0x98,0x0b,
+    0x60,0x0e,0x2b,0xe0,0xec,0xd2,0x22,0x8c,0x8e,0xef,0xd8,0x40,0xd6,0x4b,0x60,0xac,
+    0x1a,0xa1,0x70,0x43,0x4f,0x30,0x06,0x80,0x4e,0x4c,0x76,0x38,0x83,0x0e,0x7e,0x2b,
+    0x8c,0xbf,0xfe,0xe1,0xbf,0x11,0x04,0x3b,0xbe,0x0c,0x10,0x25,0x5c,0x5f,0x43,0xc6,
+    0x09,0xe6,0x80,0xbc,0x55,0x17,0x1a,0x68,0x5d,0x75,0xa1,0x81,0xcd,0xd0,0x29,0x03,
+    0xc6,0xd7,0xae,0x30,0xd2,0x36,0x29,0x46,0x64,0x02,0x25,0x60,0x3c,0xe3,0x09,0x70,
+    0x67,0xc9,0x07,0x23,0x60,0x8a,0x0a,0xc1,0x99,0xb0,0xe3,0x75,0x78,0x76,0x0f,0xa6,
+    0x3c,0xbf,0x4e,0x87,0xa3,0x63,0xf0,0x99,0xe3,0x63,0xe0,0xc5,0xb8,0xe9,0x0a,0xf3,
+    0x51,0x8e,0x27,0x80,0x85,0x84,0x67,0xa4,0x9a,0x5c,0x74,0x3e,0x0d,0xaf,0x8e,0x73,
+    0x78,0xb5,0xad,0xed,0x51,0x6a,0x66,0x38,0x9b,0x99,0x61,0xb6,0x03,0xa0,0x43,0xe2,
+    0xc2,0x52,0xc3,0x3f,0xab,0xbb,0xd1,0xb1,0x50,0xec,0x28,0x5a,0x98,0xa0,0x01,0x6f,
+    0x94,0xef,0x7d,0xdb,0x11,0x4f,0xdc,0xb9,0x18,0xbb,0xa0,0x62,0xbc,0x24,0x8a,0xa3,
+    0x3c,0x4b,0xdb,0x05,0x86,0x81,0x1b,0x10,0x7d,0x80,0xbf,0xd5,0x2f,0xd1,0xc2,0xd1,
+    0xe0,0x8a,0xe0,0xd6,0x5f,0x47,0x91,0x07,0x72,0x54,0xf1,0xb0,0xd5,0x34,0x25,0x01,
+    0x48,0xd2,0x04,0xfe,0x0a,0xb3,0x64,0x45,0x6b,0x97,0x18,0x97,0x5a,0x3f,0x38,0x19,
+    0xca,0x20,0xc0,0x33,0x86,0x26,0x14,0x63,0xe8,0x65,0xcf,0xc1,0xbe,0xe2,0xba,0xe4,
+    0x6a,0x6e,0x0e,0x0b,0x56,0xf5,0xfd,0xc4,0x9f,0xe6,0xd3,0x52,0x6b,0x54,0x87,0x4a,
+    0x24,0xa8,0x61,0xf2,0x7d,0xa4,0x55,0xea,0x74,0x5f,0x4c,0x23,0x90,0xac,0x9e,0xcc,
+    0x5c,0x3f,0xe8,0xf0,0xc3,0x00,0x78,0x85,0x76,0x11,0xbb,0xaa,0x35,0xaf,0xee,0xbb,
+    0xd0,0x0a,0x16,0x9c,0x4c,0xf9,0xaa,0x8d,0x70,0x91,0xf6,0xe2,0xf1,0x5f,0xff,0x9f,
+    0x7d,0x41,0x4c,0xb2,0x0d,0xcc,0x1b,0x09,0xec,0x24,0x88,0x67,0x3f,0x4e,0x75,0x6b,
+    0x92,0x07,0x4f,0x10,0xb1,0xba,0x08,0x25,0x60,0xad,0x8b,0x98,0xc5,0x53,0x9f,0x1a,
+    0xc0,0xb3,0x92,0x11,0xaa,0x0b,0x66,0x00,0x1a,0x49,0x21,0x0b,0x56,0xd5,0x4a,0x48,
+    0x05,0x2c,0x72,0x11,0xfb,0xb1,0xc4,0x64,0xa3,0xe2,0x78,0x2c,0x43,0x85,0x94,0x47,
+    0xa6,0xf3,0x21,0x9b,0x7e,0xb0,0x50,0xfe,0xf5,0x0f,0xff,0x1b,0xcb,0x65,0xda,0x3e,
+    0xde,0x16,0x01,0xfe,0xc1,0x79,0x18,0x82,0x05,0x91,0x00,0xab,0xc1,0xfa,0x7c,0xfe,
+    0x10,0x96,0xa8,0x9f,0x4a,0xdd,0x52,0xad,0x81,0xfb,0xfe,0xa1,0x9f,0xb9,0x81,0xa0,
+    0x8c,0xa2,0x3c,0x66,0xe1,0xc6,0x40,0x14,0x60,0x83,0x81,0x1c,0x51,0xbf,0x87,0x2e,
+    0xf4,0xe6,0xd0,0xbc,0x12,0x97,0xca,0x13,0x3f,0xa4,0x49,0xb1,0x3b,0xa7,0xc0,0x5d,
+    0x1e,0x0f,0xcb,0x36,0x91,0x01,0xe2,0x43,0x4c,0x00,0xa0,0x5a,0xd3,0x82,0x7a,0x04,
+    0x7c,0x1a,0x01,0xa5,0x43,0xa4,0x1a,0x34,0x9a,0x22,0xdb,0x09,0x3f,0x15,0xb4,0x19,
+    0x20,0x3d,0xd3,0x47,0x5e,0x2e,0x7b,0x30,0x98,0xc8,0x03,0x6d,0xa6,0x44,0x8d,0x22,
+    0x16,0x29,0xb7,0x1a,0x51,0xd5,0x52,0xd2,0xab,0x55,0xa8,0x8c,0xe9,0x22,0x35,0x6b,
+    0x4e,0xd3,0xda,0x74,0x09,0x17,0x1a,0x33,0x2c,0x98,0xa1,0x30,0x7b,0xc3,0x28,0x0a,
+    0x64,0xd2,0xa9,0xcc,0x22,0x10,0x17,0xf4,0x22,0x1e,0x95,0x2b,0x51,0xac,0xcf,0xa8,
+    0x7b,0x4e,0x43,0x40,0x81,0x86,0xa1,0x63,0x3f,0x58,0x21,0xa5,0x93,0x68,0x5d,0x59,
+    0xd5,0xc6,0xe6,0xa4,0x0d,0x16,0xbe,0x75,0x2e,0xa7,0x2b,0xa6,0xee,0x09,0x12,0x43,
+    0x1d,0xaa,0xe9,0x52,0x23,0x27,0xe8,0x44,0xcc,0xbc,0x17,0x14,0x9e,0x56,0x7b,0xea,
+    0xdd,0xe5,0xb7,0x82,0x88,0x76,0xbd,0x39,0x29,0x2b,0xd5,0x65,0x41,0x25,0x15,0x28,
+    0xb0,0x9b,0x70,0x6d,0x7b,0x25,0x40,0x5d,0x58,0x81,0xa5,0x7d,0x59,0x04,0xbd,0x07,
+    0x04,0x44,0xf6,0x43,0xc1,0xe5,0x03,0xff,0x89,0x5f,0xff,0xf0,0x6f,0x66,0xd6,0x58,
+    0x2a,0x06,0xd5,0x17,0xa5,0x32,0x4c,0xa3,0xe4,0x80,0x24,0x3b,0xca,0x38,0x7c,0x12,
+    0x79,0xe8,0xce,0x60,0x0d,0x93,0x74,0x41,0x1c,0x71,0xd1,0x87,0xd8,0x05,0xd7,0x76,
+    0x49,0x0f,0x30,0x8a,0x36,0xf5,0x91,0x00,0x56,0xa7,0x55,0x1d,0xe0,0xf9,0x2f,0x02,
+    0xb8,0x16,0xa8,0x0c,0x23,0x38,0x94,0xa8,0x9d,0x12,0xb9,0xaa,0x83,0x22,0x8a,0x13,
+    0xdb,0x9e,0x73,0x6b,0x5d,0xfc,0xf5,0xbf,0xdf,0x13,0x69,0xee,0xc3,0xc2,0x9c,0x46,
+    0x40,0x4a,0xb6,0xae,0x06,0x11,0xd8,0x75,0xe9,0x36,0x09,0x53,0x6c,0xfe,0xc5,0x3a,
+    0xf4,0xed,0x8b,0x2d,0x02,0x26,0x9e,0x94,0x2e,0xf2,0x19,0x30,0x4d,0x10,0xa5,0x79,
+    0x42,0xab,0xb5,0x98,0x95,0x03,0x34,0x41,0x7b,0xce,0xd3,0x08,0x56,0x9b,0x62,0x0a,
+    0xbe,0xdc,0x03,0x4d,0xe6,0x32,0x2b,0xc3,0x8e,0xa6,0x48,0x8c,0x2c,0x8a,0x63,0xa8,
+    0x05,0x06,0x5b,0x79,0xf1,0xe0,0xc9,0xde,0x0a,0xbd,0xa9,0x45,0xac,0x25,0x56,0x76,
+    0x1f,0x3f,0x79,0xfc,0x82,0x8a,0xda,0x4a,0x7c,0xad,0xbc,0x78,0xfc,0xe4,0xc1,0x8a,
+    0x60,0x33,0x4c,0xb4,0x56,0xee,0x7e,0xfd,0x6c,0xa5,0x5d,0xc6,0x5b,0xa6,0xb6,0x32,
+    0x28,0x6c,0xf2,0x9a,0x79,0x17,0x98,0x60,0x1e,0x95,0x01,0x1e,0xaf,0xa5,0xb5,0x69,
+    0xb1,0xd0,0x02,0x79,0x61,0x6c,0xe0,0xdd,0xca,0x02,0xa3,0x19,0xa2,0xa6,0x3e,0xca,
+    0x37,0xb2,0xd2,0xd8,0x1e,0xec,0xa2,0xb5,0x86,0x16,0x83,0xc0,0xbb,0x8f,0xaa,0xff,
+    0x63,0x20,0xef,0xb1,0x9b,0x48,0x5a,0x88,0xa9,0xc0,0xf6,0xe6,0x35,0xb4,0x1f,0x7f,
+    0x00,0xee,0x05,0x08,0x4e,0x6b,0x12,0x3f,0x2f,0xe6,0x90,0xd0,0x6b,0x70,0xba,0x7a,
+    0x9f,0x87,0x08,0x08,0x2d,0xd4,0x0f,0xc1,0x66,0xa9,0x05,0xe1,0x1e,0x46,0x05,0x14,
+    0x26,0xf8,0x45,0x73,0xc6,0xc8,0xbb,0xd2,0x5a,0x47,0x71,0x3d,0x45,0x1f,0x1e,0x79,
+    0x58,0x60,0xde,0xbf,0x54,0x18,0xb3,0x95,0x25,0x36,0x8e,0x91,0x39,0x45,0x82,0xee,
+    0x93,0x1e,0x4b,0x75,0x9e,0x2e,0x60,0x17,0x85,0x8a,0x0a,0x89,0x95,0xc8,0x8e,0x99,
+    0x9a,0x5b,0xdd,0x98,0xb7,0x18,0x94,0x4a,0xb7,0xf4,0x7e,0x25,0x47,0x5e,0x58,0x93,
+    0x61,0xae,0x9a,0x10,0xd3,0x65,0x15,0x8a,0x77,0x85,0x62,0x5f,0x10,0xab,0x2e,0x68,
+    0xa9,0x91,0xd4,0x76,0xd3,0xb6,0xc0,0x4d,0x21,0x9b,0x69,0xfd,0x91,0x70,0x7d,0xca,
+    0x9c,0x8c,0xd0,0x71,0x14,0x25,0x5d,0xe7,0x4d,0x67,0x98,0x2e,0xf3,0x2a,0x60,0x04,
+    0xcb,0xbc,0x8a,0x99,0xf1,0x29,0x5c,0x74,0x29,0xdc,0xcb,0xb9,0x14,0xb3,0xd3,0x3f,
+    0x4f,0x50,0x66,0xb2,0x43,0xf1,0x32,0x0a,0xc2,0xd3,0xb7,0xe2,0xf9,0xdd,0x27,0x55,
+    0x8f,0xe2,0x7e,0x34,0x70,0xc5,0xe0,0xdd,0x8f,0xe3,0xbc,0xc9,0xab,0x48,0x2b,0x5e,
+    0xc5,0x37,0xcb,0xbc,0x8a,0x68,0x76,0xfa,0x36,0x3c,0xfd,0xd9,0xf6,0x2c,0x9e,0xcf,
+    0x87,0xe3,0x00,0x97,0x78,0xec,0x82,0x42,0x3b,0xfb,0xa5,0xea,0x5e,0xec,0x45,0x29,
+    0x70,0x1a,0x34,0x62,0x2a,0xc4,0x67,0x7f,0xf2,0xe3,0xe8,0x48,0x12,0x16,0xcb,0xcf,
+    0x28,0xc0,0x58,0xd8,0xf1,0xab,0xf3,0x66,0x6f,0xe3,0xe5,0x22,0x4a,0x26,0xd1,0xcc,
+    0x1d,0x02,0xf8,0x28,0x91,0x93,0x19,0x48,0x0c,0xe3,0x77,0x7c,0xef,0xa7,0x13,0xe5,
+    0x77,0xbc,0x04,0x6b,0x60,0x82,0x7d,0xe3,0xa4,0x28,0x79,0xcd,0xf9,0x90,0x35,0xe7,
+    0x43,0xfb,0x1e,0xfb,0x31,0xa8,0xb2,0x71,0xe0,0xcf,0xa0,0xb9,0xed,0x7c,0x10,0x07,
+    0x4f,0x80,0xc8,0xd1,0x20,0x84,0x1e,0x9c,0xe3,0x82,0xf0,0xd4,0xd4,0x7d,0x10,0x19,
+    0x07,0x51,0xe6,0x5a,0x3e,0xc8,0xbc,0xe6,0x83,0x7c,0x7f,0x77,0xaf,0xee,0x84,0xbc,
+    0xfc,0x87,0xbd,0x8b,0x9c,0x10,0xce,0xc9,0x69,0x7b,0x21,0x2f,0x4f,0xff,0x3c,0x1c,
+    0x47,0x0b,0x24,0xf6,0x12,0x37,0x04,0x06,0x91,0x89,0x85,0x7b,0xf6,0xa7,0xd3,0x9f,
+    0x17,0x38,0x2b,0x22,0x9c,0xc3,0xbf,0x75,0x8f,0xe4,0x19,0x8e,0x17,0xd6,0xe1,0x4c,
+    0x63,0x14,0x21,0xcc,0x1e,0x98,0xc6,0xd8,0xc6,0xd5,0x4a,0x0a,0xb1,0x55,0xfc,0x93,
+    0xef,0x2d,0xdc,0xa9,0xb1,0x41,0xf2,0xa3,0x9a,0x9f,0x42,0x6f,0xc8,0x8f,0xfc,0x0b,
+    0x5e,0x01,0x10,0xcb,0x3c,0x96,0xbd,0x68,0x92,0x44,0xef,0xfe,0xe8,0x07,0x30,0x3f,
+    0x45,0xd3,0x92,0xdb,0x02,0xb6,0x48,0x1e,0x2a,0xb7,0x65,0x2f,0x71,0xc7,0xc8,0xd1,
+    0x62,0x1c,0x79,0x20,0x7f,0x8b,0x37,0x28,0xf7,0xc5,0x98,0x42,0x30,0x8f,0x59,0x12,
+    0xb1,0xe6,0xd5,0x1e,0xcc,0x73,0x79,0xf6,0x17,0x1f,0xec,0x38,0xc0,0x91,0x97,0xfd,
+    0x17,0x66,0x91,0x79,0xd5,0x8d,0x39,0x7d,0x1b,0x84,0xef,0x7e,0x34,0xae,0xcc,0x1e,
+    0x74,0x12,0x39,0x28,0x3c,0xfd,0xb3,0x7e,0xaf,0x71,0x67,0xf6,0x22,0x78,0x25,0xb0,
+    0xae,0x8b,0x3d,0xf3,0x61,0x49,0x0f,0xc7,0xca,0xad,0x79,0xa8,0xb9,0x1d,0x4d,0x7c,
+    0xe5,0xd6,0x3c,0xa5,0x91,0xfa,0x4b,0x7c,0x1b,0x01,0x14,0x58,0x20,0xc3,0x32,0xeb,
+    0x83,0x5a,0x9b,0xcd,0xcf,0xde,0x9e,0xbd,0x05,0x92,0x2e,0x4e,0xdf,0x66,0xef,0x7e,
+    0x3c,0xfb,0x0b,0xbb,0x0b,0xd3,0xe8,0xec,0x2f,0xe1,0xe9,0x4f,0x48,0xfd,0xd8,0xf5,
+    0x26,0xf3,0x46,0x4f,0xe7,0xe5,0x1c,0xe8,0x75,0xf6,0x17,0x89,0x80,0xad,0x34,0x3b,
+    0xfb,0x13,0xaf,0xd9,0x32,0x26,0x2f,0x1a,0x24,0xf0,0x42,0x6d,0x61,0xba,0x4b,0x1c,
+    0x1f,0x3f,0xe0,0xe5,0x4e,0x7b,0x0b,0xad,0xd0,0x3f,0xfb,0x4b,0x43,0xaf,0xa0,0x37,
+    0x83,0x28,0x09,0x97,0xa0,0x63,0x27,0xe8,0xe5,0x3c,0x8d,0x26,0x36,0x04,0x60,0x93,
+    0x47,0x4b,0x10,0x82,0x2d,0xd8,0x2d,0xe1,0xb2,0x5c,0xa2,0x97,0x9a,0x32,0x46,0xa8,
+    0x80,0x51,0x3b,0x3b,0xfd,0x79,0xa8,0x7d,0xa2,0xb3,0x5f,0xa0,0x47,0xef,0x7e,0xcc,
+    0x08,0xc8,0x73,0x81,0xdd,0x61,0xf6,0xb2,0x68,0x52,0xf6,0x8d,0xbe,0x97,0xe9,0xe9,
+    0xcf,0x01,0x71,0x6d,0x1c,0xb1,0x4f,0x44,0x6c,0x97,0x6f,0xa3,0xf8,0x83,0x2a,0xff,
+    0xec,0xad,0x98,0x51,0xa7,0x7f,0x12,0x13,0xf0,0x8e,0x60,0x31,0x94,0xfc,0xa3,0x97,
+    0xf4,0xca,0x19,0x4a,0xb9,0xb3,0x5f,0xc4,0x8c,0x45,0x6b,0x8e,0x7d,0xd1,0x1d,0x54,
+    0x93,0x69,0xf5,0xc6,0x0c,0xa9,0xec,0x24,0xed,0x81,0xbc,0x85,0xb7,0x4f,0xc0,0xd3,
+    0xca,0x45,0xa2,0x64,0xb5,0xaf,0x85,0x35,0x4c,0xd5,0x91,0x27,0xc5,0x84,0xa5,0xd9,
+    0xbb,0x1f,0x6d,0xef,0xe8,0x25,0xcb,0x2f,0xe8,0x27,0xf4,0xd8,0x7d,0xf7,0x47,0x8c,
+    0x11,0x22,0x7f,0x69,0x5b,0xa4,0x30,0x34,0x62,0x82,0x9f,0xc5,0xf4,0xec,0x17,0xf8,
+    0x25,0x16,0x81,0x8c,0xcf,0xde,0x82,0x78,0x38,0x7b,0x9b,0x4f,0x9b,0x3c,0x25,0xe4,
+    0x7e,0x00,0x1f,0xf8,0x4c,0x33,0xa2,0x07,0x52,0x03,0x2c,0x9b,0xb3,0xb7,0x30,0x79,
+    0x81,0x52,0x2d,0xd3,0xba,0xb7,0xa4,0x9a,0x26,0x15,0x45,0x43,0xca,0x34,0x8d,0xf3,
+    0x33,0x9c,0x5d,0x04,0xa0,0x31,0xcc,0x4b,0xfe,0xd2,0xdf,0x81,0xc9,0xff,0xee,0x8f,
+    0xb0,0x3e,0x22,0x14,0x3d,0xd0,0x00,0x5e,0xe2,0x01,0xa8,0x5a,0xd0,0xae,0x12,0xd2,
+    0x79,0xd5,0x6f,0x4a,0x60,0x3d,0x79,0x32,0xb0,0xd6,0x66,0x49,0x44,0x4e,0x66,0x67,
+    0xbf,0x04,0xbe,0x21,0x79,0x41,0xb7,0xaa,0x0f,0x35,0x95,0x0b,0xa0,0x75,0xb1,0xd2,
+    0xa7,0xbe,0xc6,0x37,0x2f,0x39,0x51,0x4f,0x35,0xaf,0x2a,0x3f,0x6a,0x1c,0xb8,0x1e,
+    0x08,0x8b,0x23,0x2c,0xeb,0x68,0x1a,0xa3,0xea,0x04,0x9e,0x53,0x73,0xef,0x37,0x78,
+    0x53,0xc3,0x71,0xe2,0x86,0x2e,0xd9,0x49,0x3e,0x11,0x77,0x0c,0x7d,0x7e,0x9b,0xa1,
+    0x08,0x2c,0x19,0x43,0x2f,0xe7,0xf1,0xe9,0xcf,0x21,0xa9,0xcf,0x4c,0xab,0xa3,0x9a,
+    0x63,0x35,0x2b,0xb9,0x55,0x77,0x27,0x59,0xae,0x26,0xa2,0xd2,0x84,0x9c,0x2b,0xda,
+    0x6b,0x68,0xae,0xa7,0x01,0xbe,0x70,0x27,0x19,0x8b,0x2c,0xdb,0xcb,0x2a,0x94,0x3e,
+    0xac,0xd1,0xd4,0x1d,0x37,0x3b,0x5a,0x66,0x58,0x68,0x3a,0x24,0x28,0xd3,0xdd,0xa5,
+    0xbe,0x96,0x86,0x9d,0xcd,0xe3,0x30,0xaf,0x0e,0xab,0xf0,0xb3,0xf6,0x2c,0xda,0x90,
+    0x7f,0x04,0xf2,0x22,0x06,0x2d,0x0b,0xed,0x90,0xf6,0xef,0xfe,0x13,0x78,0xe5,0x2e,
+    0x32,0x57,0x7a,0xf6,0x1f,0xf0,0x33,0xc9,0xdf,0xfd,0x91,0x64,0xf7,0xf9,0x8e,0xd7,
+    0x02,0xad,0x49,0x1a,0xfc,0x1c,0x10,0x7a,0xc0,0xab,0x79,0x8c,0x2c,0x84,0x2f,0x88,
+    0xf4,0x20,0xa2,0x85,0x52,0x4c,0xee,0x45,0x2e,0x98,0x1e,0xcb,0xe2,0xec,0x97,0x14,
+    0xd6,0x0f,0x2a,0xaa,0x41,0x10,0x4d,0x88,0x93,0xde,0xb2,0x57,0x17,0x65,0xb3,0x84,
+    0x3a,0xbb,0x40,0xd5,0x69,0x2d,0x86,0x46,0x7f,0xec,0x08,0xb7,0x1a,0x16,0xb1,0x84,
+    0xc1,0x80,0xe0,0xc1,0xe5,0xc3,0xd2,0xc3,0x0f,0x73,0x36,0xbb,0xb7,0x41,0xd6,0xe4,
+    0x0b,0x77,0x06,0xd4,0x09,0x51,0x07,0x8b,0x49,0x02,0x1c,0xfe,0xee,0x8f,0x13,0xd4,
+    0x40,0x62,0x16,0x05,0x59,0xc9,0xfc,0x6d,0xf2,0xce,0xbe,0x77,0x81,0xa4,0x53,0x71,
+    0xf6,0x17,0x58,0x68,0xf4,0x16,0x8b,0xd2,0x8d,0x1e,0x1a,0x49,0x7f,0x9e,0x2e,0x9a,
+    0xe1,0x8b,0x3c,0x35,0x90,0xa8,0xca,0x4d,0x23,0x73,0xf6,0x52,0x5e,0x9a,0x8c,0x25,
+    0x19,0xc6,0x51,0x99,0x3b,0x7a,0x9a,0x55,0x61,0xb6,0x68,0x59,0xa3,0xf3,0x06,0x13,
+    0xe4,0x5b,0x8b,0xab,0xe2,0x9d,0x55,0x31,0x45,0x1e,0xe9,0x5e,0x90,0x24,0x25,0xdf,
+    0xec,0x7b,0x17,0x17,0x98,0x3c,0x42,0x36,0x02,0xc5,0x03,0x7d,0x66,0xc6,0xf2,0xe0,
+    0xb5,0x16,0x1d,0x2c,0x9f,0x6c,0x0f,0xa7,0xd2,0x83,0xc1,0xba,0x3c,0x97,0xd0,0x06,
+    0xe8,0xed,0x67,0xe7,0x38,0x65,0xa1,0x5c,0x40,0x57,0xa6,0xc0,0x60,0x28,0xe2,0x96,
+    0xbb,0x65,0x31,0x28,0x63,0x98,0x68,0x18,0xec,0xbb,0xff,0xd4,0xec,0x9a,0xb1,0x92,
+    0x80,0x99,0x22,0xf3,0x89,0x68,0x41,0x94,0xcf,0x05,0x33,0xab,0x51,0xd3,0x1d,0xe1,
+    0x0e,0xe6,0x20,0x9e,0x00,0x63,0x88,0x83,0xf6,0x64,0x3a,0xc9,0x85,0xcb,0x82,0x7c,
+    0x21,0x53,0x1f,0xc4,0x38,0xa8,0x8a,0x25,0x1e,0x18,0xd1,0xba,0xc3,0xb3,0x3c,0x01,
+    0x09,0x09,0xec,0x91,0x4a,0x6d,0x00,0xe0,0x9c,0x48,0xe3,0x7b,0xcd,0xe6,0x68,0x99,
+    0x81,0x4c,0xf7,0x26,0xc9,0x3c,0x03,0xc1,0x49,0xaf,0x82,0xd1,0x22,0x8b,0xe2,0xac,
+    0x9d,0xfe,0x84,0xb6,0x57,0xc4,0x26,0x88,0xb1,0x14,0xab,0xfc,0xf9,0xe6,0xcd,0xb6,
+    0x3a,0xec,0x79,0xf4,0x60,0x77,0xef,0xe0,0xc1,0xef,0x5e,0x1c,0x3c,0x78,0xda,0x7f,
+    0xa5,0x32,0xad,0xa0,0xa0,0xe7,0x24,0x38,0x4e,0x47,0x50,0x87,0x4d,0xc5,0xbe,0x84,
+    0x66,0xe0,0x7f,0x46,0x23,0x7c,0xcb,0x50,0xa6,0x29,0x6e,0x23,0xd0,0x4e,0xe7,0x44,
+    0xc6,0x99,0xf0,0x43,0xb1,0xb7,0x4f,0x7e,0xd6,0x3a,0xc8,0x6b,0x30,0xd3,0xdb,0x5d,
+    0x71,0x37,0x64,0x26,0x60,0x2f,0x0a,0xfc,0x4a,0x90,0xd5,0xb8,0x41,0x41,0x8e,0x50,
+    0x2a,0x0e,0xa5,0xda,0xa5,0x64,0x34,0x30,0xb5,0x53,0x1f,0xd1,0x76,0x78,0x37,0x1e,
+    0x9c,0xb2,0xde,0xda,0x1a,0x58,0xb6,0x6b,0x54,0x7f,0x47,0x75,0xa5,0x7f,0x7d,0x5d,
+    0xa8,0x1d,0x4e,0xfc,0x85,0x2f,0xa6,0x9d,0x4e,0x17,0x03,0x1d,0xef,0xc3,0xfc,0x06,
+    0x91,0xcb,0x9b,0x03,0xec,0xe3,0x08,0x37,0x15,0xdf,0xdd,0x7d,0x09,0x16,0x4c,0x34,
+    0x15,0x6b,0x6e,0xec,0xaf,0xe9,0x34,0x38,0xc7,0xee,0xec,0x4e,0xca,0xc3,0xea,0x3f,
+    0xed,0x8a,0xa7,0xe4,0x5f,0xbb,0xca,0x91,0x3e,0xc6,0x14,0x4b,0x34,0x22,0x98,0x3b,
+    0xa1,0x9c,0x46,0x2b,0x01,0xa3,0x21,0x90,0x72,0x27,0x73,0xfe,0x46,0x92,0x49,0xb5,
+    0x44,0xbb,0xb8,0xcf,0x5f,0xec,0xe9,0x9d,0xdc,0xd6,0xfe,0x7d,0x70,0x64,0xfb,0x04,
+    0x0e,0xa4,0x79,0x01,0xfd,0x53,0x59,0xba,0x75,0x3f,0x61,0x50,0xf3,0x14,0x74,0x59,
+    0x72,0x28,0xcb,0xfb,0x91,0xdb,0x42,0xba,0x20,0x6d,0x14,0x18,0xb8,0xd5,0x69,0xe0,
+    0xe3,0xde,0x3a,0x48,0xb2,0x48,0xa1,0xa7,0x79,0xc9,0xc6,0x50,0x07,0x56,0xd6,0x21,
+    0xf4,0x1c,0x11,0xd0,0xde,0x2d,0xac,0xe4,0xec,0x18,0xcc,0x26,0xb3,0xf7,0x88,0xb4,
+    0x7d,0xf2,0xe2,0x5b,0xfa,0x1a,0x95,0xa7,0x9b,0x77,0xc5,0x3f,0x3a,0x3a,0xa9,0xe3,
+    0x3f,0xe2,0xe9,0x2c,0x4d,0x35,0x6e,0x20,0x70,0xef,0x71,0x30,0xfc,0x7e,0xa4,0x86,
+    0x4e,0xcd,0xdd,0x73,0xec,0x2c,0xea,0x9a,0x22,0x45,0x2d,0x19,0x7a,0x43,0xdc,0x4b,
+    0xe4,0xee,0x49,0x6b,0x6b,0xa2,0x2b,0x90,0x4f,0x52,0x77,0x2a,0x71,0x82,0xac,0xd3,
+    0xb2,0xae,0x78,0x86,0xab,0xe4,0xd8,0x4f,0x0d,0x63,0xa4,0x9a,0x54,0xb4,0x71,0x45,
+    0xc3,0xa4,0x6d,0x62,0x1c,0x0a,0x4c,0x1f,0x08,0x98,0x0c,0x8f,0x1a,0xc0,0x41,0x9d,
+    0xc7,0x63,0x17,0xda,0x71,0xca,0xd7,0x36,0x6e,0x91,0xe0,0x5b,0x2d,0xec,0xcc,0x84,
+    0x6a,0xc7,0x01,0x99,0x51,0xfa,0x33,0x99,0x76,0x84,0xec,0x1e,0x76,0x05,0x25,0x5c,
+    0x17,0xbf,0xfe,0xaf,0xff,0x59,0xdc,0xc0,0x14,0xfa,0x02,0x68,0xc8,0x3f,0xb0,0xe8,
+    0xfa,0x26,0xfc,0xea,0x8a,0xfd,0x3c,0xc6,0x4f,0x71,0xe1,0xe6,0x2f,0x4e,0x78,0xaa,
+    0x37,0xc5,0xe1,0x55,0x80,0x98,0xb6,0xf6,0x6e,0xac,0xdd,0x20,0x2a,0x61,0xa6,0x3e,
+    0xdc,0xc1,0xa4,0x2c,0x83,0x38,0x74,0x34,0xdf,0x4c,0xc2,0x3d,0x4d,0x2e,0x2a,0x7f,
+    0x71,0x1c,0xa1,0xef,0x8a,0x40,0x48,0x77,0x22,0xfd,0x20,0x4f,0x45,0x6b,0x77,0xed,
+    0xb9,0x3a,0x2b,0x17,0x31,0x70,0x3a,0xee,0xab,0x70,0x35,0xef,0x29,0xe3,0x03,0x8e,
+    0x30,0x42,0x92,0x01,0x5b,0xa9,0x04,0x79,0x2c,0x41,0x52,0x60,0x65,0xcc,0x13,0x96,
+    0x0a,0xca,0x97,0x07,0x3e,0x40,0x24,0xf6,0x9f,0xdf,0xeb,0xe0,0xae,0x10,0x2d,0x72,
+    0xc5,0xd7,0x1d,0x81,0xa9,0x63,0x3a,0xe2,0xee,0x57,0xcf,0x71,0xc8,0x84,0x8b,0x7b,
+    0x9f,0x02,0x4a,0x4a,0x13,0xe7,0x7a,0x6a,0xeb,0x09,0x78,0x49,0x6d,0xad,0x51,0x32,
+    0x36,0xdc,0xa8,0xc2,0xbe,0xf2,0xf4,0x82,0x34,0x3c,0x1e,0xfb,0xc0,0xaa,0x69,0x26,
+    0x41,0x67,0xab,0x75,0xe9,0x27,0x34,0x51,0xc4,0x8d,0x29,0x0e,0x66,0xb4,0x4a,0xc7,
+    0x07,0x02,0x04,0x67,0x4e,0xbb,0x9e,0xd7,0x85,0xf7,0xd5,0x36,0x41,0x2b,0xd1,0xc7,
+    0x4b,0x01,0x8f,0xaf,0xbb,0x98,0xc7,0x38,0x3c,0xc4,0xf7,0x10,0xff,0x40,0xaf,0x44,
+    0xe9,0x84,0x83,0x5b,0x20,0xbd,0x31,0x27,0x5c,0xcf,0x29,0xb2,0xda,0x21,0xcd,0x25,
+    0x48,0xae,0x22,0xa3,0x9b,0x21,0x39,0x16,0xdf,0x8b,0xa6,0x71,0x9e,0xe1,0x71,0x0d,
+    0x74,0xed,0x70,0x15,0xca,0xc0,0xbc,0x01,0x3a,0x27,0xd1,0x21,0x00,0x6b,0xc2,0xaa,
+    0x73,0x82,0xd6,0xcd,0x1b,0x74,0xee,0x03,0x9c,0xb2,0xb1,0x85,0xf2,0x94,0xb2,0x18,
+    0x8b,0x47,0x0b,0x78,0x5e,0xdf,0xbc,0xb1,0x86,0xd9,0x6e,0x57,0xe9,0x33,0x74,0xe2,
+    0xe1,0xc3,0x17,0x2c,0x3c,0xb6,0xd6,0x57,0x04,0x7f,0xdb,0x2a,0x6e,0xb3,0xf4,0x21,
+    0x7a,0x94,0x85,0x67,0x47,0x6d,0xf3,0xa2,0x96,0x4c,0x99,0x39,0x69,0xfb,0x32,0x94,
+    0x6a,0x87,0xd3,0xea,0x53,0x57,0xec,0xc1,0xa4,0x89,0xaf,0x81,0x71,0x49,0x8e,0x41,
+    0x97,0xef,0xa4,0x3e,0x38,0x3d,0xfd,0xdb,0xa9,0xfc,0xe7,0x1d,0xd1,0x1a,0xf8,0xa1,
+    0x9b,0xcc,0x3b,0xcc,0x3d,0x73,0x60,0x76,0x5a,0xb6,0x48,0x7c,0x60,0x9d,0xf5,0xee,
+    0x16,0x90,0x99,0x62,0x30,0x61,0xcc,0x03,0xe8,0x99,0xf8,0xf5,0x5f,0xfe,0xf3,0xc6,
+    0xe6,0x3a,0x94,0x3e,0xdc,0x67,0xf2,0xff,0x6e,0x15,0x88,0xb5,0xfa,0x54,0x9e,0x64,
+    0x02,0x3f,0xdb,0xc5,0xd2,0x06,0x2b,0x42,0x2c,0xe2,0xaf,0xed,0x01,0x4b,0xfc,0xa6,
+    0x9a,0x57,0xee,0x37,0x30,0x27,0xa3,0x3c,0x05,0x62,0x92,0xbc,0xdf,0xdb,0xbd,0xfb,
+    0x0f,0x20,0x4f,0x23,0xd0,0xdd,0x66,0xcf,0x1d,0xe8,0x49,0x16,0xd5,0xea,0xbd,0x9b,
+    0xc4,0x88,0x0f,0xf7,0xbe,0x45,0x13,0x45,0xe8,0x3c,0x71,0x3d,0x67,0xe5,0xe1,0x0a,
+    0x90,0x09,0xe7,0x69,0x0d,0xc8,0xbc,0xf2,0x2d,0x98,0x37,0xff,0x93,0x0f,0xc3,0xa8,
+    0x14,0x60,0x13,0x5c,0x4f,0x76,0x16,0x2f,0x3d,0xa1,0x54,0xf1,0x5d,0xe2,0xe3,0x74,
+    0x36,0x10,0x19,0x79,0xec,0x26,0xea,0x0a,0xd4,0x03,0xa9,0x3c,0x9c,0x82,0x36,0x22,
+    0xc5,0xb1,0x06,0x0d,0xf5,0x4c,0x93,0x68,0x02,0xe4,0x18,0x69,0x21,0x5a,0xbf,0x7b,
+    0x7c,0xf7,0x99,0xea,0xf0,0xfe,0x75,0x81,0x67,0x08,0xb2,0x8d,0xcc,0x1d,0xa0,0xd3,
+    0x87,0xb9,0xb9,0x7c,0xde,0x4d,0xee,0xf0,0xcc,0x02,0x3d,0xc1,0x5a,0xdb,0xc4,0x77,
+    0xa8,0xb3,0x2b,0x62,0x1e,0xdc,0xd5,0xcf,0xc3,0xcc,0x0f,0x58,0x55,0xf1,0xc2,0x01,
+    0x3d,0x07,0x8d,0xf1,0x73,0x6d,0x1d,0x5c,0x6e,0x2e,0x7d,0xb3,0x8d,0xe0,0x49,0x54,
+    0xb2,0x6e,0xc0,0x0b,0x0d,0x20,0x4a,0x4c,0x67,0x5d,0x3a,0x85,0x0c,0x24,0x0a,0x1e,
+    0xf4,0xdd,0x60,0x81,0x10,0x97,0x29,0xed,0xa7,0x73,0x7a,0xb9,0x27,0x07,0xd3,0x01,
+    0x48,0x0e,0xef,0x10,0x55,0x0e,0x4a,0xd8,0x2f,0x91,0x0b,0x59,0xf8,0xd2,0x07,0xe1,
+    0xba,0x62,0x17,0x6c,0x69,0x5a,0xad,0xcc,0xa6,0x86,0x9d,0x12,0x4d,0xd5,0xb4,0xc4,
+    0x55,0xc8,0x3e,0x23,0x09,0x36,0x1f,0xb1,0xd5,0x92,0x26,0xa0,0x47,0xff,0xb9,0xff,
+    0x54,0xb4,0x1e,0xbd,0x00,0x8d,0xf7,0x1c,0x23,0xdf,0x45,0xaa,0x05,0x65,0x47,0xa4,
+    0x11,0xaa,0x55,0x18,0x30,0xc8,0xe5,0x40,0x9d,0x24,0xa6,0x39,0xe9,0x41,0x56,0xba,
+    0x46,0xcf,0xea,0xb4,0x62,0xc0,0x0d,0xfb,0x2b,0x3d,0xb1,0xf2,0x74,0xc5,0x90,0x80,
+    0x59,0x02,0x86,0xb2,0xf2,0xd5,0x8a,0x78,0xf2,0x95,0x02,0xa6,0xfd,0xc0,0x67,0x98,
+    0xc4,0x9d,0x1e,0xc3,0xe8,0x80,0xbe,0x0e,0x8d,0x67,0x22,0x6a,0x2e,0x8b,0x9a,0x38,
+    0x4d,0x50,0x42,0x40,0x15,0xbd,0x4f,0x55,0x98,0x31,0xe0,0x0e,0x56,0xc1,0x57,0x58,
+    0x05,0x54,0x0e,0xbd,0xc1,0x9c,0x9c,0x3f,0xfc,0x61,0x34,0x1c,0x4b,0x76,0xd6,0xee,
+    0x73,0xb2,0x37,0x40,0xb5,0xe2,0xc6,0x14,0x28,0x11,0x4c,0x6e,0x8b,0x7a,0x38,0x4a,
+    0xc1,0x95,0x4b,0x53,0xb1,0x71,0x73,0x15,0x7c,0x7c,0xb1,0x77,0x0f,0x4c,0xa3,0x01,
+    0xce,0xa9,0x15,0x48,0x03,0x04,0x28,0x25,0xb9,0x15,0x63,0x37,0x98,0x49,0x8e,0x46,
+    0xe0,0x94,0xb6,0x8f,0x9f,0xdc,0x5d,0xe5,0xb4,0xb6,0xe2,0x9f,0x73,0x10,0x7a,0x5a,
+    0xac,0x9a,0x43,0x68,0x42,0x07,0x4a,0xf0,0x10,0x50,0x03,0x6f,0x10,0x73,0x76,0x50,
+    0x15,0xa5,0x11,0xa8,0x56,0xec,0x05,0xd2,0x0c,0xda,0xd2,0xc9,0xa6,0xe0,0xf0,0x18,
+    0x90,0xad,0x78,0x32,0x61,0x6c,0x31,0xc5,0x99,0xf4,0x55,0x70,0xc0,0x84,0x33,0x31,
+    0x8e,0x47,0x7c,0x22,0x4e,0x5f,0x66,0xe0,0x02,0xcc,0x4c,0x0f,0x85,0xe6,0x93,0x00,
+    0x9a,0x1e,0x65,0x58,0xa5,0x7d,0x45,0x6b,0x33,0xf4,0x56,0xe9,0x63,0x82,0x1d,0xf1,
+    0xbf,0x6c,0x6c,0x82,0x98,0x59,0x8b,0x86,0x59,0x1b,0xde,0x3a,0x8d,0x70,0x90,0xa0,
+    0x10,0x56,0x47,0x3a,0x20,0x01,0x3c,0xca,0x29,0x8a,0x89,0x34,0x1f,0x92,0xc6,0x02,
+    0xbf,0x03,0x3f,0x77,0x29,0xb2,0xc4,0x1d,0x8d,0xfc,0x21,0x28,0x16,0x1f,0x68,0x12,
+    0xe1,0x89,0x4e,0xe8,0xd1,0x89,0x20,0x1f,0x41,0x8b,0x17,0x79,0x12,0x8a,0x67,0x4f,
+    0x59,0xff,0x82,0x85,0x93,0xa3,0x92,0xd7,0x68,0xf1,0x34,0x7e,0x20,0x51,0x69,0x12,
+    0xff,0x53,0xa7,0xd5,0x2a,0x9e,0x48,0x19,0x23,0x1a,0xd2,0xd8,0xf8,0xc5,0x3b,0xf0,
+    0xe6,0xf0,0x74,0x7a,0x41,0x66,0x1c,0x4a,0x87,0x0c,0xd3,0xa8,0x59,0x43,0xe4,0xd1,
+    0xf3,0xc8,0x45,0xd1,0x71,0x75,0x62,0x42,0xea,0xd8,0x1e,0x3f,0x74,0x6d,0x1e,0xe3,
+    0xd9,0x4e,0x0f,0x16,0x3f,0xaa,0x8c,0x5b,0xa4,0x30,0x80,0x41,0xc8,0x2c,0xa3,0x68,
+    0x35,0x50,0xf0,0x5c,0x77,0x83,0xea,0xda,0xd4,0x2b,0x3e,0xe2,0x77,0xa7,0x03,0x9f,
+    0xf6,0xdb,0x94,0xee,0x14,0x78,0x4a,0x94,0x6e,0xeb,0x93,0x64,0xdd,0xfc,0xa6,0x85,
+    0xba,0x8d,0xca,0x10,0x38,0x01,0xd4,0x87,0x32,0x4a,0x12,0x64,0x4d,0x45,0xa8,0x97,
+    0x78,0x86,0x4e,0x36,0x83,0xde,0x1e,0x16,0x53,0x10,0x22,0xb8,0x4c,0x31,0x60,0x8b,
+    0xa6,0x23,0xf6,0xf9,0x68,0x0d,0x95,0x8e,0x4f,0x87,0x8d,0xc2,0x8e,0x8f,0x80,0x5e,
+    0x4c,0xdd,0x70,0xae,0x84,0xaa,0x1d,0xae,0xc0,0x66,0x34,0x49,0x29,0x6d,0xaa,0x75,
+    0x85,0x8a,0xa7,0xc0,0xc6,0x48,0xcf,0x61,0x82,0x91,0xc3,0x6a,0xdf,0x90,0x86,0x55,
+    0x30,0x31,0x3e,0xe1,0xc1,0x73,0x9e,0xba,0xc0,0x7e,0x60,0x75,0x89,0xc9,0xa3,0x45,
+    0xd3,0x79,0xd3,0x8d,0x1b,0xdd,0x0d,0x53,0x17,0x80,0x60,0x19,0xf9,0x61,0x69,0x70,
+    0xfc,0x36,0x1a,0x59,0x46,0xe3,0xd2,0x31,0x0d,0xf8,0x0a,0xa5,0x17,0xac,0x10,0x04,
+    0xde,0x9f,0xdc,0x8f,0x46,0x19,0x1d,0x13,0xba,0x1c,0xc4,0x31,0x64,0x5b,0x9e,0x57,
+    0x05,0x4e,0x2e,0xda,0x66,0x7c,0x03,0x44,0x7c,0x9b,0x92,0xb1,0x37,0x88,0x90,0x71,
+    0x82,0x28,0xf7,0xf0,0xdb,0xb2,0x30,0xd9,0x26,0xb8,0xc3,0x25,0x45,0x88,0x31,0x1e,
+    0xc4,0x60,0x2d,0x64,0x65,0x10,0x84,0x80,0x10,0x96,0x3b,0x65,0x6e,0x55,0xa3,0x61,
+    0x8c,0x60,0x41,0x74,0xd7,0x4f,0xff,0x1d,0x07,0x14,0xca,0x1c,0xf8,0x3d,0x00,0xc7,
+    0xc9,0xa3,0x93,0x43,0xe6,0xd4,0x63,0x74,0xb8,0xb5,0x01,0x64,0xcc,0x9d,0x62,0x6f,
+    0x74,0xdf,0x9a,0x07,0x6d,0xec,0xb3,0xd9,0x0e,0xc6,0x1b,0x85,0x4c,0x18,0xd7,0x41,
+    0xcd,0x41,0x6a,0x9c,0x81,0x01,0xde,0xd7,0x98,0xe2,0x36,0xa0,0x4c,0x0b,0x87,0x03,
+    0x55,0xe2,0x31,0x06,0x07,0x14,0xfb,0x9b,0x53,0xe0,0xbe,0x02,0x91,0xb2,0xe5,0x6c,
+    0x2c,0x48,0x71,0xd2,0x77,0xc6,0xa3,0x40,0xc3,0x88,0xa7,0xf0,0x10,0xa3,0x7e,0xd4,
+    0x96,0x79,0x79,0x33,0xf6,0x3b,0x3c,0xe4,0xe4,0xc3,0x56,0xd0,0x13,0x96,0xc1,0x55,
+    0xb2,0xf1,0x94,0x43,0xa5,0x63,0x59,0xfc,0x91,0x76,0x4b,0xc8,0x0b,0xc0,0xb7,0xda,
+    0xcb,0xdc,0x1c,0x66,0x02,0x07,0xc2,0x9b,0x52,0xa1,0x22,0x48,0x58,0x53,0x1f,0x06,
+    0xc4,0xe3,0x29,0x69,0xb2,0x28,0xd7,0x41,0x04,0x82,0xaf,0x8d,0x80,0x6c,0x84,0x79,
+    0x6a,0x0a,0x89,0x81,0x89,0x09,0x53,0xdc,0x7b,0xa1,0xc0,0x18,0x34,0x1e,0xbc,0xaf,
+    0xa6,0x95,0xc5,0x5c,0x8e,0x91,0xb1,0x2c,0xdd,0x50,0xba,0x49,0xc5,0xff,0x61,0x7e,
+    0xa4,0xd6,0x5e,0xe2,0x1e,0x77,0x88,0x88,0x7a,0xd9,0x92,0x10,0x16,0xcf,0xd0,0x10,
+    0xa4,0xa5,0x08,0x1c,0xa9,0x0d,0xb7,0xc4,0xd2,0xac,0x68,0x41,0x93,0xf6,0x77,0x81,
+    0x3e,0xca,0x52,0x26,0x35,0x0f,0xc6,0x18,0x1e,0x29,0x03,0xa1,0xe6,0x51,0x0e,0xab,
+    0x93,0xf3,0xab,0xc1,0x5c,0xe0,0xac,0x56,0x36,0xa3,0x9f,0x53,0xb8,0x0e,0xa8,0xa8,
+    0xd5,0x72,0xc8,0x0e,0xda,0xe5,0x9b,0x30,0x76,0x54,0x5e,0xc4,0xfe,0x8a,0xcd,0x94,
+    0x7d,0xa3,0xfc,0x2e,0xe2,0xcb,0x08,0x94,0x1c,0x43,0x9a,0x45,0xcf,0xb8,0x14,0x9f,
+    0xcc,0xf0,0x7b,0xf2,0x3c,0x62,0x77,0x16,0xf9,0x5e,0xb1,0x3a,0x54,0x80,0x91,0x02,
+    0x4f,0x5c,0x1f,0x99,0x53,0x81,0x6b,0xae,0x42,0xd8,0x73,0x22,0x86,0x98,0x09,0x5a,
+    0xda,0x0f,0x2e,0xa4,0x51,0x1b,0xfb,0x98,0xfa,0xa0,0x7f,0x60,0x34,0x60,0xce,0x06,
+    0xd9,0x78,0xae,0x96,0x94,0x39,0xc6,0xed,0x8a,0xc7,0x23,0x30,0x41,0xdd,0x94,0x9c,
+    0x4b,0xc2,0xc4,0xbe,0x87,0x66,0x27,0xe4,0xdf,0x8c,0x14,0xa3,0x44,0x7b,0x0d,0xb9,
+    0x56,0x98,0x88,0x24,0xc3,0xa4,0x40,0x1f,0xc0,0x14,0x0a,0x0a,0xc6,0x24,0x1f,0x85,
+    0x5a,0x0e,0x41,0x05,0xa7,0xcc,0x76,0x4c,0xbd,0xc2,0x6d,0xd5,0x3e,0x3f,0x38,0xe1,
+    0xa2,0xc5,0xd6,0xe3,0x17,0x6c,0xa9,0xc9,0x93,0x98,0x22,0xa3,0xdb,0x57,0x8a,0x73,
+    0xa2,0xe3,0x6d,0x74,0x67,0xd0,0x09,0x1c,0x23,0x77,0x24,0x42,0xdf,0x84,0xc2,0x15,
+    0x00,0xba,0x4c,0x8c,0x5c,0xcc,0xa3,0xce,0x26,0x1c,0x2d,0x68,0x12,0xb9,0x43,0x90,
+    0x63,0x38,0x0d,0x78,0x5b,0xb1,0xd4,0x84,0x58,0x91,0xd0,0xa7,0x95,0xd3,0x80,0x67,
+    0x14,0xae,0x8d,0x51,0x1e,0xb5,0x70,0x2a,0x3c,0x49,0x55,0x9b,0x0f,0xe1,0xe1,0x2a,
+    0x20,0x9b,0x96,0xc5,0x0a,0x88,0x1a,0x58,0xeb,0x74,0x20,0xa8,0x85,0x15,0x88,0x8a,
+    0x5d,0x89,0x11,0x85,0xcf,0x1e,0x3e,0x04,0x6b,0x99,0x8c,0x26,0x60,0x5b,0x76,0x81,
+    0xfc,0xac,0x72,0x92,0xf0,0x94,0xee,0x92,0x21,0xa1,0xa8,0xa0,0x31,0x28,0x0b,0x3b,
+    0x01,0x58,0xef,0x12,0x27,0xa7,0xec,0x50,0x51,0x38,0x45,0x25,0x5a,0x12,0xe9,0xf7,
+    0xec,0x69,0xe9,0xdc,0x61,0x8f,0x35,0x04,0xda,0x54,0x6c,0x8c,0x17,0xd1,0x5c,0x4c,
+    0x91,0x54,0x50,0x78,0x96,0x59,0xbd,0x46,0x23,0x23,0x08,0x0a,0x00,0xc4,0x05,0xc3,
+    0x40,0xe7,0x09,0x20,0x67,0x73,0x81,0xf6,0x21,0x48,0x43,0x70,0x0e,0x9e,0x68,0x9d,
+    0xa6,0x8f,0x0f,0xb5,0x26,0xb0,0xd8,0x5b,0x1d,0xa6,0x22,0x27,0xf5,0x8a,0xf0,0x51,
+    0xc1,0xdc,0x84,0x0e,0xab,0xc7,0x0c,0x65,0xef,0x69,0x60,0x67,0x78,0xef,0x66,0x9b,
+    0x98,0x73,0x0a,0x06,0x33,0xc6,0x00,0xe1,0x3c,0x90,0x7d,0x03,0x1a,0x29,0x01,0x82,
+    0x70,0xec,0x68,0x4f,0xfc,0x03,0x50,0x97,0xa2,0x69,0x41,0x76,0xc8,0x13,0x64,0x8d,
+    0x69,0x7d,0x49,0x71,0x6c,0x07,0x8b,0x10,0x81,0x1b,0xa7,0x2c,0x4b,0xb4,0x86,0x21,
+    0xb3,0x44,0xc9,0x7f,0xda,0x50,0x84,0xc5,0x1b,0x52,0x24,0x9c,0xa0,0x9c,0x88,0xa0,
+    0x97,0xac,0xac,0x8e,0xda,0x90,0xd0,0x55,0xe3,0xe8,0x38,0x35,0x56,0x13,0x1a,0xc5,
+    0x31,0xaa,0x1b,0x72,0x3b,0x04,0xee,0x57,0x8b,0x3c,0xf6,0x68,0x2f,0xe8,0xae,0x3f,
+    0xa5,0x61,0xdc,0x64,0x33,0x67,0x45,0x2f,0x16,0x70,0x5d,0x6f,0xa0,0xe0,0x81,0xbf,
+    0x9b,0xe4,0xc0,0xb6,0x69,0x29,0x83,0xac,0x4a,0x71,0xf9,0xde,0xdb,0x7d,0xbc,0xb7,
+    0xf7,0xf8,0xe9,0xd7,0x9d,0xc2,0xee,0x30,0x21,0xba,0x68,0x45,0x2a,0xee,0xc6,0x88,
+    0x6c,0x36,0x21,0x51,0x8e,0xa1,0x15,0x09,0x5d,0x42,0x09,0x06,0xd2,0x8c,0x4c,0xb9,
+    0xd6,0x16,0xd9,0x57,0x37,0x95,0x7d,0xc5,0x2b,0x10,0x47,0x42,0x03,0x45,0xc9,0x74,
+    0x10,0xc1,0xea,0x7c,0xf6,0x8d,0x7e,0xc2,0x4b,0xc6,0x2a,0x08,0x95,0xc6,0x4a,0x31,
+    0x62,0x18,0xbc,0x45,0x46,0x43,0x61,0x14,0x58,0x1d,0xc0,0xfe,0xd4,0x7b,0xd9,0x36,
+    0x2f,0x18,0xb8,0x18,0x07,0xa7,0x06,0xf4,0x29,0x88,0x99,0x0b,0x06,0x04,0xae,0x3c,
+    0xc8,0x26,0x7b,0x14,0xf6,0x20,0x10,0xad,0x3b,0x48,0x30,0x98,0xb9,0x7c,0x57,0x44,
+    0x4f,0x11,0x55,0x92,0x5e,0x46,0xff,0xe6,0x98,0x9d,0x6a,0x58,0xc3,0x20,0x2e,0x5a,
+    0xa8,0x56,0xc0,0xb1,0x20,0x1e,0x61,0x09,0x06,0xce,0x1d,0x0a,0x4a,0xa5,0x25,0xdb,
+    0xe5,0x4d,0x1c,0x54,0x58,0xe8,0x24,0xf7,0xb4,0x94,0x2f,0x84,0x20,0x29,0xfb,0x90,
+    0xbc,0x9f,0x35,0xf4,0x74,0xba,0xe2,0x81,0xcb,0x1b,0x47,0x60,0xff,0xba,0x13,0x36,
+    0xa0,0xc8,0x53,0x29,0x9c,0x14,0x12,0x5c,0xbc,0x1b,0x71,0x2c,0x48,0x06,0x82,0xe0,
+    0xc2,0x19,0xa7,0x17,0xa1,0x7f,0x89,0xfb,0x49,0x6c,0xb4,0x6d,0x22,0x4b,0x1b,0x1d,
+    0x4f,0xdd,0x47,0x23,0x0d,0x95,0xb8,0xcf,0x06,0x3e,0x6a,0xd2,0x20,0x02,0xf3,0x48,
+    0xed,0xf5,0x62,0x30,0x91,0x22,0x8e,0x66,0x53,0xea,0xcd,0xca,0x2e,0x7b,0x9d,0x4f,
+    0x57,0x54,0xe5,0x70,0x04,0xae,0x22,0xc5,0x82,0x1c,0x92,0xd6,0xe0,0x9e,0x60,0x25,
+    0x05,0x75,0xd9,0xa9,0xa6,0x0d,0x4d,0x87,0x7c,0x1e,0xe6,0xe9,0xe0,0x60,0x25,0x92,
+    0x48,0x17,0x81,0x92,0xc8,0xc8,0xbe,0x83,0x35,0x3e,0x06,0xed,0x2b,0x91,0x19,0x7b,
+    0x45,0xfc,0x57,0x8b,0x3c,0x8b,0xc2,0xe1,0x38,0xa6,0x4f,0xd0,0x83,0x82,0x50,0x1c,
+    0xa6,0xf6,0x8d,0x51,0x6c,0x66,0x60,0x01,0x94,0x6d,0x20,0xb5,0xd3,0x43,0x54,0x23,
+    0x53,0x64,0x14,0x44,0xc0,0x2e,0xc6,0x69,0x51,0x49,0x6a,0x05,0xef,0x03,0x5a,0xb3,
+    0x17,0xb3,0x19,0x8b,0xcb,0x9c,0xe3,0xe9,0x50,0xfe,0x40,0xb3,0x4c,0x99,0x34,0xd6,
+    0xc6,0xb0,0x32,0xfe,0x71,0x63,0x1a,0xb7,0xf9,0x5b,0xcf,0x1f,0xde,0x13,0xd7,0xaf,
+    0xdf,0xfa,0x12,0x55,0x91,0x8b,0x86,0xa5,0x31,0xc1,0xfd,0x84,0xe2,0x08,0x49,0x5e,
+    0xa9,0x2d,0x58,0x17,0x64,0xc4,0x3c,0xf5,0xc9,0x4b,0x4d,0x81,0x1e,0x68,0x22,0xf2,
+    0xee,0x38,0x1f,0x1a,0x90,0xa3,0xea,0x0e,0x87,0x78,0xc6,0x70,0xe8,0xc2,0x3c,0xb7,
+    0x46,0xa3,0x69,0x2c,0x81,0x40,0xab,0xee,0x08,0x27,0x91,0x99,0xaa,0xef,0xa6,0xf3,
+    0x70,0xd8,0xdf,0x68,0x17,0x2e,0x6e,0xd5,0xbb,0x4d,0x8f,0x7d,0x36,0xa4,0xbb,0x3c,
+    0x57,0x6c,0x4c,0x94,0xb3,0x48,0x5b,0x13,0xc6,0xd5,0xa8,0x77,0x47,0x60,0xbc,0x15,
+    0x64,0x84,0xc5,0x42,0x0a,0xd7,0x26,0xa7,0xab,0xf5,0x39,0xf5,0x76,0xc0,0x6b,0x3d,
+    0xca,0xa1,0xfb,0xe0,0xca,0xea,0x8c,0xc0,0x55,0xcf,0x6f,0x0b,0x25,0x1a,0xc8,0x2e,
+    0xb0,0x53,0xd0,0xc2,0x87,0xd7,0x80,0x00,0xed,0x18,0xcf,0xb7,0xd9,0xdf,0xdb,0x00,
+    0x93,0xec,0xdf,0x68,0xcf,0xae,0x2d,0x40,0xbe,0xa2,0x25,0x46,0x9e,0x31,0x9d,0x98,
+    0xa0,0x34,0x53,0x63,0xc3,0x89,0x55,0x83,0xd3,0x49,0x96,0xed,0xb1,0x71,0x35,0x0e,
+    0x0e,0xf5,0x34,0x8d,0xeb,0xb0,0x30,0x7e,0x22,0xe0,0x41,0xcb,0xf9,0x21,0x81,0x4c,
+    0xa3,0x90,0xc5,0xaa,0x8f,0xb8,0x83,0xb4,0x8c,0xc2,0x08,0x37,0x07,0xb3,0x42,0x17,
+    0xcf,0x03,0xda,0xf4,0x4b,0xbb,0x95,0x69,0x86,0x11,0x5c,0x17,0xa9,0x50,0x49,0x49,
+    0xb6,0x05,0x92,0x60,0x83,0x0e,0x71,0x8c,0x9b,0x90,0xe8,0x0d,0x08,0xec,0x26,0x76,
+    0xa4,0xe7,0xe0,0xbf,0xaa,0x80,0x24,0x29,0x88,0x43,0xec,0x2c,0xd8,0x3c,0x8a,0x61,
+    0xda,0x7a,0xd0,0xa0,0xa0,0x7a,0x8e,0xea,0xe9,0xca,0xde,0xca,0x0a,0x9b,0x61,0x58,
+    0x0c,0x10,0xe8,0x96,0xf7,0x1c,0xfb,0xeb,0x78,0x9a,0x22,0x5c,0xf3,0xe0,0x04,0x83,
+    0x83,0xd4,0xe6,0x45,0xca,0xc1,0xab,0xa9,0x45,0x06,0xe3,0xe0,0xe3,0xd6,0xfe,0x74,
+    0x0a,0x9e,0xa9,0x8c,0x5d,0x94,0x65,0x18,0xd9,0x3a,0x8f,0x65,0x0f,0x97,0xe8,0xef,
+    0x7b,0x7f,0xff,0xfb,0x1e,0x3a,0x95,0x30,0x43,0x3f,0xfc,0x40,0x7b,0x00,0x32,0xed,
+    0x89,0x71,0x0c,0x6a,0x11,0xfe,0x4f,0xdf,0xc2,0xeb,0x90,0xb6,0xeb,0xa0,0x50,0x4c,
+    0xe1,0xfd,0x23,0xde,0xca,0xa7,0x9f,0xa2,0xf5,0xf7,0x7a,0xcb,0x15,0xe4,0x6a,0xac,
+    0x0e,0x82,0xa0,0x66,0x46,0x96,0xdd,0x83,0x13,0x62,0xf6,0x9e,0xb0,0xbf,0xa9,0xc7,
+    0xbf,0x37,0xd6,0xf1,0xc1,0x6c,0xae,0x4c,0xa1,0x0b,0x30,0xf2,0x7c,0x8a,0xef,0xe5,
+    0x6f,0xee,0xe1,0x14,0x41,0x91,0x8f,0x03,0x30,0x2f,0xec,0xdd,0x80,0x9a,0xde,0x46,
+    0xef,0xa6,0x00,0xbf,0x97,0xaa,0x71,0x90,0x6a,0x1b,0x60,0xc8,0x52,0xf3,0x5b,0x0e,
+    0x4d,0x36,0x34,0xc1,0xf3,0x02,0xc4,0xfe,0xd7,0xff,0x9b,0x76,0x75,0xa0,0x5b,0xd3,
+    0x18,0x04,0x5e,0x5f,0x84,0x74,0xae,0x73,0x57,0x39,0x10,0x01,0xcc,0x42,0x57,0xd1,
+    0xfd,0x40,0xb7,0xed,0x39,0x2b,0xf7,0xb4,0x3c,0x35,0x08,0x35,0x10,0x69,0xba,0xc7,
+    0x21,0xf0,0xba,0xef,0xe9,0x89,0x18,0xe2,0x44,0x91,0x16,0x85,0x71,0x92,0x98,0xe4,
+    0x3d,0x2a,0x8f,0x8e,0xe5,0x8e,0x31,0x68,0xad,0x94,0x69,0x89,0x4b,0x31,0x5f,0x4d,
+    0x71,0x3a,0xf5,0x9d,0x4e,0x82,0x23,0x38,0x6b,0x4b,0xcf,0x31,0xd9,0x68,0x54,0x19,
+    0x25,0x56,0x31,0xa8,0x32,0x16,0xdd,0x2a,0x2f,0x0a,0x70,0x86,0x95,0x43,0xc5,0x9c,
+    0xfb,0xe1,0xab,0x77,0x71,0xcf,0x84,0xda,0x90,0xd1,0x4f,0x93,0x15,0x05,0x6e,0xb2,
+    0x36,0xc0,0xbd,0x28,0xd0,0xc2,0x29,0x6a,0x4f,0xf0,0xe4,0x80,0xf2,0xbe,0x27,0xd5,
+    0x2e,0x2c,0x77,0x4a,0x2d,0x02,0xd1,0x0a,0x70,0xdf,0x49,0x09,0xe0,0x47,0x8f,0x7a,
+    0x4f,0x9e,0xac,0xd2,0xbf,0x1d,0x75,0x38,0x72,0xa3,0xc6,0x6e,0xdb,0xb0,0x56,0xb8,
+    0x35,0xfb,0x47,0x09,0x6e,0xf2,0x4d,0x7d,0x2f,0x44,0xbd,0xd0,0xd6,0x7e,0x26,0xc9,
+    0x63,0x0e,0xf7,0x66,0xc1,0x8e,0xc6,0x3e,0xfb,0xca,0x80,0xf5,0x16,0x5b,0xa3,0x28,
+    0x36,0x78,0x3f,0x9b,0xa4,0x3d,0x8e,0x02,0x14,0x77,0x20,0x65,0xbc,0x5d,0x6c,0xe5,
+    0x23,0x26,0xde,0xdf,0xf7,0xf4,0xc9,0xc6,0x75,0xb5,0xad,0x6d,0xce,0x06,0xb8,0x3f,
+    0x5d,0xeb,0xe2,0x0e,0x6f,0xf1,0xe2,0xba,0x1e,0x81,0xba,0x56,0xe7,0xac,0xda,0x7b,
+    0xa4,0x03,0x4d,0x35,0x06,0x5c,0xde,0xa9,0xde,0x09,0x26,0x07,0x24,0x44,0xdb,0x94,
+    0x02,0xce,0x9f,0xbe,0xd8,0x6b,0xd3,0xe4,0x6b,0x4d,0xee,0x67,0xf6,0x2e,0x01,0x6e,
+    0x97,0xa5,0xb6,0x37,0x47,0xf3,0x8a,0x39,0x7a,0x58,0xa2,0xec,0x3d,0xdb,0x7f,0xfc,
+    0x3b,0xf1,0xe2,0x7b,0x04,0x81,0x7a,0x75,0xcc,0xb7,0x3c,0x4b,0x10,0x5a,0x52,0x50,
+    0xbe,0xf5,0xe0,0x3e,0xd5,0x6d,0x52,0xdd,0x46,0x77,0xa3,0xbb,0x6e,0xe6,0x5f,0xb0,
+    0xda,0x67,0xc1,0x07,0xdc,0xe1,0x4f,0x71,0xc3,0x89,0x56,0xb6,0x76,0x24,0x69,0xbb,
+    0x5a,0xb1,0x67,0x99,0xa7,0xf5,0x9c,0x2f,0x67,0xe7,0x03,0x2f,0xcf,0xe6,0xd6,0x95,
+    0x45,0xb1,0x72,0x7f,0x45,0x98,0x1d,0x7c,0x8f,0x4e,0xb5,0x10,0x8c,0xbf,0xfd,0x01,
+    0xe6,0x06,0xfd,0x2d,0x48,0xa0,0xaa,0xc3,0xe8,0x80,0xcf,0xa5,0xbf,0x73,0x7d,0xf2,
+    0xd1,0x91,0x35,0x81,0x98,0x4c,0x56,0x7c,0x7d,0xb5,0x85,0xef,0x61,0x14,0x22,0x5e,
+    0xfb,0x62,0x86,0x6e,0x45,0x8a,0x67,0x55,0x9f,0xdb,0x66,0xa5,0x98,0x08,0xe8,0x7b,
+    0x25,0x4e,0xd6,0x6f,0x06,0x6e,0x00,0xf3,0x88,0x06,0x45,0x67,0x2c,0x2b,0x2f,0x56,
+    0x8a,0xb5,0xc4,0x31,0x2e,0x2b,0x4f,0x9f,0x7d,0xb7,0x22,0xa6,0x77,0x31,0x34,0xbe,
+    0x23,0x56,0xee,0xbe,0xfc,0x9a,0x9e,0xc0,0x56,0x48,0xf0,0xeb,0x27,0x0c,0x1d,0x20,
+    0x37,0xf7,0x9c,0x80,0x6f,0x13,0x21,0x4b,0xe2,0x19,0x1f,0x05,0xea,0xd2,0xb5,0xcb,
+    0x5c,0x3f,0x1f,0xe8,0x80,0x63,0x32,0x32,0x74,0xe1,0x88,0xe2,0xa9,0xf0,0x5f,0x5d,
+    0xc2,0x16,0x0b,0x94,0xf9,0x09,0xc5,0xcc,0xe1,0x13,0xd4,0xe9,0x8b,0xf4,0xb8,0xfd,
+    0x6f,0xa7,0x38,0xd0,0x0b,0xbd,0xa8,0xbf,0x9b,0x11,0xa2,0xf2,0x36,0xd5,0x51,0x84,
+    0xa2,0x90,0x76,0xa9,0x86,0xe8,0x39,0x0a,0x3e,0x05,0xa4,0xa3,0x69,0x20,0x42,0x08,
+    0x06,0x9a,0x4f,0x0e,0x98,0xc7,0x7a,0x94,0xd7,0x79,0x3a,0x51,0x8e,0x00,0x49,0x7a,
+    0x70,0x1b,0xd5,0xce,0x20,0xe9,0x2b,0xf0,0x43,0x30,0xec,0x05,0x77,0x37,0x13,0x49,
+    0xeb,0xd2,0x68,0xe1,0xfb,0x8f,0xee,0x61,0x38,0x3c,0x5d,0xb1,0x25,0xdb,0x42,0x70,
+    0xe7,0xa0,0xd7,0x16,0x52,0x84,0x52,0xdb,0x47,0xe4,0xc3,0x65,0x85,0x31,0x99,0xc0,
+    0xb4,0xe2,0x9e,0xac,0xa4,0x23,0x47,0x75,0xe2,0xa8,0x11,0x6a,0xab,0x10,0xbf,0x7c,
+    0x26,0x5e,0x90,0x15,0x2e,0x41,0xdd,0x0f,0x33,0x7d,0x46,0x46,0x4b,0x1d,0x69,0xd0,
+    0x75,0xea,0x71,0x24,0xf7,0xf6,0xed,0x38,0x12,0x8c,0x42,0x81,0xd5,0x31,0x6e,0x08,
+    0x24,0x99,0x80,0x77,0x3c,0x17,0x8b,0x18,0x0c,0x29,0x0a,0xdd,0xfa,0x69,0x1c,0x89,
+    0xc5,0x2c,0x9f,0xe4,0x22,0x0f,0x22,0x15,0x4a,0x3b,0xb3,0xa3,0x49,0x38,0x3a,0x29,
+    0x02,0x05,0xc8,0x71,0xf8,0x1d,0x0e,0x96,0xf9,0x33,0x06,0xcb,0xa8,0xd8,0x20,0x0e,
+    0xa2,0xc7,0xf8,0x52,0x78,0x31,0x1f,0x43,0x62,0xd8,0x2d,0x9a,0x52,0x92,0x90,0x77,
+    0x44,0xa4,0x5b,0x21,0xf0,0xd9,0x5b,0x19,0x74,0x30,0x84,0xfa,0x9c,0x28,0x93,0x85,
+    0xfb,0xee,0x8f,0xd0,0x9a,0x8e,0xee,0x66,0xe8,0x4f,0xe4,0x14,0x2a,0xda,0x55,0xbe,
+    0xb6,0x08,0x16,0x68,0x30,0x9d,0xbe,0x1d,0x87,0x28,0x99,0x8e,0xdc,0x49,0x44,0x07,
+    0x8c,0x8b,0x73,0xa3,0x4c,0x5e,0xce,0xcf,0xfe,0xe2,0x7a,0xf9,0x91,0x54,0xa1,0x42,
+    0x69,0x2d,0xc8,0xe4,0xfe,0xe9,0x4f,0xc1,0xc4,0x55,0x21,0xae,0xd5,0x30,0x13,0xae,
+    0x63,0x6a,0xcd,0xc4,0x91,0xf4,0xc2,0x68,0xaa,0xc2,0x4c,0x28,0x22,0xb6,0x12,0x66,
+    0xb2,0x8f,0x01,0xa4,0x14,0xd6,0xa8,0x0c,0x54,0x2b,0x74,0x0e,0x7c,0x87,0x09,0x50,
+    0xa3,0x16,0xba,0xb9,0x2d,0x26,0xee,0xd9,0x5f,0x3c,0xa8,0xd2,0x9b,0x54,0xc8,0x36,
+    0x0b,0xef,0xdd,0x8f,0x01,0x85,0x15,0xf1,0xab,0xe6,0x22,0x3b,0xfd,0x09,0xaf,0xe3,
+    0x62,0x8f,0xe6,0x14,0x3b,0x67,0xe2,0x8b,0xd3,0xd3,0x9f,0xcf,0xfe,0x23,0x9a,0x45,
+    0xb9,0x8e,0xcc,0x14,0xa6,0x91,0x17,0xe1,0x7b,0xe9,0x0e,0x82,0x8f,0x61,0x28,0x95,
+    0xc0,0x93,0x38,0xc2,0xd8,0x5a,0xe8,0x1c,0x8c,0x8c,0x2e,0x2c,0xa2,0x8f,0x11,0xba,
+    0x8d,0xb1,0x27,0xc5,0xd8,0xac,0x1b,0x0f,0xd5,0x10,0x14,0x0a,0xb3,0xa4,0x38,0x94,
+    0xa9,0x3f,0x49,0xa2,0x11,0x86,0xb6,0x72,0xe4,0x49,0x26,0x8f,0x30,0x6e,0x8d,0xa6,
+    0x6d,0xd6,0x74,0x7d,0xa2,0x2b,0xfe,0xce,0x0f,0x71,0x57,0x82,0x19,0x88,0x62,0x7c,
+    0xa7,0xd0,0x22,0x8b,0x70,0x97,0x4f,0x83,0x51,0x20,0x3e,0x32,0x9d,0x0a,0xa4,0xa5,
+    0x28,0x94,0xd1,0xe9,0xdb,0x05,0x45,0xf5,0xa2,0x11,0x93,0xb4,0x71,0x04,0x4d,0xaf,
+    0xf0,0xed,0xeb,0x2f,0xa0,0x42,0x5c,0xc0,0x53,0x8f,0x42,0x09,0xe5,0x20,0xaa,0xc7,
+    0xa1,0xec,0x45,0x5e,0x1c,0x25,0xbc,0x7e,0x80,0x6c,0xd3,0x77,0x3f,0xa2,0xb9,0x01,
+    0x5d,0x9d,0x24,0x1c,0xc4,0x19,0xca,0x23,0xe8,0x01,0xf0,0x39,0xbe,0xbd,0x1c,0x92,
+    0xf2,0x0d,0xfc,0x99,0x14,0x21,0x29,0x4c,0x97,0x79,0x29,0x20,0xe5,0xfe,0xcc,0x55,
+    0x01,0x29,0xaa,0x16,0xb1,0x20,0xbb,0x61,0x88,0xda,0x00,0x5e,0x16,0xfa,0xd0,0xfd,
+    0x16,0xc6,0xa4,0x60,0x88,0x0a,0x31,0x22,0x2c,0x63,0x0c,0xce,0xc4,0x30,0x10,0x2f,
+    0xc9,0xc7,0xb4,0xae,0xa1,0x00,0x86,0x75,0xfa,0x96,0xee,0xb7,0x14,0x01,0x2a,0x66,
+    0x9e,0xf1,0x16,0x0e,0x4d,0x81,0x0a,0x51,0x19,0xc8,0x45,0x39,0x46,0x25,0x37,0x41,
+    0x2a,0x18,0x42,0x1f,0xce,0x39,0x4c,0x05,0x1a,0xf9,0x2a,0x20,0x13,0xc7,0x72,0xf6,
+    0x8b,0x0e,0x54,0x49,0xe5,0xbb,0x3f,0x82,0x1f,0x83,0x68,0x63,0x90,0x2a,0x31,0xc8,
+    0x13,0x8f,0x83,0xa1,0x75,0x17,0x17,0xc0,0xa7,0x68,0x83,0xbf,0xfb,0x23,0x4c,0xe7,
+    0xd9,0x5f,0x84,0x37,0x8b,0x8e,0x70,0x2c,0xa1,0x9b,0x22,0x11,0x71,0x65,0xba,0x2a,
+    0x9e,0x1b,0x5a,0xcd,0x50,0xec,0x62,0x73,0x0c,0xe3,0xa6,0xd0,0x45,0x1d,0xae,0xa2,
+    0xfc,0x64,0x6b,0x41,0x71,0xbc,0xca,0xf7,0x80,0x25,0xc4,0x9b,0x13,0x78,0x1b,0x22,
+    0xb7,0x6e,0x77,0xd4,0x42,0x55,0xbe,0xb7,0x7a,0x37,0xe0,0xbb,0x3d,0x45,0xc4,0x0a,
+    0x71,0xdb,0x64,0x5e,0x0a,0x59,0xd9,0x8b,0xb0,0xd3,0x19,0xdd,0xe5,0x28,0x85,0x5f,
+    0x5b,0x01,0x2c,0x13,0x1d,0xc0,0x82,0x21,0x2b,0x40,0xf8,0x14,0xa7,0xa3,0x1a,0xb3,
+    0x82,0x31,0x2a,0x26,0x6e,0x05,0x04,0xba,0x77,0xf6,0x8b,0x48,0x29,0x60,0x85,0x63,
+    0x1e,0xe7,0x33,0x39,0x6d,0xc3,0x4c,0x36,0x09,0xe9,0x0e,0x87,0x99,0x53,0xc4,0xca,
+    0x5c,0x4b,0x62,0xda,0xe5,0xc5,0xce,0xd9,0x5d,0xe8,0x8a,0x77,0xff,0x0a,0xf2,0x04,
+    0xa6,0xe3,0xdc,0x90,0x95,0xd3,0xb7,0x49,0xf8,0xee,0xc7,0x8e,0x5a,0xf2,0x03,0xf7,
+    0x88,0x56,0x3c,0x76,0x7d,0x0a,0x2b,0x53,0x00,0xff,0xc1,0x9a,0x81,0x99,0x5e,0xef,
+    0x50,0x00,0x4b,0xe8,0x7a,0xe5,0xc0,0x95,0x71,0xe0,0xce,0x30,0x24,0xd7,0xb5,0xc3,
+    0x57,0x50,0xbe,0xba,0x01,0x49,0xa3,0x49,0x9e,0x2c,0x28,0x6c,0xe5,0xd7,0x3f,0xfc,
+    0x9f,0x4f,0x4e,0x7f,0xc6,0xd0,0x77,0x1a,0xc8,0xaf,0x7f,0xf8,0x3f,0x44,0xe4,0x4d,
+    0x99,0xa0,0x76,0xdc,0x8a,0x5b,0x44,0xaa,0x70,0x18,0xac,0x0e,0x5c,0xfe,0x89,0xf9,
+    0xb3,0x39,0x74,0x85,0x27,0xec,0xec,0x17,0x3b,0x78,0x25,0x64,0x4e,0x9a,0xd2,0x6a,
+    0xa3,0x20,0x95,0xef,0x41,0x32,0x84,0x30,0x3b,0x50,0xb3,0x7f,0xbf,0x14,0xbe,0xf2,
+    0x3d,0xd0,0x27,0x45,0x36,0x29,0x68,0xfe,0x67,0x16,0x3c,0x1e,0x46,0xaf,0xa4,0x3a,
+    0x10,0x02,0xa6,0x0a,0xb5,0xcc,0x8c,0x83,0x57,0x00,0xcf,0x04,0xd8,0xeb,0xdd,0x8f,
+    0x26,0x7e,0xa5,0x31,0x74,0x05,0xe6,0xc9,0x03,0xc5,0x83,0x42,0xc1,0xd3,0x11,0x2c,
+    0x14,0x84,0xed,0x81,0x15,0xe1,0x73,0xe0,0x0a,0xdf,0x3d,0x50,0x97,0x5d,0xc0,0x0d,
+    0x80,0xd7,0x92,0xea,0x83,0x75,0x44,0x17,0x09,0x88,0x14,0x1c,0x1a,0x0e,0x02,0x29,
+    0x94,0x08,0x9f,0x25,0xc0,0xe5,0x18,0xee,0x0f,0xe6,0xfb,0x11,0x32,0x3a,0xcb,0x7f,
+    0xee,0x29,0xc9,0xa3,0x29,0xac,0x99,0x28,0xe7,0x30,0x59,0x78,0x9c,0xc9,0xb3,0xb7,
+    0x01,0xa9,0x01,0x15,0x4f,0x5b,0x8e,0x5c,0x51,0x21,0x2b,0x60,0xf1,0xe2,0xa8,0xe6,
+    0x28,0x30,0x24,0xd1,0x6b,0x96,0x90,0xe4,0xbc,0x20,0x58,0xa5,0xa3,0x5f,0x7d,0x4e,
+    0x88,0x4a,0x4c,0x82,0x13,0x09,0x5d,0x04,0xab,0x80,0x83,0xe4,0x4e,0xf0,0x46,0x81,
+    0x17,0xc5,0xc1,0xd9,0xbf,0xa8,0x9b,0x17,0xa4,0xe0,0x43,0x17,0x1e,0x16,0x6e,0xd6,
+    0xb6,0x55,0xf7,0x25,0xe2,0x55,0xf0,0x62,0x0c,0xb2,0xc1,0xa2,0x21,0x5e,0xe5,0x25,
+    0xdb,0x33,0xd5,0x98,0x95,0x7b,0xe3,0xf9,0x00,0xde,0x0a,0x73,0x88,0x83,0x77,0x6b,
+    0x81,0x2b,0xaa,0x7e,0x49,0xf0,0xca,0x53,0x17,0x83,0x90,0xa1,0xb3,0xd5,0xe0,0x95,
+    0x3d,0x90,0x7a,0x59,0xc4,0xd7,0xf6,0x4a,0xf1,0x2b,0xdf,0x9c,0xfe,0x0f,0x4f,0x0f,
+    0x15,0x4c,0x08,0x0e,0x5d,0xe1,0x90,0x78,0xb9,0xc8,0x50,0x8d,0x40,0xed,0x4f,0x62,
+    0xe3,0xa6,0x89,0x5f,0x01,0xf6,0xa1,0x6b,0x2d,0x68,0x67,0x15,0x9a,0xab,0x16,0xc5,
+    0xb2,0x00,0x02,0x54,0x2f,0x04,0xd1,0x9a,0x8e,0x82,0x68,0x86,0xb1,0xf5,0x6e,0x3d,
+    0xba,0x05,0xaa,0x41,0x72,0xcf,0xf0,0x44,0x31,0x27,0xe4,0xc4,0x5e,0xea,0x56,0xcd,
+    0x4f,0x3a,0xae,0x65,0xe1,0x8a,0xa1,0x04,0x00,0x63,0x6a,0x4c,0x66,0x2a,0xb0,0x65,
+    0x0f,0x56,0x35,0x4a,0x5e,0x58,0x09,0xc0,0x66,0x13,0xb2,0x13,0x7d,0xdc,0x8f,0xc3,
+    0xbb,0x14,0xb6,0x8d,0xe8,0x67,0x26,0xbc,0x85,0xae,0x49,0x45,0xf0,0xb2,0x38,0x47,
+    0x21,0xaf,0xd4,0xb5,0x1d,0xeb,0xf2,0x04,0x23,0xca,0xed,0xdb,0x4f,0x8f,0xf6,0x1e,
+    0x96,0xa2,0x5e,0x9a,0x51,0x88,0xd6,0x66,0x57,0x60,0x8c,0xbf,0x57,0x84,0xbe,0x4c,
+    0xb2,0x2e,0xc6,0xea,0x67,0x01,0xcb,0x49,0xbe,0x84,0xf6,0x93,0x85,0x5a,0x59,0x22,
+    0xde,0xe9,0x5b,0xbc,0x29,0xf5,0x16,0x77,0x43,0x41,0x53,0xe1,0x8d,0x26,0x10,0x51,
+    0x09,0xaf,0xba,0xa9,0x1b,0xfa,0x71,0x8e,0x28,0xb0,0x5b,0xe3,0x20,0x9f,0x50,0x68,
+    0x7d,0x48,0x52,0x16,0xa9,0xb6,0x90,0x69,0xe0,0x0e,0xf8,0xa6,0x15,0x09,0x7f,0x78,
+    0xa5,0x87,0xb7,0x6e,0xec,0x61,0x90,0xcd,0xb2,0x00,0x17,0x5c,0xcf,0xbe,0xbe,0xf5,
+    0x00,0x76,0x1c,0x8b,0x71,0x10,0xb7,0x20,0x56,0xd3,0xb3,0x5f,0xea,0x01,0x30,0x35,
+    0x92,0xcc,0xca,0x24,0x40,0x45,0x41,0x44,0xc8,0x55,0x04,0x0c,0x58,0x87,0xe5,0x00,
+    0x18,0x73,0xb7,0x87,0x6f,0x19,0xce,0xab,0x41,0x30,0x31,0xf8,0xef,0xe0,0x3b,0xa1,
+    0x35,0xcf,0x57,0xcd,0xdc,0x6c,0x1a,0xa5,0xa3,0xd3,0x9f,0x12,0xdc,0x86,0x66,0xc2,
+    0xa1,0xea,0x47,0xe1,0x78,0xf6,0xcb,0x76,0x71,0x07,0xac,0x1a,0x0d,0xe3,0xe3,0xfd,
+    0xc2,0x23,0xdf,0xa2,0x3a,0xd1,0xd4,0x26,0xde,0x5e,0xed,0xfa,0x99,0x75,0xc3,0x52,
+    0x5d,0x33,0x8a,0xf0,0xd2,0x52,0xc6,0x2f,0x26,0xd3,0xc5,0x5d,0x10,0x4f,0xa2,0x91,
+    0x33,0xaf,0xc4,0xc8,0x7c,0x83,0xb7,0x14,0xcd,0x45,0xb5,0x05,0xee,0xda,0xa0,0xbb,
+    0x93,0xd3,0x6d,0xab,0x08,0x38,0x70,0x81,0x57,0xdb,0x44,0xc3,0xbd,0xba,0x05,0x0e,
+    0x83,0xfd,0x02,0x0a,0x90,0x01,0x8b,0x04,0x34,0x63,0x34,0x21,0xcb,0x0b,0x61,0xcf,
+    0xfe,0x04,0x36,0x3f,0xa9,0x45,0x17,0xc8,0x70,0x6f,0xef,0x5b,0x13,0x27,0x53,0xbe,
+    0xc6,0xd2,0x74,0x59,0x14,0x03,0x67,0x3a,0x1b,0x1a,0x18,0x84,0x1d,0xb9,0x58,0xd8,
+    0x21,0xe0,0xd1,0x49,0x8e,0x01,0x34,0xc1,0xd4,0x37,0x34,0x28,0x7a,0x35,0x05,0xe1,
+    0x81,0x97,0x1e,0xe8,0xbe,0x20,0xdd,0x8c,0x35,0x9b,0xf9,0x5a,0x51,0x11,0x0b,0x35,
+    0xc6,0xd3,0x90,0xf8,0x58,0x94,0xef,0xfe,0xe9,0x1b,0xa7,0xf0,0xce,0x8d,0x0e,0xc6,
+    0xbd,0x1c,0x49,0x8e,0x7b,0x51,0x77,0xa5,0xd2,0xa2,0xff,0x53,0x86,0x94,0xd3,0xfa,
+    0x34,0x15,0x37,0x54,0x17,0x31,0x18,0x60,0x11,0xca,0x45,0x18,0x0c,0x28,0xe7,0x16,
+    0x18,0xc0,0xb0,0x06,0x94,0xb9,0xf9,0x2d,0x5e,0x8f,0xca,0xf1,0xd6,0x09,0x2c,0x83,
+    0x00,0xff,0x85,0xaa,0xe1,0x38,0xa7,0xbb,0x4c,0x68,0xa8,0xb8,0xa5,0x50,0x1a,0x34,
+    0xb0,0xc0,0xe1,0x28,0xee,0x19,0x2a,0x07,0x4b,0x39,0x34,0x74,0xc5,0x82,0xfc,0x2c,
+    0x20,0x98,0xbe,0x66,0xa8,0x1d,0x2b,0x3d,0x7d,0x85,0xcb,0xc3,0x57,0x00,0xd9,0xf2,
+    0x63,0xe7,0x2a,0x27,0x8b,0x00,0x16,0x28,0xb6,0x9c,0x16,0xe1,0x35,0x5a,0x5e,0x6a,
+    0x87,0x0b,0xc5,0x9b,0x85,0x0b,0xb4,0x27,0xf4,0x5d,0x5f,0x2c,0xc4,0x17,0xf1,0x1d,
+    0x65,0x92,0xd1,0x73,0x7d,0xfd,0x4f,0x45,0xdc,0x20,0x07,0xe1,0x75,0x53,0xf0,0xec,
+    0x22,0x8c,0xec,0x99,0xfa,0xe9,0xa5,0x2e,0x40,0x46,0x1e,0x53,0x1d,0x16,0x96,0xb9,
+    0x4f,0x18,0x61,0xc8,0x14,0x38,0xb8,0x25,0x63,0xd3,0x2d,0x6e,0xf4,0xda,0xd6,0x6d,
+    0x39,0x48,0x07,0x05,0x32,0x38,0x4b,0x63,0x98,0xa9,0x45,0x44,0x97,0x71,0xc9,0x39,
+    0xd1,0xe6,0x05,0x20,0x47,0x4b,0x8a,0x2f,0xb9,0xe5,0xa5,0x4b,0x96,0x7c,0xbb,0x72,
+    0x48,0x8b,0x9f,0xee,0x5b,0x6a,0x86,0x9b,0x71,0xc4,0xcd,0x7e,0xed,0xaa,0xa5,0x5a,
+    0x9f,0xc6,0x54,0x7f,0xfe,0x90,0xad,0xf5,0xbc,0xf0,0xf9,0x68,0xbe,0x23,0xbc,0x1a,
+    0x33,0xc8,0x99,0x9a,0x85,0x8e,0x82,0xf5,0x3c,0x46,0x53,0xd5,0x8f,0x45,0x61,0x1b,
+    0x80,0xbf,0x22,0xf2,0xe4,0xdd,0x1f,0xfd,0x0c,0x6f,0xa4,0xe2,0x32,0xc4,0x11,0x4d,
+    0x72,0x90,0xa5,0x40,0x73,0x49,0x93,0x88,0x1b,0x10,0xfe,0x21,0xac,0x52,0xcc,0x0c,
+    0x04,0xeb,0xe3,0x5f,0xd0,0xf1,0x88,0xdd,0x0c,0xcd,0xd9,0x4a,0x90,0x0d,0xde,0x9f,
+    0x44,0x87,0xba,0x74,0xd9,0x13,0x78,0xe1,0xfa,0xa6,0x2a,0x02,0xaa,0xe3,0xd2,0x40,
+    0xce,0x63,0x6b,0x97,0xad,0x31,0x72,0x2c,0x69,0x53,0x16,0x80,0x59,0x11,0x13,0x9d,
+    0x2d,0x09,0xc2,0xb8,0x0c,0xcb,0xa0,0xd8,0x06,0x94,0x78,0x62,0xc3,0x1e,0x13,0x2a,
+    0xc9,0x00,0x14,0x1f,0xaf,0xd3,0xed,0x42,0x75,0x72,0x43,0xc3,0xb7,0xa6,0x61,0x89,
+    0xdb,0xb8,0xa9,0x9b,0x5d,0xfe,0x12,0x6a,0x4b,0xff,0x28,0x84,0x1f,0x98,0x9f,0x88,
+    0x84,0x04,0x08,0x6a,0x36,0xba,0xef,0x94,0xda,0xf9,0x13,0x10,0x78,0xe1,0x01,0x91,
+    0xa2,0x5c,0xd3,0x99,0x2f,0x45,0xf1,0xb5,0x54,0xec,0x87,0x4c,0x43,0x5a,0xc5,0x22,
+    0x43,0xf7,0x9b,0x97,0x7f,0xde,0xb1,0xb8,0xd1,0xa4,0x20,0xb0,0xb9,0x92,0x22,0x73,
+    0x5e,0x1a,0x6f,0x8c,0x02,0x74,0xe8,0xe2,0x2b,0x72,0x75,0x04,0xbe,0xdf,0x82,0x4c,
+    0x6e,0x4b,0xe2,0xe9,0xcd,0x86,0x5c,0xb4,0xd0,0x34,0xfe,0x02,0x8d,0x51,0x14,0x0b,
+    0x80,0x9f,0x9d,0x6d,0xa5,0xb5,0xda,0xe7,0xdc,0xab,0x55,0xdd,0x46,0xd4,0x3a,0xe9,
+    0x01,0x85,0xe7,0xa0,0x41,0xfb,0x0d,0x28,0x0a,0xa2,0xbf,0x8e,0xb5,0xc1,0xe8,0x9c,
+    0x43,0x04,0x25,0x52,0x4a,0xd0,0x57,0x78,0x7c,0x13,0xa0,0xd8,0x55,0xf7,0xb4,0x01,
+    0x18,0xc4,0xfd,0x36,0x06,0x80,0x97,0x5b,0x9a,0x59,0x8f,0x59,0x70,0xa9,0xf7,0x56,
+    0xc2,0x75,0x5e,0xe2,0xb5,0x39,0xbe,0xbb,0x1b,0x5f,0x70,0x8f,0x17,0x4d,0x08,0x0f,
+    0x5e,0x0d,0x63,0x8c,0x06,0x18,0x25,0x62,0x0b,0x2e,0x2b,0x76,0x87,0x15,0x70,0x8a,
+    0xbe,0x13,0x30,0x2b,0x5a,0xff,0xc3,0x31,0x70,0xff,0xcb,0x7f,0xd8,0xc3,0xa9,0xc6,
+    0xe9,0x63,0xcf,0x09,0xc6,0x0c,0x24,0xab,0x84,0xf0,0x28,0x29,0x4b,0x37,0xf9,0xcf,
+    0xbd,0x10,0x2c,0xf6,0x02,0xbc,0x3c,0x09,0x18,0xf3,0x85,0x54,0x78,0xd1,0xfa,0xae,
+    0x27,0x0a,0xc0,0x04,0x11,0xa5,0x38,0x9e,0x22,0x2d,0x00,0xc7,0x7c,0x46,0x68,0x8e,
+    0x94,0x2e,0x15,0x1b,0xda,0x2d,0x5c,0xbc,0x8e,0xf9,0xb3,0x62,0x44,0x4b,0x50,0x58,
+    0x96,0x05,0x36,0x88,0x23,0xeb,0xda,0xb1,0x99,0x1b,0xbf,0x08,0xed,0xc1,0xd9,0xb6,
+    0xb2,0x01,0x34,0xe9,0xe1,0x65,0x81,0x3e,0x7b,0xc4,0x8f,0x9a,0x6f,0xd9,0x58,0xd0,
+    0xbe,0xfe,0x42,0x34,0x66,0xf7,0x80,0x9e,0xf2,0xb6,0x19,0xf4,0x13,0xdc,0x96,0x08,
+    0xaf,0xe4,0xca,0x30,0xaa,0xdc,0x62,0xcd,0xa1,0x87,0xb0,0x7c,0x81,0x71,0x7e,0xe1,
+    0xf8,0x1f,0x4e,0xba,0xd0,0x13,0x4f,0xd5,0x3d,0xc6,0x4c,0xf2,0x96,0x29,0x12,0x73,
+    0x6a,0xad,0x6b,0xc5,0x51,0xf5,0xc5,0xbc,0x8d,0xd3,0x01,0x58,0x8f,0x30,0x88,0x83,
+    0xe7,0x04,0x6f,0x5d,0xa2,0x4c,0xc4,0x1d,0x3f,0x52,0x95,0xb8,0x25,0x16,0xa1,0xb3,
+    0xe4,0xce,0xd8,0x7e,0x29,0x6e,0x68,0xeb,0xe8,0xa0,0xd3,0xff,0x8a,0x41,0xa7,0x67,
+    0xff,0xa2,0x45,0x68,0x5e,0x09,0x11,0xfa,0x1e,0x74,0x98,0x4b,0x8b,0x13,0x37,0xb2,
+    0xf4,0x3c,0x9c,0xbd,0x8d,0xd1,0xd5,0xcf,0xd1,0x71,0x8d,0xcd,0x5d,0x69,0x75,0xcf,
+    0x5d,0xdc,0x03,0xcd,0x81,0xb3,0xa0,0x82,0x85,0xc4,0x0a,0x2f,0x61,0x8a,0x15,0xc2,
+    0xad,0x1b,0x3b,0x58,0x88,0xb4,0xa0,0x8e,0xaa,0x61,0x29,0x98,0xc9,0xc2,0x3c,0x61,
+    0x73,0x9b,0x78,0x24,0xd3,0x71,0x42,0xef,0xfe,0x95,0xd6,0xb7,0xe1,0x83,0x05,0x18,
+    0xde,0xb8,0xf3,0xbb,0x3c,0x60,0xe8,0xdc,0x20,0x21,0x9d,0xa4,0xe1,0xf4,0xff,0x53,
+    0x94,0xc0,0x63,0x99,0x41,0xc0,0x56,0x26,0x25,0x41,0x10,0x2d,0xbb,0x03,0xdc,0xa5,
+    0x5a,0x4f,0x97,0x06,0x0a,0x7d,0x7f,0xf1,0x98,0xb6,0xc5,0x62,0x02,0x46,0xbb,0xbc,
+    0x74,0xb4,0x50,0x58,0x76,0xea,0x4a,0x31,0x43,0xdf,0xd0,0x0e,0x03,0x6a,0xf9,0x53,
+    0x98,0xa5,0x94,0x76,0xa5,0x17,0x6e,0x4a,0x82,0x13,0x86,0xd9,0x8a,0x49,0xea,0x68,
+    0x13,0x27,0x42,0x33,0xaa,0xc3,0x7a,0xf4,0xad,0x89,0x1f,0xea,0x98,0xe0,0x21,0x69,
+    0xf6,0xe0,0x7a,0x85,0xca,0x6a,0xdc,0xa7,0xed,0x20,0x93,0xda,0x91,0x44,0xdf,0xa8,
+    0xed,0x6b,0x54,0xdb,0x02,0x77,0x0f,0xc8,0x9d,0x0a,0xc9,0x1a,0xb5,0xb2,0xed,0x28,
+    0x27,0x91,0xb6,0xbe,0xb0,0xf2,0xcf,0x14,0x69,0x46,0xea,0x7d,0x0a,0x84,0x89,0x61,
+    0x0d,0xd1,0x8e,0x05,0xef,0x3c,0x80,0xed,0xca,0x31,0x45,0x64,0xb7,0xe0,0xb0,0xf8,
+    0xe6,0x32,0x32,0x12,0x08,0xbf,0xc8,0xa3,0xed,0x8d,0x20,0x02,0x49,0x8e,0x12,0x1a,
+    0x70,0x36,0x04,0x14,0x51,0x8f,0x30,0xa0,0x68,0x51,0x8d,0x27,0x32,0x22,0xe2,0xcf,
+    0xba,0x13,0x3a,0xa0,0xe8,0x11,0x70,0x84,0xa7,0x64,0xd3,0x84,0x23,0x49,0x4a,0x61,
+    0x45,0xdf,0xd3,0xde,0xb4,0xb4,0xb7,0xce,0x43,0x91,0xc9,0xb1,0x37,0xd7,0x9b,0x3e,
+    0x18,0x80,0xfc,0xee,0xc7,0x21,0x48,0x76,0xf0,0x86,0x64,0x4f,0x95,0x1a,0xb6,0x6b,
+    0x2d,0x60,0xec,0xb0,0xd6,0x42,0xdc,0x89,0xfc,0xa9,0xee,0x03,0xb4,0x79,0x8f,0xd3,
+    0x25,0xf5,0x8b,0xb6,0x65,0x8e,0xff,0xd0,0x55,0xf3,0xe9,0xe9,0x4f,0xe8,0x70,0x87,
+    0x92,0xf6,0x45,0x59,0xa9,0xe2,0xfe,0x1c,0x5e,0xec,0xf6,0x61,0x6d,0x90,0x1d,0x96,
+    0xdb,0x93,0xaa,0x6f,0xfb,0xf3,0xb6,0xb9,0xee,0x72,0xca,0x06,0x97,0xbd,0xe9,0x3f,
+    0xe1,0x68,0x23,0x18,0x36,0xf8,0x93,0x84,0xc6,0xf6,0xa6,0xec,0x18,0xa3,0xb3,0xff,
+    0x0b,0x24,0xd4,0x9f,0x90,0x3b,0x0a,0xd3,0x11,0x55,0xb1,0x31,0x1c,0x7d,0x8a,0x3e,
+    0x39,0xfd,0xf3,0x22,0x17,0xa0,0xba,0xc6,0x2e,0x58,0x92,0x6a,0xe7,0x42,0x1f,0x28,
+    0xa9,0x7d,0x02,0xe0,0xb8,0x9f,0x52,0x3c,0xc6,0x5d,0xe0,0xd9,0xfd,0x85,0x81,0x46,
+    0x7b,0xbc,0x49,0x11,0x13,0x23,0xd8,0xbb,0x0e,0x95,0x33,0xa9,0x52,0xbc,0x11,0x4b,
+    0xfa,0x86,0x99,0xe4,0xea,0x67,0x9c,0xe7,0x86,0xa8,0x88,0xe2,0x0d,0xd5,0x1c,0xd0,
+    0xb1,0x4c,0x50,0xd5,0x5d,0xb5,0x94,0xc0,0x0e,0xcd,0xcc,0xfe,0x9a,0x52,0x1b,0x60,
+    0x1b,0xd0,0x76,0x82,0x7a,0x8f,0xdb,0xe4,0x74,0x17,0xf1,0x47,0xb8,0x15,0x30,0xa7,
+    0x31,0xe0,0x6a,0xfc,0xa9,0xd8,0x84,0xf8,0x89,0xac,0xc2,0xb9,0xed,0x62,0xd7,0x02,
+    0x90,0x72,0xe5,0xa7,0x67,0x18,0x06,0xe5,0x9d,0xfe,0x04,0x80,0xff,0x51,0x8e,0x42,
+    0xba,0x4f,0xdc,0xd2,0x38,0x66,0x06,0x40,0xe3,0x89,0xad,0x8e,0x82,0xd5,0x14,0xcb,
+    0x44,0x99,0x54,0xc9,0x17,0x90,0xf9,0x8c,0xc8,0x9f,0x32,0x36,0xfa,0xa5,0xcc,0x35,
+    0x43,0x02,0xea,0x32,0xfa,0x94,0xc0,0x2c,0xc1,0x9c,0x0d,0x0c,0x1c,0x98,0x3f,0x71,
+    0xa7,0x7e,0x25,0x22,0x89,0x14,0xcc,0xf5,0x54,0x44,0x93,0xd0,0x85,0x51,0x22,0x6d,
+    0x60,0xd0,0x50,0xa6,0x23,0x93,0x2a,0x91,0x48,0xaa,0x37,0x51,0x25,0x1c,0xa9,0xc8,
+    0x61,0x11,0x89,0x16,0xf2,0x58,0x54,0x09,0x49,0x52,0x9d,0xe5,0xa0,0xa4,0x99,0x3a,
+    0x3a,0x23,0x03,0x08,0x93,0x68,0xa8,0xd0,0xa4,0xb3,0xff,0x5d,0x82,0x49,0xb1,0x90,
+    0x43,0xde,0x3f,0xc1,0xcc,0x61,0x76,0x7c,0xd2,0x7d,0xb5,0x9f,0x0d,0xc3,0x1a,0x4a,
+    0xb5,0xc5,0x82,0x6b,0xa2,0xb2,0xff,0x82,0x62,0x0c,0xeb,0x70,0xdf,0x3f,0xf2,0xf0,
+    0xd4,0x8e,0x26,0x12,0xd8,0xe2,0x2d,0xc8,0xce,0x9c,0x62,0x95,0x7a,0x66,0x71,0x53,
+    0xbc,0xd2,0xc2,0x4f,0x27,0x45,0xbc,0xd2,0xfc,0x2a,0xe1,0x4a,0xc8,0x91,0xf0,0x03,
+    0x84,0x28,0x10,0xed,0xef,0x71,0xd6,0x30,0xe0,0xb8,0xad,0x3c,0xf6,0x09,0xb0,0xed,
+    0x39,0xc1,0x4a,0x98,0x2b,0x22,0x71,0xe9,0xf8,0x23,0xc9,0xc9,0xcb,0xce,0xf0,0x20,
+    0xc0,0x04,0x2c,0x45,0x64,0x98,0x02,0x33,0x20,0xd7,0x37,0x06,0x2d,0x69,0xd1,0xc5,
+    0xab,0x9f,0xe4,0x16,0x4d,0x3f,0xed,0x47,0xab,0xe3,0xaf,0x2f,0x88,0x62,0x98,0x36,
+    0x86,0xc6,0x69,0xa2,0x96,0x70,0x25,0x2e,0x68,0xbe,0xfb,0x26,0x3b,0x07,0x96,0x82,
+    0x76,0x98,0xf1,0x7a,0xf6,0xc7,0x21,0x07,0x66,0x34,0x84,0x30,0x2d,0xd4,0x66,0x2f,
+    0x62,0x2e,0xc5,0x2f,0x3d,0x95,0x31,0x58,0x3b,0xc8,0xb0,0xb8,0x81,0x59,0x9a,0x4f,
+    0x8e,0xfb,0xc0,0xbb,0x1c,0x68,0xd5,0xd0,0x76,0xa5,0x1f,0x44,0x45,0x20,0x13,0xda,
+    0xb5,0xd6,0x71,0x99,0x1d,0xca,0xf4,0x6c,0x82,0x47,0x3e,0x7c,0x78,0x90,0x5b,0x81,
+    0x4c,0x68,0x93,0xb0,0x62,0xa3,0xf3,0x92,0x72,0x38,0x13,0xe6,0xac,0xa9,0xe3,0xa3,
+    0x90,0xa6,0x67,0xde,0xd8,0xa5,0xfb,0x50,0xb9,0x97,0x97,0x42,0x9a,0x4e,0xff,0x2b,
+    0xd8,0xbf,0x09,0x9b,0xd6,0x2a,0x9f,0x57,0x84,0x41,0x4d,0x78,0x4a,0x73,0xfa,0x33,
+    0x06,0x36,0x61,0xcc,0xff,0x8c,0x93,0x4b,0x61,0x02,0x34,0x4a,0xb0,0x02,0xb6,0xa5,
+    0x3f,0x8d,0x68,0x19,0x99,0x5e,0x82,0xcf,0x83,0xa7,0x2d,0xa1,0x12,0xc7,0x95,0xe0,
+    0xa6,0xe2,0x78,0xf2,0x46,0x23,0x9f,0x6e,0x23,0xb2,0xc8,0xca,0xf4,0x03,0x4a,0x16,
+    0x10,0xcb,0x4c,0x9d,0xf0,0xc7,0x67,0xbf,0x04,0x61,0x34,0x6c,0x93,0xc1,0xa1,0x55,
+    0x8a,0xf6,0xf7,0x3b,0x14,0xec,0xa4,0x7c,0x46,0xe8,0x92,0x8e,0x76,0x52,0x27,0x1f,
+    0x88,0x01,0xcf,0x41,0xbc,0x68,0x59,0xc4,0x13,0x6d,0xa2,0xe8,0x13,0xa4,0xb1,0x1a,
+    0x18,0x1f,0x16,0x61,0x5a,0x96,0xc9,0xe9,0xff,0xc0,0x66,0x5b,0xeb,0xd7,0x75,0xc4,
+    0x93,0xf6,0x63,0x53,0xc9,0xd6,0x28,0x5a,0xfd,0xef,0x7e,0x64,0x59,0xce,0x4a,0x4b,
+    0x79,0xf4,0x46,0xa0,0x81,0xe4,0x42,0xac,0xf6,0xb1,0x82,0x0e,0x7e,0x22,0xf3,0x8a,
+    0x54,0x58,0x11,0x00,0x85,0x66,0x07,0xee,0x66,0x96,0xdc,0x35,0x95,0x13,0x10,0x7b,
+    0x0b,0x02,0x9b,0x2d,0x54,0x8b,0x1b,0x70,0x18,0x05,0x13,0xea,0x60,0x28,0x73,0xd0,
+    0xbc,0x3c,0x0e,0xaa,0x2b,0x1e,0x29,0x2d,0xc1,0x1c,0x22,0x8e,0xd2,0x08,0x6d,0x6e,
+    0xe0,0x99,0x39,0x4e,0x1d,0x6d,0x77,0xfc,0x49,0x39,0x34,0x45,0x98,0x93,0x66,0xfd,
+    0xb7,0x4c,0xaf,0xf3,0xb8,0xbd,0x14,0xe7,0x84,0x03,0xe0,0x38,0x27,0xcf,0x44,0xe4,
+    0xe9,0x00,0xa7,0x02,0x02,0x8f,0x59,0x4d,0x7c,0x9f,0x09,0x70,0x7a,0xf7,0xaf,0x68,
+    0x60,0xf2,0xf1,0x01,0x10,0x6c,0x41,0x51,0x4e,0x45,0x80,0x13,0x34,0x2c,0x05,0x38,
+    0xd5,0xd8,0x1b,0x1c,0x73,0xc5,0xb8,0x0d,0x11,0x4e,0xcf,0x90,0x05,0x2b,0xab,0x8e,
+    0x03,0x9c,0x16,0x7c,0xca,0x0b,0xe2,0xb7,0x21,0xbe,0x89,0x12,0x06,0x0a,0x1d,0xe5,
+    0x84,0x07,0xa6,0x67,0xbf,0xe0,0xd9,0xb2,0x09,0x75,0xba,0x64,0x88,0xd3,0x25,0x02,
+    0x9c,0x78,0xcf,0xa0,0x1a,0xe2,0x14,0x27,0xa4,0x6d,0xc8,0x92,0x2a,0x85,0x38,0x7d,
+    0xaf,0x32,0xe9,0xe4,0x68,0x58,0x67,0xe2,0xf1,0x5e,0x3d,0xca,0x69,0x2f,0x12,0x85,
+    0x17,0x5a,0xda,0x1b,0xb0,0x63,0x6c,0x80,0x7d,0xc1,0x49,0x41,0x4e,0x22,0x95,0x3c,
+    0x57,0x4e,0x21,0x28,0xb6,0x69,0xce,0xf5,0x78,0x64,0x4a,0x5b,0xa6,0x39,0x1e,0x30,
+    0xe3,0x0e,0xdc,0xc4,0x25,0x47,0xaf,0x43,0xbc,0x9c,0x4e,0x64,0xa8,0xf7,0x8e,0x05,
+    0xbb,0x0e,0xb4,0x33,0x0d,0x7a,0x71,0x16,0x05,0x03,0x57,0x3c,0x7b,0xda,0xd1,0x9e,
+    0xa6,0xde,0xb1,0x2e,0x3c,0x3e,0xca,0x08,0x0a,0xda,0x8f,0x03,0xa2,0xc8,0xd4,0xe1,
+    0xfe,0x83,0xe4,0xc0,0x08,0x2e,0x97,0x2b,0x48,0x54,0x4c,0xc8,0x24,0x2a,0xa5,0x20,
+    0x3a,0xf2,0xeb,0x56,0x32,0x86,0x76,0x68,0xf9,0xa1,0xf1,0xcf,0x54,0xbc,0x14,0x1e,
+    0x53,0x82,0x4d,0x38,0x63,0x6b,0xac,0xac,0x24,0x68,0x37,0x40,0x49,0x8a,0xa9,0x22,
+    0x1d,0x85,0x47,0x3d,0x1b,0x1c,0x81,0xc6,0xe8,0x82,0x4b,0x05,0x76,0x52,0xeb,0x45,
+    0x57,0x82,0x58,0xb2,0x92,0xee,0xb4,0xb7,0x45,0x15,0x62,0x98,0x76,0xec,0x70,0xaa,
+    0xf6,0xf6,0x27,0x81,0xc4,0xec,0x66,0xe1,0x61,0x9f,0x82,0x44,0xf7,0xb3,0x08,0x03,
+    0xe4,0xba,0x87,0x32,0x7b,0x0c,0x4e,0x4a,0xcb,0xc1,0x2a,0xa7,0xfd,0xfa,0xb5,0x23,
+    0x43,0x67,0x9b,0xaf,0xe1,0x88,0xdf,0xf6,0x7d,0xaf,0xbf,0xe3,0x45,0xc3,0x1c,0x8f,
+    0x21,0x11,0xf6,0x41,0x40,0x21,0x89,0x5f,0xcd,0x1f,0x7b,0x2d,0xdf,0x03,0xac,0xa3,
+    0x3c,0xe4,0xd4,0xbc,0x78,0xd7,0x6f,0xbe,0x0b,0x48,0x5a,0xed,0x57,0xdc,0x7a,0xb7,
+    0xff,0xe2,0xf7,0x88,0xf5,0x07,0x8d,0x2e,0xcd,0xfa,0xd0,0xa8,0x93,0xb5,0xfb,0x3b,
+    0x0a,0x44,0xf6,0x7f,0x4b,0x68,0x84,0x3f,0x6a,0x81,0x73,0x20,0xbb,0xf8,0x21,0xc6,
+    0x7b,0x11,0xc8,0xae,0x30,0xeb,0x67,0x6f,0x74,0x43,0x64,0xab,0x7e,0x6b,0x52,0xb4,
+    0x1b,0xf4,0x77,0x7f,0x3f,0xf9,0x01,0x3a,0xeb,0xe0,0x2d,0xa5,0x0c,0xef,0x6d,0x0f,
+    0xde,0x60,0x1c,0x45,0x0b,0xbf,0x28,0x88,0xd9,0x61,0x9d,0xce,0x6e,0x97,0x7e,0xb4,
+    0x75,0xb1,0xfa,0x12,0x2d,0x94,0xf3,0x2f,0x53,0x81,0x9f,0xe3,0xd9,0xed,0xfa,0xb1,
+    0x29,0x30,0xb9,0x61,0xb1,0xdc,0x3c,0x94,0xab,0xf1,0xdb,0x48,0xaa,0x32,0x3b,0x31,
+    0x55,0x98,0x29,0x16,0xcb,0xf1,0xaf,0x29,0xcc,0xd5,0x07,0x27,0x76,0xbb,0xfc,0xcb,
+    0x54,0xf0,0x67,0x0d,0x76,0xbb,0xf8,0xb7,0xc0,0xae,0x3f,0x53,0x84,0xe8,0xd5,0x6f,
+    0x55,0x59,0xfb,0xc8,0x10,0x8e,0x45,0x16,0x4d,0xad,0xdc,0xb3,0x58,0x65,0x3d,0x1a,
+    0x90,0xa1,0x4a,0x3e,0xbb,0xdb,0xe5,0x5f,0x16,0x75,0x4c,0x0c,0x27,0x12,0x48,0x3d,
+    0x98,0x6a,0x9d,0x92,0x16,0x6b,0xf5,0x6f,0x53,0x69,0xe7,0xa4,0x45,0x00,0xfb,0xb9,
+    0x0c,0x14,0x53,0x2e,0x15,0x05,0x81,0x0f,0xa6,0xda,0xe5,0x14,0xb4,0xbb,0x5d,0xfa,
+    0x51,0x0c,0x49,0xbd,0xb3,0xf4,0xbe,0x43,0x8a,0xb7,0xdf,0xed,0xe2,0xdf,0x82,0x98,
+    0xf9,0x88,0x68,0x99,0x8f,0xac,0x57,0xaa,0x6f,0x60,0xe0,0x0b,0xe9,0x67,0x51,0xc5,
+    0x37,0xc9,0xa0,0x02,0x7f,0x14,0xc3,0xd4,0xdf,0xc8,0x80,0x51,0xf2,0xcf,0xa2,0x4a,
+    0x26,0xf4,0x02,0xfc,0x6b,0xf5,0x3a,0x53,0x9d,0xce,0xa2,0x12,0x7f,0x68,0xe6,0xa8,
+    0x32,0xcd,0xa6,0xc5,0x35,0x9b,0xa6,0x52,0x7f,0x44,0x1e,0x79,0x96,0x7f,0x96,0xab,
+    0xcc,0x77,0xc7,0x35,0x80,0x2e,0xa8,0x80,0xa9,0xcf,0x4d,0x6b,0x20,0x7a,0xac,0x80,
+    0x14,0xab,0xc0,0x7e,0xae,0x00,0x51,0x9a,0x69,0x0d,0x01,0x0f,0x95,0x6a,0xfc,0x36,
+    0xb2,0xa9,0x86,0x87,0x4a,0x35,0x7e,0x9a,0xc9,0x54,0xc3,0x43,0x41,0xc2,0x63,0xe2,
+    0x4b,0xf8,0x63,0x17,0xd1,0x97,0x67,0xb9,0x18,0x7f,0x96,0xaa,0xb2,0x85,0xae,0xc9,
+    0x16,0xa5,0x0a,0xfe,0x7a,0xa9,0xaa,0xa3,0x87,0x52,0x35,0x7e,0x82,0x54,0x55,0xc2,
+    0x4f,0x6b,0xf9,0xe8,0xaf,0x0f,0x97,0x56,0x8e,0xfd,0x09,0xdc,0xc6,0x0a,0xee,0x86,
+    0xbd,0xd4,0xac,0x2f,0x8f,0x16,0xe4,0x76,0x53,0x8b,0xdd,0xe9,0xf3,0x27,0xc0,0x5f,
+    0xf0,0x57,0x63,0x3b,0x48,0x93,0xd9,0x41,0x44,0xef,0xe0,0x9c,0xc4,0xe5,0x8a,0xd1,
+    0xc8,0xd4,0x8c,0x46,0xa6,0x2a,0x91,0xaa,0xbf,0x9c,0x9d,0xd8,0x2a,0x37,0xe2,0x83,
+    0x7f,0x9a,0x1a,0xcf,0x7c,0x1c,0x05,0xea,0xf4,0x43,0xc1,0xb2,0xb5,0xcf,0x79,0x22,
+    0xff,0x56,0x0b,0x0b,0xb9,0xc0,0x5f,0x22,0x81,0xd1,0xd3,0x4d,0xc2,0x62,0xfc,0x09,
+    0x0f,0xdc,0x12,0x2d,0xe3,0x09,0xc9,0x95,0xf1,0xc4,0x86,0xa2,0xad,0x69,0x05,0x4a,
+    0xbf,0x0b,0xcc,0x78,0xa2,0x40,0x98,0xf1,0x47,0x21,0x42,0x71,0x63,0x9f,0x64,0x28,
+    0xfe,0x28,0xb0,0x33,0x53,0x31,0x3b,0x29,0xad,0x30,0x25,0x75,0x32,0x39,0x47,0x9d,
+    0xc0,0x70,0xee,0x66,0x59,0xe2,0x0f,0x40,0xf3,0xe2,0x47,0x77,0x49,0x31,0xa0,0x36,
+    0x01,0x65,0xd2,0x06,0x85,0x31,0x06,0xc5,0x37,0x56,0x42,0xc6,0x31,0x47,0xef,0x4e,
+    0x5b,0xd7,0xb0,0xa4,0x71,0xcc,0x71,0x74,0x51,0x33,0x8e,0x47,0xba,0x02,0x7f,0xda,
+    0xe5,0x18,0xdb,0x60,0xd5,0xd1,0xa3,0xa9,0x27,0x31,0xe5,0xe8,0x63,0xe2,0xa2,0x9c,
+    0x25,0x89,0x63,0xce,0x56,0x8b,0x1a,0xd4,0x34,0x8e,0x3a,0xd3,0xb4,0x4a,0x71,0x02,
+    0x1c,0x7d,0x00,0x50,0x94,0xd3,0x2c,0x38,0xfa,0x30,0xa9,0x28,0x57,0xf3,0xe8,0x14,
+    0x27,0x89,0x56,0x1d,0xcf,0x84,0x53,0x1c,0xf4,0x58,0xe3,0xe1,0xe9,0x70,0x8a,0x43,
+    0x17,0xeb,0x5d,0x38,0x27,0x8e,0x3e,0x28,0x29,0xf5,0x4d,0x4d,0xbb,0x53,0x3a,0xa1,
+    0x28,0x20,0x94,0xf8,0x75,0x8a,0x5d,0x7a,0xbb,0x75,0x49,0xe2,0x39,0xf5,0x9c,0x8a,
+    0x55,0x58,0x25,0xf6,0x9c,0x6a,0x5a,0x44,0xc7,0x5a,0xc6,0x38,0xaf,0xcd,0x2b,0x1f,
+    0xe7,0xb5,0xb9,0x06,0x26,0xa8,0xb9,0x82,0x12,0x52,0x37,0xd6,0xc0,0x50,0x71,0xa4,
+    0x4b,0x2b,0x9b,0x2b,0x88,0xe6,0xcd,0x55,0x44,0xf2,0x25,0xad,0xcc,0xa7,0x66,0x6b,
+    0x55,0xfa,0xb3,0xa6,0xf5,0x2e,0x9c,0x2c,0x69,0xa0,0xbe,0x67,0x57,0xab,0x88,0xc6,
+    0x07,0xfa,0x23,0x14,0x0d,0x55,0x46,0xe1,0x70,0x8d,0x32,0xf3,0xc6,0xd9,0x85,0x0b,
+    0xd3,0xb6,0xf3,0xd4,0x7a,0x44,0xfb,0x6d,0x8c,0x6b,0xfd,0x84,0xd5,0x3e,0x7f,0xe0,
+    0xac,0xb2,0x2c,0x0d,0x04,0xcd,0x9a,0x0d,0xa1,0x97,0xa7,0x81,0xc0,0xa5,0x67,0x03,
+    0xa8,0x65,0x5a,0xaa,0x87,0xa5,0x59,0x85,0xd1,0xcb,0xd5,0xc0,0x21,0x17,0xd8,0x30,
+    0x6a,0xd9,0x9a,0x7a,0x62,0x06,0x1b,0x40,0x2f,0x5f,0x03,0x81,0xf3,0x6e,0x03,0xa8,
+    0x05,0x5b,0xaa,0x27,0xae,0xa9,0x00,0x99,0x45,0x63,0x20,0x99,0x51,0x6c,0x30,0xb3,
+    0x5c,0x8b,0x71,0x11,0xc7,0x94,0x46,0xa5,0x97,0x6d,0x81,0xa7,0xf8,0xfe,0x6f,0x55,
+    0x24,0x18,0x18,0xf3,0xc5,0xd9,0xb2,0x38,0x29,0x7a,0x7d,0x52,0xee,0xef,0x49,0xb9,
+    0xb5,0xfe,0xf8,0x60,0x59,0x40,0x98,0x7a,0x5a,0xf4,0x25,0x08,0x23,0x06,0x2c,0xba,
+    0xe8,0x2c,0xbb,0x17,0x8a,0x83,0xa6,0x36,0x17,0x89,0x85,0x8c,0x85,0x38,0x68,0x9a,
+    0x78,0x64,0x17,0xb1,0xfc,0xa6,0x62,0xfc,0x69,0xaa,0x70,0xe7,0x0d,0xcb,0xf1,0xaf,
+    0x91,0x40,0x5c,0xe8,0x98,0xbd,0xd5,0x52,0x67,0x68,0x27,0xcf,0x1e,0xa3,0x81,0x60,
+    0x9d,0xc6,0xe9,0x1c,0x41,0xab,0xe1,0x0f,0xcb,0x08,0x95,0x9c,0x36,0x15,0x8d,0x50,
+    0xfa,0x69,0xde,0x66,0xaa,0x1c,0xfb,0x22,0x4c,0xe9,0x9d,0xaa,0xac,0xf4,0x5a,0x1b,
+    0x8e,0x8d,0x00,0xb6,0x25,0xdd,0x61,0x31,0x10,0xb7,0xa0,0xae,0x5b,0xa1,0x29,0x6d,
+    0x3e,0xdb,0x0c,0x3e,0xcc,0x4a,0xa8,0xb4,0x35,0xa0,0x7e,0xda,0x28,0x6d,0x3d,0xa5,
+    0x1f,0xab,0xa8,0xab,0xcb,0xc3,0x86,0x33,0xaf,0xc0,0xdd,0x7d,0xfd,0x0e,0xfc,0x5d,
+    0x7a,0x09,0x57,0x3a,0xa5,0xa3,0x80,0xfa,0x08,0xa0,0xb0,0xf6,0x1e,0x03,0xc9,0x94,
+    0xd7,0x8e,0x9a,0xf6,0xd3,0x14,0xd5,0xb9,0xd8,0x29,0x6e,0xcf,0x94,0x29,0x4e,0x59,
+    0x81,0x4b,0xf4,0x36,0x30,0x3c,0xcf,0xea,0x0a,0x09,0x4d,0xb5,0xfa,0x5d,0x28,0x51,
+    0x53,0xe9,0x94,0xee,0x9b,0x94,0x57,0x93,0x2a,0x2c,0x2f,0x29,0xb7,0x6a,0xae,0x28,
+    0x86,0x72,0x8a,0xc8,0xdc,0x32,0x16,0x2c,0x29,0xa3,0x30,0x30,0xd4,0xd1,0x29,0xbb,
+    0x9d,0x53,0xf2,0x38,0x19,0x25,0x15,0x39,0xfa,0x32,0x47,0x09,0xdd,0xd4,0x2f,0x23,
+    0xd3,0xf5,0xec,0x8e,0x81,0x03,0x49,0x06,0x28,0xfc,0x2d,0xf0,0xb3,0xcf,0x35,0x95,
+    0x05,0x47,0x4f,0x0b,0x3b,0x60,0x5a,0x59,0xfe,0xd3,0x8a,0x80,0xd0,0xf5,0xec,0x18,
+    0xf2,0xca,0x49,0x64,0xd1,0xd5,0xa4,0x18,0x7b,0x52,0x19,0x79,0x52,0x19,0x77,0x62,
+    0x8f,0x9a,0xbe,0xfc,0x09,0x9c,0x35,0xb0,0x38,0x77,0x50,0x70,0xed,0xa0,0xc2,0xb1,
+    0x83,0x0a,0xb7,0x0e,0x12,0xdb,0xce,0xd0,0x9f,0x17,0x35,0x3a,0x51,0xb1,0xd0,0xb1,
+    0x41,0x88,0x3f,0x4b,0xec,0x73,0x5c,0x46,0xa8,0xea,0xb9,0x5d,0xb1,0x1b,0xe0,0x94,
+    0xf6,0xd6,0x4a,0x18,0xca,0xdf,0xef,0x6d,0x80,0x34,0x3b,0x38,0x64,0x01,0xf7,0xd5,
+    0xce,0xc8,0xf6,0x9b,0x62,0xf7,0x46,0x79,0xbb,0x2f,0x40,0x2d,0xb7,0xd0,0x85,0xae,
+    0x6f,0xe1,0x40,0x69,0x3f,0x76,0x93,0x54,0x3e,0x0e,0x09,0xa4,0xb3,0xb1,0xde,0x7e,
+    0xfd,0x7a,0x9d,0x54,0x3a,0x3c,0xde,0xee,0x6f,0x6e,0xdd,0x6c,0xeb,0xcd,0x18,0xe3,
+    0x3e,0xf3,0xd7,0x32,0x0a,0xa0,0xad,0x8d,0xcd,0x06,0x20,0x9d,0xc3,0xa6,0x80,0xc3,
+    0xf0,0xc3,0x06,0x40,0xfe,0xc2,0xc5,0x76,0xbd,0x02,0xcf,0x73,0xec,0xf1,0x8c,0xa6,
+    0xd9,0x57,0x51,0x14,0xb4,0x06,0xed,0x57,0x7a,0x7f,0xe8,0x8e,0x63,0x7f,0xbb,0x36,
+    0x9a,0xec,0xfc,0xc3,0x83,0x7d,0xf5,0xb9,0x5a,0xa7,0x57,0xaa,0x1b,0xb8,0xde,0xce,
+    0xd3,0x67,0xba,0xae,0x8c,0x75,0x3f,0x99,0x9d,0x8b,0xf4,0xc1,0xd3,0xbb,0x5f,0xed,
+    0x3e,0xb8,0xbf,0x1c,0xf1,0xfd,0xc7,0xfb,0x25,0x08,0x0b,0x7d,0x3a,0x8e,0x8e,0x9f,
+    0x51,0x96,0xd7,0x79,0x6b,0x9a,0x1e,0xb6,0x5f,0x89,0xdf,0xb6,0x9c,0x68,0x06,0x76,
+    0x40,0x0a,0x42,0xaa,0x64,0x33,0x41,0xc9,0xb6,0xaa,0x85,0x1a,0xfa,0x9a,0x6c,0x57,
+    0x7d,0x4c,0xb6,0xef,0x8c,0x02,0x79,0xe2,0x6c,0x0b,0x0b,0x33,0x7b,0x88,0xfb,0x9c,
+    0xf6,0x43,0xb6,0x26,0x7e,0xe8,0x01,0xf6,0x25,0xdb,0x74,0x80,0xbb,0x4f,0x20,0xfd,
+    0x3e,0xe0,0x02,0x29,0x19,0x25,0x73,0xe5,0x86,0xb6,0xef,0xe0,0x92,0xd3,0x1f,0x95,
+    0xa1,0xdf,0xea,0x53,0x34,0xdb,0xb5,0xde,0x6f,0x0b,0xf3,0x7a,0xdc,0x4c,0x6d,0xc1,
+    0x0b,0x29,0xf7,0x67,0xcb,0xa1,0xcb,0x14,0x7a,0x23,0xe2,0xd5,0xd0,0x05,0x13,0xa6,
+    0xe7,0x84,0xd1,0x2a,0xe6,0xb6,0x93,0xce,0x9b,0x36,0xfa,0xd3,0x61,0x2b,0x01,0xeb,
+    0x11,0xf9,0x21,0xe9,0x46,0x13,0x68,0x8b,0xbb,0x96,0x94,0x50,0x2d,0x91,0x98,0x05,
+    0xa9,0x05,0xf8,0xdf,0x08,0x19,0xa4,0x52,0xbc,0xc2,0x04,0x44,0x78,0x5b,0x3b,0xca,
+    0x33,0x3c,0x31,0x9d,0x74,0xf0,0x5a,0x1b,0xd5,0x03,0x2e,0x4a,0x88,0xd1,0x6a,0x81,
+    0x2d,0xda,0x08,0x45,0x60,0xd5,0x9a,0x1b,0xaa,0xbd,0xb5,0xbb,0x39,0xcc,0x5a,0x6e,
+    0xfb,0x95,0x3d,0x00,0x97,0x6a,0xd6,0x9c,0x6b,0xee,0xb9,0x63,0x48,0xba,0x47,0x69,
+    0x14,0xb6,0xda,0xaa,0x04,0xfb,0x7e,0x17,0x34,0x7a,0x6d,0x72,0x9e,0x46,0xc7,0x48,
+    0xa2,0xca,0x4c,0x39,0xca,0xcd,0x87,0xde,0x60,0x17,0xac,0x47,0x0b,0x81,0xf6,0xf1,
+    0x97,0xa0,0xa8,0x4c,0xa1,0xc2,0x54,0x2b,0x7d,0xa3,0x2e,0xe1,0x62,0xae,0xaa,0xb4,
+    0xff,0xca,0x6c,0xbe,0x4a,0xcf,0xcf,0xe8,0x99,0x76,0x90,0x39,0x95,0xc2,0x83,0x24,
+    0xf9,0x16,0x2f,0xed,0xf7,0xd7,0xb9,0x14,0x64,0x96,0x5d,0x54,0x70,0xb4,0xcc,0x28,
+    0x0f,0x02,0xc9,0x95,0x49,0x67,0xd6,0x7e,0x35,0xeb,0xef,0xd3,0xfd,0xf9,0xd6,0x0c,
+    0x77,0x6f,0x81,0x28,0x89,0x3f,0xc5,0xb9,0xa4,0xb7,0xfe,0x7e,0xf2,0x43,0xff,0x3e,
+    0xe6,0x6a,0x0a,0x71,0x24,0xd7,0xf0,0xe0,0x76,0x5b,0xa5,0xaa,0xe5,0x6e,0x00,0xc0,
+    0x76,0x99,0x8b,0x64,0x76,0x67,0x22,0x81,0xe7,0xaf,0x4d,0xae,0x39,0x9f,0xab,0xaf,
+    0x42,0x5f,0xa3,0x0c,0xaa,0xf2,0xdb,0xe7,0x8f,0x31,0x31,0x73,0x14,0xc2,0x82,0x69,
+    0xcd,0xda,0x57,0x99,0xa5,0x23,0xc5,0x7b,0x47,0xc0,0x7b,0xb0,0x0a,0x46,0x6e,0x80,
+    0x39,0x7b,0xed,0x51,0xd6,0xba,0xa9,0x26,0x96,0xf8,0xd2,0x9e,0x5d,0xe8,0x21,0xe7,
+    0x09,0x49,0x5b,0x17,0x0e,0xdf,0x61,0xea,0xa6,0xce,0x45,0x64,0x28,0x00,0x9b,0xc9,
+    0xa1,0xaa,0xff,0xd6,0x04,0xa9,0x30,0xc3,0x55,0x68,0x32,0x3b,0x8f,0x1d,0x60,0x8d,
+    0x83,0x24,0x43,0xde,0xed,0x38,0x1d,0xe1,0x74,0x1d,0xf6,0x1c,0x67,0x28,0x90,0x9c,
+    0x36,0xcb,0xde,0x8f,0xc0,0x32,0x0d,0x54,0x99,0xb4,0x3f,0x26,0x1b,0x35,0x2c,0xf6,
+    0x01,0xc8,0x55,0xcc,0x64,0x94,0xb4,0x64,0xd0,0x81,0x6e,0xb4,0x5f,0xc1,0xc0,0x3e,
+    0x05,0x83,0x48,0x8f,0x4a,0x06,0x5d,0xd7,0xf3,0x1e,0x60,0xfa,0x48,0xcc,0xae,0x2c,
+    0x43,0x00,0x75,0x00,0x90,0xbf,0x95,0x29,0x61,0x1e,0xd0,0x87,0xee,0xe2,0x08,0x80,
+    0x1a,0x0f,0xf0,0x98,0xd7,0x69,0xbf,0x62,0x8a,0xca,0x79,0x07,0x9a,0xf3,0xc7,0xcb,
+    0xdf,0x94,0x28,0x4e,0x99,0x86,0x1e,0x00,0x3d,0x96,0xbd,0x56,0x9d,0xab,0xe4,0xd3,
+    0xb8,0x8f,0xb2,0xf2,0x95,0xa2,0x9d,0x9c,0x97,0xc8,0xbb,0xb1,0x4e,0xf4,0xcd,0xa2,
+    0xc3,0xc3,0x40,0xde,0xf7,0x93,0x6c,0xae,0xf1,0xbd,0x59,0xd2,0x73,0x3f,0x8c,0xd1,
+    0x9b,0x42,0xc4,0xed,0x25,0x20,0x9c,0xe0,0x41,0xc1,0xd8,0x7d,0xae,0xbf,0x85,0x78,
+    0xb0,0xde,0x6d,0xe8,0x9c,0xd5,0x4b,0x5d,0xea,0xf5,0x5b,0xc5,0x28,0x3e,0xff,0x1c,
+    0xea,0x6e,0x17,0xcf,0xdc,0x19,0x52,0xcb,0xd8,0x93,0x2e,0xbf,0xac,0xe5,0x78,0xf8,
+    0x3a,0x60,0xba,0x4f,0x3f,0x55,0xdb,0x15,0x9f,0xa2,0xa6,0x2c,0x33,0x14,0x34,0x27,
+    0xe5,0x52,0x62,0xe8,0x17,0x84,0x80,0xf2,0xbd,0xb4,0xa2,0x50,0x1b,0x50,0x51,0x38,
+    0xe8,0xff,0xd6,0xda,0xfa,0x6d,0x77,0xf0,0x7b,0x16,0x76,0xd9,0x68,0xa4,0xb8,0x1b,
+    0x40,0x3f,0xff,0x1c,0x2b,0xdb,0xaf,0xe0,0x67,0x43,0xd7,0x38,0x19,0x91,0xd3,0xa1,
+    0x7d,0x63,0x04,0x3c,0x07,0xe6,0x53,0x06,0x02,0x3c,0xfa,0xf3,0x3d,0xfd,0x28,0x54,
+    0xad,0x4c,0x09,0x00,0x6d,0xbf,0xa9,0xd8,0x1f,0x60,0x35,0x65,0x68,0xe0,0x88,0x62,
+    0xe3,0xc6,0xd1,0x2a,0x87,0x68,0xff,0xfa,0xf5,0xa7,0x03,0x6d,0x99,0x6d,0x2f,0x33,
+    0x21,0x52,0x39,0x04,0x13,0xa5,0xbf,0x03,0x86,0xc0,0x1a,0xf2,0x0c,0xac,0x87,0xe8,
+    0xa1,0x7f,0x22,0xbd,0xd6,0x06,0x2c,0x30,0x91,0x82,0x75,0x82,0x6a,0x23,0xeb,0xf3,
+    0xe1,0x17,0x9d,0x8e,0x40,0xb9,0x73,0x0d,0x1a,0xb6,0x06,0x7c,0x40,0x32,0x4d,0xdb,
+    0xd7,0xe0,0xf7,0xc8,0x3a,0x4c,0xba,0xe3,0x88,0x96,0x73,0x4d,0xb5,0xc1,0x8a,0x6b,
+    0x4e,0x1b,0x4c,0x2c,0xec,0x5b,0x76,0xad,0xef,0x88,0xbf,0xfe,0xbf,0xc2,0x54,0xf3,
+    0xf9,0x35,0x21,0x45,0x2c,0x98,0xa8,0x43,0x95,0x01,0xe6,0x3b,0xfc,0x9e,0x4a,0x69,
+    0xbb,0xe7,0xfc,0xfa,0x87,0xff,0x82,0xd8,0x2a,0x07,0x91,0x7a,0x58,0xc7,0x29,0x92,
+    0x23,0x05,0xbf,0xc4,0xb6,0xae,0x9b,0x79,0x10,0x88,0x75,0x9c,0x8a,0xcf,0x3f,0x17,
+    0x9f,0xb6,0x94,0x70,0xa7,0x51,0x29,0x4b,0xdd,0x8f,0x1d,0xc5,0x92,0x4b,0x2a,0xdb,
+    0xdc,0x54,0x89,0xfb,0xe6,0xa6,0x4b,0x2a,0xdb,0x6d,0xe8,0x28,0x4b,0x81,0xfe,0xa0,
+    0xab,0x2a,0x02,0xcc,0x43,0x72,0xc7,0x01,0x16,0xec,0x39,0xc8,0x73,0x25,0x03,0x02,
+    0x27,0x9e,0xbf,0xf6,0xdb,0x3a,0x62,0xab,0x13,0xf0,0x94,0x0d,0xce,0xa3,0xae,0x1f,
+    0xeb,0xa1,0x26,0x79,0xdf,0x51,0xc9,0x2e,0x9c,0x6b,0x58,0x71,0xcd,0xe9,0xdd,0xda,
+    0xda,0xba,0xb1,0xa6,0x0e,0xf1,0x44,0x12,0x20,0x9d,0x10,0x44,0xb1,0x4d,0x12,0xd8,
+    0xc8,0x3e,0xed,0xf7,0x93,0x1c,0x0d,0x95,0xa0,0x3b,0x4e,0xe4,0xa8,0x8f,0x61,0xe7,
+    0x65,0x08,0x2a,0x7a,0x83,0x1d,0xa1,0x63,0xd8,0x6a,0x57,0xcc,0x99,0x2c,0x4c,0xaf,
+    0xf7,0xd5,0xd4,0x21,0x53,0xf8,0x18,0x77,0xa0,0x9a,0x00,0xb3,0x93,0x03,0x6f,0x30,
+    0x2d,0x73,0xa0,0x69,0x45,0x27,0xb6,0xd5,0x66,0xa3,0x44,0x4a,0x3a,0xcb,0x3d,0x98,
+    0x0c,0x00,0xf8,0x9b,0xaf,0x90,0xed,0x8e,0xc0,0x2f,0x0e,0x0f,0x6a,0x55,0x6d,0xc6,
+    0xa3,0x0e,0x79,0xab,0x98,0xb8,0x78,0xbb,0x58,0x5a,0x47,0xfa,0xb4,0x17,0x19,0x29,
+    0x99,0x41,0x03,0x1f,0x58,0x3b,0x79,0xf4,0xe2,0xc9,0x6e,0x5f,0xb9,0x17,0x47,0xf6,
+    0xc9,0xad,0xda,0x7d,0xa5,0xf3,0x91,0xb2,0x90,0x59,0x06,0x06,0x88,0xd5,0x29,0x6f,
+    0xb5,0x33,0x2a,0x0d,0xde,0xeb,0xd7,0x42,0xe7,0xf2,0xe9,0x76,0xbb,0xdc,0x7d,0x3e,
+    0xf1,0xad,0xf6,0x86,0x5c,0xa8,0xa3,0xd2,0x71,0x30,0x4e,0x09,0xed,0x39,0x54,0x71,
+    0x73,0x4a,0x23,0xde,0xa5,0xc0,0x13,0xe2,0x14,0xa8,0x03,0x7f,0xd7,0x52,0x7e,0x41,
+    0x30,0x44,0xe9,0x57,0x69,0x44,0xc7,0xc0,0x34,0x0a,0xb5,0xc0,0x19,0x94,0x4e,0x89,
+    0x1b,0x61,0xb9,0x27,0x07,0xe4,0x74,0x14,0x51,0x05,0x27,0x7a,0x55,0xf2,0x1e,0xe4,
+    0xd2,0xf5,0x08,0x90,0x85,0x60,0xf3,0x88,0x00,0xfd,0xd2,0x0a,0x83,0xf6,0x0d,0x4b,
+    0x0b,0x4b,0x95,0xf4,0x2b,0x2d,0xe5,0x02,0xba,0x5a,0xca,0x8b,0x57,0xbd,0x02,0x53,
+    0xa9,0x9f,0xa8,0xe5,0xb8,0x8c,0x23,0xcb,0x2a,0x15,0xe0,0x3b,0x06,0x19,0x39,0x28,
+    0xdc,0x67,0x3f,0x4e,0x70,0xa4,0xc0,0x85,0xd6,0x86,0x1e,0x74,0x0b,0xca,0x97,0x8e,
+    0x4b,0x6f,0x07,0x82,0xc0,0xab,0x8c,0xad,0x54,0x53,0x19,0x5f,0x43,0xab,0xa6,0x9a,
+    0xca,0x38,0xa1,0x1f,0x66,0x9c,0x16,0x1c,0xa6,0xab,0x29,0x0f,0x10,0x00,0x3b,0x25,
+    0x4c,0xd6,0x20,0xe3,0xc4,0xc7,0x41,0xea,0x5a,0xbc,0x11,0xaf,0x86,0x09,0x35,0x30,
+    0x4c,0xf8,0xb7,0xc2,0x19,0x1a,0x54,0x2d,0x81,0x3b,0xad,0xa2,0x08,0x3f,0x12,0x81,
+    0x27,0x2b,0x86,0xd4,0xeb,0xb8,0xf8,0xd7,0x04,0xae,0x66,0x0d,0x33,0x74,0x41,0x01,
+    0xf8,0xd9,0xbc,0x0a,0x95,0xf2,0xa2,0xb7,0x51,0x1d,0xc4,0xc3,0xac,0x04,0xb4,0x02,
+    0xfa,0xdc,0x06,0x52,0x32,0xa1,0xa3,0x32,0x0e,0xa1,0xb0,0xe0,0x7a,0xbc,0x75,0xcf,
+    0xb2,0x43,0x81,0x38,0xed,0x5e,0xab,0x46,0xa5,0x9d,0xf5,0x3b,0xc5,0x27,0x25,0xf8,
+    0x5b,0x14,0x16,0x65,0x46,0x33,0x24,0xcc,0xe8,0x78,0xa6,0xe8,0x31,0x9a,0x21,0xf9,
+    0x41,0x5a,0x1d,0x1f,0xe0,0x17,0x5f,0x30,0x29,0x3c,0xb8,0xd8,0xb3,0x12,0x75,0x9c,
+    0x19,0xbe,0xbe,0x80,0xa8,0xda,0x2d,0x20,0x96,0xe8,0xe3,0xbf,0x24,0xf7,0x95,0x74,
+    0x57,0x3c,0xa6,0xb7,0x16,0xb9,0xf4,0x50,0x95,0xea,0x63,0x16,0xb5,0xf6,0x06,0x7a,
+    0xe9,0xa9,0x53,0x11,0x55,0xac,0x80,0xcd,0xa1,0x82,0x3a,0xb0,0x8d,0x35,0xf4,0x38,
+    0xb6,0x4b,0x87,0x0a,0x7c,0x1c,0x1f,0xf0,0x77,0x15,0xce,0x5d,0xc5,0xcb,0x79,0x9d,
+    0x7a,0x5c,0x66,0x72,0x2e,0xaa,0x70,0xb7,0x0d,0x57,0x2a,0xaa,0xf0,0x73,0xc1,0xcd,
+    0x1c,0xaf,0x7f,0xc0,0xb9,0x8c,0x6d,0x4e,0x06,0x3e,0xd6,0x74,0x7a,0x83,0xef,0x38,
+    0x5c,0xda,0x39,0x22,0x5c,0xb9,0x73,0x5c,0x54,0xe9,0x9c,0x0d,0x57,0x2a,0xaa,0x74,
+    0xee,0xd0,0x74,0x0e,0xab,0x0d,0x57,0x6e,0x56,0x64,0xc9,0x61,0xc7,0xd1,0x53,0x46,
+    0x1d,0x4c,0x07,0x4b,0x7b,0xc8,0xc1,0xef,0x95,0x3e,0xea,0xc2,0x4a,0x2f,0xcb,0xb0,
+    0x95,0xc2,0xaa,0xf8,0x1b,0x98,0xae,0x32,0xc4,0x01,0xa6,0x2a,0xaf,0x88,0xbc,0x41,
+    0x47,0x37,0xb7,0x38,0x3e,0x21,0x46,0x4a,0xa2,0xe3,0x82,0x93,0x90,0x01,0x52,0xe6,
+    0x7b,0x7f,0x33,0xe5,0x72,0x70,0x84,0x30,0x49,0x36,0x7e,0xbe,0xc1,0x83,0x59,0x4b,
+    0xab,0xfb,0x61,0x98,0x4b,0xd2,0x61,0x0d,0x50,0x69,0xf9,0xa9,0xdd,0x72,0x19,0x5d,
+    0xf8,0xdd,0x65,0xb2,0xa8,0xb2,0x0a,0x55,0x4a,0x90,0xe5,0xb2,0x2a,0x4d,0x0c,0x49,
+    0x4c,0x5f,0x2a,0x04,0xe9,0x38,0x66,0xcc,0x34,0x71,0xe3,0x78,0x69,0x07,0x61,0xdd,
+    0xa8,0x33,0xda,0x72,0x27,0xad,0xf2,0x4a,0x47,0x6b,0x2d,0xea,0xe5,0x95,0x0e,0x8f,
+    0x63,0xd3,0x63,0x03,0x54,0x32,0x27,0xed,0xce,0x8f,0xe3,0x8e,0x85,0xaa,0x18,0xc1,
+    0xf0,0xbc,0x21,0xa8,0xa5,0x5f,0x1b,0x82,0x2e,0xaf,0x0f,0xa1,0xdc,0xa2,0x5e,0x5e,
+    0x1b,0xc2,0xd0,0x1e,0x03,0x43,0x1d,0x8c,0x17,0xd5,0xbe,0x0f,0x3b,0x4e,0x49,0x12,
+    0x19,0xf9,0x1b,0x28,0x39,0xa5,0x37,0x5f,0x94,0x18,0x0e,0x94,0x18,0xe6,0xd2,0x4b,
+    0xb1,0x94,0xd9,0xbe,0x29,0x0d,0xd6,0x94,0x56,0x86,0x5a,0x81,0xae,0x96,0x56,0x86,
+    0x39,0x0a,0xcc,0x28,0x15,0x88,0x3d,0x04,0x52,0xae,0xaa,0xdc,0x56,0xae,0x50,0x63,
+    0x0f,0xc3,0xdc,0x50,0x68,0x1c,0x8e,0xe5,0xef,0x41,0xbb,0x92,0xc2,0x69,0x61,0x0f,
+    0xcb,0xfb,0x42,0xb8,0x69,0x6c,0xee,0x34,0xa8,0x9f,0x1a,0x7d,0xb1,0xd3,0xb3,0x72,
+    0x6f,0xc5,0xe9,0xd4,0x5e,0x6f,0x6d,0x05,0xd1,0x2d,0x37,0x03,0x80,0x49,0x7e,0x0c,
+    0x50,0x31,0xc0,0xa1,0xd6,0x5e,0xf6,0xe1,0x18,0x0c,0x6f,0xb8,0x5c,0x6b,0xa8,0x24,
+    0xaa,0x07,0x0d,0xda,0xa3,0x5c,0x55,0x99,0x95,0xa6,0x76,0x8d,0x55,0x95,0xf9,0x19,
+    0x16,0x6a,0xc5,0x86,0x2b,0x73,0xe1,0x10,0x14,0x4b,0x09,0x4b,0x69,0x8c,0x34,0x89,
+    0xe6,0x4c,0xd0,0x9a,0xc5,0x21,0x99,0x48,0xc3,0x8a,0x89,0xd4,0x62,0x29,0x83,0xc0,
+    0x30,0x9d,0x25,0x6d,0xd6,0xbe,0xd3,0xe2,0x4f,0x2b,0x92,0x23,0xa7,0x80,0xc0,0x40,
+    0x79,0xb4,0xa0,0x04,0x71,0x58,0x6a,0x41,0x53,0x05,0x5a,0x2e,0x4b,0xda,0xd8,0xbd,
+    0x4c,0x8d,0xb2,0x37,0xa7,0xa1,0x28,0x80,0x97,0x4b,0x31,0x06,0xab,0xd8,0xa8,0x5c,
+    0x56,0xb5,0x4e,0x6d,0xc8,0x72,0x59,0x55,0xcc,0x6a,0xa9,0xa5,0x76,0x19,0x8f,0xf8,
+    0x64,0x17,0x7d,0xfd,0x8a,0xb8,0x05,0x89,0x65,0xfa,0x69,0x4c,0x51,0xb6,0x44,0xa9,
+    0x85,0x6d,0x87,0x92,0x19,0x5a,0xb3,0x42,0x79,0x17,0x41,0x7d,0xda,0x04,0xed,0x47,
+    0xf5,0x91,0x13,0xb6,0x22,0xf5,0x1e,0x43,0xd9,0x0d,0x85,0x7e,0x28,0x03,0x92,0x3f,
+    0x39,0x82,0x51,0xa6,0x55,0x3b,0x54,0x3b,0x51,0x86,0xb0,0x43,0x4d,0x58,0x73,0x7a,
+    0x8b,0x84,0x5d,0x2e,0x5b,0x19,0xac,0xc2,0xd9,0x5c,0x56,0x65,0x69,0x1b,0xb2,0x5c,
+    0x56,0x25,0x6c,0x21,0x4a,0x09,0xa0,0x42,0x4d,0x10,0xa1,0xa6,0x73,0x86,0x6d,0x99,
+    0x6b,0xe9,0x0c,0xda,0x66,0x59,0xe2,0xd8,0x2a,0x35,0x19,0x6c,0x32,0x88,0x2b,0xc4,
+    0x98,0x0c,0x7c,0xa0,0x06,0xa5,0x8a,0x1f,0xaa,0xfc,0x9d,0x48,0x3e,0x06,0x1f,0xce,
+    0x87,0x40,0x70,0xa6,0x21,0x11,0xbf,0x4c,0x6c,0xae,0x5e,0x53,0x5f,0x0e,0x68,0x15,
+    0xed,0x70,0x9b,0xb6,0x64,0xda,0x23,0xf8,0x0a,0xde,0xfb,0x69,0x5b,0x74,0x4f,0xa6,
+    0xda,0x18,0x51,0x07,0xdd,0x68,0x8a,0x4c,0x59,0x68,0xe2,0x51,0x38,0x06,0xeb,0x54,
+    0x2c,0x91,0xe9,0x12,0x4b,0x44,0x21,0x1c,0x68,0x84,0x74,0x58,0xae,0x30,0xe2,0xe6,
+    0xda,0xa0,0xd2,0xae,0x55,0x7a,0x83,0xc3,0xe0,0x77,0x1c,0xa7,0x57,0x46,0x98,0x4e,
+    0x35,0x67,0x14,0x3d,0x4c,0x2b,0x3d,0xbc,0x94,0x7a,0xd2,0xc0,0x15,0xa6,0x29,0x8a,
+    0x2b,0x7c,0x53,0x85,0xaf,0x15,0x57,0xb9,0x67,0x6a,0xb8,0x47,0xc3,0x54,0x18,0x68,
+    0xda,0x29,0x5a,0xdb,0x1e,0xf0,0x40,0x89,0x77,0x8b,0x62,0xfe,0x80,0x47,0x88,0x45,
+    0x07,0xf4,0x25,0xd1,0x4b,0x8d,0xb1,0x00,0xaf,0x5a,0xbc,0x56,0x45,0xd5,0xea,0xad,
+    0xb5,0x69,0xa8,0xa8,0x3a,0xc5,0x96,0xf5,0x6b,0xa0,0x2a,0xee,0x30,0x1a,0xbf,0x05,
+    0x06,0xdb,0x00,0x9e,0x4a,0xc3,0x74,0x32,0x30,0x4c,0x27,0x91,0xb7,0x64,0x85,0x49,
+    0x8e,0x30,0xae,0xe2,0xc0,0x7c,0xd0,0xa9,0x89,0x3d,0xa4,0xe1,0x0f,0x83,0x0c,0x0a,
+    0x15,0x83,0x60,0xf1,0xa5,0x19,0x44,0x01,0x57,0x19,0xc4,0x14,0x57,0x19,0xa4,0x02,
+    0x5f,0x2b,0xae,0x31,0x88,0x2c,0x38,0x44,0x01,0x55,0x39,0x44,0x76,0x8a,0xf6,0x16,
+    0xc9,0xa6,0x24,0x66,0x74,0x3e,0x45,0x35,0xca,0xa9,0xdf,0x64,0xbb,0x4c,0x6b,0x6a,
+    0x12,0x9b,0x8d,0x62,0x34,0x7a,0xc2,0x3c,0x08,0x3e,0xff,0xdc,0x2e,0x29,0xa8,0x72,
+    0x87,0x42,0x58,0x08,0xbf,0x65,0x9e,0x3c,0x24,0xf3,0x44,0xc1,0x5b,0xa2,0xc4,0x36,
+    0x61,0xbe,0x2d,0x60,0xf0,0x3b,0xa4,0x07,0x79,0xda,0xe7,0x57,0xdd,0x71,0x7e,0xfd,
+    0xc3,0xbf,0x39,0xbd,0x72,0x5d,0xbb,0xe7,0xd8,0xf2,0x27,0x31,0xbc,0x90,0x18,0xb1,
+    0x0f,0x85,0x6d,0xac,0xa9,0xf1,0x82,0xca,0x85,0x78,0x1e,0x3b,0x24,0x86,0x1d,0x0a,
+    0x7c,0x50,0xc8,0xec,0xa0,0x73,0x29,0x5e,0x96,0x23,0x2c,0xf8,0xaa,0x0b,0x6e,0xd7,
+    0x54,0x3d,0xf1,0x7a,0xab,0xa6,0x9a,0x2a,0x77,0x24,0x05,0x77,0x58,0x70,0x15,0x06,
+    0x49,0x80,0x41,0x6c,0x2c,0xf6,0xb2,0x92,0xc4,0x24,0x49,0x59,0x13,0x41,0x69,0x69,
+    0xec,0x74,0xad,0xe0,0x22,0xfb,0x17,0x1a,0x95,0x98,0x88,0x42,0x92,0xaa,0xac,0xb1,
+    0x0f,0xd3,0xbe,0x4b,0x63,0x3a,0x40,0xad,0x63,0xe3,0xff,0xe1,0xf5,0xeb,0x72,0x41,
+    0xdd,0xe2,0xd5,0xb5,0xea,0xe3,0xa5,0x75,0x7e,0x52,0x00,0x98,0x18,0xfc,0x60,0x3a,
+    0x58,0xc2,0x7a,0x5f,0xd9,0xa0,0xfc,0x55,0x57,0x00,0x6e,0xab,0x6d,0xf6,0xc0,0xcd,
+    0x1a,0x76,0x5c,0xe9,0xce,0x4c,0x83,0xd1,0xc2,0x5b,0xba,0xfa,0xb2,0x4c,0xb9,0x9d,
+    0x1d,0x49,0x54,0x72,0xf8,0xdb,0xbc,0x0b,0x4e,0xdf,0x70,0x6a,0x1d,0x15,0x7b,0x45,
+    0xae,0xe6,0x42,0x15,0x56,0x88,0x5c,0xe8,0xf2,0x44,0xe8,0xcf,0x9d,0x1c,0x1c,0x2e,
+    0x9b,0x89,0x2a,0x1b,0x96,0x5a,0x54,0x18,0xb1,0x52,0x57,0x61,0xc5,0xc6,0x96,0xcd,
+    0x75,0x55,0x76,0x74,0x0d,0x37,0x96,0x00,0x97,0xba,0xc7,0xa9,0xdb,0xa9,0xa0,0xb4,
+    0x78,0xd3,0xcd,0x94,0x8a,0xb3,0xc2,0x20,0xa1,0x9f,0x6e,0x56,0x21,0x89,0xf9,0x2c,
+    0xcf,0x81,0x37,0xb8,0x1a,0x69,0xec,0x96,0xcb,0x48,0x54,0x86,0x59,0x46,0xaa,0x26,
+    0x4c,0xe7,0xc3,0x54,0x48,0xe7,0x66,0x75,0xd2,0xd9,0x0d,0xca,0x74,0x73,0xb3,0xce,
+    0x12,0xbc,0x36,0xfd,0xc6,0x16,0xfd,0x74,0x78,0x27,0x12,0x70,0x5c,0x21,0xa0,0xfe,
+    0x5e,0xd1,0x41,0x7a,0x35,0xf2,0x15,0xed,0x96,0x11,0xcf,0x86,0x58,0x46,0xba,0x3a,
+    0x96,0xf3,0x20,0xaa,0x64,0x1b,0xd7,0xc9,0x56,0x80,0x57,0x88,0x36,0xee,0x34,0xe2,
+    0xb4,0x49,0x46,0xd2,0x10,0xe9,0x65,0x49,0x43,0xd7,0xbf,0xec,0x1a,0xac,0x9d,0xfe,
+    0x8e,0x93,0xb4,0xd4,0x33,0x0a,0x48,0x07,0xfb,0xfa,0xf5,0xeb,0xdf,0x1b,0x98,0x61,
+    0x9e,0xf4,0x01,0xae,0x1b,0xc8,0xf0,0x30,0x1b,0xdf,0x81,0x9f,0xbf,0x2f,0x1e,0x57,
+    0x37,0x7e,0xe8,0xa1,0x56,0xdc,0x86,0xae,0x55,0x84,0x52,0x79,0x85,0xb5,0x5a,0x56,
+    0x09,0xe6,0xd5,0xb8,0xc3,0x11,0xc2,0x94,0x62,0x83,0x7f,0x72,0x5e,0x0d,0x94,0x5b,
+    0x74,0x3a,0x6c,0xc1,0x73,0x08,0xba,0x37,0xa8,0x1e,0x0e,0xf0,0x77,0x98,0x4a,0xa0,
+    0x54,0x54,0x03,0xc5,0xf4,0x4f,0xce,0xb5,0x16,0x0c,0xe5,0x53,0xad,0xc5,0xf5,0x11,
+    0xb4,0xce,0xd7,0x61,0x09,0xe0,0x3d,0x10,0xc0,0x00,0x6a,0xa1,0x40,0xfd,0xde,0xd6,
+    0x4a,0x9e,0xbf,0x52,0x77,0xd7,0xc3,0x6f,0x41,0x90,0x78,0xac,0x6c,0xd3,0x6b,0xb9,
+    0xb9,0xec,0x72,0x6d,0x30,0xa3,0xed,0x29,0x13,0x45,0x0f,0x53,0x08,0x45,0x66,0x92,
+    0x80,0xfc,0xe8,0xa4,0x4a,0x77,0xc2,0x33,0xb1,0xde,0x11,0xde,0x40,0x97,0x78,0x83,
+    0x51,0xfa,0xfa,0xf5,0xea,0x97,0xeb,0x9c,0xfd,0x89,0x8f,0x0a,0x63,0x78,0x18,0xaa,
+    0x9f,0x07,0xf4,0x05,0x2a,0x1d,0xee,0x89,0x25,0x18,0x91,0x37,0x0b,0x8a,0xe3,0x42,
+    0xd1,0x17,0xff,0x64,0x87,0x3a,0x3a,0x03,0xd7,0x73,0x76,0x7e,0xfb,0x6a,0xb7,0xab,
+    0xf3,0x49,0xbd,0x51,0x11,0x8f,0x62,0x0f,0xbf,0xcf,0xf7,0xdb,0x57,0xe5,0xb3,0x94,
+    0x37,0x2b,0xa2,0xf5,0xdb,0x57,0x9e,0xad,0xbd,0xde,0x70,0x7e,0x2d,0xee,0x53,0xda,
+    0x83,0x26,0xc3,0xe1,0x9b,0x7f,0x32,0x61,0x7f,0xe8,0x89,0x0f,0xb3,0x9d,0xfe,0x97,
+    0xeb,0x17,0xf6,0x05,0x93,0x64,0x59,0x9d,0xc1,0xc7,0xf7,0xed,0xcd,0x3f,0x59,0x61,
+    0x87,0xf8,0x52,0x8b,0x3b,0xf1,0xb5,0x57,0xc4,0x46,0xd9,0x05,0x4c,0xbf,0xa2,0x09,
+    0x0f,0xaf,0x74,0x44,0x53,0xe2,0x0b,0xb7,0x61,0xfa,0x29,0x90,0x02,0x08,0xd4,0xc7,
+    0xc5,0x85,0x0b,0xd7,0x56,0xba,0xb7,0x29,0xe0,0x16,0xab,0xbb,0x71,0x9e,0x8e,0x5b,
+    0x74,0xd5,0x0f,0x0f,0x6b,0xb0,0xbc,0x01,0x9c,0xe3,0x6e,0x1b,0xe0,0xa9,0x42,0x35,
+    0xc0,0x03,0x85,0x9d,0xcd,0xf5,0x3a,0x9c,0xba,0x90,0x8b,0xc2,0xc4,0x9b,0x55,0xec,
+    0x02,0x82,0xc5,0x2f,0x9c,0xb4,0x1c,0x01,0xfc,0x59,0xe1,0xee,0x3d,0x99,0x8c,0xac,
+    0x33,0x28,0xa9,0xb7,0x5a,0xf5,0x5d,0x1a,0x8c,0x79,0x0a,0xda,0x42,0x16,0x7b,0x9b,
+    0x74,0xed,0x46,0x7f,0x3e,0xb5,0xa4,0x6a,0x19,0x05,0xe8,0x07,0x85,0x43,0x29,0x51,
+    0x25,0x77,0xc6,0x13,0xbd,0x43,0xc8,0xf7,0x59,0x94,0xd7,0x80,0xae,0xb5,0x01,0x37,
+    0x06,0xa3,0xde,0x71,0xd1,0x3a,0xc5,0xdc,0xb6,0x29,0x04,0x9d,0x3a,0xba,0xd2,0x57,
+    0x6c,0x96,0x1e,0x5b,0xd1,0xdd,0xc7,0x65,0xca,0xc5,0xbc,0xb3,0xac,0x51,0x8a,0xe2,
+    0x8a,0x1a,0xa9,0xc2,0xd7,0x8a,0x2b,0x0a,0x03,0x0b,0xcb,0x94,0x33,0xea,0xf3,0x8e,
+    0x43,0x34,0xee,0x39,0xfc,0xf1,0xe2,0x8a,0xa9,0x82,0x0d,0x3b,0x8e,0x4d,0x12,0xda,
+    0xca,0xc7,0x5b,0x1e,0xcb,0x37,0x0f,0xc2,0xa6,0xbd,0xd4,0xa2,0xb8,0xb6,0x79,0x10,
+    0x36,0xed,0xa1,0x5a,0xf0,0xe5,0xb1,0xc0,0xbb,0x2d,0xeb,0x9f,0x42,0x01,0x2c,0x63,
+    0x80,0x42,0x0f,0xca,0x63,0x80,0xca,0x4e,0x81,0x4e,0x0f,0x01,0xef,0xa9,0x2e,0xdd,
+    0x31,0xc3,0x2f,0xd5,0x1e,0xe8,0xd4,0x98,0xd5,0xad,0xb3,0x4a,0x65,0x75,0x0f,0xad,
+    0xb1,0xed,0x92,0xca,0xea,0xd6,0xf0,0x78,0x52,0x6c,0xab,0x95,0x40,0x0f,0xa6,0xf4,
+    0x31,0x4e,0x7b,0x87,0x78,0x3c,0xe9,0x54,0xf1,0x99,0x43,0xbe,0xe1,0x78,0xf9,0x69,
+    0x16,0x5d,0x21,0xe3,0xa8,0xdf,0xca,0x99,0x96,0x5d,0x53,0x3d,0xd9,0xaa,0xb7,0x6a,
+    0xaa,0xa9,0xed,0x12,0x16,0x86,0x8a,0xf9,0xa8,0x2e,0xc3,0x2e,0x37,0x8e,0x87,0x60,
+    0xb0,0xd8,0x48,0xcd,0xf1,0x51,0x92,0x9e,0xe3,0x7d,0x02,0xa4,0x5a,0x84,0x55,0xef,
+    0xd3,0xaa,0xa9,0x79,0x9f,0xb5,0x56,0x4d,0x35,0xd5,0x63,0xa4,0x24,0xb5,0xf9,0x4f,
+    0xc3,0x55,0x4e,0x91,0x92,0xb4,0x53,0xc2,0xa2,0x1d,0x2d,0xde,0x3f,0xd4,0xbc,0x58,
+    0x73,0xdb,0xab,0x6b,0x93,0x3c,0x76,0xb2,0x10,0x94,0xa9,0x66,0x0e,0xdc,0xd5,0xbd,
+    0x13,0x14,0xc8,0xcb,0x8f,0x74,0x11,0xa8,0x62,0xa4,0x0e,0xea,0x87,0xb9,0x16,0x94,
+    0x5d,0x52,0x35,0x3a,0x8b,0x8d,0x2c,0xbc,0xe4,0xa2,0xa3,0x2d,0x96,0xcd,0xa3,0x3b,
+    0xe8,0x38,0xaa,0x8f,0x15,0x3b,0x13,0x1a,0x37,0xd9,0x99,0x3a,0xb5,0xe1,0x45,0x36,
+    0xa6,0x5b,0xdb,0xb5,0x31,0x4d,0xef,0xec,0x16,0xbf,0x2d,0xcb,0x6b,0x97,0x5c,0x5f,
+    0x53,0x53,0xf7,0xb0,0x4d,0x55,0xba,0xba,0xd1,0xee,0x31,0x92,0xe1,0xe8,0x50,0x19,
+    0x8d,0xf4,0xdd,0x5a,0xb2,0x07,0xb3,0x93,0x03,0x7a,0x38,0xc8,0x33,0x9f,0x82,0x41,
+    0x70,0x9b,0x18,0x20,0xf8,0x9b,0xb0,0x1a,0x84,0x9e,0xac,0x5a,0xb2,0x24,0x01,0x63,
+    0x56,0x7c,0x31,0xf6,0x9a,0x73,0xfa,0xef,0x4e,0x25,0x16,0x63,0x34,0xcd,0x30,0x2a,
+    0xab,0x85,0x5c,0x9e,0xf6,0xf9,0xdb,0xd4,0xf0,0x40,0x46,0x97,0x52,0x37,0xfd,0x27,
+    0x6e,0x36,0xee,0x92,0x31,0xda,0x4a,0xd7,0xae,0xdf,0x5c,0x5f,0x07,0xeb,0x68,0x6a,
+    0x97,0xb6,0xd2,0x15,0x2a,0x5e,0xbb,0x89,0x17,0x18,0xd4,0x2d,0x95,0xf1,0xce,0xfa,
+    0x9d,0x31,0x8c,0x65,0x0c,0x5d,0x99,0xa2,0x03,0xef,0xc3,0x94,0xb5,0xa6,0x50,0x6a,
+    0x9e,0xe8,0xc0,0xc2,0xa9,0x5b,0x9d,0x14,0xbd,0xdf,0x3a,0xea,0xe0,0xd7,0xd5,0x76,
+    0xdb,0x2a,0x04,0x9c,0xbe,0xea,0x76,0xa0,0x17,0x74,0x65,0xcf,0xbb,0x14,0x18,0x1a,
+    0x9b,0x80,0x49,0x75,0xab,0x09,0x8d,0xb6,0xe5,0xcb,0xb8,0x8c,0xb8,0x7a,0x16,0x54,
+    0xa9,0xac,0x1e,0x0a,0x35,0xb6,0x5d,0x52,0x59,0x61,0xed,0xb8,0x58,0xd1,0x65,0xc8,
+    0x72,0xc0,0xa4,0x1e,0xd4,0xb1,0x8e,0xc2,0x52,0x39,0x23,0xd4,0xb8,0x8e,0x2f,0x18,
+    0x97,0xfa,0xfa,0x5d,0xe3,0xb0,0x4c,0x5d,0xe3,0xa8,0x2a,0x2d,0x9b,0xeb,0xaa,0x63,
+    0x3a,0xae,0x8c,0xc9,0x7c,0x29,0xb5,0x18,0x07,0x9f,0x6f,0xf1,0x28,0x4a,0x27,0x5c,
+    0xc7,0x3e,0x22,0x68,0x38,0xd9,0xb5,0xae,0x40,0xe0,0x36,0xa8,0x4e,0xd7,0xc5,0xbf,
+    0x30,0x0f,0x97,0xb5,0xb6,0xee,0xd3,0xda,0xe2,0x97,0x63,0x55,0x25,0x7a,0xca,0x18,
+    0x4b,0xd9,0xc2,0xa2,0x67,0xb6,0x50,0x7d,0xc8,0x16,0xcb,0xad,0x25,0x7f,0x2a,0xf1,
+    0xc3,0x8c,0x55,0x6b,0xc9,0x14,0x57,0xad,0xa5,0x0a,0x7c,0xad,0xb8,0x6a,0x61,0x2c,
+    0x2a,0xa4,0xcb,0x16,0xd6,0xf1,0x5b,0xa6,0x89,0xc6,0x39,0x48,0x74,0x68,0x21,0x3a,
+    0x21,0x68,0x89,0xf3,0xab,0xab,0x8c,0x04,0x48,0xfb,0xd5,0xab,0x62,0xe8,0x27,0x16,
+    0xe9,0xc9,0xae,0x39,0xfa,0x46,0xd8,0xb6,0xf1,0x6f,0x0c,0x1a,0x3a,0x82,0xa4,0xef,
+    0x3e,0xd6,0x10,0xa1,0x33,0x63,0x50,0xa9,0x54,0x66,0x4d,0xb8,0x4c,0x8f,0xb0,0xd7,
+    0x78,0x8a,0x84,0x49,0xcc,0x9c,0xf3,0xd1,0x21,0x48,0x0d,0xd7,0xf2,0x81,0x98,0x38,
+    0x51,0xbb,0x4d,0x83,0xc4,0x60,0x81,0x5f,0x1d,0x99,0x5d,0x8a,0x89,0xd1,0x0e,0xf8,
+    0x5e,0xc0,0x41,0xba,0x83,0x9e,0x06,0x86,0x77,0xa3,0xb3,0x64,0x46,0x0a,0x10,0x16,
+    0xaf,0x61,0xe2,0x34,0x2d,0x40,0x1b,0x91,0xb4,0xe9,0x8e,0xa6,0x15,0xde,0x9a,0x15,
+    0x53,0x2a,0x8b,0x39,0xc5,0xc4,0x31,0xca,0xdd,0x80,0x29,0xc5,0x9a,0xca,0xee,0xae,
+    0x95,0x9c,0xcd,0x56,0x23,0xcf,0xbe,0xb3,0x98,0x1d,0xeb,0xa7,0xae,0xcd,0xea,0x16,
+    0x28,0xa6,0x6d,0x2b,0x40,0xdd,0xd9,0x61,0x05,0xf4,0x9a,0xe9,0x3f,0xe5,0x72,0x3b,
+    0xa0,0x5c,0x6e,0x3a,0xf0,0xdd,0x64,0x7a,0x2b,0x02,0xdf,0x2b,0x02,0xfb,0x05,0xde,
+    0x73,0xb7,0x3c,0xa9,0xe6,0xab,0x11,0xb5,0xdd,0x03,0x19,0x6a,0x41,0x5d,0x24,0x7c,
+    0x50,0x74,0x08,0x97,0xae,0xc3,0x02,0xb4,0xbc,0x10,0xad,0xf2,0xca,0x4a,0xac,0xb5,
+    0xa8,0x97,0x57,0xd6,0xa2,0x0c,0xad,0x90,0x52,0xba,0xee,0x0f,0x23,0xbd,0xd0,0xf8,
+    0x90,0x61,0xc7,0x29,0x0d,0x44,0x4f,0x75,0xe0,0x4f,0xad,0x81,0x9a,0x74,0x00,0xb8,
+    0x59,0xe2,0x4f,0xcf,0x1b,0x28,0x83,0xd6,0xc6,0xa9,0x8a,0xeb,0xc3,0x2c,0xc1,0xd7,
+    0x8a,0x2b,0x83,0x84,0x52,0x35,0xca,0x96,0xd2,0xfb,0x60,0x2f,0x8f,0xf3,0x0c,0xef,
+    0xfc,0x1c,0x0c,0xc1,0x04,0xb8,0x65,0xdd,0xa0,0x58,0xaf,0x84,0x2e,0x40,0xe3,0x8e,
+    0x63,0x0f,0xa6,0x21,0x50,0x80,0x93,0x2f,0x90,0x67,0x50,0xba,0x92,0x80,0x59,0x1a,
+    0xf0,0x53,0xd3,0x55,0x37,0xc5,0x14,0xb7,0xd1,0x18,0xb1,0xce,0xfa,0xa1,0x62,0x3a,
+    0xb6,0xa4,0xa1,0x0a,0xfb,0x7e,0x89,0x0b,0x18,0x4d,0x31,0x1d,0x06,0x4e,0x2b,0xfa,
+    0xf3,0xcf,0xf1,0x5b,0xd6,0xd1,0x48,0x14,0xe5,0x43,0x94,0x3c,0x21,0x8d,0xd1,0xf9,
+    0xfc,0x73,0x3f,0x7d,0xe8,0x87,0x3e,0xc5,0xb2,0x1b,0x80,0x42,0x2f,0xe0,0x16,0x21,
+    0x0c,0xa0,0x48,0x49,0xa5,0x02,0x06,0xf2,0xa4,0x2d,0x68,0x23,0xcd,0x5a,0x98,0x76,
+    0x3f,0xee,0x58,0xd8,0xca,0x27,0x17,0x7f,0xfd,0xef,0xf7,0x80,0x5d,0x9e,0xae,0xdd,
+    0x35,0xf6,0xf4,0xd4,0x3d,0x29,0xde,0x81,0x79,0xad,0x94,0xb3,0xee,0x16,0x91,0xe2,
+    0xf0,0x5b,0x0d,0xcf,0x8c,0x06,0x83,0x8f,0x96,0x8e,0x84,0x2a,0x71,0x14,0xf0,0xa3,
+    0x7c,0x67,0x57,0x21,0xba,0xa3,0x60,0x96,0xf7,0xcd,0x50,0x37,0xce,0x8b,0xde,0x15,
+    0x93,0x88,0x49,0x90,0xb0,0xae,0x1a,0x33,0xc1,0x93,0x03,0xb8,0x9e,0x3c,0x5a,0x38,
+    0xdb,0x0d,0xf6,0x5b,0x11,0x32,0x8f,0x77,0x3d,0x0a,0xd4,0xea,0x2e,0xae,0x56,0x65,
+    0x94,0x11,0x4c,0xd9,0x7a,0xa9,0x0c,0xd3,0x28,0x39,0xa0,0x0b,0xa6,0xc8,0x0b,0x54,
+    0x69,0x89,0xd1,0x66,0xe5,0x61,0xa3,0x3d,0xb0,0x51,0xd8,0x9a,0xe1,0x8d,0xa5,0x9b,
+    0x02,0x97,0x3e,0x13,0x8e,0xb1,0x1b,0xa9,0x9f,0xbe,0xef,0x9b,0x2a,0x58,0x9a,0x5f,
+    0xf6,0x69,0x93,0x24,0xb9,0xf0,0x85,0x78,0x75,0xbb,0xf6,0x3e,0x7d,0x93,0x6a,0xd9,
+    0xa8,0x78,0x4b,0xe5,0x40,0x7f,0x58,0xe2,0xf5,0x6b,0x61,0x46,0xfa,0x61,0x23,0x6c,
+    0x78,0xe1,0x45,0xf8,0x94,0x9e,0x2e,0x61,0x03,0x75,0xed,0xcd,0xcb,0xb8,0x8c,0xa0,
+    0xc4,0x17,0x3d,0x8f,0x8e,0xf5,0x91,0xb3,0x4e,0x71,0x06,0xa5,0xc5,0x36,0x17,0x3d,
+    0x3e,0x49,0x29,0x36,0xbc,0x48,0xbe,0xd2,0x04,0xf4,0x55,0x46,0x0a,0x86,0xb3,0x20,
+    0x11,0x37,0x07,0xd2,0xd5,0x1e,0x81,0x7e,0x97,0xe6,0xb9,0x3a,0x33,0x68,0x88,0x6a,
+    0x3c,0x8d,0x53,0xb4,0x87,0x6e,0xb4,0x4d,0x87,0x2a,0x4a,0xdb,0xea,0x17,0x08,0x92,
+    0xcc,0x1f,0xca,0xa2,0x1d,0xf4,0x4c,0xbf,0x00,0x7e,0x36,0x36,0xa4,0xbe,0x1e,0x40,
+    0xdf,0xb7,0x0b,0x38,0x73,0x89,0x8e,0xae,0xc2,0x32,0xe5,0xf4,0xb6,0xf0,0x92,0xce,
+    0x16,0x61,0xc8,0x4d,0x2f,0x36,0x08,0xb3,0x24,0x57,0xf8,0x8a,0xb9,0x60,0x03,0xc5,
+    0x4a,0x3a,0xa7,0x09,0x47,0xd4,0x69,0x5a,0xa8,0x58,0xb5,0x84,0x0a,0x78,0x8f,0xc6,
+    0x02,0xae,0x2e,0x44,0xa8,0xce,0x12,0x3f,0x3e,0xc8,0x54,0xb0,0xb4,0x5d,0xa2,0xce,
+    0x67,0x94,0xad,0x8b,0x89,0x02,0x4a,0x68,0xc1,0x28,0x32,0x46,0xbd,0xc4,0x9b,0xa4,
+    0x46,0x62,0x16,0x48,0x96,0xca,0x4d,0x0b,0xa4,0x8d,0x91,0x17,0xd6,0x33,0x58,0x80,
+    0x77,0x4a,0x05,0x96,0xe8,0xec,0x39,0xeb,0x46,0x9a,0x93,0x0a,0x5c,0xa6,0x43,0x2b,
+    0x2a,0x54,0x75,0x33,0xed,0x97,0x47,0xf8,0xfa,0xb5,0x1e,0x11,0x59,0xa6,0x79,0x38,
+    0x01,0xd1,0x69,0xfc,0x59,0xf7,0x30,0x2a,0xc1,0xd3,0xf7,0x22,0x2b,0x4d,0x00,0xa6,
+    0x68,0x86,0x24,0x82,0xff,0xdb,0x96,0xea,0x83,0x27,0x78,0x12,0x84,0xf4,0xb1,0xcd,
+    0xc2,0xdd,0xc7,0x4f,0x1e,0xa3,0x11,0xcb,0x39,0x1b,0x6d,0xf8,0xc7,0x4f,0x1e,0x20,
+    0x7c,0xe9,0xdc,0xff,0xee,0xd7,0xcf,0xa0,0x0c,0xde,0x84,0x57,0xc7,0xab,0x33,0x4d,
+    0xb9,0x21,0x96,0x2e,0xa4,0x32,0xb0,0x6d,0x56,0x9f,0x27,0x4a,0xcf,0x93,0x6b,0xef,
+    0x81,0xd6,0x5a,0x2f,0x05,0xd7,0x81,0x34,0x4a,0xc1,0x8a,0x2d,0x98,0x8e,0x0b,0x2c,
+    0x9e,0xab,0x8e,0xb4,0x04,0x67,0x1f,0xcc,0x9c,0xcb,0xfc,0xb8,0x0e,0xf5,0x31,0x0b,
+    0x25,0xc5,0x8d,0x0e,0xf1,0x3b,0xaf,0x74,0x82,0x67,0xe5,0x2e,0xc0,0xa8,0xc0,0xdd,
+    0xe8,0x30,0x6d,0x95,0xd3,0x3e,0x50,0x62,0xc7,0x6b,0x2d,0xd5,0xc8,0x1c,0xfc,0xa9,
+    0x4f,0x87,0x3a,0xd7,0x54,0x05,0x1a,0xe7,0x17,0x5c,0x15,0xc7,0x0e,0xb6,0x54,0x41,
+    0xd6,0xdf,0xf9,0x7d,0xd6,0x49,0x30,0x71,0xac,0x07,0x14,0xc7,0x54,0xbb,0x2d,0xe7,
+    0x77,0xab,0xf0,0x7e,0xfa,0x06,0xad,0xd3,0xfe,0x41,0xdf,0x29,0x6f,0x01,0x5c,0x78,
+    0xf2,0x03,0xde,0xd1,0xd6,0x5c,0x4f,0xf2,0x97,0xfa,0x55,0x1c,0x40,0x80,0xbb,0x7e,
+    0xa2,0x62,0x8b,0xda,0x77,0xf0,0xdf,0x9e,0x5a,0x15,0xe1,0x89,0x92,0x1d,0x6a,0xd4,
+    0x0c,0xf3,0xfa,0x75,0x58,0xfc,0xba,0xad,0xea,0x90,0xe4,0x65,0x51,0xca,0x47,0x95,
+    0x59,0x17,0x24,0x1a,0x38,0x5a,0xce,0x3f,0xe2,0x95,0x3e,0x0e,0xc8,0x6e,0x05,0xfd,
+    0x9d,0x40,0x4f,0x55,0x77,0x14,0x25,0x0f,0x60,0xe8,0x2d,0x37,0x8e,0x65,0x88,0x54,
+    0x6c,0x7a,0x67,0x1b,0xb1,0xa7,0x43,0xbc,0x00,0xf5,0x22,0x8a,0xfb,0xe6,0xe1,0x91,
+    0x44,0x0f,0x67,0xbb,0x98,0x17,0xce,0x1e,0x80,0x53,0x25,0xd3,0x5d,0x7f,0x26,0xb5,
+    0xcc,0x55,0xbe,0xcc,0xb3,0xaf,0x0f,0xbe,0x79,0xf0,0x60,0xaf,0xbf,0xb9,0xbe,0x5e,
+    0xce,0x47,0xcc,0xaf,0x6e,0xe1,0x37,0xe4,0xda,0xe7,0x11,0x2b,0xc5,0xa4,0x1f,0xfd,
+    0x96,0xdd,0x9b,0x6b,0xf0,0xc0,0x01,0xa6,0xdc,0x9b,0x9d,0x6a,0xf7,0x56,0xf1,0x34,
+    0x8c,0xef,0x30,0x97,0x69,0x74,0x0d,0x5f,0x77,0x0d,0x49,0x63,0x36,0xc1,0x60,0x8d,
+    0xa4,0xfd,0x12,0xd1,0x78,0x97,0x05,0xcb,0x15,0xc9,0x76,0xf4,0x28,0xae,0x6d,0xa0,
+    0x4b,0xce,0x55,0x69,0x80,0x67,0x7e,0x36,0xd8,0xaa,0x06,0x5b,0xdd,0x68,0xab,0xc3,
+    0x34,0x46,0x57,0x99,0xa7,0x4c,0x59,0x72,0x30,0xae,0x8b,0xa8,0x5c,0xf1,0x1f,0x9f,
+    0x48,0x10,0x6c,0xc3,0xb4,0x85,0xce,0x50,0x71,0xec,0x3c,0x5d,0x7a,0xf3,0x73,0x6a,
+    0xd2,0x01,0x97,0xef,0x7b,0x9e,0x73,0xa1,0x74,0x5a,0xbd,0x50,0xda,0x70,0x07,0x77,
+    0xda,0x7c,0x07,0x77,0xba,0xfc,0x0e,0xee,0xd5,0x7d,0x06,0xad,0x9d,0xa6,0x5d,0x14,
+    0xc6,0x25,0xc5,0xd4,0xbe,0xa3,0x0b,0xcf,0x31,0xd2,0x2d,0xc2,0xa1,0x18,0xa4,0xac,
+    0x06,0x28,0x2d,0xc8,0xc8,0xe4,0xdd,0xb6,0x2e,0x15,0xee,0x47,0x79,0x82,0xdf,0xbe,
+    0x29,0xef,0x8d,0xca,0xb4,0x1f,0xca,0x63,0x61,0x41,0x28,0x09,0x23,0x09,0x11,0x5d,
+    0x43,0x4f,0x1b,0xd2,0x25,0x60,0x6c,0x83,0xd3,0xa1,0x24,0x0d,0x7a,0x3d,0xb0,0xc9,
+    0x50,0x92,0x63,0xc2,0x70,0x79,0x7d,0x01,0x2f,0xc3,0x0c,0xf0,0x94,0x61,0xa2,0x58,
+    0x3a,0x60,0xbd,0xb8,0x99,0xdb,0x5e,0xd6,0x60,0xca,0xcc,0x42,0x8d,0x6c,0xe6,0xf9,
+    0xbb,0xfd,0x67,0x4f,0xbb,0x94,0x2c,0xca,0x60,0x60,0x14,0x20,0x79,0x93,0x24,0x4a,
+    0xfa,0xa5,0xde,0x6b,0x0b,0xaa,0x44,0x52,0x93,0x3a,0xa4,0x24,0x7c,0xd3,0xd0,0x8d,
+    0xe1,0x45,0x99,0x73,0xe5,0xdc,0x25,0xf6,0x15,0x77,0x2b,0x01,0x78,0x71,0xff,0xb1,
+    0x48,0x3c,0x6d,0x8e,0xa3,0x4d,0xae,0xe7,0x62,0x5f,0xc5,0xca,0xcf,0xfc,0x46,0x67,
+    0x44,0xa0,0x51,0xb4,0x2d,0x7d,0x61,0x0d,0x83,0x4c,0xc7,0x17,0xdc,0x66,0x97,0x32,
+    0x11,0x19,0x49,0x34,0x38,0xcf,0x24,0x86,0xd2,0x36,0x42,0x54,0xcd,0x42,0x9b,0x18,
+    0xaa,0x2b,0x6b,0xdc,0xae,0xf3,0x0a,0x66,0x63,0x1c,0x79,0x3d,0x67,0xef,0xd9,0xfe,
+    0x0b,0xa7,0x73,0xf5,0xdc,0x2e,0x9f,0x1e,0x71,0xa6,0x25,0xec,0x5e,0x04,0x86,0x2b,
+    0x7a,0x20,0x2d,0x47,0x75,0x9e,0x0d,0x55,0x1e,0x0f,0x30,0x32,0x26,0x9b,0xe7,0x93,
+    0xf0,0x37,0xe5,0x2c,0x2f,0x56,0xbe,0x25,0x53,0x8e,0xa7,0xfd,0x94,0x25,0x08,0x65,
+    0x10,0x8a,0xda,0x75,0xba,0xcc,0xfe,0x58,0x1d,0x5b,0xb6,0x98,0x1b,0x74,0xed,0xb5,
+    0x6b,0x36,0x5d,0xd1,0x69,0xd2,0x35,0x2b,0x5b,0xb0,0x44,0xd7,0xdb,0xa5,0x17,0x76,
+    0xae,0x53,0xae,0xa6,0x4f,0x74,0xde,0x89,0xa0,0xbf,0x2c,0x5d,0x3d,0x65,0xb8,0xdf,
+    0x57,0x39,0xe4,0x4c,0x20,0x01,0x16,0xf2,0x73,0x14,0xf2,0x5e,0x21,0x33,0x27,0x65,
+    0xca,0x37,0x60,0xdb,0xa5,0x9c,0xf9,0x69,0x29,0x67,0x7e,0x27,0xa0,0x74,0x84,0x56,
+    0xfe,0x7b,0xe0,0x64,0xeb,0x69,0xfb,0x93,0x22,0xe7,0x8b,0x7d,0xb3,0xb6,0xb8,0x39,
+    0x5a,0xad,0xe7,0x0b,0x9b,0xc5,0xc5,0xcd,0x6a,0xbd,0xba,0x18,0x68,0xdd,0x10,0xac,
+    0x42,0x50,0xc8,0x43,0xf9,0xd0,0xbb,0x0a,0x42,0xe1,0x0f,0x4d,0x27,0xc8,0x55,0x40,
+    0x75,0x7e,0x59,0x3b,0xce,0xac,0xc1,0x15,0x77,0xe6,0x2a,0x17,0xe8,0x6a,0xaf,0x36,
+    0x77,0xb3,0xea,0x97,0x9c,0xaa,0xb0,0xe6,0xa6,0x7b,0xed,0xc2,0x78,0x15,0xd2,0xc4,
+    0x4b,0x9e,0x13,0x24,0xd8,0xd4,0x86,0x63,0x04,0x97,0x06,0xc9,0x55,0xae,0xfc,0xbd,
+    0x67,0x72,0x1e,0x9d,0x02,0x4a,0x76,0x41,0x55,0x00,0x63,0x16,0x49,0x7a,0xb6,0x3f,
+    0x29,0x72,0xf3,0x34,0xb3,0x47,0xb5,0xbe,0xca,0x1e,0xd5,0xfa,0x3a,0x7b,0x54,0x21,
+    0x1a,0xd8,0xa3,0x0a,0xb2,0x94,0x3d,0xaa,0x80,0xcb,0xd8,0xa3,0x06,0xb7,0x94,0x3d,
+    0xaa,0x90,0x86,0xd6,0x1d,0xc7,0xba,0x69,0x59,0x85,0x32,0x87,0x6f,0x9d,0xca,0x41,
+    0xd8,0x12,0x58,0x3c,0x58,0xea,0x14,0x67,0x3e,0x0d,0x74,0xe7,0x58,0xa3,0x8e,0x53,
+    0x8a,0x2c,0x5a,0x42,0x3e,0x15,0x0e,0x53,0x0e,0x8d,0xa9,0x4d,0x04,0x47,0x0b,0xd5,
+    0xc2,0x19,0x4a,0x70,0xe6,0xf2,0xbc,0x7d,0x01,0xba,0x06,0x81,0x89,0x20,0x4a,0x39,
+    0x21,0x6a,0x10,0x78,0xa5,0xbe,0x72,0xeb,0xb6,0x06,0xa3,0xee,0x64,0x59,0x97,0xb3,
+    0x6a,0x20,0x74,0x73,0xa8,0x7c,0xf9,0xa6,0x3a,0x2c,0xbe,0x7b,0x53,0xbd,0xb2,0x52,
+    0xc7,0x24,0x69,0xd5,0xda,0x77,0x34,0x6a,0x30,0x09,0x77,0xa7,0x12,0xa6,0x5f,0x03,
+    0x53,0x37,0xf3,0xac,0x2b,0x7a,0xb5,0x19,0x5e,0x2a,0x26,0x6a,0x8c,0x7d,0x8e,0xf0,
+    0xa9,0x13,0x0c,0xf7,0x5c,0x3b,0xc5,0x7e,0x78,0x13,0x0c,0x05,0x39,0x98,0x58,0x87,
+    0x7a,0xf5,0x30,0x2b,0x49,0x97,0xc3,0x25,0x0b,0xee,0x32,0xe2,0xab,0xa9,0xcd,0x05,
+    0xe2,0xab,0xd6,0x1f,0xeb,0x58,0xa4,0x72,0x46,0xd2,0x04,0xaa,0x0e,0x15,0x4a,0x07,
+    0x0c,0x4a,0xd7,0x3e,0xea,0xb7,0xc6,0xbe,0xd7,0x49,0x7c,0xaf,0xc8,0xf3,0x8d,0x71,
+    0x72,0x50,0xd8,0xee,0x50,0x16,0x89,0x44,0xa7,0xfc,0x1e,0x7f,0xfe,0x39,0xc6,0x8b,
+    0x8d,0x51,0xc7,0x06,0xe4,0x6b,0x91,0xc6,0x4f,0xca,0x3b,0x64,0xa2,0x2f,0x5a,0x95,
+    0x22,0x32,0xc9,0x71,0xb9,0xbe,0x7e,0xfd,0x69,0xa5,0xaa,0x7d,0xc7,0x19,0xe0,0x71,
+    0x45,0x71,0xad,0x05,0x0d,0xc8,0x37,0xdb,0x9f,0x3c,0xb2,0x52,0xfa,0xd3,0x65,0x19,
+    0x93,0x37,0x17,0x3a,0xf3,0xc8,0xca,0xea,0x8f,0x95,0x45,0x1a,0x71,0x5d,0xc9,0x89,
+    0xfd,0xb1,0xce,0x24,0x10,0xb7,0xaa,0x54,0x6e,0x7f,0x5d,0x6d,0xf2,0x87,0x6b,0x10,
+    0x95,0x0e,0x1a,0xeb,0x8b,0xe4,0xcf,0xba,0x92,0x73,0xff,0xd3,0x85,0xbf,0xbc,0x82,
+    0x5a,0x67,0xee,0xc5,0x4a,0x2b,0x4d,0xaf,0xae,0xe6,0x2c,0xbc,0xea,0xee,0x61,0xa5,
+    0x8a,0x12,0xe8,0xaa,0x1b,0x62,0xe5,0xaa,0xc4,0xa0,0x4c,0xaa,0x08,0x75,0x4a,0x63,
+    0xac,0xb4,0xf2,0x17,0x9b,0x6a,0x93,0x67,0x9a,0x00,0xec,0x94,0xd2,0xa6,0xc7,0x45,
+    0xde,0x62,0xea,0x74,0x29,0x43,0xb1,0x06,0x52,0x5f,0x35,0x40,0x80,0x22,0x4d,0xba,
+    0xae,0xe4,0xd4,0xd0,0xbc,0xb9,0x9c,0xd4,0xaa,0xf4,0x17,0x04,0x54,0x7d,0x91,0x1f,
+    0xdd,0x74,0x80,0xbe,0x74,0x40,0xef,0xd6,0x99,0xca,0x75,0x95,0xfe,0xa0,0x01,0x65,
+    0x8e,0x28,0x52,0xa6,0x9b,0x79,0x54,0xdf,0x34,0xa0,0x59,0x2c,0xb2,0xa5,0x9b,0x97,
+    0x9f,0xe8,0xd7,0x9e,0x54,0xd0,0xaa,0x6f,0x28,0x98,0x84,0x14,0x95,0x0e,0xd1,0xe7,
+    0x10,0xa8,0x43,0x3a,0xf9,0xb9,0xa1,0xc3,0x40,0x0f,0xd5,0xa4,0x0f,0x36,0x55,0x43,
+    0x8d,0xd2,0xa4,0xd9,0xb6,0xaa,0x2c,0x22,0x95,0x52,0x65,0xdb,0x20,0x2a,0xfb,0xb5,
+    0x41,0x61,0xf2,0x5c,0x6b,0x20,0xfd,0xb5,0x05,0x84,0xb0,0xf2,0xae,0x17,0xc4,0x2e,
+    0x7f,0x70,0xa1,0xd8,0xee,0x2f,0xa5,0x5e,0x2f,0x83,0xeb,0xe4,0xea,0x15,0x60,0x73,
+    0x08,0xf9,0xa8,0xc8,0x7a,0x4c,0x2c,0x74,0x5c,0xe9,0xb8,0x95,0xd8,0x18,0xeb,0xcb,
+    0x29,0x8c,0xf1,0x6b,0x55,0x85,0x8d,0x5f,0xf2,0xae,0xb7,0x3f,0xb9,0xbd,0x96,0x0e,
+    0x13,0x3f,0xce,0x76,0x6e,0xaf,0x0d,0x22,0x6f,0x0e,0x7f,0xc6,0xd9,0x34,0xd8,0xf9,
+    0xe4,0xff,0x07,0x42,0x48,0x0a,0x21,0xa7,0x24,0x01,0x00,
+};
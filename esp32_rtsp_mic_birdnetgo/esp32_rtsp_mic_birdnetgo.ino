@@ -1,10 +1,37 @@
 #include <WiFi.h>
 #include <WiFiManager.h>
+#include <WiFiUdp.h>
+#include <sys/time.h>
+#include <errno.h>
+#include "lwip/sockets.h"
 #include "driver/i2s.h"
+#include "esp_pm.h"
+#include "esp_timer.h"
+#include "esp_sntp.h"
+#include "esp_wifi.h"
 #include <ArduinoOTA.h>
 #include <Preferences.h>
 #include <math.h>
+#include <stdarg.h>
+#include <SPI.h>
+#include <SD.h>
 #include "WebUI.h"
+#include "AudioRing.h"
+#include "AudioDSP.h"
+#include "AudioCodec.h"
+#include "AudioResampler.h"
+#include "AudioPreroll.h"
+#include "Metrics.h"
+#include "AudioBench.h"
+#include "RtpPacket.h"
+#include "CongestionControl.h"
+#include "ActivityDetector.h"
+#include "RtspSession.h"
+#include "LogRing.h"
+#include "PowerSchedule.h"
+#include "AudioSpectrum.h"
+#include "RecordRing.h"
+#include "ClockDrift.h"
 
 // ================== PLATFORM DETECTION ==================
 // Automatically detect ESP32 variant and configure pins accordingly
@@ -16,6 +43,16 @@
     #define I2S_LRCLK_PIN   1   // Word select (LRCLK)
     #define I2S_DOUT_PIN    2   // Data from mic
     #define I2S_DMA_BUF_COUNT 8
+    // Single core: capture and network tasks are isolated by priority only
+    #define AUDIO_CAPTURE_CORE 0
+    #define AUDIO_NET_CORE     0
+    // RISC-V core without FPU: float math is emulated, use the Q29 kernel
+    #ifndef DSP_FIXED_POINT
+    #define DSP_FIXED_POINT 1
+    #endif
+    #define CPU_MHZ_STEPS 80, 120, 160   // cpu_freq values the benchmark may recommend
+    #define HAS_MEL_FRONTEND 0           // no FPU: the float FFT would not keep up
+    #define HAS_SD_RECORDER 0
 #elif CONFIG_IDF_TARGET_ESP32S3
     #define PLATFORM_NAME "ESP32-S3"
     #define HAS_RF_SWITCH 0
@@ -24,6 +61,20 @@
     #define I2S_LRCLK_PIN   17  // Word select (LRCLK)
     #define I2S_DOUT_PIN    18  // Data from mic
     #define I2S_DMA_BUF_COUNT 8
+    // Capture next to loop() on APP core, network next to the WiFi/lwIP stack
+    #define AUDIO_CAPTURE_CORE 1
+    #define AUDIO_NET_CORE     0
+    #ifndef DSP_FIXED_POINT
+    #define DSP_FIXED_POINT 0   // hardware single-precision FPU
+    #endif
+    #define CPU_MHZ_STEPS 80, 160
+    #define HAS_MEL_FRONTEND 1
+    // microSD slot of the XIAO ESP32-S3 Sense expansion board (SPI)
+    #define HAS_SD_RECORDER 1
+    #define SD_CS_PIN   21
+    #define SD_SCK_PIN  7
+    #define SD_MISO_PIN 8
+    #define SD_MOSI_PIN 9
 #elif CONFIG_IDF_TARGET_ESP32
     #define PLATFORM_NAME "ESP32"
     #define HAS_RF_SWITCH 0
@@ -32,6 +83,14 @@
     #define I2S_LRCLK_PIN   25  // Word select (DAC1, safe)
     #define I2S_DOUT_PIN    22  // Data from mic (I2C SCL if unused)
     #define I2S_DMA_BUF_COUNT 12  // Extra buffering for WiFi coexistence
+    #define AUDIO_CAPTURE_CORE 1
+    #define AUDIO_NET_CORE     0
+    #ifndef DSP_FIXED_POINT
+    #define DSP_FIXED_POINT 0   // hardware single-precision FPU
+    #endif
+    #define CPU_MHZ_STEPS 80, 160
+    #define HAS_MEL_FRONTEND 1
+    #define HAS_SD_RECORDER 0
 #else
     #warning "Unknown ESP32 variant - using default pins, please verify"
     #define PLATFORM_NAME "ESP32-Unknown"
@@ -40,8 +99,26 @@
     #define I2S_LRCLK_PIN   25
     #define I2S_DOUT_PIN    22
     #define I2S_DMA_BUF_COUNT 8
+    #define AUDIO_CAPTURE_CORE tskNO_AFFINITY
+    #define AUDIO_NET_CORE     tskNO_AFFINITY
+    #ifndef DSP_FIXED_POINT
+    #define DSP_FIXED_POINT 1   // safe without FPU
+    #endif
+    #define CPU_MHZ_STEPS 80, 160
+    #define HAS_MEL_FRONTEND 0
+    #define HAS_SD_RECORDER 0
 #endif
 
+// DSP kernel selection (override with -D DSP_FIXED_POINT=0/1)
+#if DSP_FIXED_POINT
+    #define DSP_KERNEL_NAME "fixed-q29"
+#else
+    #define DSP_KERNEL_NAME "float"
+#endif
+const char* DSP_KERNEL_STR = DSP_KERNEL_NAME;
+const uint8_t CPU_MHZ_CANDIDATES[] = { CPU_MHZ_STEPS };
+const uint8_t CPU_MHZ_CANDIDATE_COUNT = sizeof(CPU_MHZ_CANDIDATES);
+
 // ================== MICROPHONE TYPE ====================
 // MIC_TYPE_PDM: Built-in PDM microphone (e.g., XIAO ESP32-S3 Sense)
 // MIC_TYPE_I2S_STANDARD: External I2S microphone (ICS-43434, INMP441)
@@ -83,24 +160,74 @@ const char* FW_VERSION_STR = FW_VERSION;
 #define OVERHEAT_MAX_LIMIT_C 95
 #define OVERHEAT_LIMIT_STEP_C 5
 
+// -- Audio pipeline tasks (I2S capture -> PCM block ring -> RTSP network)
+#define AUDIO_RING_SLOTS 4            // processed blocks buffered between tasks
+#define AUDIO_CAPTURE_TASK_PRIO 19    // above lwIP (18), below the WiFi task (23)
+#define AUDIO_NET_TASK_PRIO 5         // above loop() (1)
+#define AUDIO_CAPTURE_STACK 4096
+#define AUDIO_NET_STACK 6144
+
+// -- Logging: logPrintf("to " IP_FMT, IP_ARGS(ip)) formats an IPAddress without a String
+#define IP_FMT "%u.%u.%u.%u"
+#define IP_ARGS(ip) (unsigned)(ip)[0], (unsigned)(ip)[1], (unsigned)(ip)[2], (unsigned)(ip)[3]
+
 // -- Servers
 WiFiServer rtspServer(8554);
-WiFiClient rtspClient;
 
 // -- RTSP Streaming
-String rtspSessionId = "";
-volatile bool isStreaming = false;
-uint16_t rtpSequence = 0;
-uint32_t rtpTimestamp = 0;
+RtspSession rtspSessions[RTSP_MAX_SESSIONS];
+volatile bool isStreaming = false;             // any session playing (kept by the network task)
+volatile bool rtspStopStreamsRequested = false;
 uint32_t rtpSSRC = 0x43215678;
-unsigned long lastRTSPActivity = 0;
+uint8_t rtspActiveSessions = 0;
+uint32_t rtspRejectedCount = 0;                // connections refused: session table full
+
+// -- RTP over UDP (negotiated in SETUP via client_port=, else interleaved TCP)
+#define RTP_UDP_SERVER_PORT 6970          // RTP; RTCP uses the next (odd) port
+#define RTCP_SR_INTERVAL_MS 5000
+WiFiUDP rtpUdp;
+WiFiUDP rtcpUdp;
+bool rtpUdpSocketsOpen = false;
+uint32_t udpSendErrors = 0;
+uint32_t rtcpReportsSent = 0;
+uint32_t rtcpReportsReceived = 0;
+
+// -- Sample clock: I2S frames against esp_timer (drift), and the capture time
+// of the stream that the RTCP sender reports map to NTP
+ClockDrift i2sClockDrift;
+SampleClockAnchor streamClockAnchor;
+volatile bool clockDriftResetRequested = true;   // next block restarts the estimate (gap, new clock)
+uint32_t i2sFramesTotal = 0;                     // I2S frames read since boot
+int64_t i2sLastRxDoneUs = 0;                     // esp_timer at the newest RX_DONE
+int64_t i2sBlockEndUs = 0;                       // capture time of the last frame read
+uint32_t clockDriftOverflows = 0;                // i2sRxOverflows at the last restart
+uint32_t clockDriftRestarts = 0;
+// esp_timer against NTP: SNTP steps the wall clock by what the crystal drifted
+#define NTP_DRIFT_MIN_INTERVAL_US (600LL * 1000000LL)
+uint32_t ntpSyncCount = 0;
+int64_t ntpLastSyncUs = 0;                       // esp_timer at the sync the drift is measured from
+int64_t ntpSyncOffsetUs = 0;                     // wall clock minus esp_timer right after it
+float ntpTimerDriftPpm = 0.0f;
+bool ntpTimerDriftValid = false;
+
+// -- RTP over TCP: non-blocking writes, backlog in a bounded per-session queue
+#define RTP_TCP_QUEUE_BYTES 12288         // per playing TCP session (whole packets, at least 2)
+uint32_t rtpQueueDrops = 0;               // packets dropped from full send queues
 
 // -- Buffers
-uint8_t rtspParseBuffer[1024];
-int rtspParseBufferPos = 0;
-//
 int32_t* i2s_32bit_buffer = nullptr;
-int16_t* i2s_16bit_buffer = nullptr;
+int16_t* i2s_16bit_buffer = nullptr;   // PDM: scratch used to drain I2S when the ring is full
+AudioBlockRing audioRing;
+
+// -- Audio pipeline tasks and synchronization
+TaskHandle_t audioCaptureTaskHandle = nullptr;
+TaskHandle_t rtspNetTaskHandle = nullptr;
+SemaphoreHandle_t captureMutex = nullptr;    // held by capture task for one block
+SemaphoreHandle_t netAudioMutex = nullptr;   // held by network task while sending from the ring
+volatile bool audioPipelinePaused = false;   // set while restartI2S() reconfigures
+volatile uint32_t audioRingOverruns = 0;     // blocks dropped because the ring was full
+volatile uint32_t audioRingUnderruns = 0;    // network task starved while streaming
+unsigned long lastAudioBlockMs = 0;
 
 // -- Global state
 unsigned long audioPacketsSent = 0;
@@ -108,7 +235,8 @@ unsigned long lastStatsReset = 0;
 bool rtspServerEnabled = true;
 
 // -- Audio parameters (runtime configurable)
-uint32_t currentSampleRate = DEFAULT_SAMPLE_RATE;
+uint32_t currentSampleRate = DEFAULT_SAMPLE_RATE;   // RTSP stream rate (SDP, RTP clock)
+uint32_t captureSampleRate = 0;                     // I2S clock setting; 0 = same as stream
 float currentGainFactor = DEFAULT_GAIN_FACTOR;
 uint16_t currentBufferSize = DEFAULT_BUFFER_SIZE;
 uint8_t i2sShiftBits = 12;  // (1) compile-time default respected on first boot
@@ -121,24 +249,205 @@ uint16_t peakHoldAbs16 = 0;       // peak hold (recent window)
 unsigned long peakHoldUntilMs = 0; // when to clear hold
 
 // -- High-pass filter (biquad) to cut low-frequency rumble
-struct Biquad {
-    float b0{1.0f}, b1{0.0f}, b2{0.0f}, a1{0.0f}, a2{0.0f};
-    float x1{0.0f}, x2{0.0f}, y1{0.0f}, y2{0.0f};
-    inline float process(float x) {
-        float y = b0 * x + b1 * x1 + b2 * x2 - a1 * y1 - a2 * y2;
-        x2 = x1; x1 = x; y2 = y1; y1 = y;
-        return y;
-    }
-    inline void reset() { x1 = x2 = y1 = y2 = 0.0f; }
-};
 bool highpassEnabled = DEFAULT_HPF_ENABLED;
 uint16_t highpassCutoffHz = DEFAULT_HPF_CUTOFF_HZ;
-Biquad hpf;
+Biquad hpf;          // designed in float; used directly by the float kernel
+#if DSP_FIXED_POINT
+BiquadQ29 hpfQ;      // quantized copy for the fixed-point kernel
+#endif
 uint32_t hpfConfigSampleRate = 0;
 uint16_t hpfConfigCutoff = 0;
 
-// -- Preferences for persistent settings
+// -- Filter chain: user biquad sections after the HPF (none = fused HPF kernel)
+FilterSpec filterSections[DSP_CHAIN_MAX - 1];   // one chain slot stays for the HPF
+uint8_t filterSectionCount = 0;
+BiquadChain filterChain;     // [HPF] + sections, compiled at the I2S rate
+#if DSP_FIXED_POINT
+BiquadChainQ28 filterChainQ;
+#endif
+
+// -- Live parameter changes: the parameters of the previous block (the
+// outgoing set) run once more over the first block after a change, and the
+// two outputs are crossfaded, so gain, shift and filter edits do not click
+#if DSP_FIXED_POINT
+typedef BiquadQ29 DspHpf;          // the kernel variant this build runs
+typedef BiquadChainQ28 DspChain;
+#else
+typedef Biquad DspHpf;
+typedef BiquadChain DspChain;
+#endif
+struct AudioFadeSet {
+    float gain = DEFAULT_GAIN_FACTOR;
+    uint8_t shift = 12;
+    bool hpfOn = false;
+    DspHpf hpf;                     // outgoing filters, set when a fade starts
+    DspChain chain;
+    bool filtersPending = false;    // filters replaced since the last block
+};
+AudioFadeSet audioFadeFrom;
+int16_t* crossfadeBuffer = nullptr; // outgoing pass of a crossfaded block
+uint32_t audioCrossfades = 0;
+uint32_t audioLiveResizes = 0;      // buffer / ptime / pre-roll changes without a restart
+
+// -- Microphones: one (left slot), or two on the same bus (L/R pin low / high)
+// sent as stereo L16/2 or combined on the device by delay-and-sum
+enum MicMode : uint8_t { MIC_MODE_MONO, MIC_MODE_STEREO, MIC_MODE_BEAM };
+uint8_t micMode = MIC_MODE_MONO;      // MicMode
+int8_t beamDelaySamples = 0;        // steering: +n delays the right mic by n samples
+DelaySum beamformer;
+int32_t* micPlanarBuffer = nullptr; // both slots of a block, left plane then right
+int16_t* micStereoBuffer = nullptr; // processed L and R planes before interleaving
+DspHpf micRightHpf, micRightFadeHpf;        // right channel: own memory, left's coefficients
+DspChain micRightChain, micRightFadeChain;
+
+// -- DSP cost (smoothed CPU cycles per sample of the block kernel)
+float dspCyclesPerSample = 0.0f;
+
+// -- RTP payload codec (L16 default; PCMU / DVI4 to save bandwidth)
+AudioCodecId currentCodec = CODEC_L16;
+ImaAdpcmState adpcmState;          // shared by all sessions (DVI4 header carries it)
+float codecCyclesPerSample = 0.0f;
+
+// -- Sample-rate converter (I2S capture rate -> stream rate)
+PolyphaseResampler resampler;
+uint32_t i2sCaptureRate = DEFAULT_SAMPLE_RATE;     // effective I2S clock
+uint16_t captureBlockSamples = DEFAULT_BUFFER_SIZE; // I2S samples per stream block
+
+// -- RTP packetization (ptime), independent of the capture buffer
+uint8_t packetTimeMs = 0;                  // 0 = one packet per buffer
+int16_t* streamStageBuffer = nullptr;      // stream-rate buffer (ptime slicing / pre-roll)
+int16_t* sliceCarryBuffer = nullptr;       // ptime slicing: buffer tail short of a packet, topped up by the next
+uint16_t sliceCarryCount = 0;
+uint32_t sliceCarryIndex = 0;              // stream index of its first sample
+AudioCodecId sliceCarryCodec = CODEC_L16;  // encoding form of the carried samples
+uint32_t streamSampleIndex = 0;            // absolute index of the next stream-rate sample
+
+// -- Pre-roll: last N seconds of processed audio in PSRAM, replayed on PLAY
+#define PREROLL_MAX_SECONDS 600
+#define PREROLL_PSRAM_RESERVE (256 * 1024)  // PSRAM left for everything else
+#define PREROLL_BURST_PACKETS 4             // replay packets per session per wake-up (faster than real time)
+#define PREROLL_RESUME_SLOTS 4
+uint16_t prerollSeconds = 0;               // setting; 0 = off
+PrerollBuffer preroll;
+uint32_t prerollConfigRate = 0;
+AudioBlock prerollReplayBlock = { nullptr, nullptr, 0, 0, 96, 0, false };   // network task scratch packet
+uint32_t prerollReplayedPackets = 0;
+// Where each recent client stopped, so a reconnect (e.g. after a Wi-Fi drop) gets the gap
+struct PrerollResume { IPAddress ip; uint32_t nextSampleIndex; bool valid; };
+PrerollResume prerollResume[PREROLL_RESUME_SLOTS];
+uint8_t prerollResumeNext = 0;
+float srcCyclesPerSample = 0.0f;
+volatile bool captureStateResetRequested = false;  // PLAY: clear codec/SRC history
+
+// -- Mel spectrogram frames of the processed stream, polled over /api/mel,
+// next to the RTSP audio or instead of it
+#define MEL_BANDS 64
+#define MEL_MIN_HZ 150.0f
+#define MEL_MAX_HZ 15000.0f
+enum MelMode : uint8_t { MEL_MODE_OFF, MEL_MODE_ON, MEL_MODE_ONLY };
+uint8_t melMode = MEL_MODE_OFF;       // MelMode
+MelSpectrum melSpectrum;
+uint32_t melFramesTotal = 0;
+LatencyHistogram histMelFrame;        // capture: one FFT + filterbank frame
+
+// -- Local recording: WAV segments on the SD card while Wi-Fi is down (or
+// always). Capture stages the processed stream in PSRAM; a low-priority task
+// writes it in large sequential chunks and rotates a bounded ring of files.
+#define RECORD_DIR "/rec"
+#define RECORD_STAGE_SECONDS 20              // PSRAM staging; also the lead-in before a detected outage
+#define RECORD_CHUNK_SAMPLES 16384           // 32 KB per write
+#define RECORD_SEGMENT_SECONDS 60
+#define RECORD_TAIL_MS 30000                 // keep writing after the link is back, while clients reconnect
+#define RECORD_SD_HZ 20000000
+#define RECORD_MOUNT_RETRY_MS 60000
+#define RECORD_TASK_PRIO 3                   // below the network task
+#define RECORD_STACK 4096
+enum RecordMode : uint8_t { RECORD_MODE_OFF, RECORD_MODE_OUTAGE, RECORD_MODE_ALWAYS };
+uint8_t recordMode = RECORD_MODE_OFF;        // RecordMode
+uint16_t recordMaxMb = 0;                    // ring budget on the card; 0 = 90% of it
+PrerollBuffer recordStage;
+RecordRing recordRing;
+SemaphoreHandle_t recordMutex = nullptr;     // segment table and open file (recorder task / Web UI)
+TaskHandle_t recordTaskHandle = nullptr;
+int16_t* recordChunk = nullptr;              // write buffer (PSRAM)
+bool recordCardOk = false;
+uint64_t recordCardBytes = 0;
+unsigned long recordMountAtMs = 0;           // next mount attempt
+volatile bool recordLinkDown = true;         // boot counts as an outage until Wi-Fi is up
+unsigned long recordTailUntilMs = 0;
+unsigned long recordLastCheckMs = 0;
+File recordFile;                             // open segment
+uint32_t recordFileSeq = 0;
+uint32_t recordFileRate = 0;
+uint32_t recordFileData = 0;                 // sample bytes written to it
+uint32_t recordWritePos = 0;                 // next staged sample to write
+bool recordContinuous = false;               // the next segment follows on at recordWritePos
+uint32_t recordNextSeq = 0;
+volatile uint32_t recordServingSeq = UINT32_MAX;   // segment the Web UI is sending: not evicted
+uint32_t recordLostSamples = 0;              // staged audio overwritten before it reached the card
+uint32_t recordSegmentsTotal = 0;
+uint64_t recordBytesTotal = 0;
+uint32_t recordWriteUsMax = 0;
+
+// -- Activity gating: inactive buffers are not encoded or sent; sessions get
+// RFC 3389 comfort-noise packets instead and the RTP clock runs on
+#define ACTIVITY_CN_INTERVAL_MS 1000       // comfort-noise refresh while gated
+#define ACTIVITY_CN_PAYLOAD_TYPE 97        // dynamic CN type (static 13 at 8 kHz)
+bool activityGateEnabled = false;          // setting "actGate"
+uint8_t activityThresholdDb = 10;          // setting "actThrDb": dB over the noise floor
+uint16_t activityHangoverSec = 5;          // setting "actHangSec": open after the last active buffer
+ActivityDetector activityDetector;
+volatile bool activityGated = false;       // last buffer was gated
+ActivityHour activityHours[ACTIVITY_HOURS];
+uint32_t activityHour = 0;                 // hour since boot of the newest slot
+uint64_t activityActiveSamplesTotal = 0;
+uint32_t comfortNoisePackets = 0;
+uint8_t comfortNoisePacket[AUDIO_BLOCK_HEADROOM + 4];
+AudioBlock comfortNoiseBlock = { comfortNoisePacket, (int16_t*)(comfortNoisePacket + AUDIO_BLOCK_HEADROOM), 0, 1, ACTIVITY_CN_PAYLOAD_TYPE, 0, false };
+
+// -- Adaptive bitrate: step the stream format down when sends back up
+// A format change needs a new SDP, so each transition ends PLAY (clients
+// re-DESCRIBE, as after a codec change); the controller rate-limits them.
+#define ABR_WINDOW_MS 1000
+struct AbrFormat { uint32_t rate; AudioCodecId codec; };
+const AbrFormat ABR_STEPS[] = {
+    { 48000, CODEC_L16 }, { 32000, CODEC_L16 }, { 24000, CODEC_L16 },
+    { 24000, CODEC_PCMU }, { 16000, CODEC_PCMU }, { 16000, CODEC_DVI4 },
+};
+#define ABR_MAX_LEVELS (1 + sizeof(ABR_STEPS) / sizeof(ABR_STEPS[0]))
+bool abrEnabled = false;                   // setting "abrEnable"
+uint8_t abrLevel = 0;                      // 0 = configured format
+uint8_t abrLevelCount = 1;
+AbrFormat abrLevels[ABR_MAX_LEVELS];       // [0] = configured rate/codec
+uint32_t abrConfiguredCaptureRate = 0;     // captureSampleRate setting while degraded
+uint32_t abrTransitions = 0;
+CongestionController abrController;
+// Send-side signals: network task writes, loop() takes deltas
+volatile uint32_t rtpWriteStalls = 0;      // packets with a short TCP write or failed UDP send
+volatile uint32_t rtpSendUsTotal = 0;      // time inside write()/endPacket()
+volatile uint32_t rtpAudioSamplesTotal = 0;
+
+// -- I2S driver event queue (reads are paced by RX_DONE instead of timeouts)
+#define I2S_EVENT_QUEUE_LEN (I2S_DMA_BUF_COUNT * 2)
+QueueHandle_t i2sEventQueue = nullptr;
+size_t i2sDmaBufBytes = 0;          // bytes per DMA buffer (RX_DONE granularity)
+size_t i2sReadyBytes = 0;           // filled DMA bytes not yet read (capture task)
+volatile uint32_t i2sRxDoneEvents = 0;
+volatile uint32_t i2sRxOverflows = 0;   // I2S_EVENT_RX_Q_OVF: DMA overwrote unread data
+volatile uint32_t i2sDmaErrors = 0;     // I2S_EVENT_DMA_ERROR
+uint32_t i2sEventTimeouts = 0;          // no RX_DONE within 50 ms
+uint32_t lastReportedRxOverflows = 0;
+
+// -- Preferences for persistent settings. saveAudioSettings() only marks them
+// dirty; loop() commits once edits have settled and writes the changed keys only.
+#define SETTINGS_COMMIT_DELAY_MS 3000    // quiet time after the last change
+#define SETTINGS_COMMIT_MAX_MS 30000     // commit anyway while edits keep coming
 Preferences audioPrefs;
+bool settingsDirty = false;
+unsigned long settingsFirstChangeMs = 0;
+unsigned long settingsLastChangeMs = 0;
+uint32_t settingsCommits = 0;
+uint32_t settingsKeysWritten = 0;        // NVS writes since boot (flash wear)
 
 // -- Diagnostics, auto-recovery and temperature monitoring
 unsigned long lastMemoryCheck = 0;
@@ -172,6 +481,29 @@ bool overheatLatched = false;
 bool scheduledResetEnabled = false;
 uint32_t resetIntervalHours = 24; // Default 24 hours
 
+// -- Low-power schedule: outside the daily capture windows I2S is stopped,
+// the CPU clock lowered and Wi-Fi modem sleep enabled
+#define POWER_IDLE_CPU_MHZ 80           // lowest clock Wi-Fi keeps working at
+#define POWER_WARMUP_S 10               // I2S restarts this early so a window starts with audio
+#define POWER_TZ_MAX 48                 // POSIX TZ string ("CET-1CEST,M3.5.0,M10.5.0/3")
+#define POWER_DEFAULT_WINDOWS "05:00-09:00,17:00-21:00"
+// Current estimates (mA at 3.3 V) for the board without the mic; coarse by design
+#define POWER_EST_WIFI_ACTIVE_MA 75.0f  // radio always on (WiFi.setSleep(false))
+#define POWER_EST_WIFI_SLEEP_MA 20.0f   // modem sleep between DTIM beacons
+#define POWER_EST_MA_PER_MHZ 0.15f      // CPU core
+#define POWER_EST_I2S_MA 3.0f           // mic + I2S peripheral running
+bool powerScheduleEnabled = false;      // off: stream around the clock
+PowerSchedule powerSchedule;
+char powerTimezone[POWER_TZ_MAX] = "UTC0";
+volatile bool powerIdle = false;        // outside a window: I2S stopped, no PLAY
+bool powerLightSleep = false;           // automatic light sleep configured (CONFIG_PM_ENABLE)
+uint32_t powerIdleEntries = 0;
+uint32_t powerNextChangeS = 0;          // seconds to the next window edge (0 = unknown)
+uint64_t powerActiveMs = 0;             // time streaming-capable since boot
+uint64_t powerIdleMs = 0;               // time in the low-power state since boot
+double powerChargeMas = 0.0;            // estimated charge since boot (mA*s)
+unsigned long powerLastTickMs = 0;
+
 // -- Configurable thresholds
 uint32_t minAcceptableRate = 50;        // Minimum acceptable packet rate (restart below this)
 uint32_t performanceCheckInterval = 15; // Check interval in minutes
@@ -181,6 +513,19 @@ uint8_t cpuFrequencyMhz = 160;          // CPU frequency (default 160 MHz)
 float wifiTxPowerDbm = DEFAULT_WIFI_TX_DBM;
 wifi_power_t currentWifiPowerLevel = WIFI_POWER_19_5dBm;
 
+// -- Fast reconnect: AP and DHCP lease of the previous boot (skips the scan and DHCP)
+#define WIFI_FAST_CONNECT_TIMEOUT_MS 6000
+uint8_t wifiCachedBssid[6] = {0};
+uint8_t wifiCachedChannel = 0;          // 0 = nothing cached
+uint32_t wifiCachedLease[4] = {0};      // ip, gateway, mask, dns
+bool wifiStaticFromLease = false;       // setting "wfStaticIp": reuse the cached lease as static IP
+bool wifiFastConnected = false;         // this boot joined through the cache
+// -- Startup latency (ms since boot, 0 = not reached yet)
+uint32_t bootCaptureMs = 0;             // first I2S block
+uint32_t bootWifiMs = 0;                // station connected
+uint32_t bootRtspReadyMs = 0;           // network task started
+uint32_t bootFirstPacketMs = 0;         // first RTP packet to a client
+
 // -- RTSP connect/PLAY statistics
 unsigned long lastRtspClientConnectMs = 0;
 unsigned long lastRtspPlayMs = 0;
@@ -232,51 +577,54 @@ void applyWifiTxPower(bool log = true) {
         WiFi.setTxPower(desired);
         currentWifiPowerLevel = desired;
         if (log) {
-            simplePrintln("WiFi TX power set to " + String(wifiPowerLevelToDbm(currentWifiPowerLevel), 1) + " dBm");
+            logPrintf("WiFi TX power set to %.1f dBm", wifiPowerLevelToDbm(currentWifiPowerLevel));
         }
     }
 }
 
+// Design the filter chain from the HPF and the user sections (capture task,
+// or with the audio pipeline locked); the kernels only read the result
+void compileFilterChain() {
+    filterChain.clear();
+    if (filterSectionCount == 0) return;
+    if (highpassEnabled) filterChain.add(hpf);
+    for (uint8_t i = 0; i < filterSectionCount; ++i) {
+        Biquad section;
+        dsp_designSection(section, filterSections[i], (float)i2sCaptureRate);
+        filterChain.add(section);
+    }
+#if DSP_FIXED_POINT
+    filterChainQ.load(filterChain);
+#endif
+}
+
 // Recompute HPF coefficients (2nd-order Butterworth high-pass)
 void updateHighpassCoeffs() {
     if (!highpassEnabled) {
         hpf.reset();
-        hpfConfigSampleRate = currentSampleRate;
+#if DSP_FIXED_POINT
+        hpfQ.reset();
+#endif
+        hpfConfigSampleRate = i2sCaptureRate;
         hpfConfigCutoff = highpassCutoffHz;
+        compileFilterChain();
         return;
     }
-    float fs = (float)currentSampleRate;
-    float fc = (float)highpassCutoffHz;
-    if (fc < 10.0f) fc = 10.0f;
-    if (fc > fs * 0.45f) fc = fs * 0.45f; // keep reasonable
-
-    const float pi = 3.14159265358979323846f;
-    float w0 = 2.0f * pi * (fc / fs);
-    float cosw0 = cosf(w0);
-    float sinw0 = sinf(w0);
-    float Q = 0.70710678f; // Butterworth-like
-    float alpha = sinw0 / (2.0f * Q);
-
-    float b0 =  (1.0f + cosw0) * 0.5f;
-    float b1 = -(1.0f + cosw0);
-    float b2 =  (1.0f + cosw0) * 0.5f;
-    float a0 =  1.0f + alpha;
-    float a1 = -2.0f * cosw0;
-    float a2 =  1.0f - alpha;
-
-    hpf.b0 = b0 / a0;
-    hpf.b1 = b1 / a0;
-    hpf.b2 = b2 / a0;
-    hpf.a1 = a1 / a0;
-    hpf.a2 = a2 / a0;
-    hpf.reset();
+    // The filter runs before the rate converter, at the I2S rate
+    dsp_designHighpass(hpf, (float)i2sCaptureRate, (float)highpassCutoffHz);
+#if DSP_FIXED_POINT
+    hpfQ.load(hpf);
+#endif
 
-    hpfConfigSampleRate = currentSampleRate;
-    hpfConfigCutoff = (uint16_t)fc;
+    // The requested cutoff (the design may clamp it), so the capture task does
+    // not see a change on every block
+    hpfConfigSampleRate = i2sCaptureRate;
+    hpfConfigCutoff = highpassCutoffHz;
+    compileFilterChain();
 }
 
 // Uptime -> "Xd Yh Zm Ts"
-String formatUptime(unsigned long seconds) {
+size_t formatUptimeTo(char* out, size_t n, unsigned long seconds) {
     unsigned long days = seconds / 86400;
     seconds %= 86400;
     unsigned long hours = seconds / 3600;
@@ -284,19 +632,26 @@ String formatUptime(unsigned long seconds) {
     unsigned long minutes = seconds / 60;
     seconds %= 60;
 
-    String result = "";
-    if (days > 0) result += String(days) + "d ";
-    if (hours > 0 || days > 0) result += String(hours) + "h ";
-    if (minutes > 0 || hours > 0 || days > 0) result += String(minutes) + "m ";
-    result += String(seconds) + "s";
-    return result;
+    int len;
+    if (days > 0) len = snprintf(out, n, "%lud %luh %lum %lus", days, hours, minutes, seconds);
+    else if (hours > 0) len = snprintf(out, n, "%luh %lum %lus", hours, minutes, seconds);
+    else if (minutes > 0) len = snprintf(out, n, "%lum %lus", minutes, seconds);
+    else len = snprintf(out, n, "%lus", seconds);
+    return (len < 0) ? 0 : ((size_t)len < n ? (size_t)len : n - 1);
+}
+
+String formatUptime(unsigned long seconds) {
+    char buf[32];
+    formatUptimeTo(buf, sizeof(buf), seconds);
+    return String(buf);
 }
 
 // Format "X ago" for events based on millis()
-String formatSince(unsigned long eventMs) {
-    if (eventMs == 0) return String("never");
-    unsigned long seconds = (millis() - eventMs) / 1000;
-    return formatUptime(seconds) + " ago";
+size_t formatSinceTo(char* out, size_t n, unsigned long eventMs) {
+    if (eventMs == 0) return (size_t)snprintf(out, n, "never");
+    size_t len = formatUptimeTo(out, n, (millis() - eventMs) / 1000);
+    int m = snprintf(out + len, n - len, " ago");
+    return (m < 0) ? len : ((len + (size_t)m < n) ? len + (size_t)m : n - 1);
 }
 
 static bool isTemperatureValid(float temp) {
@@ -306,12 +661,48 @@ static bool isTemperatureValid(float temp) {
 }
 
 // Format current local time, fallback to uptime when no RTC/NTP time available
+// Typed writes that skip keys already holding the value (audioPrefs open)
+static void prefPutBool(const char* key, bool v) {
+    if (audioPrefs.isKey(key) && audioPrefs.getBool(key, !v) == v) return;
+    audioPrefs.putBool(key, v);
+    settingsKeysWritten++;
+}
+static void prefPutUChar(const char* key, uint8_t v) {
+    if (audioPrefs.isKey(key) && audioPrefs.getUChar(key, (uint8_t)~v) == v) return;
+    audioPrefs.putUChar(key, v);
+    settingsKeysWritten++;
+}
+static void prefPutUShort(const char* key, uint16_t v) {
+    if (audioPrefs.isKey(key) && audioPrefs.getUShort(key, (uint16_t)~v) == v) return;
+    audioPrefs.putUShort(key, v);
+    settingsKeysWritten++;
+}
+static void prefPutUInt(const char* key, uint32_t v) {
+    if (audioPrefs.isKey(key) && audioPrefs.getUInt(key, ~v) == v) return;
+    audioPrefs.putUInt(key, v);
+    settingsKeysWritten++;
+}
+static void prefPutFloat(const char* key, float v) {
+    if (audioPrefs.isKey(key) && audioPrefs.getFloat(key, NAN) == v) return;
+    audioPrefs.putFloat(key, v);
+    settingsKeysWritten++;
+}
+static void prefPutString(const char* key, const char* v) {
+    char stored[DSP_CHAIN_SPEC_MAX];
+    const size_t n = strlen(v);
+    if (n < sizeof(stored) && audioPrefs.isKey(key)
+        && audioPrefs.getString(key, stored, sizeof(stored)) > 0 && strcmp(stored, v) == 0) return;
+    audioPrefs.putString(key, v);
+    settingsKeysWritten++;
+}
+
+// The trip record is written at once (not deferred) so a reset cannot lose it
 static void persistOverheatNote() {
     audioPrefs.begin("audio", false);
-    audioPrefs.putString("ohReason", overheatLastReason);
-    audioPrefs.putString("ohStamp", overheatLastTimestamp);
-    audioPrefs.putFloat("ohTripC", overheatTripTemp);
-    audioPrefs.putBool("ohLatched", overheatLatched);
+    prefPutString("ohReason", overheatLastReason.c_str());
+    prefPutString("ohStamp", overheatLastTimestamp.c_str());
+    prefPutFloat("ohTripC", overheatTripTemp);
+    prefPutBool("ohLatched", overheatLatched);
     audioPrefs.end();
 }
 
@@ -323,7 +714,7 @@ void recordOverheatTrip(float temp) {
     overheatLastReason = String("Thermal shutdown: ") + String(temp, 1) + " C reached (limit " +
                          String(overheatShutdownC, 1) + " C). Stream disabled; acknowledge in UI.";
     overheatLatched = true;
-    simplePrintln("THERMAL PROTECTION: " + overheatLastReason);
+    logPrintf("THERMAL PROTECTION: %s", overheatLastReason.c_str());
     simplePrintln("TIP: Improve cooling or lower WiFi TX power/CPU MHz if overheating persists.");
     persistOverheatNote();
 }
@@ -367,14 +758,8 @@ void checkTemperature() {
             overheatLockoutActive = true;
             recordOverheatTrip(temp);
             // Disable streaming until user restarts manually
-            if (rtspClient && rtspClient.connected()) {
-                rtspClient.stop();
-            }
-            if (isStreaming) {
-                isStreaming = false;
-            }
+            // (the network task closes all sessions and the server socket)
             rtspServerEnabled = false;
-            rtspServer.stop();
         } else if (overheatLockoutActive && temp <= (overheatShutdownC - OVERHEAT_LIMIT_STEP_C)) {
             // Allow re-arming after we cool down by at least one step
             overheatLockoutActive = false;
@@ -387,7 +772,7 @@ void checkTemperature() {
     static unsigned long lastTempWarn = 0;
     float warnThreshold = max(overheatShutdownC - 5.0f, (float)OVERHEAT_MIN_LIMIT_C);
     if (temp > warnThreshold && (millis() - lastTempWarn) > 600000UL) { // 10 min cooldown
-        simplePrintln("WARNING: High temperature detected (" + String(temp, 1) + " C). Approaching shutdown limit.");
+        logPrintf("WARNING: High temperature detected (%.1f C). Approaching shutdown limit.", temp);
         lastTempWarn = millis();
     }
 }
@@ -399,6 +784,14 @@ void checkPerformance() {
         minFreeHeap = currentHeap;
     }
 
+    // DMA overflows are reported by the driver directly, not inferred from packet rate
+    uint32_t overflows = i2sRxOverflows;
+    if (overflows != lastReportedRxOverflows) {
+        logPrintf("I2S DMA overflow: %u buffer(s) lost (total %u, DMA errors %u)",
+                  (unsigned)(overflows - lastReportedRxOverflows), (unsigned)overflows, (unsigned)i2sDmaErrors);
+        lastReportedRxOverflows = overflows;
+    }
+
     if (isStreaming && (millis() - lastStatsReset) > 30000) {
         uint32_t runtime = millis() - lastStatsReset;
         uint32_t currentRate = (audioPacketsSent * 1000) / runtime;
@@ -408,7 +801,7 @@ void checkPerformance() {
 
         if (currentRate < minAcceptableRate) {
             simplePrintln("PERFORMANCE DEGRADATION DETECTED!");
-            simplePrintln("Rate " + String(currentRate) + " < minimum " + String(minAcceptableRate) + " pkt/s");
+            logPrintf("Rate %u < minimum %u pkt/s", (unsigned)currentRate, (unsigned)minAcceptableRate);
 
             if (autoRecoveryEnabled) {
                 simplePrintln("AUTO-RECOVERY: Restarting I2S...");
@@ -433,7 +826,7 @@ void checkWiFiHealth() {
 
     int32_t rssi = WiFi.RSSI();
     if (rssi < -85) {
-        simplePrintln("WARNING: Weak WiFi signal: " + String(rssi) + " dBm");
+        logPrintf("WARNING: Weak WiFi signal: %d dBm", (int)rssi);
     }
 }
 
@@ -443,16 +836,428 @@ void checkScheduledReset() {
 
     unsigned long uptimeHours = (millis() - bootTime) / 3600000;
     if (uptimeHours >= resetIntervalHours) {
-        simplePrintln("SCHEDULED RESET: " + String(resetIntervalHours) + " hours reached");
+        logPrintf("SCHEDULED RESET: %u hours reached", (unsigned)resetIntervalHours);
+        flushAudioSettings();
         delay(1000);
         ESP.restart();
     }
 }
 
+// Local wall-clock second of the day; false until NTP has set the clock
+static bool powerLocalSecond(uint32_t offsetS, uint32_t &secondOfDay) {
+    time_t now = time(nullptr);
+    if (now < 1704067200) return false;   // before 2024: not synced yet
+    now += offsetS;
+    struct tm lt;
+    localtime_r(&now, &lt);
+    secondOfDay = (uint32_t)lt.tm_hour * 3600UL + (uint32_t)lt.tm_min * 60UL + (uint32_t)lt.tm_sec;
+    return true;
+}
+
+bool powerTimeValid() {
+    uint32_t s;
+    return powerLocalSecond(0, s);
+}
+
+// Estimated board current for the present state
+float powerEstimateMa() {
+    float ma = (powerIdle ? POWER_EST_WIFI_SLEEP_MA : POWER_EST_WIFI_ACTIVE_MA)
+             + POWER_EST_MA_PER_MHZ * (float)getCpuFrequencyMhz();
+    if (!powerIdle) ma += POWER_EST_I2S_MA;
+    return ma;
+}
+
+float powerAverageMa() {
+    const uint64_t ms = powerActiveMs + powerIdleMs;
+    return ms ? (float)(powerChargeMas * 1000.0 / (double)ms) : powerEstimateMa();
+}
+
+// Share of the day the schedule keeps the device streaming (100 when off)
+float powerDutyPercent() {
+    if (!powerScheduleEnabled || powerSchedule.count() == 0) return 100.0f;
+    return (float)powerSchedule.activeMinutesPerDay() * 100.0f / 1440.0f;
+}
+
+// Automatic light sleep between Wi-Fi beacons; needs a core built with power management
+static void powerConfigureLightSleep(bool enable) {
+#if CONFIG_PM_ENABLE && ESP_IDF_VERSION_MAJOR >= 5
+    esp_pm_config_t pm = {};
+    pm.max_freq_mhz = enable ? POWER_IDLE_CPU_MHZ : cpuFrequencyMhz;
+    pm.min_freq_mhz = enable ? 40 : cpuFrequencyMhz;
+    pm.light_sleep_enable = enable;
+    powerLightSleep = enable && esp_pm_configure(&pm) == ESP_OK;
+#else
+    (void)enable;
+    powerLightSleep = false;
+#endif
+}
+
+// Leave the streaming configuration: no clients, I2S stopped, CPU and radio slowed
+static void powerEnterIdle() {
+    rtspStopAllStreams();
+    audioPipelineLock();
+    i2s_stop(I2S_NUM_0);
+    powerIdle = true;
+    audioPipelineUnlock();
+    setCpuFrequencyMhz(POWER_IDLE_CPU_MHZ);
+    LatencyHistogram::setCpuMhz(getCpuFrequencyMhz());
+    WiFi.setSleep(true);
+    powerConfigureLightSleep(true);
+    powerIdleEntries++;
+    logPrintf("Power schedule: outside capture windows - I2S stopped, CPU %u MHz, modem sleep%s",
+              (unsigned)getCpuFrequencyMhz(), powerLightSleep ? " + light sleep" : "");
+}
+
+// Warm start: the driver and buffers stay allocated, so restarting DMA is enough
+static void powerExitIdle() {
+    powerConfigureLightSleep(false);
+    setCpuFrequencyMhz(cpuFrequencyMhz);
+    LatencyHistogram::setCpuMhz(getCpuFrequencyMhz());
+    WiFi.setSleep(false);
+    audioPipelineLock();
+    if (i2sEventQueue) xQueueReset(i2sEventQueue);
+    i2sReadyBytes = 0;
+    clockDriftResetRequested = true;
+    i2s_zero_dma_buffer(I2S_NUM_0);
+    i2s_start(I2S_NUM_0);
+    updateHighpassCoeffs();                 // no filter history from before the pause
+    audioFadeReset();
+    captureStateResetRequested = true;
+    powerIdle = false;
+    audioPipelineUnlock();
+    logPrintf("Power schedule: capture window - streaming resumed at %u MHz", (unsigned)getCpuFrequencyMhz());
+}
+
+// Once a second from loop(): energy accounting and window edges. Without a
+// valid clock the device keeps streaming, so a lost NTP server never mutes it.
+void servicePowerSchedule() {
+    const unsigned long now = millis();
+    if (powerLastTickMs == 0) powerLastTickMs = now;
+    const unsigned long dt = now - powerLastTickMs;
+    if (dt < 1000) return;
+    powerLastTickMs = now;
+    if (powerIdle) powerIdleMs += dt;
+    else powerActiveMs += dt;
+    powerChargeMas += (double)powerEstimateMa() * (double)dt / 1000.0;
+
+    uint32_t second = 0, ahead = 0;
+    const bool clockOk = powerLocalSecond(0, second) && powerLocalSecond(POWER_WARMUP_S, ahead);
+    if (!powerScheduleEnabled || powerSchedule.count() == 0 || !clockOk) {
+        powerNextChangeS = 0;
+        if (powerIdle) powerExitIdle();
+        return;
+    }
+    const uint16_t minute = (uint16_t)(second / 60);
+    powerNextChangeS = (uint32_t)powerSchedule.minutesUntilChange(minute) * 60UL - second % 60;
+    // Wake POWER_WARMUP_S before a window opens; sleep when it closes
+    const bool wanted = powerSchedule.active(minute) || powerSchedule.active((uint16_t)(ahead / 60));
+    if (wanted && powerIdle) powerExitIdle();
+    else if (!wanted && !powerIdle) powerEnterIdle();
+}
+
+bool setPowerWindows(const char* spec) {
+    PowerSchedule parsed;
+    if (!parsed.parse(spec)) return false;
+    powerSchedule = parsed;
+    return true;
+}
+
+// POSIX TZ for the schedule; false on an empty or oversized string
+bool setPowerTimezone(const char* tz) {
+    const size_t n = strlen(tz);
+    if (n == 0 || n >= sizeof(powerTimezone)) return false;
+    for (size_t i = 0; i < n; ++i) if (tz[i] <= ' ' || tz[i] > '~') return false;
+    memcpy(powerTimezone, tz, n + 1);
+    setenv("TZ", powerTimezone, 1);
+    tzset();
+    return true;
+}
+
+bool recordSupported() {
+    return HAS_SD_RECORDER;
+}
+
+const char* recordModeName(uint8_t mode) {
+    return mode == RECORD_MODE_OUTAGE ? "outage" : (mode == RECORD_MODE_ALWAYS ? "always" : "off");
+}
+
+const char* recordStateName() {
+    if (recordMode == RECORD_MODE_OFF) return "off";
+    if (!recordStage.active() || !recordChunk) return "no_psram";
+    if (!recordCardOk) return "no_card";
+    return recordFile ? "recording" : "standby";
+}
+
+// Ring budget: the recMaxMb setting, at most 90% of the card
+uint64_t recordBudgetBytes() {
+    const uint64_t card = recordCardBytes / 10 * 9;
+    const uint64_t want = (uint64_t)recordMaxMb << 20;
+    return (recordMaxMb && want < card) ? want : card;
+}
+
+size_t recordPath(char* out, size_t n, uint32_t seq, uint32_t startUtc) {
+    char name[RECORD_NAME_MAX];
+    rec_formatName(name, sizeof(name), seq, startUtc);
+    int w = snprintf(out, n, RECORD_DIR "/%s", name);
+    return (w < 0) ? 0 : ((size_t)w < n ? (size_t)w : n - 1);
+}
+
+// Caller holds recordMutex
+bool recordSegmentOpen(uint32_t seq) {
+    return recordFile && recordFileSeq == seq;
+}
+
+// Mount the card and rebuild the segment table from the file names. A power
+// loss leaves the newest header claiming fewer samples than the file holds.
+static bool recordMount() {
+#if HAS_SD_RECORDER
+    SPI.begin(SD_SCK_PIN, SD_MISO_PIN, SD_MOSI_PIN, SD_CS_PIN);
+    if (!SD.begin(SD_CS_PIN, SPI, RECORD_SD_HZ) || SD.cardType() == CARD_NONE) {
+        SD.end();
+        return false;
+    }
+    recordCardBytes = SD.totalBytes();
+    if (!SD.exists(RECORD_DIR)) SD.mkdir(RECORD_DIR);
+    recordRing.clear();
+    File dir = SD.open(RECORD_DIR);
+    for (File f = dir.openNextFile(); f; f = dir.openNextFile()) {
+        uint32_t seq, utc;
+        if (!f.isDirectory() && rec_parseName(f.name(), seq, utc)) recordRing.insert({ seq, utc, (uint32_t)f.size() });
+        f.close();
+    }
+    dir.close();
+    if (recordRing.size()) {
+        const RecordSegment last = recordRing.newest();
+        char path[48];
+        recordPath(path, sizeof(path), last.seq, last.startUtc);
+        File f = SD.open(path, "r+");
+        uint8_t* hdr = (uint8_t*)recordChunk;
+        uint32_t claimed = 0;
+        const uint32_t held = (last.bytes > RECORD_HEADER_BYTES) ? (last.bytes - RECORD_HEADER_BYTES) & ~1u : 0;
+        if (f && f.read(hdr, RECORD_HEADER_BYTES) == RECORD_HEADER_BYTES && rec_readWavDataBytes(hdr, claimed) && claimed != held) {
+            rec_patchWavSizes(hdr, held);
+            f.seek(0);
+            f.write(hdr, RECORD_HEADER_BYTES);
+            logPrintf("Recording: repaired header of %s", path + sizeof(RECORD_DIR));
+        }
+        if (f) f.close();
+    }
+    if (recordNextSeq < recordRing.nextSeq()) recordNextSeq = recordRing.nextSeq();
+    logPrintf("Recording: SD card %u MB, %u segments (%u MB) kept", (unsigned)(recordCardBytes >> 20),
+              (unsigned)recordRing.size(), (unsigned)(recordRing.totalBytes() >> 20));
+    return true;
+#else
+    return false;
+#endif
+}
+
+// Final sizes into the header and close
+static void recordCloseSegment() {
+    if (!recordFile) return;
+    uint8_t* hdr = (uint8_t*)recordChunk;
+    rec_writeWavHeader(hdr, recordFileRate, 1, recordFileData);
+    recordFile.seek(0);
+    recordFile.write(hdr, RECORD_HEADER_BYTES);
+    recordFile.close();
+}
+
+static void recordCardFailed(const char* what) {
+    logPrintf("Recording: SD %s failed - card removed or full? Retrying in %u s", what, (unsigned)(RECORD_MOUNT_RETRY_MS / 1000));
+    if (recordFile) recordFile.close();
+    recordContinuous = false;
+    recordCardOk = false;
+    recordMountAtMs = millis() + RECORD_MOUNT_RETRY_MS;
+#if HAS_SD_RECORDER
+    SD.end();
+#endif
+}
+
+// New segment from recordWritePos: evict the oldest files until a full one
+// fits the budget, then a header with no samples yet
+static bool recordOpenSegment(uint32_t head) {
+    const uint32_t rate = currentSampleRate;
+    const uint32_t lead = (head - recordWritePos) / rate;
+    const time_t now = time(nullptr);
+    const uint32_t utc = powerTimeValid() ? (uint32_t)now - lead : 0;
+    const uint64_t segBytes = RECORD_HEADER_BYTES + (uint64_t)RECORD_SEGMENT_SECONDS * rate * sizeof(int16_t);
+    char path[48];
+    while (recordRing.size() && (recordRing.full() || recordRing.totalBytes() + segBytes > recordBudgetBytes())) {
+        const RecordSegment old = recordRing.oldest();
+        if (old.seq == recordServingSeq) break;   // being downloaded: goes next time
+        recordPath(path, sizeof(path), old.seq, old.startUtc);
+        SD.remove(path);
+        recordRing.popOldest();
+    }
+    if (recordRing.full()) return false;
+    const RecordSegment seg = { recordNextSeq, utc, RECORD_HEADER_BYTES };
+    recordPath(path, sizeof(path), seg.seq, seg.startUtc);
+    recordFile = SD.open(path, FILE_WRITE);
+    if (!recordFile) { recordCardFailed("open"); return false; }
+    uint8_t* hdr = (uint8_t*)recordChunk;
+    rec_writeWavHeader(hdr, rate, 1, 0);
+    if (recordFile.write(hdr, RECORD_HEADER_BYTES) != RECORD_HEADER_BYTES) { recordCardFailed("write"); return false; }
+    recordRing.insert(seg);
+    recordNextSeq++;
+    recordFileSeq = seg.seq;
+    recordFileRate = rate;
+    recordFileData = 0;
+    recordSegmentsTotal++;
+    if (!recordContinuous) logPrintf("Recording: %s started (%u s lead-in)", path + sizeof(RECORD_DIR), (unsigned)lead);
+    return true;
+}
+
+// One step of the writer: open, extend, rotate or close the segment. True
+// when more staged audio is waiting. Caller holds recordMutex.
+static bool recordService() {
+    if (!recordStage.active() || !recordChunk) return false;
+    if (!recordCardOk) {
+        if ((long)(millis() - recordMountAtMs) < 0) return false;
+        recordCardOk = recordMount();
+        if (!recordCardOk) {
+            recordMountAtMs = millis() + RECORD_MOUNT_RETRY_MS;
+            return false;
+        }
+    }
+    const bool want = !powerIdle && (recordMode == RECORD_MODE_ALWAYS || recordLinkDown
+                                     || (long)(recordTailUntilMs - millis()) > 0);
+    const uint32_t head = recordStage.head();
+    const uint32_t oldest = recordStage.oldest();
+    if (recordFile) {
+        // Staged audio lost (card too slow) or a new stream format: the segment ends there
+        if ((int32_t)(recordWritePos - oldest) < 0) {
+            recordLostSamples += oldest - recordWritePos;
+            logPrintf("Recording: %u ms gap in the staged audio", (unsigned)((uint64_t)(oldest - recordWritePos) * 1000 / recordFileRate));
+            recordCloseSegment();
+            recordContinuous = false;
+            return true;
+        }
+        if (currentSampleRate != recordFileRate) {
+            recordCloseSegment();
+            recordWritePos = head;   // what is staged may be either rate
+            recordContinuous = true;
+            return true;
+        }
+        if (powerIdle) {
+            recordCloseSegment();
+            recordContinuous = false;
+            return true;
+        }
+    }
+    if (!recordFile) {
+        if (!want) { recordContinuous = false; return false; }
+        if (!recordContinuous || (int32_t)(recordWritePos - oldest) < 0) recordWritePos = oldest;
+        if (head == recordWritePos) return false;
+        if (!recordOpenSegment(head)) return false;
+    }
+
+    const uint32_t segSamples = (uint32_t)RECORD_SEGMENT_SECONDS * recordFileRate;
+    const uint32_t room = segSamples - recordFileData / sizeof(int16_t);
+    const uint32_t avail = head - recordWritePos;
+    const bool last = !want && avail <= RECORD_CHUNK_SAMPLES;
+    uint32_t n = (avail < RECORD_CHUNK_SAMPLES) ? avail : RECORD_CHUNK_SAMPLES;
+    if (n > room) n = room;
+    if (n < RECORD_CHUNK_SAMPLES && n < room && !last) return false;   // whole chunks only
+    if (n) {
+        if (!recordStage.read(recordWritePos, recordChunk, n)) return true;   // lapped meanwhile
+        const uint32_t t0 = micros();
+        const size_t bytes = (size_t)n * sizeof(int16_t);
+        if (recordFile.write((const uint8_t*)recordChunk, bytes) != bytes) { recordCardFailed("write"); return false; }
+        const uint32_t us = micros() - t0;
+        if (us > recordWriteUsMax) recordWriteUsMax = us;
+        recordWritePos += n;
+        recordFileData += (uint32_t)bytes;
+        recordBytesTotal += bytes;
+        recordRing.setBytes((uint16_t)(recordRing.size() - 1), RECORD_HEADER_BYTES + recordFileData);
+    }
+    if (recordFileData >= segSamples * sizeof(int16_t)) {
+        recordCloseSegment();
+        recordContinuous = want;   // rotation: the next file starts at the next sample
+        return true;
+    }
+    if (last) {
+        recordCloseSegment();
+        recordContinuous = false;
+        logPrintf("Recording: stopped, %u segments on the card", (unsigned)recordRing.size());
+        return false;
+    }
+    return head - recordWritePos >= RECORD_CHUNK_SAMPLES;
+}
+
+void recordTask(void* arg) {
+    for (;;) {
+        xSemaphoreTake(recordMutex, portMAX_DELAY);
+        const bool more = recordService();
+        xSemaphoreGive(recordMutex);
+        vTaskDelay(more ? 1 : pdMS_TO_TICKS(50));
+    }
+}
+
+// Staging, write buffer and writer task for recordMode (loop() context). The
+// card is mounted by the task, so a slow or missing card never delays boot.
+void recordConfigure() {
+    if (!recordMutex) recordMutex = xSemaphoreCreateMutex();
+    const bool on = HAS_SD_RECORDER && recordMode != RECORD_MODE_OFF;
+    xSemaphoreTake(recordMutex, portMAX_DELAY);
+    if (!on) recordCloseSegment();
+    recordContinuous = false;
+    if (on && !recordStage.active()) {
+        if (!recordChunk && psramFound()) recordChunk = (int16_t*)ps_malloc(RECORD_CHUNK_SAMPLES * sizeof(int16_t));
+        audioPipelineLock();
+        const bool ok = recordChunk && recordStage.begin((uint32_t)RECORD_STAGE_SECONDS * 48000UL);
+        audioPipelineUnlock();
+        if (ok) logPrintf("Recording: %s, %u KB PSRAM staging", recordModeName(recordMode), (unsigned)(recordStage.bytes() / 1024));
+        else simplePrintln("Recording: disabled (needs PSRAM)");
+    } else if (!on && recordStage.active()) {
+        audioPipelineLock();
+        recordStage.end();
+        audioPipelineUnlock();
+    }
+    xSemaphoreGive(recordMutex);
+    if (on && !recordTaskHandle) {
+        xTaskCreatePinnedToCore(recordTask, "rec_sd", RECORD_STACK, nullptr, RECORD_TASK_PRIO, &recordTaskHandle, AUDIO_NET_CORE);
+    }
+}
+
+// Web UI: the staging follows at once; buffers are resized for the stage copy
+bool setRecordMode(const char* name) {
+    uint8_t mode;
+    if (strcmp(name, "off") == 0) mode = RECORD_MODE_OFF;
+    else if (strcmp(name, "outage") == 0) mode = RECORD_MODE_OUTAGE;
+    else if (strcmp(name, "always") == 0) mode = RECORD_MODE_ALWAYS;
+    else return false;
+    if (!HAS_SD_RECORDER && mode != RECORD_MODE_OFF) return false;
+    if (mode == recordMode) return true;
+    const bool resize = (mode == RECORD_MODE_OFF) != (recordMode == RECORD_MODE_OFF);
+    recordMode = mode;
+    recordConfigure();
+    if (resize) resizeAudioBuffers();
+    return true;
+}
+
+// Once a second from loop(): Wi-Fi link edges start and end outage recording
+// (checkWiFiHealth() only looks every 30 s)
+void serviceRecorder() {
+    const unsigned long now = millis();
+    if (now - recordLastCheckMs < 1000) return;
+    recordLastCheckMs = now;
+    const bool down = WiFi.status() != WL_CONNECTED;
+    if (down == recordLinkDown) return;
+    recordLinkDown = down;
+    if (!down) recordTailUntilMs = now + RECORD_TAIL_MS;
+    if (recordMode == RECORD_MODE_OUTAGE && recordStage.active()) {
+        if (down) simplePrintln("Recording: Wi-Fi down - writing to SD");
+        else logPrintf("Recording: Wi-Fi back - %u s more on SD", (unsigned)(RECORD_TAIL_MS / 1000));
+    }
+}
+
 // Load settings from flash
 void loadAudioSettings() {
     audioPrefs.begin("audio", false);
     currentSampleRate = audioPrefs.getUInt("sampleRate", DEFAULT_SAMPLE_RATE);
+    captureSampleRate = audioPrefs.getUInt("captureRate", 0);
+    packetTimeMs = audioPrefs.getUChar("ptime", 0);
+    prerollSeconds = audioPrefs.getUShort("prerollSec", 0);
+    if (prerollSeconds > PREROLL_MAX_SECONDS) prerollSeconds = PREROLL_MAX_SECONDS;
     currentGainFactor = audioPrefs.getFloat("gainFactor", DEFAULT_GAIN_FACTOR);
     currentBufferSize = audioPrefs.getUShort("bufferSize", DEFAULT_BUFFER_SIZE);
     // (1) respect compile-time default 12 on first boot
@@ -467,6 +1272,25 @@ void loadAudioSettings() {
     wifiTxPowerDbm = audioPrefs.getFloat("wifiTxDbm", DEFAULT_WIFI_TX_DBM);
     highpassEnabled = audioPrefs.getBool("hpEnable", DEFAULT_HPF_ENABLED);
     highpassCutoffHz = (uint16_t)audioPrefs.getUInt("hpCutoff", DEFAULT_HPF_CUTOFF_HZ);
+    int sections = dsp_parseFilterChain(audioPrefs.getString("filters", "").c_str(), filterSections, DSP_CHAIN_MAX - 1);
+    filterSectionCount = (sections > 0) ? (uint8_t)sections : 0;
+    abrEnabled = audioPrefs.getBool("abrEnable", false);
+    activityGateEnabled = audioPrefs.getBool("actGate", false);
+    activityThresholdDb = audioPrefs.getUChar("actThrDb", 10);
+    activityHangoverSec = audioPrefs.getUShort("actHangSec", 5);
+    if (activityThresholdDb < 3 || activityThresholdDb > 40) activityThresholdDb = 10;
+    if (activityHangoverSec < 1 || activityHangoverSec > 600) activityHangoverSec = 5;
+    uint8_t codecId = audioPrefs.getUChar("codec", CODEC_L16);
+    currentCodec = (codecId < CODEC_COUNT) ? (AudioCodecId)codecId : CODEC_L16;
+    uint8_t mode = audioPrefs.getUChar("micMode", MIC_MODE_MONO);
+    micMode = (mode <= MIC_MODE_BEAM) ? mode : (uint8_t)MIC_MODE_MONO;
+    beamDelaySamples = (int8_t)audioPrefs.getUChar("beamDelay", 0);   // stored as the byte of an int8
+    micModeApplyLimits();
+    uint8_t mel = audioPrefs.getUChar("melMode", MEL_MODE_OFF);
+    melMode = (HAS_MEL_FRONTEND && mel <= MEL_MODE_ONLY) ? mel : (uint8_t)MEL_MODE_OFF;
+    uint8_t rec = audioPrefs.getUChar("recMode", RECORD_MODE_OFF);
+    recordMode = (HAS_SD_RECORDER && rec <= RECORD_MODE_ALWAYS) ? rec : (uint8_t)RECORD_MODE_OFF;
+    recordMaxMb = audioPrefs.getUShort("recMaxMb", 0);
     overheatProtectionEnabled = audioPrefs.getBool("ohEnable", DEFAULT_OVERHEAT_PROTECTION);
     uint32_t ohLimit = audioPrefs.getUInt("ohThresh", DEFAULT_OVERHEAT_LIMIT_C);
     if (ohLimit < OVERHEAT_MIN_LIMIT_C) ohLimit = OVERHEAT_MIN_LIMIT_C;
@@ -477,6 +1301,18 @@ void loadAudioSettings() {
     overheatLastTimestamp = audioPrefs.getString("ohStamp", "");
     overheatTripTemp = audioPrefs.getFloat("ohTripC", 0.0f);
     overheatLatched = audioPrefs.getBool("ohLatched", false);
+    powerScheduleEnabled = audioPrefs.getBool("pwrSched", false);
+    if (!powerSchedule.parse(audioPrefs.getString("pwrWin", POWER_DEFAULT_WINDOWS).c_str())) {
+        powerSchedule.parse(POWER_DEFAULT_WINDOWS);
+    }
+    wifiStaticFromLease = audioPrefs.getBool("wfStaticIp", false);
+    wifiCachedChannel = audioPrefs.getUChar("wfChan", 0);
+    if (audioPrefs.getBytes("wfBssid", wifiCachedBssid, sizeof(wifiCachedBssid)) != sizeof(wifiCachedBssid)
+        || audioPrefs.getBytes("wfLease", wifiCachedLease, sizeof(wifiCachedLease)) != sizeof(wifiCachedLease)) {
+        wifiCachedChannel = 0;
+    }
+    String tz = audioPrefs.getString("tz", "UTC0");
+    if (tz.length() > 0 && tz.length() < sizeof(powerTimezone)) strcpy(powerTimezone, tz.c_str());
     audioPrefs.end();
 
     if (autoThresholdEnabled) {
@@ -487,54 +1323,100 @@ void loadAudioSettings() {
     }
     // Log the configured TX dBm (not the current enum), snapped for clarity
     float txShown = wifiPowerLevelToDbm(pickWifiPowerLevel(wifiTxPowerDbm));
+    char captureText[12], ptimeText[12];
+    if (captureSampleRate) snprintf(captureText, sizeof(captureText), "%u", (unsigned)captureSampleRate);
+    else strcpy(captureText, "auto");
+    if (packetTimeMs) snprintf(ptimeText, sizeof(ptimeText), "%ums", (unsigned)packetTimeMs);
+    else strcpy(ptimeText, "buffer");
 #if defined(MIC_TYPE_PDM)
     // PDM mode: no shift bits
-    simplePrintln("Loaded settings: Rate=" + String(currentSampleRate) +
-                  ", Gain=" + String(currentGainFactor, 1) +
-                  ", Buffer=" + String(currentBufferSize) +
-                  ", WiFiTX=" + String(txShown, 1) + "dBm" +
-                  ", HPF=" + String(highpassEnabled?"on":"off") +
-                  ", HPFcut=" + String(highpassCutoffHz) + "Hz");
+    logPrintf("Loaded settings: Rate=%u, Capture=%s, Gain=%.1f, Buffer=%u, ptime=%s, WiFiTX=%.1fdBm, HPF=%s, HPFcut=%uHz, codec=%s",
+              (unsigned)currentSampleRate, captureText, currentGainFactor, (unsigned)currentBufferSize, ptimeText,
+              txShown, highpassEnabled ? "on" : "off", (unsigned)highpassCutoffHz, codec_name(currentCodec));
 #else
-    simplePrintln("Loaded settings: Rate=" + String(currentSampleRate) +
-                  ", Gain=" + String(currentGainFactor, 1) +
-                  ", Buffer=" + String(currentBufferSize) +
-                  ", WiFiTX=" + String(txShown, 1) + "dBm" +
-                  ", shiftBits=" + String(i2sShiftBits) +
-                  ", HPF=" + String(highpassEnabled?"on":"off") +
-                  ", HPFcut=" + String(highpassCutoffHz) + "Hz");
+    logPrintf("Loaded settings: Rate=%u, Capture=%s, Gain=%.1f, Buffer=%u, ptime=%s, WiFiTX=%.1fdBm, shiftBits=%u, HPF=%s, HPFcut=%uHz, codec=%s",
+              (unsigned)currentSampleRate, captureText, currentGainFactor, (unsigned)currentBufferSize, ptimeText,
+              txShown, (unsigned)i2sShiftBits, highpassEnabled ? "on" : "off", (unsigned)highpassCutoffHz, codec_name(currentCodec));
 #endif
 }
 
-// Save settings to flash
+// Mark the settings for the next commit (Web UI, ABR); cheap enough per slider step
 void saveAudioSettings() {
+    const unsigned long now = millis();
+    if (!settingsDirty) settingsFirstChangeMs = now;
+    settingsLastChangeMs = now;
+    settingsDirty = true;
+}
+
+// Write the settings to flash; unchanged keys cost one NVS read, no write
+void commitAudioSettings() {
+    const uint32_t writtenBefore = settingsKeysWritten;
+    settingsDirty = false;
     audioPrefs.begin("audio", false);
-    audioPrefs.putUInt("sampleRate", currentSampleRate);
-    audioPrefs.putFloat("gainFactor", currentGainFactor);
-    audioPrefs.putUShort("bufferSize", currentBufferSize);
-    audioPrefs.putUChar("shiftBits", i2sShiftBits);
-    audioPrefs.putBool("autoRecovery", autoRecoveryEnabled);
-    audioPrefs.putBool("schedReset", scheduledResetEnabled);
-    audioPrefs.putUInt("resetHours", resetIntervalHours);
-    audioPrefs.putUInt("minRate", minAcceptableRate);
-    audioPrefs.putUInt("checkInterval", performanceCheckInterval);
-    audioPrefs.putBool("thrAuto", autoThresholdEnabled);
-    audioPrefs.putUChar("cpuFreq", cpuFrequencyMhz);
-    audioPrefs.putFloat("wifiTxDbm", wifiTxPowerDbm);
-    audioPrefs.putBool("hpEnable", highpassEnabled);
-    audioPrefs.putUInt("hpCutoff", (uint32_t)highpassCutoffHz);
-    audioPrefs.putBool("ohEnable", overheatProtectionEnabled);
+    // While degraded the running format is not the setting
+    prefPutUInt("sampleRate", abrLevel ? abrLevels[0].rate : currentSampleRate);
+    prefPutUInt("captureRate", abrLevel ? abrConfiguredCaptureRate : captureSampleRate);
+    prefPutUChar("ptime", packetTimeMs);
+    prefPutUShort("prerollSec", prerollSeconds);
+    prefPutFloat("gainFactor", currentGainFactor);
+    prefPutUShort("bufferSize", currentBufferSize);
+    prefPutUChar("shiftBits", i2sShiftBits);
+    prefPutBool("autoRecovery", autoRecoveryEnabled);
+    prefPutBool("schedReset", scheduledResetEnabled);
+    prefPutUInt("resetHours", resetIntervalHours);
+    prefPutUInt("minRate", minAcceptableRate);
+    prefPutUInt("checkInterval", performanceCheckInterval);
+    prefPutBool("thrAuto", autoThresholdEnabled);
+    prefPutUChar("cpuFreq", cpuFrequencyMhz);
+    prefPutFloat("wifiTxDbm", wifiTxPowerDbm);
+    prefPutBool("hpEnable", highpassEnabled);
+    prefPutUInt("hpCutoff", (uint32_t)highpassCutoffHz);
+    char filterSpec[DSP_CHAIN_SPEC_MAX];
+    dsp_formatFilterChain(filterSections, filterSectionCount, filterSpec, sizeof(filterSpec));
+    prefPutString("filters", filterSpec);
+    prefPutUChar("codec", (uint8_t)(abrLevel ? abrLevels[0].codec : currentCodec));
+    prefPutUChar("micMode", (uint8_t)micMode);
+    prefPutUChar("beamDelay", (uint8_t)beamDelaySamples);
+    prefPutUChar("melMode", melMode);
+    prefPutUChar("recMode", recordMode);
+    prefPutUShort("recMaxMb", recordMaxMb);
+    prefPutBool("abrEnable", abrEnabled);
+    prefPutBool("actGate", activityGateEnabled);
+    prefPutUChar("actThrDb", activityThresholdDb);
+    prefPutUShort("actHangSec", activityHangoverSec);
+    prefPutBool("ohEnable", overheatProtectionEnabled);
     uint32_t ohLimit = (uint32_t)(overheatShutdownC + 0.5f);
     if (ohLimit < OVERHEAT_MIN_LIMIT_C) ohLimit = OVERHEAT_MIN_LIMIT_C;
     if (ohLimit > OVERHEAT_MAX_LIMIT_C) ohLimit = OVERHEAT_MAX_LIMIT_C;
-    audioPrefs.putUInt("ohThresh", ohLimit);
-    audioPrefs.putString("ohReason", overheatLastReason);
-    audioPrefs.putString("ohStamp", overheatLastTimestamp);
-    audioPrefs.putFloat("ohTripC", overheatTripTemp);
-    audioPrefs.putBool("ohLatched", overheatLatched);
+    prefPutUInt("ohThresh", ohLimit);
+    prefPutString("ohReason", overheatLastReason.c_str());
+    prefPutString("ohStamp", overheatLastTimestamp.c_str());
+    prefPutFloat("ohTripC", overheatTripTemp);
+    prefPutBool("ohLatched", overheatLatched);
+    prefPutBool("pwrSched", powerScheduleEnabled);
+    char windows[POWER_SPEC_MAX];
+    powerSchedule.format(windows, sizeof(windows));
+    prefPutString("pwrWin", windows);
+    prefPutString("tz", powerTimezone);
+    prefPutBool("wfStaticIp", wifiStaticFromLease);
     audioPrefs.end();
+    settingsCommits++;
+
+    logPrintf("Settings saved to flash (%u key(s) changed)", (unsigned)(settingsKeysWritten - writtenBefore));
+}
+
+// Deferred commit from loop(): after SETTINGS_COMMIT_DELAY_MS without edits
+void serviceSettingsCommit() {
+    if (!settingsDirty) return;
+    const unsigned long now = millis();
+    if (now - settingsLastChangeMs >= SETTINGS_COMMIT_DELAY_MS || now - settingsFirstChangeMs >= SETTINGS_COMMIT_MAX_MS) {
+        commitAudioSettings();
+    }
+}
 
-    simplePrintln("Settings saved to flash");
+// Before a restart: pending edits must not be lost
+void flushAudioSettings() {
+    if (settingsDirty) commitAudioSettings();
 }
 
 // Schedule a safe reboot (optionally with factory reset) after delayMs
@@ -543,10 +1425,98 @@ void scheduleReboot(bool factoryReset, uint32_t delayMs) {
     scheduledRebootAt = millis() + delayMs;
 }
 
+// Channels in the RTP stream and I2S slots read per frame
+uint8_t streamChannels() {
+    return (micMode == MIC_MODE_STEREO) ? 2 : 1;
+}
+
+uint8_t i2sSlots() {
+    return (micMode == MIC_MODE_MONO) ? 1 : 2;
+}
+
+const char* micModeName(uint8_t mode) {
+    return mode == MIC_MODE_STEREO ? "stereo" : (mode == MIC_MODE_BEAM ? "beam" : "mono");
+}
+
+// Stereo is a plain L16/2 tap of both slots: the single-channel stages (SRC,
+// pre-roll, ptime slicing, activity gate, codecs, ABR) are off while it runs
+void micModeApplyLimits() {
+#if defined(MIC_TYPE_PDM)
+    micMode = MIC_MODE_MONO;         // one PDM mic on the data line
+#endif
+    if (beamDelaySamples > DSP_BEAM_MAX_DELAY) beamDelaySamples = DSP_BEAM_MAX_DELAY;
+    if (beamDelaySamples < -DSP_BEAM_MAX_DELAY) beamDelaySamples = -DSP_BEAM_MAX_DELAY;
+    beamformer.delay = beamDelaySamples;
+    if (micMode != MIC_MODE_STEREO) return;
+    abrRestoreConfigured();
+    abrEnabled = false;
+    currentCodec = CODEC_L16;
+    activityGateEnabled = false;
+}
+
+// Web UI: new slot format and SDP channel count, so the streams restart
+bool setMicMode(const char* name) {
+    uint8_t mode;
+    if (strcmp(name, "mono") == 0) mode = MIC_MODE_MONO;
+    else if (strcmp(name, "stereo") == 0) mode = MIC_MODE_STEREO;
+    else if (strcmp(name, "beam") == 0) mode = MIC_MODE_BEAM;
+    else return false;
+#if defined(MIC_TYPE_PDM)
+    if (mode != MIC_MODE_MONO) return false;
+#endif
+    if (mode == micMode) return true;
+    micMode = mode;
+    micModeApplyLimits();
+    restartI2S();
+    return true;
+}
+
+// Steering delay of the delay-and-sum pair, from the next block on
+void setBeamDelay(int samples) {
+    audioPipelineLock();
+    beamDelaySamples = (int8_t)samples;
+    micModeApplyLimits();
+    audioPipelineUnlock();
+}
+
+bool melSupported() {
+    return HAS_MEL_FRONTEND;
+}
+
+const char* melModeName(uint8_t mode) {
+    return mode == MEL_MODE_ON ? "on" : (mode == MEL_MODE_ONLY ? "only" : "off");
+}
+
+// Web UI: frames from the next block on, without touching the streams;
+// "only" ends the RTSP sessions and refuses new ones
+bool setMelMode(const char* name) {
+    uint8_t mode;
+    if (strcmp(name, "off") == 0) mode = MEL_MODE_OFF;
+    else if (strcmp(name, "on") == 0) mode = MEL_MODE_ON;
+    else if (strcmp(name, "only") == 0) mode = MEL_MODE_ONLY;
+    else return false;
+    if (!HAS_MEL_FRONTEND && mode != MEL_MODE_OFF) return false;
+    if (mode == melMode) return true;
+    const bool resize = (mode == MEL_MODE_OFF) != (melMode == MEL_MODE_OFF);
+    melMode = mode;
+    if (melMode == MEL_MODE_ONLY) rtspStopAllStreams();
+    if (resize) resizeAudioBuffers();
+    return true;
+}
+
+// Frames per RTP packet for the configured ptime (whole buffer when 0)
+uint16_t rtpPacketSamples() {
+    if (packetTimeMs == 0 || micMode == MIC_MODE_STEREO) return currentBufferSize;
+    uint32_t n = currentSampleRate * (uint32_t)packetTimeMs / 1000UL;
+    if (n < 16) n = 16;
+    if (n > currentBufferSize) n = currentBufferSize;
+    return (uint16_t)n;
+}
+
 // Compute recommended minimum packet-rate threshold based on current sample rate and buffer size
 uint32_t computeRecommendedMinRate() {
-    uint32_t buf = max((uint16_t)1, currentBufferSize);
-    float expectedPktPerSec = (float)currentSampleRate / (float)buf;
+    uint32_t pkt = max((uint16_t)1, rtpPacketSamples());
+    float expectedPktPerSec = (float)currentSampleRate / (float)pkt;
     uint32_t rec = (uint32_t)(expectedPktPerSec * 0.7f + 0.5f); // 70% safety margin
     if (rec < 5) rec = 5;
     return rec;
@@ -563,6 +1533,9 @@ void resetToDefaultSettings() {
 
     // Reset runtime variables to defaults
     currentSampleRate = DEFAULT_SAMPLE_RATE;
+    captureSampleRate = 0;
+    packetTimeMs = 0;
+    prerollSeconds = 0;
     currentGainFactor = DEFAULT_GAIN_FACTOR;
     currentBufferSize = DEFAULT_BUFFER_SIZE;
     i2sShiftBits = 12;  // compile-time default respected
@@ -577,6 +1550,18 @@ void resetToDefaultSettings() {
     wifiTxPowerDbm = DEFAULT_WIFI_TX_DBM;
     highpassEnabled = DEFAULT_HPF_ENABLED;
     highpassCutoffHz = DEFAULT_HPF_CUTOFF_HZ;
+    filterSectionCount = 0;
+    currentCodec = CODEC_L16;
+    micMode = MIC_MODE_MONO;
+    beamDelaySamples = 0;
+    melMode = MEL_MODE_OFF;
+    recordMode = RECORD_MODE_OFF;
+    recordMaxMb = 0;
+    abrEnabled = false;
+    abrLevel = 0;
+    activityGateEnabled = false;
+    activityThresholdDb = 10;
+    activityHangoverSec = 5;
     overheatProtectionEnabled = DEFAULT_OVERHEAT_PROTECTION;
     overheatShutdownC = (float)DEFAULT_OVERHEAT_LIMIT_C;
     overheatLockoutActive = false;
@@ -588,80 +1573,371 @@ void resetToDefaultSettings() {
     overheatLatched = false;
     lastTemperatureC = 0.0f;
     lastTemperatureValid = false;
+    powerScheduleEnabled = false;
+    powerSchedule.parse(POWER_DEFAULT_WINDOWS);
+    strcpy(powerTimezone, "UTC0");
+    wifiStaticFromLease = false;
 
-    isStreaming = false;
+    rtspStopAllStreams();
 
-    saveAudioSettings();
+    commitAudioSettings();
 
     simplePrintln("Defaults applied. Device will reboot.");
 }
 
-// Restart I2S with new parameters
-void restartI2S() {
-    simplePrintln("Restarting I2S with new parameters...");
-    isStreaming = false;
+// Pick the I2S rate and block length for the stream rate; falls back to
+// capturing at the stream rate when the ratio is not supported
+void configureSampleRateConverter() {
+    uint32_t capture = captureSampleRate ? captureSampleRate : currentSampleRate;
+    i2sCaptureRate = currentSampleRate;
+    captureBlockSamples = currentBufferSize;
+    resampler.end();
+    srcCyclesPerSample = 0.0f;
+    if (capture == currentSampleRate) return;
+    if (micMode == MIC_MODE_STEREO) {
+        logPrintf("SRC: not used in stereo, capturing at %u Hz", (unsigned)currentSampleRate);
+        return;
+    }
 
-#if defined(MIC_TYPE_PDM)
-    // PDM mode: only 16-bit buffer needed
-    if (i2s_16bit_buffer) { free(i2s_16bit_buffer); i2s_16bit_buffer = nullptr; }
+    uint32_t inLen = (uint32_t)currentBufferSize * capture / currentSampleRate;
+    bool exact = ((uint64_t)inLen * currentSampleRate == (uint64_t)currentBufferSize * capture);
+    if (!exact || inLen > 16384 || !resampler.begin(capture, currentSampleRate, (int)inLen)) {
+        resampler.end();
+        logPrintf("SRC: %u->%u Hz not supported with buffer %u, capturing at stream rate",
+                  (unsigned)capture, (unsigned)currentSampleRate, (unsigned)currentBufferSize);
+        return;
+    }
+    i2sCaptureRate = capture;
+    captureBlockSamples = (uint16_t)inLen;
+    logPrintf("SRC: capture %u Hz -> stream %u Hz (L/M %u/%u, %u taps/phase)", (unsigned)capture, (unsigned)currentSampleRate,
+              (unsigned)resampler.up(), (unsigned)resampler.down(), (unsigned)resampler.taps());
+}
 
-    i2s_16bit_buffer = (int16_t*)malloc(currentBufferSize * sizeof(int16_t));
-    if (!i2s_16bit_buffer) {
-        simplePrintln("FATAL: Memory allocation failed after parameter change!");
-        ESP.restart();
+// Size the PSRAM pre-roll for prerollSeconds at the stream rate. Kept across
+// restartI2S() when neither changes, so the history survives reconfiguration.
+void configurePreroll(uint16_t packetSamples) {
+    if (prerollReplayBlock.packet) { free(prerollReplayBlock.packet); prerollReplayBlock.packet = nullptr; }
+    uint32_t want = (micMode == MIC_MODE_STEREO) ? 0 : (uint32_t)prerollSeconds * currentSampleRate;
+    if (want && psramFound()) {
+        uint32_t freePsram = ESP.getFreePsram() + (uint32_t)preroll.bytes();
+        uint32_t maxSamples = (freePsram > PREROLL_PSRAM_RESERVE) ? (freePsram - PREROLL_PSRAM_RESERVE) / sizeof(int16_t) : 0;
+        if (want > maxSamples) want = maxSamples;
+    } else {
+        want = 0;
+    }
+    if (want != preroll.capacity() || prerollConfigRate != currentSampleRate) {
+        preroll.end();
+        prerollConfigRate = currentSampleRate;
+        if (want && preroll.begin(want)) {
+            logPrintf("Pre-roll: %u s (%u KB PSRAM)", (unsigned)(want / currentSampleRate), (unsigned)(preroll.bytes() / 1024));
+        } else if (prerollSeconds) {
+            simplePrintln(micMode == MIC_MODE_STEREO ? "Pre-roll: off in stereo" : "Pre-roll: disabled (needs PSRAM)");
+        }
+        for (int i = 0; i < PREROLL_RESUME_SLOTS; ++i) prerollResume[i].valid = false;
     }
+    if (preroll.active()) {
+        prerollReplayBlock.packet = (uint8_t*)malloc(AUDIO_BLOCK_HEADROOM + (size_t)packetSamples * sizeof(int16_t));
+        prerollReplayBlock.samples = (int16_t*)(prerollReplayBlock.packet + AUDIO_BLOCK_HEADROOM);
+    }
+}
+
+// (Re)allocate the I2S read buffer and the PCM block ring for currentBufferSize
+bool allocateAudioBuffers() {
+    configureSampleRateConverter();
+    // 16-bit staging: PDM read/drain buffer, and the DSP output ahead of the SRC
+    if (i2s_16bit_buffer) { free(i2s_16bit_buffer); i2s_16bit_buffer = nullptr; }
+#if defined(MIC_TYPE_PDM)
+    i2s_16bit_buffer = (int16_t*)malloc(captureBlockSamples * sizeof(int16_t));
+    bool rawOk = (i2s_16bit_buffer != nullptr);
 #else
-    // Standard I2S: both 32-bit and 16-bit buffers
+    // Standard I2S: 32-bit read buffer, converted into 16-bit ring blocks
     if (i2s_32bit_buffer) { free(i2s_32bit_buffer); i2s_32bit_buffer = nullptr; }
-    if (i2s_16bit_buffer) { free(i2s_16bit_buffer); i2s_16bit_buffer = nullptr; }
+    i2s_32bit_buffer = (int32_t*)malloc(captureBlockSamples * sizeof(int32_t) * i2sSlots());
+    bool rawOk = (i2s_32bit_buffer != nullptr);
+    // Two mics: planar slots, and for stereo the two processed planes
+    if (micPlanarBuffer) { free(micPlanarBuffer); micPlanarBuffer = nullptr; }
+    if (micStereoBuffer) { free(micStereoBuffer); micStereoBuffer = nullptr; }
+    if (micMode != MIC_MODE_MONO) {
+        micPlanarBuffer = (int32_t*)malloc(captureBlockSamples * 2 * sizeof(int32_t));
+        rawOk = rawOk && (micPlanarBuffer != nullptr);
+    }
+    if (micMode == MIC_MODE_STEREO) {
+        micStereoBuffer = (int16_t*)malloc(captureBlockSamples * 2 * sizeof(int16_t));
+        rawOk = rawOk && (micStereoBuffer != nullptr);
+    }
+    if (resampler.active()) {
+        i2s_16bit_buffer = (int16_t*)malloc(captureBlockSamples * sizeof(int16_t));
+        rawOk = rawOk && (i2s_16bit_buffer != nullptr);
+    }
+#endif
+
+    // Second DSP output for live-change crossfades; without it changes just step
+    if (crossfadeBuffer) { free(crossfadeBuffer); crossfadeBuffer = nullptr; }
+    crossfadeBuffer = (int16_t*)malloc(captureBlockSamples * sizeof(int16_t));
+
+    // Mel frames at the stream rate; without the memory the mode just stays idle
+    melSpectrum.end();
+    if (melMode != MEL_MODE_OFF && !melSpectrum.begin(currentSampleRate, MEL_BANDS, MEL_MIN_HZ, MEL_MAX_HZ)) {
+        simplePrintln("Mel frames: not enough memory - disabled");
+    }
+
+    // ptime slicing: stage the whole buffer, ring holds AUDIO_RING_SLOTS buffers of packets.
+    // The pre-roll, the mel frames and the recorder also need the stage while nobody is streaming.
+    if (streamStageBuffer) { free(streamStageBuffer); streamStageBuffer = nullptr; }
+    uint16_t packetSamples = rtpPacketSamples();
+    configurePreroll(packetSamples);
+    uint32_t slots = AUDIO_RING_SLOTS;
+    if (packetSamples < currentBufferSize || preroll.active() || melSpectrum.active() || recordStage.active()) {
+        streamStageBuffer = (int16_t*)malloc(currentBufferSize * sizeof(int16_t));
+        rawOk = rawOk && (streamStageBuffer != nullptr);
+    }
+    if (sliceCarryBuffer) { free(sliceCarryBuffer); sliceCarryBuffer = nullptr; }
+    sliceCarryCount = 0;
+    if (packetSamples < currentBufferSize) {
+        uint32_t perBuffer = (currentBufferSize + packetSamples - 1) / packetSamples;
+        slots = AUDIO_RING_SLOTS * perBuffer;
+        if (slots > AudioBlockRing::MAX_SLOTS) slots = AudioBlockRing::MAX_SLOTS;
+        sliceCarryBuffer = (int16_t*)malloc(packetSamples * sizeof(int16_t));   // slicing is mono only
+        rawOk = rawOk && (sliceCarryBuffer != nullptr);
+    }
+    return rawOk && audioRing.begin((uint8_t)slots, packetSamples * streamChannels());
+}
+
+// Park capture and network tasks at a block boundary (caller: loop()/Web UI context)
+void audioPipelineLock() {
+    audioPipelinePaused = true;
+    if (captureMutex) xSemaphoreTake(captureMutex, portMAX_DELAY);
+    if (netAudioMutex) xSemaphoreTake(netAudioMutex, portMAX_DELAY);
+}
+
+void audioPipelineUnlock() {
+    if (netAudioMutex) xSemaphoreGive(netAudioMutex);
+    if (captureMutex) xSemaphoreGive(captureMutex);
+    audioPipelinePaused = false;
+}
+
+// The block that follows runs the outgoing parameters too and crossfades
+// (after a restart: nothing to fade from)
+void audioFadeReset() {
+    audioFadeFrom.gain = currentGainFactor;
+    audioFadeFrom.shift = i2sShiftBits;
+    audioFadeFrom.hpfOn = highpassEnabled;
+    audioFadeFrom.filtersPending = false;
+    micRightHpf.reset();
+    micRightChain.reset();
+    beamformer.reset();
+}
+
+// New HPF / chain coefficients, keeping the filter memory so the running audio
+// does not restart from silence; the old set is kept for the crossfade.
+// Capture task, or with the audio pipeline locked.
+void redesignAudioFilters() {
+    if (!audioFadeFrom.filtersPending) {   // still fading from an older set: keep that one
+#if DSP_FIXED_POINT
+        audioFadeFrom.hpf = hpfQ;
+        audioFadeFrom.chain = filterChainQ;
+#else
+        audioFadeFrom.hpf = hpf;
+        audioFadeFrom.chain = filterChain;
+#endif
+        audioFadeFrom.filtersPending = true;
+    }
+    updateHighpassCoeffs();
+#if DSP_FIXED_POINT
+    hpfQ.copyState(audioFadeFrom.hpf);
+    filterChainQ.copyState(audioFadeFrom.chain);
+#else
+    hpf.copyState(audioFadeFrom.hpf);
+    filterChain.copyState(audioFadeFrom.chain);
+#endif
+}
+
+// HPF or cutoff edits from the Web UI without racing the capture task
+void retuneAudioFilters() {
+    audioPipelineLock();
+    redesignAudioFilters();
+    audioPipelineUnlock();
+}
+
+// Replace the user filter sections; false (nothing changed) on a bad spec
+bool setFilterChain(const char* spec) {
+    FilterSpec parsed[DSP_CHAIN_MAX - 1];
+    int count = dsp_parseFilterChain(spec, parsed, DSP_CHAIN_MAX - 1);
+    if (count < 0) return false;
+    audioPipelineLock();
+    memcpy(filterSections, parsed, sizeof(parsed));
+    filterSectionCount = (uint8_t)count;
+    redesignAudioFilters();
+    audioPipelineUnlock();
+    return true;
+}
+
+// Restart I2S with new parameters
+uint32_t i2sRestartCount = 0;
+
+// Detector parameters follow the stream rate and the settings (Web UI
+// context: the capture task runs the detector, so it is parked meanwhile)
+void activityConfigure() {
+    audioPipelineLock();
+    activityDetector.configure(currentSampleRate, (float)activityThresholdDb, (uint32_t)activityHangoverSec * 1000UL);
+    activityDetector.reset();
+    audioPipelineUnlock();
+}
+
+// Payload type of comfort-noise packets (SDP and RTP)
+uint8_t activityCnPayloadType() {
+    return (currentSampleRate == 8000) ? 13 : ACTIVITY_CN_PAYLOAD_TYPE;
+}
 
-    i2s_32bit_buffer = (int32_t*)malloc(currentBufferSize * sizeof(int32_t));
-    i2s_16bit_buffer = (int16_t*)malloc(currentBufferSize * sizeof(int16_t));
-    if (!i2s_32bit_buffer || !i2s_16bit_buffer) {
+// Per-hour active time (capture task): slots are hours since boot
+static void activityAccount(uint32_t samples, bool active) {
+    const uint32_t hour = millis() / 3600000UL;
+    if (hour != activityHour) {
+        // Clear the slots of the hours that started since the last buffer
+        uint32_t gap = hour - activityHour;
+        if (gap > ACTIVITY_HOURS) gap = ACTIVITY_HOURS;
+        for (uint32_t i = 0; i < gap; ++i) {
+            ActivityHour &h = activityHours[(hour - i) % ACTIVITY_HOURS];
+            h.activeSamples = 0;
+            h.totalSamples = 0;
+        }
+        activityHour = hour;
+    }
+    ActivityHour &h = activityHours[hour % ACTIVITY_HOURS];
+    h.totalSamples += samples;
+    if (active) {
+        h.activeSamples += samples;
+        activityActiveSamplesTotal += samples;
+    }
+}
+
+void restartI2S() {
+    simplePrintln("Restarting I2S with new parameters...");
+    i2sRestartCount++;
+    rtspStopAllStreams();
+
+    audioPipelineLock();
+    if (!allocateAudioBuffers()) {
         simplePrintln("FATAL: Memory allocation failed after parameter change!");
         ESP.restart();
     }
-#endif
 
     setup_i2s_driver();
+    if (powerIdle) i2s_stop(I2S_NUM_0);   // reinstalled driver starts running
     // Refresh HPF with current parameters
     updateHighpassCoeffs();
+    audioFadeReset();
+    audioPipelineUnlock();
+    if (abrLevel == 0) abrBuildLadder();   // settings may have changed the base format
+    activityConfigure();
+
     maxPacketRate = 0;
     minPacketRate = 0xFFFFFFFF;
     simplePrintln("I2S restarted successfully");
 }
 
+// Buffer size, ptime or pre-roll changes: new buffers at a block boundary while
+// the sessions keep playing (stream rate and codec are unchanged, so the SDP
+// still holds). The driver is only reinstalled when the capture rate or the DMA
+// length changes. Audio lost in the pause advances the stream index, so every
+// session's RTP clock jumps with wall time instead of falling behind.
+void resizeAudioBuffers() {
+    const uint32_t prevCaptureRate = i2sCaptureRate;
+    const uint16_t prevDmaLen = i2sDmaBufLen();
+    const uint32_t prevPreroll = preroll.capacity();
+
+    audioPipelineLock();
+    const uint32_t pauseStart = micros();
+    if (!allocateAudioBuffers()) {
+        simplePrintln("FATAL: Memory allocation failed after parameter change!");
+        ESP.restart();
+    }
+    const bool reinstall = (i2sCaptureRate != prevCaptureRate) || (i2sDmaBufLen() != prevDmaLen);
+    if (reinstall) {
+        setup_i2s_driver();
+        if (powerIdle) i2s_stop(I2S_NUM_0);
+        updateHighpassCoeffs();
+        audioFadeReset();
+    }
+    if (preroll.capacity() != prevPreroll) {
+        for (int i = 0; i < RTSP_MAX_SESSIONS; ++i) rtspSessions[i].replaying = false;   // history is gone: go live
+    }
+    // TCP send queues were sized for the old packet; the network task owns them
+    // (it may be flushing one right now) and resizes before its next packet
+    for (int i = 0; i < RTSP_MAX_SESSIONS; ++i) {
+        RtspSession &s = rtspSessions[i];
+        if (s.active && !s.overUdp && s.txQueue.active()) s.txQueueRefit = true;
+    }
+    // The DMA ring keeps filling while capture is parked; only a longer pause
+    // (or a reinstall, which empties it) loses samples
+    uint64_t lost = (uint64_t)(micros() - pauseStart) * currentSampleRate / 1000000ULL;
+    if (!reinstall) {
+        const uint64_t held = (uint64_t)I2S_DMA_BUF_COUNT * prevDmaLen * currentSampleRate / prevCaptureRate;
+        lost = (lost > held) ? lost - held : 0;
+    }
+    streamSampleIndex += (uint32_t)lost;
+    if (lost) clockDriftResetRequested = true;
+    audioLiveResizes++;
+    audioPipelineUnlock();
+
+    maxPacketRate = 0;
+    minPacketRate = 0xFFFFFFFF;
+    logPrintf("Audio buffers resized live: buffer %u, %u samples/packet%s", (unsigned)currentBufferSize,
+              (unsigned)rtpPacketSamples(), reinstall ? ", I2S reinstalled" : "");
+}
+
 // Minimal print helpers: Serial + buffered for Web UI
 void simplePrint(String message) {
     Serial.print(message);
 }
 
-void simplePrintln(String message) {
+void simplePrintln(const char* message) {
     Serial.println(message);
     webui_pushLog(message);
 }
 
+// printf-style log line to Serial and the Web UI (stack buffer, no String)
+__attribute__((format(printf, 1, 2))) void logPrintf(const char* fmt, ...) {
+    char line[LogRing::MAX_LINE + 1];
+    va_list ap;
+    va_start(ap, fmt);
+    int n = vsnprintf(line, sizeof(line), fmt, ap);
+    va_end(ap);
+    if (n < 0) return;
+    Serial.println(line);
+    webui_pushLog(line, ((size_t)n < sizeof(line)) ? (size_t)n : sizeof(line) - 1);
+}
+
 // OTA setup
 void setupOTA() {
     ArduinoOTA.setHostname("ESP32-RTSP-Mic");
 #ifdef OTA_PASSWORD
     ArduinoOTA.setPassword(OTA_PASSWORD);
 #endif
+    ArduinoOTA.onStart([]() { flushAudioSettings(); });
     ArduinoOTA.begin();
 }
 
+// DMA buffer length in samples for the capture block
+uint16_t i2sDmaBufLen() {
+    return (captureBlockSamples > 512) ? 512 : captureBlockSamples;
+}
+
 // I2S setup
 void setup_i2s_driver() {
-    i2s_driver_uninstall(I2S_NUM_0);
+    i2s_driver_uninstall(I2S_NUM_0);   // also deletes the previous event queue
+    i2sEventQueue = nullptr;
+    i2sReadyBytes = 0;
+    clockDriftResetRequested = true;
 
-    uint16_t dma_buf_len = (currentBufferSize > 512) ? 512 : currentBufferSize;
+    uint16_t dma_buf_len = i2sDmaBufLen();
 
 #if defined(MIC_TYPE_PDM)
     // PDM microphone configuration (e.g., XIAO ESP32-S3 Sense built-in mic)
     // PDM outputs 16-bit samples directly - no shift bits needed
     i2s_config_t i2s_config = {
         .mode = (i2s_mode_t)(I2S_MODE_MASTER | I2S_MODE_RX | I2S_MODE_PDM),
-        .sample_rate = currentSampleRate,
+        .sample_rate = i2sCaptureRate,
         .bits_per_sample = I2S_BITS_PER_SAMPLE_16BIT,
         .channel_format = I2S_CHANNEL_FMT_ONLY_LEFT,
         .communication_format = I2S_COMM_FORMAT_STAND_I2S,
@@ -677,19 +1953,19 @@ void setup_i2s_driver() {
         .data_in_num = PDM_DATA_PIN         // PDM Data
     };
 
-    i2s_driver_install(I2S_NUM_0, &i2s_config, 0, NULL);
+    i2s_driver_install(I2S_NUM_0, &i2s_config, I2S_EVENT_QUEUE_LEN, &i2sEventQueue);
     i2s_set_pin(I2S_NUM_0, &pin_config);
+    i2sDmaBufBytes = (size_t)dma_buf_len * sizeof(int16_t);
 
-    simplePrintln("I2S (PDM) ready: " + String(currentSampleRate) + "Hz, gain " +
-                  String(currentGainFactor, 1) + ", buffer " + String(currentBufferSize) +
-                  ", DMA " + String(I2S_DMA_BUF_COUNT) + "x" + String(dma_buf_len));
+    logPrintf("I2S (PDM) ready: %uHz, gain %.1f, buffer %u, DMA %ux%u", (unsigned)i2sCaptureRate, currentGainFactor,
+              (unsigned)currentBufferSize, (unsigned)I2S_DMA_BUF_COUNT, (unsigned)dma_buf_len);
 #else
     // Standard I2S microphone configuration (ICS-43434, INMP441)
     i2s_config_t i2s_config = {
         .mode = (i2s_mode_t)(I2S_MODE_MASTER | I2S_MODE_RX),
-        .sample_rate = currentSampleRate,
+        .sample_rate = i2sCaptureRate,
         .bits_per_sample = I2S_BITS_PER_SAMPLE_32BIT,
-        .channel_format = I2S_CHANNEL_FMT_ONLY_LEFT,
+        .channel_format = (micMode == MIC_MODE_MONO) ? I2S_CHANNEL_FMT_ONLY_LEFT : I2S_CHANNEL_FMT_RIGHT_LEFT,
         .communication_format = I2S_COMM_FORMAT_STAND_I2S,
         .intr_alloc_flags = ESP_INTR_FLAG_LEVEL1,
         .dma_buf_count = I2S_DMA_BUF_COUNT,  // Platform-specific buffer count
@@ -703,272 +1979,1289 @@ void setup_i2s_driver() {
         .data_in_num = I2S_DOUT_PIN
     };
 
-    i2s_driver_install(I2S_NUM_0, &i2s_config, 0, NULL);
+    i2s_driver_install(I2S_NUM_0, &i2s_config, I2S_EVENT_QUEUE_LEN, &i2sEventQueue);
     i2s_set_pin(I2S_NUM_0, &pin_config);
+    i2sDmaBufBytes = (size_t)dma_buf_len * sizeof(int32_t) * i2sSlots();   // dma_buf_len counts frames
 
     // (5) log i2sShiftBits for easier debugging
-    simplePrintln("I2S ready: " + String(currentSampleRate) + "Hz, gain " +
-                  String(currentGainFactor, 1) + ", buffer " + String(currentBufferSize) +
-                  ", shiftBits " + String(i2sShiftBits) + 
-                  ", DMA " + String(I2S_DMA_BUF_COUNT) + "x" + String(dma_buf_len));
+    logPrintf("I2S ready: %uHz, gain %.1f, buffer %u, shiftBits %u, DMA %ux%u, mics %s", (unsigned)i2sCaptureRate, currentGainFactor,
+              (unsigned)currentBufferSize, (unsigned)i2sShiftBits, (unsigned)I2S_DMA_BUF_COUNT, (unsigned)dma_buf_len, micModeName(micMode));
 #endif
 }
 
-static bool writeAll(WiFiClient &client, const uint8_t* data, size_t len) {
-    size_t off = 0;
-    while (off < len) {
-        int w = client.write(data + off, len - off);
-        if (w <= 0) return false;
-        off += (size_t)w;
+// TX accounting: bytes handed to lwIP and client.write() calls (1 per packet ideally)
+uint64_t rtpBytesSent = 0;
+uint32_t rtpWriteCalls = 0;
+uint32_t rtpPacketsTotal = 0;   // never reset (audioPacketsSent is per stats window)
+uint32_t audioPacketsSentTotal = 0;   // blocks streamed since boot (Prometheus counter)
+
+// Hot-path latency histograms for /metrics, from cycle-counter deltas
+LatencyHistogram histI2sWait;      // capture: wait for DMA data + i2s_read()
+LatencyHistogram histDspBlock;     // capture: DSP, SRC, pre-roll and encode of one buffer
+LatencyHistogram histRtpSend;      // network: one packet write (TCP queue + send / UDP)
+LatencyHistogram histStreamFanout; // network: one ring block to all playing sessions
+
+// Nominal payload bitrate, for ordering the ladder
+static uint32_t abrBitrate(uint32_t rate, AudioCodecId codec) {
+    return rate * (codec == CODEC_L16 ? 16 : (codec == CODEC_PCMU ? 8 : 4));
+}
+
+// Ladder below the configured format: each step lower in bitrate, never above the configured rate
+void abrBuildLadder() {
+    abrLevels[0].rate = currentSampleRate;
+    abrLevels[0].codec = currentCodec;
+    abrLevelCount = 1;
+    for (const AbrFormat &step : ABR_STEPS) {
+        const AbrFormat &prev = abrLevels[abrLevelCount - 1];
+        if (step.rate <= abrLevels[0].rate && abrBitrate(step.rate, step.codec) < abrBitrate(prev.rate, prev.codec)) {
+            abrLevels[abrLevelCount++] = step;
+        }
     }
+}
+
+// Switch the running format to a ladder level; I2S keeps the configured
+// clock and the resampler makes the lower stream rate
+static void abrApplyLevel(uint8_t level, const char* reason) {
+    const uint8_t from = abrLevel;
+    if (from == 0) abrConfiguredCaptureRate = captureSampleRate;
+    abrLevel = level;
+    currentSampleRate = abrLevels[level].rate;
+    currentCodec = abrLevels[level].codec;
+    captureSampleRate = (level == 0 || abrConfiguredCaptureRate) ? abrConfiguredCaptureRate : abrLevels[0].rate;
+    if (autoThresholdEnabled) minAcceptableRate = computeRecommendedMinRate();
+    abrTransitions++;
+    logPrintf("ABR: %.1fk %s -> %.1fk %s (%s, write %u%% of audio time, stalls %u%%, RSSI %d dBm)",
+              abrLevels[from].rate / 1000.0f, codec_rtpEncoding(abrLevels[from].codec),
+              abrLevels[level].rate / 1000.0f, codec_rtpEncoding(abrLevels[level].codec), reason,
+              (unsigned)abrController.utilPct(), (unsigned)abrController.stallPct(), (int)WiFi.RSSI());
+    restartI2S();   // ends PLAY: clients re-DESCRIBE the new format
+}
+
+// Back to the configured format (ABR switched off, or a format setting is
+// about to change). Returns true when the running format changed.
+bool abrRestoreConfigured() {
+    if (abrLevel == 0) return false;
+    currentSampleRate = abrLevels[0].rate;
+    currentCodec = abrLevels[0].codec;
+    captureSampleRate = abrConfiguredCaptureRate;
+    abrLevel = 0;
+    abrController.reset(millis());
+    if (autoThresholdEnabled) minAcceptableRate = computeRecommendedMinRate();
     return true;
 }
 
-void sendRTPPacket(WiFiClient &client, int16_t* audioData, int numSamples) {
-    if (!client.connected()) return;
+// Once per window from loop(): feed the controller and act on its decision
+void serviceAdaptiveBitrate() {
+    static unsigned long lastMs = 0;
+    static uint32_t lastPackets = 0, lastStalls = 0, lastSendUs = 0, lastSamples = 0;
+    unsigned long now = millis();
+    if (now - lastMs < ABR_WINDOW_MS) return;
+    lastMs = now;
+
+    const uint32_t packets = rtpPacketsTotal, stalls = rtpWriteStalls;
+    const uint32_t sendUs = rtpSendUsTotal, samples = rtpAudioSamplesTotal;
+    CongestionController::Window w;
+    w.packets = packets - lastPackets;
+    w.stalls = stalls - lastStalls;
+    w.sendUs = sendUs - lastSendUs;
+    w.audioUs = (uint32_t)((uint64_t)(samples - lastSamples) * 1000000ULL / currentSampleRate);
+    lastPackets = packets; lastStalls = stalls; lastSendUs = sendUs; lastSamples = samples;
+    if (!abrEnabled) return;
+
+    CongestionController::Decision d = abrController.update(w, (uint32_t)now, abrLevel + 1 < abrLevelCount, abrLevel > 0);
+    if (d == CongestionController::STEP_DOWN) abrApplyLevel(abrLevel + 1, "congested");
+    else if (d == CongestionController::STEP_UP) abrApplyLevel(abrLevel - 1, "recovered");
+}
+
+static uint32_t benchClock() { return ESP.getCycleCount(); }
+
+// On-device benchmark (/api/action/bench): the current kernel, HPF, gain and
+// codec on synthetic input, one buffer size per call (runs on loop())
+bool benchmarkPipeline(int samples, BenchStages &out) {
+    BenchConfig cfg;
+    cfg.clock = benchClock;
+#ifdef MIC_TYPE_PDM
+    cfg.pdm = true;
+#else
+    cfg.pdm = false;
+#endif
+    cfg.fixedPoint = DSP_FIXED_POINT;
+    cfg.shift = i2sShiftBits;
+    cfg.gain = currentGainFactor;
+    cfg.hpf = hpf;
+    cfg.codec = currentCodec;
+    return bench_measure(cfg, samples, out);
+}
+
+// Send cost per sample from the live rtp_send histogram; 0 until packets went out
+float benchSendCyclesPerSample() {
+    LatencyHistogram::Snapshot snap;
+    histRtpSend.snapshot(snap);
+    uint16_t packetSamples = rtpPacketSamples();
+    if (snap.count == 0 || packetSamples == 0) return 0.0f;
+    float usPerPacket = (float)snap.sumUs / (float)snap.count;
+    return usPerPacket * (float)getCpuFrequencyMhz() / (float)packetSamples;
+}
+
+// Non-blocking socket write: bytes taken, 0 when the send buffer is full,
+// -1 on a connection error. WiFiClient::write() would retry (and block).
+static int tcpWriteNow(WiFiClient &client, const uint8_t* data, size_t len) {
+    int w = lwip_send(client.fd(), data, len, MSG_DONTWAIT);
+    rtpWriteCalls++;
+    if (w < 0) return (errno == EAGAIN || errno == EWOULDBLOCK) ? 0 : -1;
+    return w;
+}
 
-    const uint16_t payloadSize = (uint16_t)(numSamples * (int)sizeof(int16_t));
-    const uint16_t packetSize = (uint16_t)(12 + payloadSize);
-
-    // RTSP interleaved header: '$' 0x24, channel 0, length
-    uint8_t inter[4];
-    inter[0] = 0x24;
-    inter[1] = 0x00;
-    inter[2] = (uint8_t)((packetSize >> 8) & 0xFF);
-    inter[3] = (uint8_t)(packetSize & 0xFF);
-
-    // RTP header (12 bytes)
-    uint8_t header[12];
-    header[0] = 0x80;      // V=2, P=0, X=0, CC=0
-    header[1] = 96;        // M=0, PT=96 (dynamic)
-    // (3) safe byte-wise filling (no unaligned writes)
-    header[2] = (uint8_t)((rtpSequence >> 8) & 0xFF);
-    header[3] = (uint8_t)(rtpSequence & 0xFF);
-    header[4] = (uint8_t)((rtpTimestamp >> 24) & 0xFF);
-    header[5] = (uint8_t)((rtpTimestamp >> 16) & 0xFF);
-    header[6] = (uint8_t)((rtpTimestamp >> 8) & 0xFF);
-    header[7] = (uint8_t)(rtpTimestamp & 0xFF);
-    header[8]  = (uint8_t)((rtpSSRC >> 24) & 0xFF);
-    header[9]  = (uint8_t)((rtpSSRC >> 16) & 0xFF);
-    header[10] = (uint8_t)((rtpSSRC >> 8) & 0xFF);
-    header[11] = (uint8_t)(rtpSSRC & 0xFF);
-
-    // Host->network: per-sample byte-swap (16bit PCM L16 big-endian)
-    for (int i = 0; i < numSamples; ++i) {
-        uint16_t s = (uint16_t)audioData[i];
-        s = (uint16_t)((s << 8) | (s >> 8)); // htons without dependency
-        audioData[i] = (int16_t)s;
-    }
-
-    if (!writeAll(client, inter, sizeof(inter)) ||
-        !writeAll(client, header, sizeof(header)) ||
-        !writeAll(client, (uint8_t*)audioData, payloadSize)) {
-        isStreaming = false;
+// Push queued packets into the socket, oldest first, until it is full.
+// false on a connection error.
+static bool tcpFlushQueue(RtspSession &s) {
+    while (!s.txQueue.empty()) {
+        const uint16_t rem = s.txQueue.frontRemaining();
+        int w = tcpWriteNow(s.client, s.txQueue.frontData(), rem);
+        if (w < 0) return false;
+        if (w == 0) return true;
+        s.txQueue.consume((uint16_t)w);
+        s.bytesSent += (uint32_t)w;
+        rtpBytesSent += (uint32_t)w;
+        if (w < rem) return true;
+    }
+    return true;
+}
+
+// Size the session's send queue for the current packet size (PLAY over TCP,
+// or after a live resize: queued packets, a partly written one included, stay)
+static bool tcpQueueBegin(RtspSession &s) {
+    const uint16_t maxPacket = RTSP_INTERLEAVE_BYTES + RTP_HEADER_BYTES + rtpPacketSamples() * streamChannels() * sizeof(int16_t);
+    uint32_t packets = RTP_TCP_QUEUE_BYTES / maxPacket;
+    if (packets > PacketQueue::MAX_PACKETS) packets = PacketQueue::MAX_PACKETS;
+    s.txQueueRefit = false;
+    uint8_t dropped = 0;
+    if (!s.txQueue.resize((uint8_t)packets, maxPacket, dropped)) return false;
+    s.drops += dropped;
+    s.queueDrops += dropped;
+    rtpQueueDrops += dropped;
+    return true;
+}
+
+// Ask the network task to stop audio on every session (clients stay connected)
+void rtspStopAllStreams() {
+    rtspStopStreamsRequested = true;
+    isStreaming = false;
+}
+
+// Send one ring block to one session. The payload is already encoded (L16 in
+// network order, or PCMU/DVI4) and shared by all sessions; only the 16-byte
+// headroom is rewritten per session, so each packet still goes out in one write.
+void sendRTPPacket(RtspSession &session, AudioBlock* block, bool marker) {
+    const int numSamples = block->count;
+    const uint16_t payloadSize = block->bytes;
+    uint8_t* pkt = block->packet;
+
+    // RTSP interleave prefix (channel 0) and RTP header in the block headroom
+    const uint8_t pt = marker ? (uint8_t)(block->payloadType | 0x80) : block->payloadType;
+    const uint16_t packetSize = rtp_writeHeaders(pkt, 0, pt, session.rtpSequence,
+                                                 session.rtpTimestamp, rtpSSRC, payloadSize);
+    const uint8_t* header = pkt + RTSP_INTERLEAVE_BYTES;
+
+    size_t wireBytes;
+    const uint32_t sendStart = ESP.getCycleCount();
+    if (session.overUdp) {
+        // UDP: plain RTP datagram (no interleave header); a dropped datagram
+        // is a gap for the receiver, never a reason to stop the session
+        bool sent = rtpUdp.beginPacket(session.remoteIP, session.udpRtpPort) &&
+                    rtpUdp.write(header, packetSize) == packetSize &&
+                    rtpUdp.endPacket();
+        rtpWriteCalls++;
+        if (!sent) { udpSendErrors++; rtpWriteStalls++; session.drops++; }
+        wireBytes = sent ? packetSize : 0;
+    } else {
+        // TCP: never wait for the socket. Whatever it does not take now is
+        // queued behind older packets; a full queue drops its oldest packet.
+        const uint16_t len = RTSP_INTERLEAVE_BYTES + packetSize;
+        if (session.txQueueRefit && !tcpQueueBegin(session)) {
+            logPrintf("RTSP " IP_FMT " stopped - no memory to resize the send queue", IP_ARGS(session.remoteIP));
+            session.playing = false;
+            session.drops++;
+            return;
+        }
+        int w = 0;
+        if (!session.client.connected() || !tcpFlushQueue(session) ||
+            (session.txQueue.empty() && (w = tcpWriteNow(session.client, pkt, len)) < 0)) {
+            session.playing = false;
+            session.drops++;
+            return;
+        }
+        if (w < len) {
+            rtpWriteStalls++;
+            if (session.txQueue.push(pkt + w, len - (uint16_t)w, w > 0)) {
+                session.drops++;
+                session.queueDrops++;
+                rtpQueueDrops++;
+            }
+        }
+        wireBytes = (size_t)w;
+    }
+    const uint32_t sendCycles = ESP.getCycleCount() - sendStart;
+    histRtpSend.recordCycles(sendCycles);
+    rtpSendUsTotal += LatencyHistogram::cyclesToUs(sendCycles);
+    rtpAudioSamplesTotal += (uint32_t)numSamples;
+
+    // Sequence and timestamp advance even for a lost datagram or a packet
+    // dropped from the send queue (receiver sees a gap)
+    session.rtpSequence++;
+    session.rtpTimestamp += (uint32_t)numSamples;
+    session.packets++;
+    session.octets += payloadSize;
+    session.bytesSent += wireBytes;
+    rtpPacketsTotal++;
+    rtpBytesSent += wireBytes;
+}
+
+// Current wall clock as 64-bit NTP timestamp (seconds since 1900, Q32 fraction)
+static void currentNtpTime(uint32_t &ntpSec, uint32_t &ntpFrac) {
+    struct timeval tv;
+    gettimeofday(&tv, nullptr);
+    ntpSec = (uint32_t)tv.tv_sec + 2208988800UL;
+    ntpFrac = (uint32_t)(((uint64_t)tv.tv_usec << 32) / 1000000ULL);
+}
+
+// SNTP sync (lwIP task): wall clock minus esp_timer only moves when SNTP
+// steps it, by what the crystal drifted since the previous sync
+void onNtpTimeSync(struct timeval* tv) {
+    const int64_t nowUs = esp_timer_get_time();
+    const int64_t offset = (int64_t)tv->tv_sec * 1000000LL + tv->tv_usec - nowUs;
+    if (ntpSyncCount == 0) {
+        ntpLastSyncUs = nowUs;
+        ntpSyncOffsetUs = offset;
+    } else if (nowUs - ntpLastSyncUs >= NTP_DRIFT_MIN_INTERVAL_US) {
+        // A fast crystal runs ahead, so SNTP steps the wall clock back
+        ntpTimerDriftPpm = (float)((double)(ntpSyncOffsetUs - offset) * 1e6 / (double)(nowUs - ntpLastSyncUs));
+        ntpTimerDriftValid = true;
+        ntpLastSyncUs = nowUs;
+        ntpSyncOffsetUs = offset;
+    }
+    ntpSyncCount++;
+}
+
+// The session's RTP timestamp for this instant: the capture anchor (last
+// block read, stamped at DMA completion) moved on to now. A session keeps
+// rtpTimestamp at nextSampleIndex, so any stream index maps to its clock.
+static uint32_t sessionRtpTimestampAt(const RtspSession &s, int64_t nowUs) {
+    uint32_t index;
+    int64_t atUs;
+    if (!s.synced || !streamClockAnchor.get(index, atUs) || nowUs < atUs) return s.rtpTimestamp;
+    const uint32_t since = (uint32_t)((nowUs - atUs) * (int64_t)currentSampleRate / 1000000LL);
+    return s.rtpTimestamp + (index - s.nextSampleIndex) + since;
+}
+
+// RTCP sender report (RFC 3550 6.4.1), no report blocks: on the RTCP port, or
+// interleaved channel 1 of a TCP session. The NTP time is when the audio with
+// that RTP timestamp was captured, not when it leaves the device.
+void sendRtcpSenderReport(RtspSession &session) {
+    uint8_t frame[RTSP_INTERLEAVE_BYTES + RTCP_SR_BYTES];
+    uint8_t* sr = frame + RTSP_INTERLEAVE_BYTES;
+    uint32_t ntpSec, ntpFrac;
+    const int64_t nowUs = esp_timer_get_time();
+    currentNtpTime(ntpSec, ntpFrac);
+    rtcp_writeSenderReport(sr, rtpSSRC, ntpSec, ntpFrac, sessionRtpTimestampAt(session, nowUs), session.packets, session.octets);
+    if (session.overUdp) {
+        if (rtcpUdp.beginPacket(session.remoteIP, session.udpRtcpPort) &&
+            rtcpUdp.write(sr, RTCP_SR_BYTES) == RTCP_SR_BYTES && rtcpUdp.endPacket()) {
+            rtcpReportsSent++;
+        } else {
+            udpSendErrors++;
+        }
         return;
     }
+    frame[0] = '$';
+    frame[1] = 1;
+    frame[2] = 0;
+    frame[3] = RTCP_SR_BYTES;
+    // Behind queued RTP like any packet; a dead connection is left to the RTP path
+    int w = 0;
+    if (!session.client.connected() || !tcpFlushQueue(session) ||
+        (session.txQueue.empty() && (w = tcpWriteNow(session.client, frame, sizeof(frame))) < 0)) {
+        return;
+    }
+    if (w < (int)sizeof(frame) && session.txQueue.push(frame + w, (uint16_t)(sizeof(frame) - w), w > 0)) {
+        session.queueDrops++;
+        rtpQueueDrops++;
+    }
+    rtcpReportsSent++;
+}
+
+// RTCP housekeeping: periodic SR per playing session, drain incoming UDP
+// receiver reports (a report from a session's client counts as activity)
+void serviceRtcp() {
+    while (rtpUdpSocketsOpen && rtcpUdp.parsePacket() > 0) {
+        IPAddress from = rtcpUdp.remoteIP();
+        uint16_t fromPort = rtcpUdp.remotePort();
+        uint8_t discard[64];
+        while (rtcpUdp.available() > 0) rtcpUdp.read(discard, sizeof(discard));
+        rtcpReportsReceived++;
+        for (int i = 0; i < RTSP_MAX_SESSIONS; ++i) {
+            RtspSession &s = rtspSessions[i];
+            if (s.active && s.overUdp && s.remoteIP == from && s.udpRtcpPort == fromPort) {
+                s.lastActivityMs = millis();
+            }
+        }
+    }
+    for (int i = 0; i < RTSP_MAX_SESSIONS; ++i) {
+        RtspSession &s = rtspSessions[i];
+        if (s.active && s.playing && s.synced && (rtpUdpSocketsOpen || !s.overUdp) && millis() - s.lastSenderReportMs >= RTCP_SR_INTERVAL_MS) {
+            sendRtcpSenderReport(s);
+            s.lastSenderReportMs = millis();
+        }
+    }
+}
 
-    rtpSequence++;
-    rtpTimestamp += (uint32_t)numSamples;
-    audioPacketsSent++;
+// Block until the driver reports enough filled DMA buffers for one read
+// (I2S_EVENT_RX_DONE), counting overflow/error events on the way.
+// false on timeout; without a queue the blocking read paces itself.
+bool waitForI2SData(size_t blockBytes) {
+    if (!i2sEventQueue) return true;
+    const size_t dmaCapacity = i2sDmaBufBytes * I2S_DMA_BUF_COUNT;
+    if (blockBytes > dmaCapacity) blockBytes = dmaCapacity;
+    i2s_event_t evt;
+    while (i2sReadyBytes < blockBytes) {
+        if (xQueueReceive(i2sEventQueue, &evt, pdMS_TO_TICKS(50)) != pdTRUE) {
+            i2sEventTimeouts++;
+            return false;
+        }
+        switch (evt.type) {
+            case I2S_EVENT_RX_DONE:
+                i2sRxDoneEvents++;
+                i2sLastRxDoneUs = esp_timer_get_time();
+                i2sReadyBytes += evt.size ? evt.size : i2sDmaBufBytes;
+                if (i2sReadyBytes > dmaCapacity) i2sReadyBytes = dmaCapacity;
+                break;
+            case I2S_EVENT_RX_Q_OVF:
+                i2sRxOverflows++;
+                break;
+            case I2S_EVENT_DMA_ERROR:
+                i2sDmaErrors++;
+                break;
+            default:
+                break;
+        }
+    }
+    return true;
+}
+
+// After each read: the newest RX_DONE completed the frames read so far plus
+// those still ready. Lost DMA buffers break the count, so they restart the
+// estimate like a gap does.
+static void trackSampleClock(size_t bytesRead, size_t frameBytes) {
+    if (clockDriftResetRequested || i2sRxOverflows != clockDriftOverflows) {
+        clockDriftResetRequested = false;
+        clockDriftOverflows = i2sRxOverflows;
+        i2sClockDrift.begin(i2sCaptureRate);
+        clockDriftRestarts++;
+    }
+    i2sFramesTotal += (uint32_t)(bytesRead / frameBytes);
+    if (!i2sEventQueue) {   // blocking read: it returns as the block completes
+        i2sBlockEndUs = esp_timer_get_time();
+        i2sClockDrift.add(i2sFramesTotal, i2sBlockEndUs);
+        return;
+    }
+    const uint32_t ready = (uint32_t)(i2sReadyBytes / frameBytes);
+    i2sClockDrift.add(i2sFramesTotal + ready, i2sLastRxDoneUs);
+    i2sBlockEndUs = i2sLastRxDoneUs - (int64_t)ready * 1000000LL / i2sCaptureRate;
 }
 
-// Audio streaming
-void streamAudio(WiFiClient &client) {
-    if (!isStreaming || !client.connected()) return;
+// Encode n stream-rate samples into a ring block (src may be the block's own
+// samples: encoding is in place) and hand it to the network task. A gated
+// block carries only its position and length.
+static void commitAudioBlock(AudioBlock* block, const int16_t* src, int n, AudioCodecId codec, uint32_t sampleIndex, bool gated) {
+    size_t payloadBytes = gated ? 0 : codec_encode(codec, src, (uint8_t*)block->samples, n * streamChannels(), adpcmState);
+    block->gated = gated;
+    block->count = (uint16_t)n;   // frames: the RTP clock counts them, not samples
+    block->bytes = (uint16_t)payloadBytes;
+    block->payloadType = codec_payloadType(codec, currentSampleRate);
+    block->sampleIndex = sampleIndex;
+    audioRing.commitWrite();
+    if (rtspNetTaskHandle) xTaskNotifyGive(rtspNetTaskHandle);
+}
 
+// Audio capture: read one I2S block, process it into the next free ring block
+// Returns false when the driver returned nothing (caller backs off)
+bool captureAudioBlock() {
     size_t bytesRead = 0;
+#if defined(MIC_TYPE_PDM)
+    const size_t blockBytes = captureBlockSamples * sizeof(int16_t);
+#else
+    const size_t blockBytes = captureBlockSamples * sizeof(int32_t) * i2sSlots();   // both slots of every frame
+#endif
+    const uint32_t waitStart = ESP.getCycleCount();
+    if (!waitForI2SData(blockBytes)) return false;
+    if (captureStateResetRequested) {
+        captureStateResetRequested = false;
+        adpcmState.reset();
+        activityDetector.reset();
+        if (!preroll.active()) resampler.reset();   // pre-roll: audio is continuous
+    }
+    // With the SRC active the DSP writes capture-rate samples to the staging buffer
+    const bool resampling = resampler.active();
+    // ptime shorter than the buffer: stream-rate samples are staged, then sliced into packets
+    const bool slicing = audioRing.blockSamples() < currentBufferSize;
+
+    // Only fill the ring while a client is playing; otherwise just drain I2S
+    AudioBlock* block = (isStreaming && !slicing) ? audioRing.acquireWrite() : nullptr;
+    if (isStreaming && !slicing && !block) audioRingOverruns++;
+    const bool recording = preroll.active();
+    const bool spectrum = melSpectrum.active();
+    const bool staging = recordStage.active();
+    const bool wanted = recording || spectrum || staging || (slicing ? isStreaming : (block != nullptr));
+    int16_t* streamOut = block ? block->samples : streamStageBuffer;
 
 #if defined(MIC_TYPE_PDM)
     // PDM: Read 16-bit samples directly (no 32-bit conversion needed)
-    esp_err_t result = i2s_read(I2S_NUM_0, i2s_16bit_buffer,
-                                currentBufferSize * sizeof(int16_t),
+    int16_t* pcm = (wanted && !resampling) ? streamOut : i2s_16bit_buffer;
+    esp_err_t result = i2s_read(I2S_NUM_0, pcm, blockBytes,
                                 &bytesRead, 50 / portTICK_PERIOD_MS);
+    i2sReadyBytes -= (bytesRead < i2sReadyBytes) ? bytesRead : i2sReadyBytes;
+    histI2sWait.recordCycles(ESP.getCycleCount() - waitStart);
+    if (result != ESP_OK || bytesRead == 0) return false;
+    trackSampleClock(bytesRead, sizeof(int16_t));
+    if (!wanted) return true;
+    int samplesRead = bytesRead / sizeof(int16_t);
+    const bool stereo = false;
+#else
+    // Standard I2S: Read 32-bit samples, convert to 16-bit
+    esp_err_t result = i2s_read(I2S_NUM_0, i2s_32bit_buffer, blockBytes,
+                                &bytesRead, 50 / portTICK_PERIOD_MS);
+    i2sReadyBytes -= (bytesRead < i2sReadyBytes) ? bytesRead : i2sReadyBytes;
+    histI2sWait.recordCycles(ESP.getCycleCount() - waitStart);
+    if (result != ESP_OK || bytesRead == 0) return false;
+    trackSampleClock(bytesRead, sizeof(int32_t) * i2sSlots());
+    if (!wanted) return true;
+    int samplesRead = bytesRead / (sizeof(int32_t) * i2sSlots());
+    // Stereo: both channels are processed as planes, then interleaved into the block
+    const bool stereo = (micMode == MIC_MODE_STEREO);
+    int16_t* pcm = stereo ? micStereoBuffer : (resampling ? i2s_16bit_buffer : streamOut);
+#endif
+
+    // If HPF params changed dynamically, recompute
+    if (highpassEnabled && (hpfConfigSampleRate != i2sCaptureRate || hpfConfigCutoff != highpassCutoffHz)) {
+        redesignAudioFilters();
+    }
 
-    if (result == ESP_OK && bytesRead > 0) {
-        int samplesRead = bytesRead / sizeof(int16_t);
+    // L16 is sent as-is, so the kernel writes network order; encoders take host order
+    const AudioCodecId codec = currentCodec;
+    const bool bigEndianOut = (codec == CODEC_L16) && !resampling;
+
+    uint32_t c0 = ESP.getCycleCount();
+    const uint32_t processStart = c0;
+#if !defined(MIC_TYPE_PDM)
+    // Two mics: split the slots once; delay-and-sum folds them into the mono input
+    const int32_t* monoIn = i2s_32bit_buffer;
+    if (micMode != MIC_MODE_MONO) {
+        dsp_deinterleave32(i2s_32bit_buffer, micPlanarBuffer, micPlanarBuffer + samplesRead, samplesRead);
+        if (micMode == MIC_MODE_BEAM) beamformer.process(micPlanarBuffer, micPlanarBuffer + samplesRead, i2s_32bit_buffer, samplesRead);
+        else monoIn = micPlanarBuffer;
+    }
+#else
+    const int32_t* monoIn = nullptr;   // PDM filters pcm in place
+#endif
+    // One snapshot of the live parameters per block (the Web UI writes them any time)
+    const float gain = currentGainFactor;
+    const uint8_t shift = i2sShiftBits;
+    const bool hpfOn = highpassEnabled;
+#if DSP_FIXED_POINT
+    DspHpf &liveHpf = hpfQ;
+    DspChain &liveChain = filterChainQ;
+#else
+    DspHpf &liveHpf = hpf;
+    DspChain &liveChain = filterChain;
+#endif
+    // HPF only: the fused single-section kernel; user sections: the chain (HPF included).
+    // PDM filters in place, so `out` holds the raw samples on entry.
+    auto dspPass = [&](const int32_t* in, DspHpf &f, DspChain &chain, bool useHpf, float g, uint8_t sh, int16_t* out, bool bigEndian) -> DspBlockStats {
+        (void)in; (void)sh;
+#if DSP_FIXED_POINT
+        const int32_t gQ16 = dsp_gainToQ16(g);
+  #if defined(MIC_TYPE_PDM)
+        return chain.count ? dsp_processChainQ16(out, out, samplesRead, &chain, gQ16, bigEndian)
+                           : dsp_processQ16(out, out, samplesRead, useHpf ? &f : nullptr, gQ16, bigEndian);
+  #else
+        return chain.count ? dsp_processChainQ32(in, out, samplesRead, sh, &chain, gQ16, bigEndian)
+                           : dsp_processQ32(in, out, samplesRead, sh, useHpf ? &f : nullptr, gQ16, bigEndian);
+  #endif
+#else
+  #if defined(MIC_TYPE_PDM)
+        return chain.count ? dsp_processChainFloat16(out, out, samplesRead, &chain, g, bigEndian)
+                           : dsp_processFloat16(out, out, samplesRead, useHpf ? &f : nullptr, g, bigEndian);
+  #else
+        return chain.count ? dsp_processChainFloat32(in, out, samplesRead, sh, &chain, g, bigEndian)
+                           : dsp_processFloat32(in, out, samplesRead, sh, useHpf ? &f : nullptr, g, bigEndian);
+  #endif
+#endif
+    };
 
-        // If HPF params changed dynamically, recompute
-        if (highpassEnabled && (hpfConfigSampleRate != currentSampleRate || hpfConfigCutoff != highpassCutoffHz)) {
-            updateHighpassCoeffs();
+    AudioFadeSet &from = audioFadeFrom;
+    const bool fading = crossfadeBuffer && (from.filtersPending || from.gain != gain || from.shift != shift || from.hpfOn != hpfOn);
+    // One channel; on a change the outgoing set runs on a copy of the filter
+    // memory, then the new one, both in host order, and the two are crossfaded
+    auto dspChannel = [&](const int32_t* in, int16_t* out, DspHpf &h, DspChain &c, DspHpf &oldH, DspChain &oldC, bool bigEndian) -> DspBlockStats {
+        if (!fading) return dspPass(in, h, c, hpfOn, gain, shift, out, bigEndian);
+#if defined(MIC_TYPE_PDM)
+        memcpy(crossfadeBuffer, out, (size_t)samplesRead * sizeof(int16_t));
+#endif
+        DspBlockStats old = dspPass(in, oldH, oldC, from.hpfOn, from.gain, from.shift, crossfadeBuffer, false);
+        DspBlockStats cur = dspPass(in, h, c, hpfOn, gain, shift, out, false);
+        dsp_crossfade(crossfadeBuffer, out, samplesRead, bigEndian);
+        if (old.peakAbs > cur.peakAbs) cur.peakAbs = old.peakAbs;
+        cur.clipped = cur.clipped || old.clipped;
+        return cur;
+    };
+    if (fading && !from.filtersPending) { from.hpf = liveHpf; from.chain = liveChain; }
+#if !defined(MIC_TYPE_PDM)
+    DspBlockStats st = dspChannel(monoIn, pcm, liveHpf, liveChain, from.hpf, from.chain, bigEndianOut && !stereo);
+    if (stereo) {
+        // Right slot: its own filter memory under the current coefficients
+        // (the fade copy keeps the outgoing ones)
+        micRightFadeHpf = micRightHpf;
+        micRightFadeChain = micRightChain;
+        micRightHpf = liveHpf;
+        micRightHpf.copyState(micRightFadeHpf);
+        micRightChain = liveChain;
+        micRightChain.copyState(micRightFadeChain);
+        DspBlockStats right = dspChannel(micPlanarBuffer + samplesRead, pcm + samplesRead, micRightHpf, micRightChain,
+                                         micRightFadeHpf, micRightFadeChain, false);
+        if (right.peakAbs > st.peakAbs) st.peakAbs = right.peakAbs;
+        st.clipped = st.clipped || right.clipped;
+        if (block) {   // no block: only the mel frames want this one
+            dsp_interleave16(pcm, pcm + samplesRead, streamOut, samplesRead, bigEndianOut);
+            pcm = streamOut;
         }
+    }
+#else
+    DspBlockStats st = dspChannel(monoIn, pcm, liveHpf, liveChain, from.hpf, from.chain, bigEndianOut);
+#endif
+    if (fading) {
+        from.filtersPending = false;
+        audioCrossfades++;
+    }
+    from.gain = gain;
+    from.shift = shift;
+    from.hpfOn = hpfOn;
+    uint32_t cycles = ESP.getCycleCount() - c0;
+    if (samplesRead > 0) {
+        float cps = (float)cycles / (float)samplesRead;
+        dspCyclesPerSample = (dspCyclesPerSample == 0.0f) ? cps : (dspCyclesPerSample * 0.9f + cps * 0.1f);
+    }
 
-        bool clipped = false;
-        float peakAbs = 0.0f;
-        for (int i = 0; i < samplesRead; i++) {
-            // PDM outputs 16-bit samples directly - no shift needed
-            float sample = (float)i2s_16bit_buffer[i];
-            if (highpassEnabled) sample = hpf.process(sample);
-            float amplified = sample * currentGainFactor;
-            float aabs = fabsf(amplified);
-            if (aabs > peakAbs) peakAbs = aabs;
-            if (aabs > 32767.0f) clipped = true;
-            if (amplified > 32767.0f) amplified = 32767.0f;
-            if (amplified < -32768.0f) amplified = -32768.0f;
-            i2s_16bit_buffer[i] = (int16_t)amplified;
+    // Capture rate -> stream rate (L16 stored in network order)
+    if (resampling) {
+        c0 = ESP.getCycleCount();
+        samplesRead = resampler.process(pcm, samplesRead, streamOut, currentBufferSize, codec == CODEC_L16);
+        cycles = ESP.getCycleCount() - c0;
+        pcm = streamOut;
+        if (samplesRead > 0) {
+            float cps = (float)cycles / (float)samplesRead;
+            srcCyclesPerSample = (srcCyclesPerSample == 0.0f) ? cps : (srcCyclesPerSample * 0.9f + cps * 0.1f);
         }
-        // Update metering after processing the block
-        if (peakAbs > 32767.0f) peakAbs = 32767.0f;
-        lastPeakAbs16 = (uint16_t)peakAbs;
-        audioClippedLastBlock = clipped;
-        if (clipped) audioClipCount++;
-
-        // Update peak hold for a short window (~3 s) to match UI polling cadence
-        if (lastPeakAbs16 > peakHoldAbs16) {
-            peakHoldAbs16 = lastPeakAbs16;
-            peakHoldUntilMs = millis() + 3000UL;
-        } else if (peakHoldAbs16 > 0 && millis() > peakHoldUntilMs) {
-            peakHoldAbs16 = 0;
+    }
+
+    // Update metering after processing the block
+    lastPeakAbs16 = st.peakAbs;
+    audioClippedLastBlock = st.clipped;
+    if (st.clipped) audioClipCount++;
+
+    // Update peak hold for a short window (~3 s) to match UI polling cadence
+    if (lastPeakAbs16 > peakHoldAbs16) {
+        peakHoldAbs16 = lastPeakAbs16;
+        peakHoldUntilMs = millis() + 3000UL;
+    } else if (peakHoldAbs16 > 0 && millis() > peakHoldUntilMs) {
+        peakHoldAbs16 = 0;
+    }
+
+    // Activity gate: one decision per buffer; the pre-roll keeps everything
+    bool gated = false;
+    if (activityGateEnabled && samplesRead > 0) {
+        bool open = activityDetector.process(pcm, samplesRead, codec == CODEC_L16);
+        activityAccount((uint32_t)samplesRead, open);
+        gated = !open;
+    }
+    activityGated = gated;
+
+    // Mel frames and SD stage take one channel (stereo: the left plane)
+    const MonoPlane mono = preroll_monoPlane(pcm, micStereoBuffer, stereo, codec == CODEC_L16);
+    if (spectrum && samplesRead > 0) {
+        c0 = ESP.getCycleCount();
+        int frames = melSpectrum.push(mono.samples, samplesRead, mono.byteSwapped);
+        if (frames > 0) {
+            const uint32_t perFrame = (ESP.getCycleCount() - c0) / (uint32_t)frames;
+            for (int i = 0; i < frames; ++i) histMelFrame.recordCycles(perFrame);
+            melFramesTotal += (uint32_t)frames;
         }
+    }
 
-        sendRTPPacket(client, i2s_16bit_buffer, samplesRead);
+    // History first, so a replaying session never finds a live block ahead of it
+    const uint32_t firstIndex = streamSampleIndex;
+    if (recording) preroll.write(firstIndex, pcm, samplesRead, codec == CODEC_L16);
+    if (staging) recordStage.write(firstIndex, mono.samples, samplesRead, mono.byteSwapped);
+    streamSampleIndex += (uint32_t)samplesRead;
+    streamClockAnchor.set(streamSampleIndex, i2sBlockEndUs);
+
+    // Encode and queue: the whole buffer as one packet, or ptime-sized slices
+    c0 = ESP.getCycleCount();
+    if (!slicing) {
+        if (block) commitAudioBlock(block, pcm, samplesRead, codec, firstIndex, gated);
+    } else if (isStreaming) {
+        // Whole packets only: a tail that does not fill one waits for the next
+        // buffer, so every packet matches a=ptime
+        const int perPacket = audioRing.blockSamples();
+        int off = 0;
+        if (sliceCarryCount > 0 && (sliceCarryIndex + sliceCarryCount != firstIndex || sliceCarryCodec != codec)) {
+            // Not continuous (samples lost, codec switched): it goes out short
+            AudioBlock* slice = audioRing.acquireWrite();
+            if (slice) commitAudioBlock(slice, sliceCarryBuffer, sliceCarryCount, sliceCarryCodec, sliceCarryIndex, gated);
+            else audioRingOverruns++;
+            sliceCarryCount = 0;
+        } else if (sliceCarryCount > 0) {
+            off = perPacket - sliceCarryCount;
+            if (off > samplesRead) off = samplesRead;
+            memcpy(sliceCarryBuffer + sliceCarryCount, pcm, (size_t)off * sizeof(int16_t));
+            sliceCarryCount += (uint16_t)off;
+            if (sliceCarryCount == perPacket) {
+                AudioBlock* slice = audioRing.acquireWrite();
+                if (slice) commitAudioBlock(slice, sliceCarryBuffer, perPacket, codec, sliceCarryIndex, gated);
+                else audioRingOverruns++;
+                sliceCarryCount = 0;
+            }
+        }
+        for (; off + perPacket <= samplesRead; off += perPacket) {
+            AudioBlock* slice = audioRing.acquireWrite();
+            if (!slice) { audioRingOverruns++; continue; }
+            commitAudioBlock(slice, pcm + off, perPacket, codec, firstIndex + (uint32_t)off, gated);
+        }
+        if (off < samplesRead) {
+            sliceCarryCount = (uint16_t)(samplesRead - off);
+            sliceCarryIndex = firstIndex + (uint32_t)off;
+            sliceCarryCodec = codec;
+            memcpy(sliceCarryBuffer, pcm + off, (size_t)sliceCarryCount * sizeof(int16_t));
+        }
+    } else {
+        sliceCarryCount = 0;   // nobody playing: the next stream starts on fresh audio
     }
-#else
-    // Standard I2S: Read 32-bit samples, convert to 16-bit
-    esp_err_t result = i2s_read(I2S_NUM_0, i2s_32bit_buffer,
-                                currentBufferSize * sizeof(int32_t),
-                                &bytesRead, 50 / portTICK_PERIOD_MS);
+    cycles = ESP.getCycleCount() - c0;
+    if (codec != CODEC_L16 && samplesRead > 0) {
+        float cps = (float)cycles / (float)samplesRead;
+        codecCyclesPerSample = (codecCyclesPerSample == 0.0f) ? cps : (codecCyclesPerSample * 0.9f + cps * 0.1f);
+    } else if (codec == CODEC_L16) {
+        codecCyclesPerSample = 0.0f;
+    }
+    histDspBlock.recordCycles(ESP.getCycleCount() - processStart);
+    return true;
+}
 
-    if (result == ESP_OK && bytesRead > 0) {
-        int samplesRead = bytesRead / sizeof(int32_t);
+// Gated block: a comfort-noise packet (RFC 3389, one noise-level byte) opens
+// the silence and refreshes it once a second; otherwise only the RTP clock moves
+static void sendComfortNoise(RtspSession &s, const AudioBlock* block) {
+    if (s.inSilence && millis() - s.lastComfortNoiseMs < ACTIVITY_CN_INTERVAL_MS) {
+        s.rtpTimestamp += block->count;
+        return;
+    }
+    comfortNoisePacket[AUDIO_BLOCK_HEADROOM] = activityDetector.noiseLevel();
+    comfortNoiseBlock.count = block->count;
+    comfortNoiseBlock.bytes = 1;
+    comfortNoiseBlock.payloadType = activityCnPayloadType();
+    comfortNoiseBlock.sampleIndex = block->sampleIndex;
+    sendRTPPacket(s, &comfortNoiseBlock, false);
+    s.inSilence = true;
+    s.lastComfortNoiseMs = millis();
+    comfortNoisePackets++;
+}
+
+// Live block to one session, in stream order: blocks it already got from the
+// pre-roll are skipped, a jump (ring overrun) advances the RTP clock
+static void deliverLiveBlock(RtspSession &s, AudioBlock* block) {
+    if (!s.synced) { s.nextSampleIndex = block->sampleIndex; s.synced = true; }
+    int32_t ahead = (int32_t)(block->sampleIndex - s.nextSampleIndex);
+    if (ahead < 0) return;
+    if (ahead > 0) { s.rtpTimestamp += (uint32_t)ahead; s.drops++; }
+    if (block->gated) {
+        sendComfortNoise(s, block);
+    } else {
+        // First packet after a silence starts a talkspurt (marker bit, RFC 3551 4.1)
+        sendRTPPacket(s, block, s.inSilence);
+        s.inSilence = false;
+    }
+    s.nextSampleIndex = block->sampleIndex + block->count;
+}
 
-        // If HPF params changed dynamically, recompute
-        if (highpassEnabled && (hpfConfigSampleRate != currentSampleRate || hpfConfigCutoff != highpassCutoffHz)) {
-            updateHighpassCoeffs();
+// Burst pre-roll packets to a replaying session; hands over to the live ring
+// once it reaches the pre-roll head
+static void serviceReplay(RtspSession &s) {
+    const int perPacket = audioRing.blockSamples();
+    const AudioCodecId codec = currentCodec;
+    for (int burst = 0; burst < PREROLL_BURST_PACKETS && s.playing; ++burst) {
+        int32_t pending = (int32_t)(preroll.head() - s.nextSampleIndex);
+        if (pending <= 0 || !prerollReplayBlock.packet) {
+            s.replaying = false;
+            logPrintf("Pre-roll replay done for " IP_FMT ", live", IP_ARGS(s.remoteIP));
+            return;
+        }
+        int n = (pending < perPacket) ? (int)pending : perPacket;
+        int16_t* pcm = prerollReplayBlock.samples;
+        if (!preroll.read(s.nextSampleIndex, pcm, n)) {
+            // Lapped by the producer: continue from the oldest sample still held
+            uint32_t oldest = preroll.oldest();
+            s.rtpTimestamp += oldest - s.nextSampleIndex;
+            s.nextSampleIndex = oldest;
+            s.drops++;
+            continue;
         }
+        size_t bytes;
+        if (codec == CODEC_PCMU) {
+            bytes = codec_encodePCMU(pcm, (uint8_t*)pcm, n);
+        } else if (codec == CODEC_DVI4) {
+            bytes = codec_encodeDVI4(pcm, (uint8_t*)pcm, n, s.replayAdpcm);
+        } else {
+            for (int i = 0; i < n; ++i) {
+                uint16_t u = (uint16_t)pcm[i];
+                pcm[i] = (int16_t)(uint16_t)((u << 8) | (u >> 8));
+            }
+            bytes = (size_t)n * sizeof(int16_t);
+        }
+        prerollReplayBlock.count = (uint16_t)n;
+        prerollReplayBlock.bytes = (uint16_t)bytes;
+        prerollReplayBlock.payloadType = codec_payloadType(codec, currentSampleRate);
+        prerollReplayBlock.sampleIndex = s.nextSampleIndex;
+        sendRTPPacket(s, &prerollReplayBlock, false);
+        s.nextSampleIndex += (uint32_t)n;
+        prerollReplayedPackets++;
+    }
+}
 
-        bool clipped = false;
-        float peakAbs = 0.0f;
-        for (int i = 0; i < samplesRead; i++) {
-            float sample = (float)(i2s_32bit_buffer[i] >> i2sShiftBits);
-            if (highpassEnabled) sample = hpf.process(sample);
-            float amplified = sample * currentGainFactor;
-            float aabs = fabsf(amplified);
-            if (aabs > peakAbs) peakAbs = aabs;
-            if (aabs > 32767.0f) clipped = true;
-            if (amplified > 32767.0f) amplified = 32767.0f;
-            if (amplified < -32768.0f) amplified = -32768.0f;
-            i2s_16bit_buffer[i] = (int16_t)amplified;
+// Audio streaming: fan every queued ring block out to all playing sessions
+void streamAudio() {
+    if (!isStreaming || audioPipelinePaused) return;
+
+    xSemaphoreTake(netAudioMutex, portMAX_DELAY);
+    AudioBlock* block;
+    while (isStreaming && (block = audioRing.acquireRead()) != nullptr) {
+        const uint32_t fanoutStart = ESP.getCycleCount();
+        bool delivered = false;
+        for (int i = 0; i < RTSP_MAX_SESSIONS; ++i) {
+            RtspSession &s = rtspSessions[i];
+            if (s.active && s.playing && !s.replaying) {
+                deliverLiveBlock(s, block);
+                delivered = true;
+            }
         }
-        // Update metering after processing the block
-        if (peakAbs > 32767.0f) peakAbs = 32767.0f;
-        lastPeakAbs16 = (uint16_t)peakAbs;
-        audioClippedLastBlock = clipped;
-        if (clipped) audioClipCount++;
-
-        // Update peak hold for a short window (~3 s) to match UI polling cadence
-        if (lastPeakAbs16 > peakHoldAbs16) {
-            peakHoldAbs16 = lastPeakAbs16;
-            peakHoldUntilMs = millis() + 3000UL;
-        } else if (peakHoldAbs16 > 0 && millis() > peakHoldUntilMs) {
-            peakHoldAbs16 = 0;
+        audioRing.releaseRead();
+        if (delivered) {
+            audioPacketsSent++;   // per block, independent of client count
+            if (bootFirstPacketMs == 0) bootFirstPacketMs = millis();
+            audioPacketsSentTotal++;
+            histStreamFanout.recordCycles(ESP.getCycleCount() - fanoutStart);
         }
+        lastAudioBlockMs = millis();
+    }
+    for (int i = 0; i < RTSP_MAX_SESSIONS; ++i) {
+        RtspSession &s = rtspSessions[i];
+        if (s.active && s.playing && s.replaying) serviceReplay(s);
+    }
+    xSemaphoreGive(netAudioMutex);
 
-        sendRTPPacket(client, i2s_16bit_buffer, samplesRead);
+    // Starved for more than two block periods while streaming = underrun
+    unsigned long blockMs = ((unsigned long)currentBufferSize * 1000UL) / currentSampleRate;
+    if (isStreaming && (millis() - lastAudioBlockMs) > (2 * blockMs + 10)) {
+        audioRingUnderruns++;
+        lastAudioBlockMs = millis();
     }
-#endif
 }
 
-// RTSP handling
-void handleRTSPCommand(WiFiClient &client, String request) {
-    String cseq = "1";
-    int cseqPos = request.indexOf("CSeq: ");
-    if (cseqPos >= 0) {
-        cseq = request.substring(cseqPos + 6, request.indexOf("\r", cseqPos));
-        cseq.trim();
+// Remember where a client stopped so its reconnect can be filled from the pre-roll
+static void prerollRememberSession(const RtspSession &s) {
+    if (!preroll.active() || !s.synced) return;
+    int slot = -1;
+    for (int i = 0; i < PREROLL_RESUME_SLOTS; ++i) {
+        if (prerollResume[i].valid && prerollResume[i].ip == s.remoteIP) { slot = i; break; }
     }
+    if (slot < 0) { slot = prerollResumeNext; prerollResumeNext = (prerollResumeNext + 1) % PREROLL_RESUME_SLOTS; }
+    prerollResume[slot].ip = s.remoteIP;
+    prerollResume[slot].nextSampleIndex = s.nextSampleIndex;
+    prerollResume[slot].valid = true;
+}
 
-    lastRTSPActivity = millis();
+// Replay start for PLAY: explicit "preroll=<s>" in the URL, else the gap since
+// this client's previous session; false = start live
+static bool prerollReplayStart(const RtspSession &s, uint32_t &start) {
+    if (!preroll.active() || preroll.filled() == 0) return false;
+    const uint32_t head = preroll.head();
+    const uint32_t held = preroll.filled();
+    if (s.prerollRequestSec > 0) {
+        uint32_t want = (uint32_t)s.prerollRequestSec * currentSampleRate;
+        if (want > held) want = held;
+        start = head - want;
+        return true;
+    }
+    for (int i = 0; i < PREROLL_RESUME_SLOTS; ++i) {
+        if (!prerollResume[i].valid || !(prerollResume[i].ip == s.remoteIP)) continue;
+        prerollResume[i].valid = false;
+        uint32_t gap = head - prerollResume[i].nextSampleIndex;
+        if ((int32_t)gap <= 0) return false;
+        if (gap > held) gap = held;
+        start = head - gap;
+        return true;
+    }
+    return false;
+}
 
-    if (request.startsWith("OPTIONS")) {
-        client.print("RTSP/1.0 200 OK\r\n");
-        client.print("CSeq: " + cseq + "\r\n");
-        client.print("Public: OPTIONS, DESCRIBE, SETUP, PLAY, TEARDOWN, GET_PARAMETER\r\n\r\n");
+// Drop blocks queued before PLAY so a new stream starts with fresh audio
+void flushAudioRing() {
+    xSemaphoreTake(netAudioMutex, portMAX_DELAY);
+    audioRing.drain();
+    lastAudioBlockMs = millis();
+    xSemaphoreGive(netAudioMutex);
+}
 
-    } else if (request.startsWith("DESCRIBE")) {
-        String ip = WiFi.localIP().toString();
-        String sdp = "v=0\r\n";
-        sdp += "o=- 0 0 IN IP4 " + ip + "\r\n";
-        sdp += "s=ESP32 RTSP Mic (" + String(currentSampleRate) + "Hz, 16-bit PCM)\r\n";
+// Parse "client_port=a-b" from a Transport header; false when absent
+static bool parseClientPorts(const RtspField &transport, uint16_t &rtpPort, uint16_t &rtcpPort) {
+    uint32_t a = transport.numberAfter("client_port=", 0);
+    if (a == 0 || a > 65535) return false;
+    char key[20];
+    snprintf(key, sizeof(key), "client_port=%u-", (unsigned)a);
+    uint32_t b = transport.numberAfter(key, a + 1);
+    if (b == 0 || b > 65535) return false;
+    rtpPort = (uint16_t)a;
+    rtcpPort = (uint16_t)b;
+    return true;
+}
+
+// Replies are composed here and sent with one write (network task only)
+static char rtspReply[1024];
+static char rtspSdp[512];
+
+static void rtspSendReply(RtspSession &session, const RtspWriter &w) {
+    if (w.overflow()) {
+        simplePrintln("RTSP reply too long - dropped");
+        return;
+    }
+    session.client.write((const uint8_t*)w.data(), w.length());
+}
+
+// RTSP handling: one parsed request (fields point into the parse buffer)
+void handleRTSPCommand(RtspSession &session, const RtspRequestParser &req) {
+    RtspWriter w(rtspReply, sizeof(rtspReply));
+
+    session.lastActivityMs = millis();
+
+    // Pre-roll start offset may arrive on any request URL (DESCRIBE usually)
+    if (req.uri.contains("preroll=")) session.prerollRequestSec = (uint16_t)req.uri.numberAfter("preroll=", 0);
+
+    switch (req.method) {
+    case RTSP_OPTIONS:
+        w.status(200, "OK", req.cseq);
+        w.printf("Public: OPTIONS, DESCRIBE, SETUP, PLAY, TEARDOWN, GET_PARAMETER\r\n\r\n");
+        break;
+
+    case RTSP_DESCRIBE: {
+        const IPAddress ip = WiFi.localIP();
+        const AudioCodecId codec = currentCodec;
+        const uint8_t pt = codec_payloadType(codec, currentSampleRate);
+        const bool cn = activityGateEnabled;
+        RtspWriter sdp(rtspSdp, sizeof(rtspSdp));
+        sdp.printf("v=0\r\no=- 0 0 IN IP4 " IP_FMT "\r\n", IP_ARGS(ip));
+        sdp.printf("s=ESP32 RTSP Mic (%uHz, %s)\r\n", (unsigned)currentSampleRate, codec_rtpEncoding(codec));
         // better compatibility: include actual IP
-        sdp += "c=IN IP4 " + ip + "\r\n";
-        sdp += "t=0 0\r\n";
-        sdp += "m=audio 0 RTP/AVP 96\r\n";
-        sdp += "a=rtpmap:96 L16/" + String(currentSampleRate) + "/1\r\n";
-        sdp += "a=control:track1\r\n";
-
-        client.print("RTSP/1.0 200 OK\r\n");
-        client.print("CSeq: " + cseq + "\r\n");
-        client.print("Content-Type: application/sdp\r\n");
-        client.print("Content-Base: rtsp://" + ip + ":8554/audio/\r\n");
-        client.print("Content-Length: " + String(sdp.length()) + "\r\n\r\n");
-        client.print(sdp);
-
-    } else if (request.startsWith("SETUP")) {
-        rtspSessionId = String(random(100000000, 999999999));
-        client.print("RTSP/1.0 200 OK\r\n");
-        client.print("CSeq: " + cseq + "\r\n");
-        client.print("Session: " + rtspSessionId + "\r\n");
-        client.print("Transport: RTP/AVP/TCP;unicast;interleaved=0-1\r\n\r\n");
-
-    } else if (request.startsWith("PLAY")) {
-        client.print("RTSP/1.0 200 OK\r\n");
-        client.print("CSeq: " + cseq + "\r\n");
-        client.print("Session: " + rtspSessionId + "\r\n");
-        client.print("Range: npt=0.000-\r\n\r\n");
+        sdp.printf("c=IN IP4 " IP_FMT "\r\nt=0 0\r\n", IP_ARGS(ip));
+        if (cn) sdp.printf("m=audio 0 RTP/AVP %u %u\r\n", (unsigned)pt, (unsigned)activityCnPayloadType());
+        else sdp.printf("m=audio 0 RTP/AVP %u\r\n", (unsigned)pt);
+        sdp.printf("a=rtpmap:%u %s/%u/%u\r\n", (unsigned)pt, codec_rtpEncoding(codec), (unsigned)currentSampleRate, (unsigned)streamChannels());
+        if (cn) sdp.printf("a=rtpmap:%u CN/%u\r\n", (unsigned)activityCnPayloadType(), (unsigned)currentSampleRate);
+        sdp.printf("a=ptime:%u\r\n", (unsigned)((rtpPacketSamples() * 1000UL + currentSampleRate / 2) / currentSampleRate));
+        sdp.printf("a=control:track1\r\n");
+
+        w.status(200, "OK", req.cseq);
+        w.printf("Content-Type: application/sdp\r\n");
+        w.printf("Content-Base: rtsp://" IP_FMT ":8554/audio/\r\n", IP_ARGS(ip));
+        w.printf("Content-Length: %u\r\n\r\n%s", (unsigned)sdp.length(), sdp.data());
+        break;
+    }
 
+    case RTSP_SETUP: {
+        if (session.sessionId[0] == 0) snprintf(session.sessionId, sizeof(session.sessionId), "%ld", random(100000000, 999999999));
+        // UDP when the client offers client_port= without asking for TCP/interleaved
+        uint16_t cliRtp = 0, cliRtcp = 0;
+        bool wantsTcp = req.transport.contains("TCP") || req.transport.contains("interleaved");
+        bool useUdp = !wantsTcp && parseClientPorts(req.transport, cliRtp, cliRtcp);
+        if (useUdp && !rtpUdpSocketsOpen) {
+            rtpUdpSocketsOpen = rtpUdp.begin(RTP_UDP_SERVER_PORT) && rtcpUdp.begin(RTP_UDP_SERVER_PORT + 1);
+            if (!rtpUdpSocketsOpen) simplePrintln("RTP/UDP socket bind failed - using TCP");
+        }
+        useUdp = useUdp && rtpUdpSocketsOpen;
+        session.overUdp = useUdp;
+
+        w.status(200, "OK", req.cseq);
+        w.printf("Session: %s\r\n", session.sessionId);
+        if (useUdp) {
+            session.udpRtpPort = cliRtp;
+            session.udpRtcpPort = cliRtcp;
+            w.printf("Transport: RTP/AVP;unicast;client_port=%u-%u;server_port=%u-%u\r\n\r\n",
+                     (unsigned)cliRtp, (unsigned)cliRtcp, (unsigned)RTP_UDP_SERVER_PORT, (unsigned)(RTP_UDP_SERVER_PORT + 1));
+            logPrintf("RTP over UDP to " IP_FMT ":%u", IP_ARGS(session.remoteIP), (unsigned)cliRtp);
+        } else {
+            w.printf("Transport: RTP/AVP/TCP;unicast;interleaved=0-1\r\n\r\n");
+        }
+        break;
+    }
+
+    case RTSP_PLAY: {
+        if (melMode == MEL_MODE_ONLY) {
+            w.status(503, "Service Unavailable", req.cseq);
+            w.printf("\r\n");
+            rtspSendReply(session, w);
+            logPrintf("RTSP PLAY refused for " IP_FMT " - mel frames only", IP_ARGS(session.remoteIP));
+            return;
+        }
+        if (powerIdle) {
+            w.status(503, "Service Unavailable", req.cseq);
+            w.printf("Retry-After: %u\r\n\r\n", (unsigned)(powerNextChangeS ? powerNextChangeS : 60));
+            rtspSendReply(session, w);
+            logPrintf("RTSP PLAY refused for " IP_FMT " - outside capture windows", IP_ARGS(session.remoteIP));
+            return;
+        }
+        if (!session.overUdp && !tcpQueueBegin(session)) {
+            w.status(453, "Not Enough Bandwidth", req.cseq);
+            w.printf("\r\n");
+            rtspSendReply(session, w);
+            logPrintf("RTSP PLAY refused for " IP_FMT " - no memory for the send queue", IP_ARGS(session.remoteIP));
+            return;
+        }
+        w.status(200, "OK", req.cseq);
+        w.printf("Session: %s\r\nRange: npt=0.000-\r\n\r\n", session.sessionId);
+        rtspSendReply(session, w);   // before the first RTP packet
+
+        // First playing session starts the shared stream; later ones join it
+        if (!isStreaming) {
+            flushAudioRing();
+            captureStateResetRequested = true;
+            audioPacketsSent = 0;
+            lastStatsReset = millis();
+        }
+        session.rtpSequence = 0;
+        session.rtpTimestamp = 0;
+        session.packets = 0;
+        session.octets = 0;
+        session.bytesSent = 0;
+        session.drops = 0;
+        session.queueDrops = 0;
+        session.inSilence = false;
+        session.lastSenderReportMs = 0;
+        session.playStartedMs = millis();
+        session.replayAdpcm.reset();
+        uint32_t replayFrom = 0;
+        session.replaying = prerollReplayStart(session, replayFrom);
+        session.synced = session.replaying;
+        session.nextSampleIndex = replayFrom;
+        if (session.replaying) {
+            logPrintf("Pre-roll replay to " IP_FMT ": %u s", IP_ARGS(session.remoteIP),
+                      (unsigned)((preroll.head() - replayFrom) / currentSampleRate));
+        }
+        session.playing = true;
+        rtspStopStreamsRequested = false;
         isStreaming = true;
-        rtpSequence = 0;
-        rtpTimestamp = 0;
-        audioPacketsSent = 0;
-        lastStatsReset = millis();
         lastRtspPlayMs = millis();
         rtspPlayCount++;
-        simplePrintln("STREAMING STARTED");
-
-    } else if (request.startsWith("TEARDOWN")) {
-        client.print("RTSP/1.0 200 OK\r\n");
-        client.print("CSeq: " + cseq + "\r\n");
-        client.print("Session: " + rtspSessionId + "\r\n\r\n");
-        isStreaming = false;
-        simplePrintln("STREAMING STOPPED");
-    } else if (request.startsWith("GET_PARAMETER")) {
+        logPrintf("STREAMING STARTED to " IP_FMT, IP_ARGS(session.remoteIP));
+        return;   // replied above
+    }
+
+    case RTSP_TEARDOWN:
+        session.txQueue.end();   // unsent audio is stale now
+        w.status(200, "OK", req.cseq);
+        w.printf("Session: %s\r\n\r\n", session.sessionId);
+        if (session.playing) prerollRememberSession(session);
+        session.playing = false;
+        session.overUdp = false;
+        logPrintf("STREAMING STOPPED to " IP_FMT, IP_ARGS(session.remoteIP));
+        break;
+
+    case RTSP_GET_PARAMETER:
         // Many RTSP clients send GET_PARAMETER as keep-alive.
-        client.print("RTSP/1.0 200 OK\r\n");
-        client.print("CSeq: " + cseq + "\r\n\r\n");
+        w.status(200, "OK", req.cseq);
+        w.printf("\r\n");
+        break;
+
+    default:
+        w.status(501, "Not Implemented", req.cseq);
+        w.printf("\r\n");
+        break;
     }
+    rtspSendReply(session, w);
 }
 
-// RTSP processing
-void processRTSP(WiFiClient &client) {
+// RTSP processing: append what arrived, then handle every complete request
+// (pipelined requests in one read included); partial ones wait in the buffer.
+// Requests held back by a partly sent packet are handled on a later call,
+// with or without new bytes.
+void processRTSP(RtspSession &session) {
+    WiFiClient &client = session.client;
     if (!client.connected()) return;
 
-    if (client.available()) {
-        int available = client.available();
+    int available = client.available();
+    if (available <= 0 && !session.parseHeld) return;
+    if (available > 0) {
+        int room = (int)sizeof(session.parseBuffer) - session.parseBufferPos;
+        if (available > room) available = room;
+        if (available <= 0) {
+            simplePrintln("RTSP buffer overflow - resetting");
+            session.parseBufferPos = 0;
+            session.parseHeld = false;
+            session.parser.reset();
+            return;
+        }
+        int got = client.read(session.parseBuffer + session.parseBufferPos, available);
+        if (got > 0) session.parseBufferPos += got;
+        else if (!session.parseHeld) return;
+    }
+    session.parseHeld = false;
+
+    const char* buf = (const char*)session.parseBuffer;
+    int used = 0;
+    for (;;) {
+        RtspRequestParser::Result r = session.parser.parse(buf + used, (size_t)(session.parseBufferPos - used));
+        if (r == RtspRequestParser::NEED_MORE) break;
+        if (r == RtspRequestParser::BAD) {
+            simplePrintln("RTSP malformed request - resetting");
+            used = session.parseBufferPos;
+            session.parser.reset();
+            break;
+        }
+        if (r == RtspRequestParser::REQUEST) handleRTSPCommand(session, session.parser);
+        used += (int)session.parser.consumed();   // interleaved frames (RTCP RR) are skipped
+        if (!session.active) break;
+        if (session.txQueue.midPacket()) {   // replies wait for the RTP framing
+            session.parseHeld = used < session.parseBufferPos;
+            break;
+        }
+    }
+    if (used > 0) {
+        memmove(session.parseBuffer, session.parseBuffer + used, (size_t)(session.parseBufferPos - used));
+        session.parseBufferPos -= used;
+    }
+}
+
+// Audio pipeline tasks
+// Capture task: drains I2S into the PCM block ring at high priority, so slow
+// HTTP/OTA work in loop() can no longer stall DMA
+void audioCaptureTask(void* arg) {
+    for (;;) {
+        if (audioPipelinePaused) { vTaskDelay(pdMS_TO_TICKS(2)); continue; }
+        if (powerIdle) { vTaskDelay(pdMS_TO_TICKS(100)); continue; }   // I2S stopped
+        xSemaphoreTake(captureMutex, portMAX_DELAY);
+        bool ok = captureAudioBlock();
+        xSemaphoreGive(captureMutex);
+        if (ok && bootCaptureMs == 0) bootCaptureMs = millis();
+        if (!ok) vTaskDelay(1);
+    }
+}
+
+// Close one session and free its slot
+static void rtspCloseSession(RtspSession &session, const char* reason) {
+    if (session.playing) prerollRememberSession(session);
+    if (session.client) session.client.stop();
+    session.txQueue.end();
+    session.active = false;
+    session.playing = false;
+    session.overUdp = false;
+    session.sessionId[0] = 0;
+    session.parseBufferPos = 0;
+    session.parseHeld = false;
+    session.parser.reset();
+    session.prerollRequestSec = 0;
+    logPrintf("RTSP client " IP_FMT " %s", IP_ARGS(session.remoteIP), reason);
+}
+
+// Accept pending connections into free slots; refuse when the table is full
+static void rtspAcceptClients() {
+    WiFiClient newClient = rtspServer.available();
+    while (newClient) {
+        RtspSession* slot = nullptr;
+        for (int i = 0; i < RTSP_MAX_SESSIONS; ++i) {
+            if (!rtspSessions[i].active) { slot = &rtspSessions[i]; break; }
+        }
+        if (!slot) {
+            newClient.print("RTSP/1.0 503 Service Unavailable\r\nCSeq: 0\r\n\r\n");
+            newClient.stop();
+            rtspRejectedCount++;
+            logPrintf("RTSP client refused - all %d sessions in use", RTSP_MAX_SESSIONS);
+        } else {
+            slot->client = newClient;
+            slot->client.setNoDelay(true);
+            slot->remoteIP = slot->client.remoteIP();
+            slot->active = true;
+            slot->playing = false;
+            slot->overUdp = false;
+            slot->sessionId[0] = 0;
+            slot->parseBufferPos = 0;
+            slot->parseHeld = false;
+            slot->parser.reset();
+            slot->lastActivityMs = millis();
+            slot->connectedAtMs = millis();
+            lastRtspClientConnectMs = millis();
+            rtspConnectCount++;
+            logPrintf("New RTSP client connected from: " IP_FMT, IP_ARGS(slot->remoteIP));
+        }
+        newClient = rtspServer.available();
+    }
+}
+
+// Network task: owns the RTSP server and session sockets and consumes the ring
+void rtspNetTask(void* arg) {
+    bool serverRunning = false;
+    for (;;) {
+        // Apply server ON/OFF requested from Web UI or thermal protection
+        if (rtspServerEnabled && !serverRunning) {
+            rtspServer.begin();
+            rtspServer.setNoDelay(true);
+            serverRunning = true;
+        } else if (!rtspServerEnabled && serverRunning) {
+            for (int i = 0; i < RTSP_MAX_SESSIONS; ++i) {
+                if (rtspSessions[i].active) rtspCloseSession(rtspSessions[i], "closed (server stopped)");
+            }
+            isStreaming = false;
+            rtspServer.stop();
+            serverRunning = false;
+        }
 
-        if (rtspParseBufferPos + available >= (int)sizeof(rtspParseBuffer)) {
-            available = sizeof(rtspParseBuffer) - rtspParseBufferPos - 1;
-            if (available <= 0) {
-                simplePrintln("RTSP buffer overflow - resetting");
-                rtspParseBufferPos = 0;
-                return;
+        // Stop audio on every session (I2S restart, defaults, Web UI)
+        if (rtspStopStreamsRequested) {
+            rtspStopStreamsRequested = false;
+            for (int i = 0; i < RTSP_MAX_SESSIONS; ++i) {
+                rtspSessions[i].playing = false;
+                rtspSessions[i].replaying = false;
+                rtspSessions[i].txQueue.dropUnstarted();
             }
         }
 
-        client.read(rtspParseBuffer + rtspParseBufferPos, available);
-        rtspParseBufferPos += available;
+        if (serverRunning) {
+            for (int i = 0; i < RTSP_MAX_SESSIONS; ++i) {
+                RtspSession &s = rtspSessions[i];
+                if (!s.active) continue;
+                if (!s.client.connected()) {
+                    rtspCloseSession(s, "disconnected");
+                } else if (!s.playing && millis() - s.lastActivityMs > 30000) {
+                    // Timeout for RTSP clients (30 seconds of inactivity)
+                    rtspCloseSession(s, "timeout - disconnected");
+                }
+            }
 
-        char* endOfHeader = strstr((char*)rtspParseBuffer, "\r\n\r\n");
-        if (endOfHeader != nullptr) {
-            *endOfHeader = '\0';
-            String request = String((char*)rtspParseBuffer);
+            rtspAcceptClients();
+
+            for (int i = 0; i < RTSP_MAX_SESSIONS; ++i) {
+                RtspSession &s = rtspSessions[i];
+                if (!s.active) continue;
+                if (s.client.available()) {
+                    s.lastActivityMs = millis();
+                }
+                // Finish a partly written packet before any RTSP reply
+                if (!s.txQueue.empty() && !tcpFlushQueue(s)) {
+                    rtspCloseSession(s, "disconnected (send failed)");
+                    continue;
+                }
+                if (!s.txQueue.midPacket()) processRTSP(s);
+            }
 
-            handleRTSPCommand(client, request);
+            uint8_t activeCount = 0;
+            bool anyPlaying = false;
+            for (int i = 0; i < RTSP_MAX_SESSIONS; ++i) {
+                if (!rtspSessions[i].active) continue;
+                activeCount++;
+                if (rtspSessions[i].playing) anyPlaying = true;
+            }
+            rtspActiveSessions = activeCount;
+            isStreaming = anyPlaying && !rtspStopStreamsRequested;
 
-            int headerLen = (endOfHeader - (char*)rtspParseBuffer) + 4;
-            memmove(rtspParseBuffer, rtspParseBuffer + headerLen, rtspParseBufferPos - headerLen);
-            rtspParseBufferPos -= headerLen;
+            if (isStreaming) {
+                streamAudio();
+            }
+            serviceRtcp();
+        } else {
+            rtspActiveSessions = 0;
         }
+
+        if (isStreaming) {
+            // Wake as soon as the capture task commits a block (bounded so
+            // RTSP keep-alives are still answered promptly)
+            ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(20));
+        } else {
+            vTaskDelay(pdMS_TO_TICKS(5));
+        }
+    }
+}
+
+// Create synchronization objects and start capture + network tasks
+// Capture runs from before Wi-Fi is up, so the pre-roll already holds the
+// startup audio; the network task follows once the station is connected
+void startAudioCapture() {
+    captureMutex = xSemaphoreCreateMutex();
+    netAudioMutex = xSemaphoreCreateMutex();
+    xTaskCreatePinnedToCore(audioCaptureTask, "audio_cap", AUDIO_CAPTURE_STACK, nullptr,
+                            AUDIO_CAPTURE_TASK_PRIO, &audioCaptureTaskHandle, AUDIO_CAPTURE_CORE);
+}
+
+void startAudioNetwork() {
+    xTaskCreatePinnedToCore(rtspNetTask, "rtsp_net", AUDIO_NET_STACK, nullptr,
+                            AUDIO_NET_TASK_PRIO, &rtspNetTaskHandle, AUDIO_NET_CORE);
+    bootRtspReadyMs = millis();
+    logPrintf("Audio tasks: capture core %d prio %d, network core %d prio %d, ring %ux%u",
+              (int)AUDIO_CAPTURE_CORE, (int)AUDIO_CAPTURE_TASK_PRIO, (int)AUDIO_NET_CORE, (int)AUDIO_NET_TASK_PRIO,
+              (unsigned)audioRing.capacity(), (unsigned)audioRing.blockSamples());
+}
+
+// Join the AP of the previous boot directly: the known BSSID and channel skip
+// the scan, the cached lease (optional) skips DHCP. False to fall back to WiFiManager.
+static bool wifiFastConnect() {
+    if (wifiCachedChannel == 0) return false;
+    WiFi.mode(WIFI_STA);
+    // Credentials WiFiManager stored in the driver's NVS (WiFi.SSID()/psk()
+    // only report the AP once connected)
+    wifi_config_t conf;
+    if (esp_wifi_get_config(WIFI_IF_STA, &conf) != ESP_OK || conf.sta.ssid[0] == 0) return false;
+    char ssid[sizeof(conf.sta.ssid) + 1], pass[sizeof(conf.sta.password) + 1];
+    memcpy(ssid, conf.sta.ssid, sizeof(conf.sta.ssid));
+    ssid[sizeof(conf.sta.ssid)] = 0;
+    memcpy(pass, conf.sta.password, sizeof(conf.sta.password));
+    pass[sizeof(conf.sta.password)] = 0;
+    const bool useLease = wifiStaticFromLease && wifiCachedLease[0] != 0;
+    if (useLease) {
+        WiFi.config(IPAddress(wifiCachedLease[0]), IPAddress(wifiCachedLease[1]),
+                    IPAddress(wifiCachedLease[2]), IPAddress(wifiCachedLease[3]));
     }
+    WiFi.begin(ssid, pass[0] ? pass : nullptr, wifiCachedChannel, wifiCachedBssid, true);
+    const unsigned long start = millis();
+    while (WiFi.status() != WL_CONNECTED && millis() - start < WIFI_FAST_CONNECT_TIMEOUT_MS) delay(20);
+    if (WiFi.status() == WL_CONNECTED) return true;
+    simplePrintln("WiFi fast reconnect failed (AP moved or channel changed) - scanning");
+    WiFi.disconnect();
+    if (useLease) WiFi.config(INADDR_NONE, INADDR_NONE, INADDR_NONE);   // back to DHCP
+    return false;
+}
+
+// Cache the AP and lease for the next boot; NVS is written only when they change
+static void wifiRememberNetwork() {
+    const uint8_t* bssid = WiFi.BSSID();
+    if (!bssid) return;
+    const uint8_t channel = (uint8_t)WiFi.channel();
+    const uint32_t lease[4] = { (uint32_t)WiFi.localIP(), (uint32_t)WiFi.gatewayIP(),
+                                (uint32_t)WiFi.subnetMask(), (uint32_t)WiFi.dnsIP(0) };
+    if (channel == wifiCachedChannel && memcmp(bssid, wifiCachedBssid, sizeof(wifiCachedBssid)) == 0
+        && memcmp(lease, wifiCachedLease, sizeof(lease)) == 0) return;
+    memcpy(wifiCachedBssid, bssid, sizeof(wifiCachedBssid));
+    memcpy(wifiCachedLease, lease, sizeof(lease));
+    wifiCachedChannel = channel;
+    audioPrefs.begin("audio", false);
+    audioPrefs.putBytes("wfBssid", wifiCachedBssid, sizeof(wifiCachedBssid));
+    audioPrefs.putBytes("wfLease", wifiCachedLease, sizeof(wifiCachedLease));
+    audioPrefs.putUChar("wfChan", wifiCachedChannel);
+    audioPrefs.end();
+    logPrintf("WiFi: cached AP %02X:%02X:%02X:%02X:%02X:%02X on channel %u for fast reconnect",
+              bssid[0], bssid[1], bssid[2], bssid[3], bssid[4], bssid[5], (unsigned)channel);
 }
 
 
@@ -1011,58 +3304,59 @@ void setup() {
 
     // Load settings from flash
     loadAudioSettings();
+    abrBuildLadder();
+    activityConfigure();
+    recordConfigure();
 
     // Allocate buffers with current size
-#if defined(MIC_TYPE_PDM)
-    // PDM mode: only 16-bit buffer needed
-    i2s_16bit_buffer = (int16_t*)malloc(currentBufferSize * sizeof(int16_t));
-    if (!i2s_16bit_buffer) {
+    if (!allocateAudioBuffers()) {
         simplePrintln("FATAL: Memory allocation failed!");
         ESP.restart();
     }
-#else
-    // Standard I2S: both 32-bit and 16-bit buffers
-    i2s_32bit_buffer = (int32_t*)malloc(currentBufferSize * sizeof(int32_t));
-    i2s_16bit_buffer = (int16_t*)malloc(currentBufferSize * sizeof(int16_t));
-    if (!i2s_32bit_buffer || !i2s_16bit_buffer) {
-        simplePrintln("FATAL: Memory allocation failed!");
-        ESP.restart();
-    }
-#endif
+
+    setCpuFrequencyMhz(cpuFrequencyMhz);
+    LatencyHistogram::setCpuMhz(getCpuFrequencyMhz());
+    logPrintf("CPU frequency set to %u MHz for optimal thermal/performance balance", (unsigned)cpuFrequencyMhz);
+
+    // Capture starts before Wi-Fi, so a reboot loses no more audio than it must
+    setup_i2s_driver();
+    updateHighpassCoeffs();
+    audioFadeReset();
+    startAudioCapture();
 
     // WiFi optimization for stable streaming
     WiFi.setSleep(false);
 
-    WiFiManager wm;
-    wm.setConnectTimeout(60);
-    wm.setConfigPortalTimeout(180);
-    if (!wm.autoConnect("ESP32-RTSP-Mic-AP")) {
-        simplePrintln("WiFi failed, restarting...");
-        ESP.restart();
+    wifiFastConnected = wifiFastConnect();
+    if (!wifiFastConnected) {
+        WiFiManager wm;
+        wm.setConnectTimeout(60);
+        wm.setConfigPortalTimeout(180);
+        if (!wm.autoConnect("ESP32-RTSP-Mic-AP")) {
+            simplePrintln("WiFi failed, restarting...");
+            ESP.restart();
+        }
     }
+    bootWifiMs = millis();
 
-    simplePrintln("WiFi connected: " + WiFi.localIP().toString());
+    logPrintf("WiFi connected: " IP_FMT " after %u ms%s", IP_ARGS(WiFi.localIP()), (unsigned)bootWifiMs,
+              wifiFastConnected ? " (fast reconnect)" : "");
+    wifiRememberNetwork();
+    // Wall clock for the power schedule and the RTCP sender reports; streaming does not wait for it
+    sntp_set_time_sync_notification_cb(onNtpTimeSync);
+    configTzTime(powerTimezone, "pool.ntp.org", "time.google.com");
 
     // Apply configured WiFi TX power after connect (logs once on change)
     applyWifiTxPower(true);
 
     setupOTA();
-    setup_i2s_driver();
-    updateHighpassCoeffs();
 
-    if (!overheatLatched) {
-        rtspServer.begin();
-        rtspServer.setNoDelay(true);
-        rtspServerEnabled = true;
-    } else {
-        rtspServerEnabled = false;
-        rtspServer.stop();
-    }
+    // RTSP server socket is opened by the network task
+    rtspServerEnabled = !overheatLatched;
     // Web UI
     webui_begin();
 
     lastStatsReset = millis();
-    lastRTSPActivity = millis();
     lastMemoryCheck = millis();
     lastPerformanceCheck = millis();
     lastWiFiCheck = millis();
@@ -1086,16 +3380,15 @@ void setup() {
         simplePrintln("WARNING: Temperature sensor unavailable at startup. Thermal protection paused.");
     }
 
-    setCpuFrequencyMhz(cpuFrequencyMhz);
-    simplePrintln("CPU frequency set to " + String(cpuFrequencyMhz) + " MHz for optimal thermal/performance balance");
-
     if (!overheatLatched) {
         simplePrintln("RTSP server ready on port 8554");
-        simplePrintln("RTSP URL: rtsp://" + WiFi.localIP().toString() + ":8554/audio");
+        logPrintf("RTSP URL: rtsp://" IP_FMT ":8554/audio", IP_ARGS(WiFi.localIP()));
     } else {
         simplePrintln("RTSP server paused due to thermal latch. Clear via Web UI before resuming streaming.");
     }
-    simplePrintln("Web UI: http://" + WiFi.localIP().toString() + "/");
+    logPrintf("Web UI: http://" IP_FMT "/", IP_ARGS(WiFi.localIP()));
+
+    startAudioNetwork();
 }
 
 void loop() {
@@ -1125,57 +3418,24 @@ void loop() {
     }
 
     checkScheduledReset();
+    serviceAdaptiveBitrate();
+    servicePowerSchedule();
+    serviceRecorder();
+    serviceSettingsCommit();
 
-    // RTSP client management
-    if (rtspServerEnabled) {
-        if (rtspClient && !rtspClient.connected()) {
-            rtspClient.stop();
-            isStreaming = false;
-            simplePrintln("RTSP client disconnected");
-        }
-
-        // Timeout for RTSP clients (30 seconds of inactivity)
-        if (rtspClient && rtspClient.connected() && !isStreaming) {
-            if (millis() - lastRTSPActivity > 30000) {
-                rtspClient.stop();
-                simplePrintln("RTSP client timeout - disconnected");
-            }
-        }
-
-        if (!rtspClient || !rtspClient.connected()) {
-            WiFiClient newClient = rtspServer.available();
-            if (newClient) {
-                rtspClient = newClient;
-                rtspClient.setNoDelay(true);
-                rtspParseBufferPos = 0;
-                lastRTSPActivity = millis();
-                lastRtspClientConnectMs = millis();
-                rtspConnectCount++;
-                simplePrintln("New RTSP client connected from: " + rtspClient.remoteIP().toString());
-            }
-        }
+    // RTSP client management and audio run in their own tasks (startAudioCapture / startAudioNetwork)
 
-        if (rtspClient && rtspClient.connected()) {
-            if (rtspClient.available()) {
-                lastRTSPActivity = millis();
-            }
-            processRTSP(rtspClient);
-            if (isStreaming) {
-                streamAudio(rtspClient);
-            }
-        }
-    } else {
-        if (rtspClient && rtspClient.connected()) {
-            rtspClient.stop();
-            isStreaming = false;
-        }
-    }
     // Handle deferred reboot/reset safely here
     if (scheduledRebootAt != 0 && millis() >= scheduledRebootAt) {
         if (scheduledFactoryReset) {
             resetToDefaultSettings();
+        } else {
+            flushAudioSettings();
         }
         delay(50);
         ESP.restart();
     }
+
+    // loop() is no longer on the audio path; give the idle task some time
+    delay(1);
 }
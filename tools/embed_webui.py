@@ -0,0 +1,55 @@
+#!/usr/bin/env python3
+# Web UI embedder (ESP32 RTSP Mic for BirdNET-Go)
+# Compresses esp32_rtsp_mic_birdnetgo/webui/index.html into WebUI_index.h
+# (gzip byte array in flash + ETag). Run after editing the page:
+#   python3 tools/embed_webui.py
+# PlatformIO runs it automatically as a pre: script; Arduino IDE builds use
+# the committed header.
+import gzip
+import hashlib
+import os
+
+try:
+    Import("env")  # noqa: F821 - PlatformIO/SCons
+    ROOT = env["PROJECT_DIR"]  # noqa: F821
+except NameError:
+    ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+
+SKETCH = os.path.join(ROOT, "esp32_rtsp_mic_birdnetgo")
+SRC = os.path.join(SKETCH, "webui", "index.html")
+DST = os.path.join(SKETCH, "WebUI_index.h")
+
+
+def render(html):
+    gz = gzip.compress(html, compresslevel=9, mtime=0)
+    etag = hashlib.sha1(html).hexdigest()[:16]
+    out = [
+        "// Generated by tools/embed_webui.py from webui/index.html - do not edit",
+        "#pragma once",
+        "#include <Arduino.h>",
+        "",
+        "// %d bytes of HTML, gzip %d bytes" % (len(html), len(gz)),
+        "#define WEBUI_INDEX_ETAG \"\\\"%s\\\"\"" % etag,
+        "static const size_t WEBUI_INDEX_GZ_LEN = %d;" % len(gz),
+        "static const uint8_t WEBUI_INDEX_GZ[] PROGMEM = {",
+    ]
+    for i in range(0, len(gz), 16):
+        out.append("    " + ",".join("0x%02x" % b for b in gz[i:i + 16]) + ",")
+    out.append("};")
+    return "\n".join(out) + "\n"
+
+
+def main():
+    with open(SRC, "rb") as f:
+        text = render(f.read())
+    old = None
+    if os.path.exists(DST):
+        with open(DST, "r") as f:
+            old = f.read()
+    if text != old:  # keep the timestamp (and the build cache) when unchanged
+        with open(DST, "w") as f:
+            f.write(text)
+        print("embed_webui: wrote " + DST)
+
+
+main()